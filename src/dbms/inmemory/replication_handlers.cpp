@@ -22,6 +22,7 @@
 #include "storage/v2/indices/label_index_stats.hpp"
 #include "storage/v2/inmemory/storage.hpp"
 #include "storage/v2/inmemory/unique_constraints.hpp"
+#include "utils/string.hpp"
 
 using memgraph::replication_coordination_glue::ReplicationRole;
 using memgraph::storage::Delta;
@@ -274,6 +275,8 @@ void InMemoryReplicationHandlers::SnapshotHandler(dbms::DbmsHandler *dbms_handle
   auto storage_guard = std::unique_lock{storage->main_lock_};
   spdlog::trace("Clearing database since recovering from snapshot.");
   // Clear the database
+  storage->vertex_directory_.Clear();
+  storage->indices_.label_property_hash_index_.Clear();
   storage->vertices_.clear();
   storage->edges_.clear();
 
@@ -281,6 +284,8 @@ void InMemoryReplicationHandlers::SnapshotHandler(dbms::DbmsHandler *dbms_handle
   storage->constraints_.unique_constraints_ = std::make_unique<storage::InMemoryUniqueConstraints>();
   storage->indices_.label_index_ = std::make_unique<storage::InMemoryLabelIndex>();
   storage->indices_.label_property_index_ = std::make_unique<storage::InMemoryLabelPropertyIndex>();
+  storage->indices_.label_property_composite_index_ = std::make_unique<storage::InMemoryLabelPropertyCompositeIndex>();
+  storage->indices_.edge_type_property_index_ = std::make_unique<storage::InMemoryEdgeTypePropertyIndex>();
   try {
     spdlog::debug("Loading snapshot");
     auto recovered_snapshot = storage::durability::LoadSnapshot(
@@ -303,6 +308,9 @@ void InMemoryReplicationHandlers::SnapshotHandler(dbms::DbmsHandler *dbms_handle
     memgraph::storage::durability::RecoverConstraints(recovered_snapshot.indices_constraints.constraints,
                                                       &storage->constraints_, &storage->vertices_,
                                                       storage->name_id_mapper_.get());
+    storage->property_column_cache_.Rebuild(storage->vertices_.access());
+    storage->vertex_directory_.Rebuild(storage->vertices_.access());
+    storage->indices_.label_property_hash_index_.Rebuild(storage->vertices_.access());
   } catch (const storage::durability::RecoveryFailure &e) {
     LOG_FATAL("Couldn't load the snapshot because of: {}", e.what());
   }
@@ -359,6 +367,8 @@ void InMemoryReplicationHandlers::ForceResetStorageHandler(dbms::DbmsHandler *db
   auto storage_guard = std::unique_lock{storage->main_lock_};
 
   // Clear the database
+  storage->vertex_directory_.Clear();
+  storage->indices_.label_property_hash_index_.Clear();
   storage->vertices_.clear();
   storage->edges_.clear();
   storage->commit_log_.reset();
@@ -368,6 +378,8 @@ void InMemoryReplicationHandlers::ForceResetStorageHandler(dbms::DbmsHandler *db
   storage->constraints_.unique_constraints_ = std::make_unique<storage::InMemoryUniqueConstraints>();
   storage->indices_.label_index_ = std::make_unique<storage::InMemoryLabelIndex>();
   storage->indices_.label_property_index_ = std::make_unique<storage::InMemoryLabelPropertyIndex>();
+  storage->indices_.label_property_composite_index_ = std::make_unique<storage::InMemoryLabelPropertyCompositeIndex>();
+  storage->indices_.edge_type_property_index_ = std::make_unique<storage::InMemoryEdgeTypePropertyIndex>();
 
   // Fine since we will force push when reading from WAL just random epoch with 0 timestamp, as it should be if it
   // acted as MAIN before
@@ -820,6 +832,33 @@ uint64_t InMemoryReplicationHandlers::ReadAndApplyDelta(storage::InMemoryStorage
           throw utils::BasicException("Invalid transaction! Please raise an issue, {}:{}", __FILE__, __LINE__);
         break;
       }
+      case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE: {
+        const auto &info = delta.operation_label_ordered_properties;
+        spdlog::trace("       Create label+properties index on :{} ({})", info.label,
+                      utils::Join(info.properties, ", "));
+        std::vector<PropertyId> properties;
+        properties.reserve(info.properties.size());
+        for (const auto &prop : info.properties) {
+          properties.emplace_back(storage->NameToProperty(prop));
+        }
+        auto *transaction = get_transaction(timestamp, kUniqueAccess);
+        if (transaction->CreateIndex(storage->NameToLabel(info.label), std::move(properties)).HasError())
+          throw utils::BasicException("Invalid transaction! Please raise an issue, {}:{}", __FILE__, __LINE__);
+        break;
+      }
+      case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+        const auto &info = delta.operation_label_ordered_properties;
+        spdlog::trace("       Drop label+properties index on :{} ({})", info.label, utils::Join(info.properties, ", "));
+        std::vector<PropertyId> properties;
+        properties.reserve(info.properties.size());
+        for (const auto &prop : info.properties) {
+          properties.emplace_back(storage->NameToProperty(prop));
+        }
+        auto *transaction = get_transaction(timestamp, kUniqueAccess);
+        if (transaction->DropIndex(storage->NameToLabel(info.label), std::move(properties)).HasError())
+          throw utils::BasicException("Invalid transaction! Please raise an issue, {}:{}", __FILE__, __LINE__);
+        break;
+      }
       case WalDeltaData::Type::LABEL_PROPERTY_INDEX_STATS_SET: {
         const auto &info = delta.operation_label_property_stats;
         spdlog::trace("       Set label-property index statistics on :{}", info.label);
@@ -856,6 +895,24 @@ uint64_t InMemoryReplicationHandlers::ReadAndApplyDelta(storage::InMemoryStorage
           throw utils::BasicException("Invalid transaction! Please raise an issue, {}:{}", __FILE__, __LINE__);
         break;
       }
+      case WalDeltaData::Type::EDGE_PROPERTY_INDEX_CREATE: {
+        const auto &info = delta.operation_edge_type_property;
+        spdlog::trace("       Create edge index on :{}({})", info.edge_type, info.property);
+        auto *transaction = get_transaction(timestamp, kUniqueAccess);
+        if (transaction->CreateIndex(storage->NameToEdgeType(info.edge_type), storage->NameToProperty(info.property))
+                .HasError())
+          throw utils::BasicException("Invalid transaction! Please raise an issue, {}:{}", __FILE__, __LINE__);
+        break;
+      }
+      case WalDeltaData::Type::EDGE_PROPERTY_INDEX_DROP: {
+        const auto &info = delta.operation_edge_type_property;
+        spdlog::trace("       Drop edge index on :{}({})", info.edge_type, info.property);
+        auto *transaction = get_transaction(timestamp, kUniqueAccess);
+        if (transaction->DropIndex(storage->NameToEdgeType(info.edge_type), storage->NameToProperty(info.property))
+                .HasError())
+          throw utils::BasicException("Invalid transaction! Please raise an issue, {}:{}", __FILE__, __LINE__);
+        break;
+      }
       case WalDeltaData::Type::TEXT_INDEX_CREATE: {
         // NOTE: Text search doesn’t have replication in scope yet (Phases 1 and 2)
         break;
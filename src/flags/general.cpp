@@ -17,6 +17,7 @@
 #include "utils/flag_validation.hpp"
 #include "utils/string.hpp"
 
+#include <optional>
 #include <thread>
 
 // Short help flag.
@@ -67,6 +68,14 @@ DEFINE_bool(allow_load_csv, true, "Controls whether LOAD CSV clause is allowed i
 DEFINE_VALIDATED_uint64(storage_gc_cycle_sec, 30, "Storage garbage collector interval (in seconds).",
                         FLAG_IN_RANGE(1, 24UL * 3600));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_gc_threads, memgraph::storage::Config::Gc().threads,
+                        "Number of threads the storage garbage collector splits its work between.",
+                        FLAG_IN_RANGE(1, 256));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_gc_step_budget_ms, memgraph::storage::Config::Gc().step_budget.count(),
+              "Time (in milliseconds) a single storage garbage collector run may spend unlinking old versions of "
+              "objects. The rest is left to the following runs. Set to 0 to unlink everything in each run.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(storage_python_gc_cycle_sec, 180,
                         "Storage python full garbage collection interval (in seconds).", FLAG_IN_RANGE(1, 24UL * 3600));
 // NOTE: The `storage_properties_on_edges` flag must be the same here and in
@@ -101,6 +110,15 @@ DEFINE_VALIDATED_uint64(storage_wal_file_flush_every_n_tx,
                         "WAL file. Set to 1 for fully synchronous operation.",
                         FLAG_IN_RANGE(1, 1000000));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_wal_group_commit, memgraph::storage::Config::Durability().wal_group_commit,
+            "Every committed transaction is durable before the commit returns, but the WAL is synced by a dedicated "
+            "thread once for all transactions committed in the meantime. Replaces "
+            "--storage-wal-file-flush-every-n-tx when enabled.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_durability_compression, memgraph::storage::Config::Durability().compression,
+            "Compress new snapshot and WAL files with zlib. The data is compressed in blocks and each WAL sync also "
+            "writes the block that is still being filled, so compression doesn't delay the durability of commits.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_snapshot_on_exit, false, "Controls whether the storage creates another snapshot on exit.");
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
@@ -127,6 +145,12 @@ DEFINE_uint64(storage_recovery_thread_count,
                        memgraph::storage::Config::Durability().recovery_thread_count),
               "The number of threads used to recover persisted data from disk.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_snapshot_thread_count, memgraph::storage::Config::Durability().snapshot_thread_count,
+                        "The number of threads used to create a snapshot. With more than one thread, vertices and "
+                        "edges are encoded, compressed and written to the snapshot file in parallel.",
+                        FLAG_IN_RANGE(1, 1024));
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_enable_schema_metadata, false,
             "Controls whether metadata should be collected about the resident labels and edge types.");
@@ -135,6 +159,78 @@ DEFINE_bool(storage_enable_schema_metadata, false,
 DEFINE_bool(storage_delta_on_identical_property_update, true,
             "Controls whether updating a property with the same value should create a delta object.");
 
+namespace {
+// Parses one entry of a comma-separated list of Label.property pairs.
+std::optional<std::pair<std::string, std::string>> ParseLabelProperty(std::string_view entry) {
+  auto parts = memgraph::utils::Split(memgraph::utils::Trim(entry), ".", 1);
+  if (parts.size() != 2 || parts[0].empty() || parts[1].empty()) return std::nullopt;
+  return std::pair{std::move(parts[0]), std::move(parts[1])};
+}
+
+bool ValidateLabelPropertyList(std::string_view flagname, std::string_view value) {
+  if (value.empty()) return true;
+  for (const auto &entry : memgraph::utils::Split(value, ",")) {
+    if (!ParseLabelProperty(entry)) {
+      std::cout << "Expected --" << flagname << " to be a comma-separated list of Label.property pairs, got '"
+                << entry << "'." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+// Expects a value accepted by ValidateLabelPropertyList.
+std::vector<std::pair<std::string, std::string>> ParseLabelPropertyList(std::string_view value) {
+  std::vector<std::pair<std::string, std::string>> pairs;
+  if (value.empty()) return pairs;
+  for (const auto &entry : memgraph::utils::Split(value, ",")) {
+    pairs.emplace_back(*ParseLabelProperty(entry));
+  }
+  return pairs;
+}
+}  // namespace
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_string(storage_property_column_cache, "",
+                        "Comma-separated list of Label.property pairs whose integer, floating point and boolean values "
+                        "are additionally kept in dense per-vertex columns, so property lookups on vertices with that "
+                        "label don't have to decode the vertex's property store. Only used by the in-memory "
+                        "transactional storage mode.",
+                        { return ValidateLabelPropertyList(flagname, value); });
+
+auto memgraph::flags::ParsePropertyColumnCache() -> std::vector<std::pair<std::string, std::string>> {
+  return ParseLabelPropertyList(FLAGS_storage_property_column_cache);
+}
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_string(storage_hash_indices, "",
+                        "Comma-separated list of Label.property pairs which get a hash index. A hash index only "
+                        "answers equality lookups, such as MATCH or MERGE on an external id, and does so without "
+                        "comparing values along a skip list. Only used by the in-memory storage modes.",
+                        { return ValidateLabelPropertyList(flagname, value); });
+
+auto memgraph::flags::ParseHashIndices() -> std::vector<std::pair<std::string, std::string>> {
+  return ParseLabelPropertyList(FLAGS_storage_hash_indices);
+}
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_vertex_directory, false,
+            "Controls whether a dense table from vertex ids to vertices is kept next to the vertex skip list, so "
+            "vertices are found by id in constant time. Uses 8 bytes per vertex id handed out. Only used by the "
+            "in-memory storage modes.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_index_creation_thread_count, memgraph::storage::Config::IndexCreation().thread_count,
+                        "The number of threads which build a label or label+property index created by a query. With "
+                        "more than one thread, every thread indexes chunks of the vertices.",
+                        FLAG_IN_RANGE(1, 1024));
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_index_creation_online, false,
+            "Controls whether a label or label+property index created by a query is populated while other "
+            "transactions keep running. Unique access to the storage is only taken to register the index and to "
+            "make it visible. Only used by the in-memory transactional storage mode.");
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(telemetry_enabled, false,
             "Set to true to enable telemetry. We collect information about the "
@@ -12,3 +12,23 @@
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 // DEFINE_bool(cartesian_product_enabled, true, "Enable cartesian product expansion.");  Moved to run_time_configurable
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_parallel_execution_threads, 1,
+              "Maximum number of threads a single query can use to scan and aggregate vertices in parallel. Values "
+              "less than 2 disable parallel execution.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(query_parallel_execution_pin_threads, false,
+            "Pin the threads used for parallel query execution to CPUs, filling the CPUs of one NUMA node before "
+            "moving on to the next one.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(query_compile_expressions, true,
+            "Compile the filter expressions of frequently executed cached plans instead of interpreting them for "
+            "every row.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_spill_threshold_mb, 0,
+              "Memory in MiB a single aggregation can use before its groups are spilled to disk. Value of 0 means the "
+              "groups are spilled only when the query gets close to its memory limit.");
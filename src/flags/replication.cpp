@@ -32,3 +32,8 @@ DEFINE_uint64(replication_replica_check_frequency_sec, 1,
               "The MAIN instance allocates a new thread for each REPLICA.");
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(replication_restore_state_on_startup, false, "Restore replication state on startup, e.g. recover replica");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(replication_compression, false,
+            "Compress the deltas, snapshots and WAL files that MAIN sends to its replicas with zlib. Replicas "
+            "which can't read compressed data are sent uncompressed data. Helps when the replicas are behind a "
+            "slow link, at the cost of CPU time on both ends.");
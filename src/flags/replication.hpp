@@ -32,3 +32,5 @@ DECLARE_uint32(instance_get_uuid_frequency_sec);
 DECLARE_uint64(replication_replica_check_frequency_sec);
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DECLARE_bool(replication_restore_state_on_startup);
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_bool(replication_compression);
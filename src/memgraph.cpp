@@ -308,17 +308,23 @@ int main(int argc, char **argv) {
   // Main storage and execution engines initialization
   memgraph::storage::Config db_config{
       .gc = {.type = memgraph::storage::Config::Gc::Type::PERIODIC,
-             .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec)},
+             .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec),
+             .threads = FLAGS_storage_gc_threads,
+             .step_budget = std::chrono::milliseconds(FLAGS_storage_gc_step_budget_ms)},
 
       .durability = {.storage_directory = FLAGS_data_directory,
                      .recover_on_startup = FLAGS_storage_recover_on_startup || FLAGS_data_recovery_on_startup,
                      .snapshot_retention_count = FLAGS_storage_snapshot_retention_count,
                      .wal_file_size_kibibytes = FLAGS_storage_wal_file_size_kib,
                      .wal_file_flush_every_n_tx = FLAGS_storage_wal_file_flush_every_n_tx,
+                     .wal_group_commit = FLAGS_storage_wal_group_commit,
+                     .compression = FLAGS_storage_durability_compression,
                      .snapshot_on_exit = FLAGS_storage_snapshot_on_exit,
                      .restore_replication_state_on_startup = FLAGS_replication_restore_state_on_startup,
+                     .replication_compression = FLAGS_replication_compression,
                      .items_per_batch = FLAGS_storage_items_per_batch,
                      .recovery_thread_count = FLAGS_storage_recovery_thread_count,
+                     .snapshot_thread_count = FLAGS_storage_snapshot_thread_count,
                      // deprecated
                      .allow_parallel_index_creation = FLAGS_storage_parallel_index_recovery,
                      .allow_parallel_schema_creation = FLAGS_storage_parallel_schema_recovery},
@@ -331,6 +337,11 @@ int main(int argc, char **argv) {
                .id_name_mapper_directory = FLAGS_data_directory + "/rocksdb_id_name_mapper",
                .durability_directory = FLAGS_data_directory + "/rocksdb_durability",
                .wal_directory = FLAGS_data_directory + "/rocksdb_wal"},
+      .property_column_cache = {.columns = memgraph::flags::ParsePropertyColumnCache()},
+      .hash_indices = {.label_properties = memgraph::flags::ParseHashIndices()},
+      .vertex_directory = {.enabled = FLAGS_storage_vertex_directory},
+      .index_creation = {.thread_count = FLAGS_storage_index_creation_thread_count,
+                         .online = FLAGS_storage_index_creation_online},
       .salient.items = {.properties_on_edges = FLAGS_storage_properties_on_edges,
                         .enable_schema_metadata = FLAGS_storage_enable_schema_metadata,
                         .delta_on_identical_property_update = FLAGS_storage_delta_on_identical_property_update},
@@ -119,6 +119,18 @@ bool QueriesMemoryControl::CheckTransactionIdTrackerExists(uint64_t transaction_
   return transaction_id_to_tracker_accessor.contains(transaction_id);
 }
 
+std::optional<std::pair<int64_t, int64_t>> QueriesMemoryControl::GetTransactionIdTrackerUsage(
+    uint64_t transaction_id) {
+  auto transaction_id_to_tracker_accessor = transaction_id_to_tracker.access();
+  auto query_tracker = transaction_id_to_tracker_accessor.find(transaction_id);
+
+  if (query_tracker == transaction_id_to_tracker_accessor.end()) {
+    return std::nullopt;
+  }
+
+  return query_tracker->tracker.QueryUsage();
+}
+
 void QueriesMemoryControl::TryCreateTransactionProcTracker(uint64_t transaction_id, int64_t procedure_id,
                                                            size_t limit) {
   auto transaction_id_to_tracker_accessor = transaction_id_to_tracker.access();
@@ -206,6 +218,14 @@ bool IsTransactionTracked(uint64_t transaction_id) {
 bool IsTransactionTracked(uint64_t /*transaction_id*/) { return false; }
 #endif
 
+std::optional<std::pair<int64_t, int64_t>> GetTransactionMemoryUsage([[maybe_unused]] uint64_t transaction_id) {
+#if USE_JEMALLOC
+  return GetQueriesMemoryControl().GetTransactionIdTrackerUsage(transaction_id);
+#else
+  return std::nullopt;
+#endif
+}
+
 void CreateOrContinueProcedureTracking(uint64_t transaction_id, int64_t procedure_id, size_t limit) {
 #if USE_JEMALLOC
   if (!GetQueriesMemoryControl().CheckTransactionIdTrackerExists(transaction_id)) {
@@ -12,8 +12,10 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <thread>
 #include <unordered_map>
+#include <utility>
 
 #include "utils/memory_tracker.hpp"
 #include "utils/query_memory_tracker.hpp"
@@ -43,6 +45,9 @@ class QueriesMemoryControl {
   // Check if tracker for given transaction id exists
   bool CheckTransactionIdTrackerExists(uint64_t);
 
+  // Memory used by transaction with given id and its limit, if the transaction is limited
+  std::optional<std::pair<int64_t, int64_t>> GetTransactionIdTrackerUsage(uint64_t);
+
   // Remove current tracker for transaction_id
   bool EraseTransactionIdTracker(uint64_t);
 
@@ -144,6 +149,10 @@ void TryStopTrackingOnTransaction(uint64_t transaction_id);
 // Is transaction with given id tracked in memory tracker
 bool IsTransactionTracked(uint64_t transaction_id);
 
+// Memory used by transaction with given id and its limit, in bytes.
+// Returns nullopt if the transaction has no memory limit or if jemalloc is not enabled
+std::optional<std::pair<int64_t, int64_t>> GetTransactionMemoryUsage(uint64_t transaction_id);
+
 // Creates tracker on procedure if doesn't exist. Sets query tracker
 // to track procedure with id.
 void CreateOrContinueProcedureTracking(uint64_t transaction_id, int64_t procedure_id, size_t limit);
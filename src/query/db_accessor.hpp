@@ -439,6 +439,13 @@ class DbAccessor final {
     return std::nullopt;
   }
 
+  std::optional<EdgeAccessor> FindEdge(storage::Gid gid, storage::View view, storage::EdgeTypeId edge_type,
+                                       VertexAccessor *from_vertex, VertexAccessor *to_vertex) {
+    auto maybe_edge = accessor_->FindEdge(gid, view, edge_type, &from_vertex->impl_, &to_vertex->impl_);
+    if (maybe_edge) return EdgeAccessor(*maybe_edge);
+    return std::nullopt;
+  }
+
   void FinalizeTransaction() { accessor_->FinalizeTransaction(); }
 
   void TrackCurrentThreadAllocations() {
@@ -453,6 +460,24 @@ class DbAccessor final {
 
   VerticesIterable Vertices(storage::View view) { return VerticesIterable(accessor_->Vertices(view)); }
 
+  std::vector<VerticesIterable> ChunkedVertices(storage::View view, uint64_t num_chunks) {
+    auto chunks = accessor_->ChunkedVertices(view, num_chunks);
+    std::vector<VerticesIterable> result;
+    result.reserve(chunks.size());
+    for (auto &chunk : chunks) result.emplace_back(std::move(chunk));
+    return result;
+  }
+
+  std::vector<VerticesIterable> ChunkedVertices(storage::View view, storage::LabelId label, uint64_t num_chunks) {
+    auto chunks = accessor_->ChunkedVertices(label, view, num_chunks);
+    std::vector<VerticesIterable> result;
+    result.reserve(chunks.size());
+    for (auto &chunk : chunks) result.emplace_back(std::move(chunk));
+    return result;
+  }
+
+  void SetConcurrentReads(bool enabled) { accessor_->SetConcurrentReads(enabled); }
+
   VerticesIterable Vertices(storage::View view, storage::LabelId label) {
     return VerticesIterable(accessor_->Vertices(label, view));
   }
@@ -472,10 +497,33 @@ class DbAccessor final {
     return VerticesIterable(accessor_->Vertices(label, property, lower, upper, view));
   }
 
+  VerticesIterable Vertices(storage::View view, storage::LabelId label,
+                            const std::vector<storage::PropertyId> &properties,
+                            const std::vector<storage::PropertyValue> &prefix,
+                            const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+                            const std::optional<utils::Bound<storage::PropertyValue>> &upper) {
+    return VerticesIterable(accessor_->Vertices(label, properties, prefix, lower, upper, view));
+  }
+
   EdgesIterable Edges(storage::View view, storage::EdgeTypeId edge_type) {
     return EdgesIterable(accessor_->Edges(edge_type, view));
   }
 
+  EdgesIterable Edges(storage::View view, storage::EdgeTypeId edge_type, storage::PropertyId property) {
+    return EdgesIterable(accessor_->Edges(edge_type, property, view));
+  }
+
+  EdgesIterable Edges(storage::View view, storage::EdgeTypeId edge_type, storage::PropertyId property,
+                      const storage::PropertyValue &value) {
+    return EdgesIterable(accessor_->Edges(edge_type, property, value, view));
+  }
+
+  EdgesIterable Edges(storage::View view, storage::EdgeTypeId edge_type, storage::PropertyId property,
+                      const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+                      const std::optional<utils::Bound<storage::PropertyValue>> &upper) {
+    return EdgesIterable(accessor_->Edges(edge_type, property, lower, upper, view));
+  }
+
   VertexAccessor InsertVertex() { return VertexAccessor(accessor_->CreateVertex()); }
 
   storage::Result<EdgeAccessor> InsertEdge(VertexAccessor *from, VertexAccessor *to,
@@ -632,8 +680,29 @@ class DbAccessor final {
     return accessor_->LabelPropertyIndexExists(label, prop);
   }
 
+  bool LabelPropertyHashIndexExists(storage::LabelId label, storage::PropertyId prop) const {
+    return accessor_->LabelPropertyHashIndexExists(label, prop);
+  }
+
+  bool LabelPropertyCompositeIndexExists(storage::LabelId label, const std::vector<storage::PropertyId> &props) const {
+    return accessor_->LabelPropertyCompositeIndexExists(label, props);
+  }
+
+  /// Properties of the label+properties indices on the label.
+  std::vector<std::vector<storage::PropertyId>> LabelPropertyCompositeIndices(storage::LabelId label) const {
+    std::vector<std::vector<storage::PropertyId>> indices;
+    for (auto &[index_label, properties] : accessor_->ListAllIndices().label_properties) {
+      if (index_label == label) indices.push_back(std::move(properties));
+    }
+    return indices;
+  }
+
   bool EdgeTypeIndexExists(storage::EdgeTypeId edge_type) const { return accessor_->EdgeTypeIndexExists(edge_type); }
 
+  bool EdgeTypePropertyIndexExists(storage::EdgeTypeId edge_type, storage::PropertyId property) const {
+    return accessor_->EdgeTypePropertyIndexExists(edge_type, property);
+  }
+
   bool TextIndexExists(const std::string &index_name) const { return accessor_->TextIndexExists(index_name); }
 
   void TextIndexAddVertex(const VertexAccessor &vertex) { accessor_->TextIndexAddVertex(vertex.impl_); }
@@ -696,6 +765,11 @@ class DbAccessor final {
     return accessor_->ApproximateVertexCount(label, property, lower, upper);
   }
 
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties,
+                        const std::vector<storage::PropertyValue> &prefix) const {
+    return accessor_->ApproximateVertexCount(label, properties, prefix);
+  }
+
   std::vector<storage::LabelId> ListAllPossiblyPresentVertexLabels() const {
     return accessor_->ListAllPossiblyPresentVertexLabels();
   }
@@ -722,6 +796,16 @@ class DbAccessor final {
     return accessor_->CreateIndex(edge_type);
   }
 
+  utils::BasicResult<storage::StorageIndexDefinitionError, void> CreateIndex(storage::EdgeTypeId edge_type,
+                                                                             storage::PropertyId property) {
+    return accessor_->CreateIndex(edge_type, property);
+  }
+
+  utils::BasicResult<storage::StorageIndexDefinitionError, void> CreateIndex(
+      storage::LabelId label, std::vector<storage::PropertyId> properties) {
+    return accessor_->CreateIndex(label, std::move(properties));
+  }
+
   utils::BasicResult<storage::StorageIndexDefinitionError, void> DropIndex(storage::LabelId label) {
     return accessor_->DropIndex(label);
   }
@@ -735,6 +819,16 @@ class DbAccessor final {
     return accessor_->DropIndex(edge_type);
   }
 
+  utils::BasicResult<storage::StorageIndexDefinitionError, void> DropIndex(storage::EdgeTypeId edge_type,
+                                                                           storage::PropertyId property) {
+    return accessor_->DropIndex(edge_type, property);
+  }
+
+  utils::BasicResult<storage::StorageIndexDefinitionError, void> DropIndex(
+      storage::LabelId label, std::vector<storage::PropertyId> properties) {
+    return accessor_->DropIndex(label, std::move(properties));
+  }
+
   void CreateTextIndex(const std::string &index_name, storage::LabelId label) {
     accessor_->CreateTextIndex(index_name, label, this);
   }
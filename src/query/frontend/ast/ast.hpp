@@ -2258,16 +2258,24 @@ class EdgeIndexQuery : public memgraph::query::Query {
 
   memgraph::query::EdgeIndexQuery::Action action_;
   memgraph::query::EdgeTypeIx edge_type_;
+  /// Empty for an edge-type index, a single property for an edge-type+property
+  /// index.
+  std::vector<memgraph::query::PropertyIx> properties_;
 
   EdgeIndexQuery *Clone(AstStorage *storage) const override {
     EdgeIndexQuery *object = storage->Create<EdgeIndexQuery>();
     object->action_ = action_;
     object->edge_type_ = storage->GetEdgeTypeIx(edge_type_.name);
+    object->properties_.resize(properties_.size());
+    for (auto i = 0; i < object->properties_.size(); ++i) {
+      object->properties_[i] = storage->GetPropertyIx(properties_[i].name);
+    }
     return object;
   }
 
  protected:
-  EdgeIndexQuery(Action action, EdgeTypeIx edge_type) : action_(action), edge_type_(edge_type) {}
+  EdgeIndexQuery(Action action, EdgeTypeIx edge_type, std::vector<PropertyIx> properties = {})
+      : action_(action), edge_type_(edge_type), properties_(std::move(properties)) {}
 
  private:
   friend class AstStorage;
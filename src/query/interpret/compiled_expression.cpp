@@ -0,0 +1,416 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/interpret/compiled_expression.hpp"
+
+#include <array>
+#include <optional>
+#include <string_view>
+
+#include "query/context.hpp"
+#include "query/exceptions.hpp"
+#include "query/frontend/semantic/symbol_table.hpp"
+#include "query/interpret/eval.hpp"
+#include "utils/typeinfo.hpp"
+
+namespace memgraph::query {
+
+namespace {
+
+using Node = CompiledExpression::Node;
+using Runtime = CompiledExpression::Runtime;
+
+enum class Comparison : uint8_t { EQUAL, NOT_EQUAL, LESS, GREATER, LESS_EQUAL, GREATER_EQUAL };
+
+struct BinaryOperatorInfo {
+  const utils::TypeInfo *type;
+  TypedValue (*apply)(const TypedValue &, const TypedValue &);
+  const char *cypher_op;
+  std::optional<Comparison> comparison;
+};
+
+// Binary operators with the same semantics and errors as the corresponding
+// ExpressionEvaluator::Visit overloads.
+const std::array<BinaryOperatorInfo, 12> kBinaryOperators{{
+    {&XorOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a ^ b; }, "XOR", std::nullopt},
+    {&AdditionOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a + b; }, "+", std::nullopt},
+    {&SubtractionOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a - b; }, "-", std::nullopt},
+    {&MultiplicationOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a * b; }, "*",
+     std::nullopt},
+    {&DivisionOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a / b; }, "/", std::nullopt},
+    {&ModOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a % b; }, "%", std::nullopt},
+    {&NotEqualOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a != b; }, "<>",
+     Comparison::NOT_EQUAL},
+    {&EqualOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a == b; }, "=", Comparison::EQUAL},
+    {&LessOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a < b; }, "<", Comparison::LESS},
+    {&GreaterOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a > b; }, ">",
+     Comparison::GREATER},
+    {&LessEqualOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a <= b; }, "<=",
+     Comparison::LESS_EQUAL},
+    {&GreaterEqualOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a >= b; }, ">=",
+     Comparison::GREATER_EQUAL},
+}};
+
+const BinaryOperatorInfo *FindBinaryOperator(const Expression &expression) {
+  for (const auto &op : kBinaryOperators) {
+    if (expression.GetTypeInfo() == *op.type) return &op;
+  }
+  return nullptr;
+}
+
+TypedValue ApplyBinary(const BinaryOperatorInfo &op, const TypedValue &lhs, const TypedValue &rhs) {
+  try {
+    return op.apply(lhs, rhs);
+  } catch (const TypedValueException &) {
+    throw QueryRuntimeException("Invalid types: {} and {} for '{}'.", lhs.type(), rhs.type(), op.cypher_op);
+  }
+}
+
+// The comparisons are derived from `<` and `==` the same way TypedValue
+// derives them, which matters for NaN.
+template <Comparison kComparison, typename T>
+bool Compare(const T &a, const T &b) {
+  if constexpr (kComparison == Comparison::EQUAL) {
+    return a == b;
+  } else if constexpr (kComparison == Comparison::NOT_EQUAL) {
+    return !(a == b);
+  } else if constexpr (kComparison == Comparison::LESS) {
+    return a < b;
+  } else if constexpr (kComparison == Comparison::GREATER) {
+    return !(a < b || a == b);
+  } else if constexpr (kComparison == Comparison::LESS_EQUAL) {
+    return a < b || a == b;
+  } else {
+    return !(a < b);
+  }
+}
+
+double NumericToDouble(const storage::PropertyValue &value) {
+  return value.IsInt() ? static_cast<double>(value.ValueInt()) : value.ValueDouble();
+}
+
+double NumericToDouble(const TypedValue &value) {
+  return value.IsInt() ? static_cast<double>(value.ValueInt()) : value.ValueDouble();
+}
+
+// Compares a property with a constant without converting the property to a
+// TypedValue. Returns std::nullopt for the combinations of types which are
+// left to the TypedValue comparison (nulls, temporal types, errors...).
+template <Comparison kComparison>
+std::optional<bool> CompareProperty(const storage::PropertyValue &property, const TypedValue &constant,
+                                    bool property_first) {
+  const auto compare = [property_first](const auto &p, const auto &c) {
+    return property_first ? Compare<kComparison>(p, c) : Compare<kComparison>(c, p);
+  };
+  if (property.IsInt() && constant.IsInt()) return compare(property.ValueInt(), constant.ValueInt());
+  if ((property.IsInt() || property.IsDouble()) && constant.IsNumeric()) {
+    return compare(NumericToDouble(property), NumericToDouble(constant));
+  }
+  if (property.IsString() && constant.IsString()) {
+    return compare(std::string_view(property.ValueString()), std::string_view(constant.ValueString()));
+  }
+  return std::nullopt;
+}
+
+// Own property of the vertex or the edge at `position` of the frame, or
+// std::nullopt if the frame holds another kind of value there.
+std::optional<storage::PropertyValue> ReadRecordProperty(const Runtime &rt, size_t position,
+                                                         const PropertyIx &property) {
+  const auto &record = rt.frame->elems()[position];
+  if (record.IsVertex()) return rt.evaluator->LookupProperty(record.ValueVertex(), property);
+  if (record.IsEdge()) return rt.evaluator->LookupProperty(record.ValueEdge(), property);
+  return std::nullopt;
+}
+
+// Values other than vertices and edges are handed to the evaluator, which
+// knows how to look up properties of maps and temporal types.
+TypedValue LookupProperty(const Runtime &rt, size_t position, PropertyLookup *lookup) {
+  if (rt.frame->elems()[position].IsNull()) return TypedValue(rt.ctx->memory);
+  if (auto property = ReadRecordProperty(rt, position, lookup->property_)) {
+    return TypedValue(std::move(*property), rt.ctx->memory);
+  }
+  return lookup->Accept(*rt.evaluator);
+}
+
+struct CompiledNode {
+  Node node;
+  // Value of the node if it depends neither on the row nor on the parameters.
+  std::optional<TypedValue> constant;
+  // Slot of the parameter if the node just reads one.
+  std::optional<size_t> parameter;
+  // Set if the node is an own property lookup on an identifier.
+  PropertyLookup *property_lookup{nullptr};
+  size_t record_position{0};
+  // Set if the node is evaluated by the ExpressionEvaluator.
+  bool interpreted{false};
+};
+
+class Compiler {
+ public:
+  explicit Compiler(const SymbolTable &symbol_table) : symbol_table_(&symbol_table) {}
+
+  CompiledNode Compile(Expression *expression) {
+    if (auto *literal = utils::Downcast<PrimitiveLiteral>(expression)) return Constant(TypedValue(literal->value_));
+    if (auto *parameter = utils::Downcast<ParameterLookup>(expression)) return CompileParameter(*parameter);
+    if (auto *identifier = utils::Downcast<Identifier>(expression)) return CompileIdentifier(*identifier);
+    if (auto *lookup = utils::Downcast<PropertyLookup>(expression)) return CompilePropertyLookup(lookup);
+    if (auto *op = utils::Downcast<AndOperator>(expression)) return CompileAnd(op);
+    if (auto *op = utils::Downcast<OrOperator>(expression)) return CompileOr(op);
+    if (auto *op = utils::Downcast<IsNullOperator>(expression)) return CompileIsNull(op);
+    if (auto *op = utils::Downcast<NotOperator>(expression)) {
+      return CompileUnary(op, [](const TypedValue &a) { return !a; }, "NOT");
+    }
+    if (auto *op = utils::Downcast<UnaryPlusOperator>(expression)) {
+      return CompileUnary(op, [](const TypedValue &a) { return +a; }, "+");
+    }
+    if (auto *op = utils::Downcast<UnaryMinusOperator>(expression)) {
+      return CompileUnary(op, [](const TypedValue &a) { return -a; }, "-");
+    }
+    if (const auto *info = FindBinaryOperator(*expression)) {
+      return CompileBinary(utils::Downcast<BinaryOperator>(expression), *info);
+    }
+    return Interpreted(expression);
+  }
+
+  std::vector<int32_t> TakeParameterPositions() { return std::move(parameter_positions_); }
+
+ private:
+  static CompiledNode Constant(TypedValue value) {
+    CompiledNode compiled;
+    compiled.node = [value](const Runtime &rt) { return TypedValue(value, rt.ctx->memory); };
+    compiled.constant = std::move(value);
+    return compiled;
+  }
+
+  static CompiledNode Interpreted(Expression *expression) {
+    CompiledNode compiled;
+    compiled.node = [expression](const Runtime &rt) { return expression->Accept(*rt.evaluator); };
+    compiled.interpreted = true;
+    return compiled;
+  }
+
+  // Evaluates a node whose operands are all constants once. Errors are left
+  // to be raised when the expression is evaluated.
+  static CompiledNode Fold(CompiledNode compiled) {
+    EvaluationContext ctx;
+    const Runtime rt{.frame = nullptr, .ctx = &ctx, .evaluator = nullptr, .parameters = nullptr};
+    try {
+      return Constant(compiled.node(rt));
+    } catch (const QueryRuntimeException &) {
+      return compiled;
+    }
+  }
+
+  CompiledNode CompileParameter(const ParameterLookup &lookup) {
+    const auto slot = parameter_positions_.size();
+    parameter_positions_.push_back(lookup.token_position_);
+    CompiledNode compiled;
+    compiled.node = [slot](const Runtime &rt) { return TypedValue((*rt.parameters)[slot], rt.ctx->memory); };
+    compiled.parameter = slot;
+    return compiled;
+  }
+
+  CompiledNode CompileIdentifier(const Identifier &identifier) const {
+    const size_t position = symbol_table_->at(identifier).position();
+    CompiledNode compiled;
+    compiled.node = [position](const Runtime &rt) { return TypedValue(rt.frame->elems()[position], rt.ctx->memory); };
+    return compiled;
+  }
+
+  CompiledNode CompilePropertyLookup(PropertyLookup *lookup) const {
+    auto *identifier = utils::Downcast<Identifier>(lookup->expression_);
+    if (!identifier || lookup->evaluation_mode_ != PropertyLookup::EvaluationMode::GET_OWN_PROPERTY) {
+      return Interpreted(lookup);
+    }
+    const size_t position = symbol_table_->at(*identifier).position();
+    CompiledNode compiled;
+    compiled.node = [position, lookup](const Runtime &rt) { return LookupProperty(rt, position, lookup); };
+    compiled.property_lookup = lookup;
+    compiled.record_position = position;
+    return compiled;
+  }
+
+  CompiledNode CompileAnd(AndOperator *op) {
+    auto lhs = Compile(op->expression1_);
+    auto rhs = Compile(op->expression2_);
+    if (lhs.interpreted && rhs.interpreted) return Interpreted(op);
+    // The second operand isn't evaluated if the first one is false.
+    if (lhs.constant && lhs.constant->IsBool() && !lhs.constant->ValueBool()) return Constant(*lhs.constant);
+    CompiledNode compiled;
+    compiled.node = [lhs_node = std::move(lhs.node), rhs_node = std::move(rhs.node)](const Runtime &rt) {
+      auto value1 = lhs_node(rt);
+      if (value1.IsBool() && !value1.ValueBool()) return value1;
+      auto value2 = rhs_node(rt);
+      try {
+        return value1 && value2;
+      } catch (const TypedValueException &) {
+        throw QueryRuntimeException("Invalid types: {} and {} for AND.", value1.type(), value2.type());
+      }
+    };
+    if (lhs.constant && rhs.constant) return Fold(std::move(compiled));
+    return compiled;
+  }
+
+  CompiledNode CompileOr(OrOperator *op) {
+    auto lhs = Compile(op->expression1_);
+    auto rhs = Compile(op->expression2_);
+    if (lhs.interpreted && rhs.interpreted) return Interpreted(op);
+    // The second operand isn't evaluated if the first one is true.
+    if (lhs.constant && lhs.constant->IsBool() && lhs.constant->ValueBool()) return Constant(*lhs.constant);
+    CompiledNode compiled;
+    compiled.node = [lhs_node = std::move(lhs.node), rhs_node = std::move(rhs.node)](const Runtime &rt) {
+      auto value1 = lhs_node(rt);
+      if (value1.IsBool() && value1.ValueBool()) return value1;
+      auto value2 = rhs_node(rt);
+      try {
+        return value1 || value2;
+      } catch (const TypedValueException &) {
+        throw QueryRuntimeException("Invalid types: {} and {} for OR.", value1.type(), value2.type());
+      }
+    };
+    if (lhs.constant && rhs.constant) return Fold(std::move(compiled));
+    return compiled;
+  }
+
+  CompiledNode CompileIsNull(IsNullOperator *op) {
+    auto operand = Compile(op->expression_);
+    if (operand.interpreted) return Interpreted(op);
+    CompiledNode compiled;
+    compiled.node = [operand_node = std::move(operand.node)](const Runtime &rt) {
+      return TypedValue(operand_node(rt).IsNull(), rt.ctx->memory);
+    };
+    if (operand.constant) return Fold(std::move(compiled));
+    return compiled;
+  }
+
+  CompiledNode CompileUnary(UnaryOperator *op, TypedValue (*apply)(const TypedValue &), const char *cypher_op) {
+    auto operand = Compile(op->expression_);
+    if (operand.interpreted) return Interpreted(op);
+    CompiledNode compiled;
+    compiled.node = [apply, cypher_op, operand_node = std::move(operand.node)](const Runtime &rt) {
+      auto value = operand_node(rt);
+      try {
+        return apply(value);
+      } catch (const TypedValueException &) {
+        throw QueryRuntimeException("Invalid type {} for '{}'.", value.type(), cypher_op);
+      }
+    };
+    if (operand.constant) return Fold(std::move(compiled));
+    return compiled;
+  }
+
+  CompiledNode CompileBinary(BinaryOperator *op, const BinaryOperatorInfo &info) {
+    auto lhs = Compile(op->expression1_);
+    auto rhs = Compile(op->expression2_);
+    if (lhs.interpreted && rhs.interpreted) return Interpreted(op);
+    if (info.comparison) {
+      if (lhs.property_lookup && (rhs.constant || rhs.parameter)) return ComparePropertyWith(info, lhs, rhs, true);
+      if (rhs.property_lookup && (lhs.constant || lhs.parameter)) return ComparePropertyWith(info, rhs, lhs, false);
+    }
+    CompiledNode compiled;
+    compiled.node = [&info, lhs_node = std::move(lhs.node), rhs_node = std::move(rhs.node)](const Runtime &rt) {
+      auto value1 = lhs_node(rt);
+      auto value2 = rhs_node(rt);
+      return ApplyBinary(info, value1, value2);
+    };
+    if (lhs.constant && rhs.constant) return Fold(std::move(compiled));
+    return compiled;
+  }
+
+  static CompiledNode ComparePropertyWith(const BinaryOperatorInfo &info, const CompiledNode &property,
+                                          const CompiledNode &operand, bool property_first) {
+    CompiledNode compiled;
+    switch (*info.comparison) {
+      case Comparison::EQUAL:
+        compiled.node = PropertyComparison<Comparison::EQUAL>(info, property, operand, property_first);
+        break;
+      case Comparison::NOT_EQUAL:
+        compiled.node = PropertyComparison<Comparison::NOT_EQUAL>(info, property, operand, property_first);
+        break;
+      case Comparison::LESS:
+        compiled.node = PropertyComparison<Comparison::LESS>(info, property, operand, property_first);
+        break;
+      case Comparison::GREATER:
+        compiled.node = PropertyComparison<Comparison::GREATER>(info, property, operand, property_first);
+        break;
+      case Comparison::LESS_EQUAL:
+        compiled.node = PropertyComparison<Comparison::LESS_EQUAL>(info, property, operand, property_first);
+        break;
+      case Comparison::GREATER_EQUAL:
+        compiled.node = PropertyComparison<Comparison::GREATER_EQUAL>(info, property, operand, property_first);
+        break;
+    }
+    return compiled;
+  }
+
+  // Comparison of an own property lookup with a constant or a parameter.
+  template <Comparison kComparison>
+  static Node PropertyComparison(const BinaryOperatorInfo &info, const CompiledNode &property,
+                                 const CompiledNode &operand, bool property_first) {
+    return [&info, lookup = property.property_lookup, position = property.record_position, constant = operand.constant,
+            slot = operand.parameter.value_or(0), property_first](const Runtime &rt) {
+      const auto &other = constant ? *constant : (*rt.parameters)[slot];
+      auto value = ReadRecordProperty(rt, position, lookup->property_);
+      if (value) {
+        if (auto result = CompareProperty<kComparison>(*value, other, property_first)) {
+          return TypedValue(*result, rt.ctx->memory);
+        }
+      }
+      auto value1 = value ? TypedValue(std::move(*value), rt.ctx->memory) : LookupProperty(rt, position, lookup);
+      auto value2 = TypedValue(other, rt.ctx->memory);
+      return property_first ? ApplyBinary(info, value1, value2) : ApplyBinary(info, value2, value1);
+    };
+  }
+
+  const SymbolTable *symbol_table_;
+  std::vector<int32_t> parameter_positions_;
+};
+
+}  // namespace
+
+std::unique_ptr<CompiledExpression> CompiledExpression::Compile(Expression *expression,
+                                                                const SymbolTable &symbol_table) {
+  Compiler compiler(symbol_table);
+  auto compiled = compiler.Compile(expression);
+  if (compiled.interpreted) return nullptr;
+  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+  return std::unique_ptr<CompiledExpression>(
+      new CompiledExpression(std::move(compiled.node), compiler.TakeParameterPositions()));
+}
+
+CompiledExpression::Parameters CompiledExpression::BindParameters(const EvaluationContext &ctx) const {
+  Parameters parameters;
+  parameters.reserve(parameter_positions_.size());
+  for (const auto position : parameter_positions_) {
+    parameters.emplace_back(ctx.parameters.AtTokenPosition(position), ctx.memory);
+  }
+  return parameters;
+}
+
+TypedValue CompiledExpression::Evaluate(ExpressionEvaluator &evaluator, const Parameters &parameters) const {
+  return root_(Runtime{.frame = evaluator.GetFrame(),
+                       .ctx = &evaluator.GetEvaluationContext(),
+                       .evaluator = &evaluator,
+                       .parameters = &parameters});
+}
+
+std::shared_ptr<const CompiledExpression> CompiledExpressionCache::Get(Expression *expression,
+                                                                       const SymbolTable &symbol_table) {
+  if (executions_.fetch_add(1, std::memory_order_acq_rel) + 1 < kExecutionsBeforeCompile) return nullptr;
+  auto guard = std::lock_guard{lock_};
+  if (!compiled_) {
+    expression_ = CompiledExpression::Compile(expression, symbol_table);
+    compiled_ = true;
+  }
+  return expression_;
+}
+
+}  // namespace memgraph::query
@@ -0,0 +1,109 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "query/frontend/ast/ast.hpp"
+#include "query/interpret/frame.hpp"
+#include "query/typed_value.hpp"
+
+namespace memgraph::query {
+
+struct EvaluationContext;
+class ExpressionEvaluator;
+
+/// Expression lowered into a tree of closures, so that evaluating it doesn't
+/// go through the AST visitor for every row.
+///
+/// Identifiers are resolved to frame positions and literal-only subtrees are
+/// folded into constants when the expression is compiled. Parameters are
+/// resolved once per execution by `BindParameters` instead of being looked up
+/// by token position for every row. Comparisons of an own property of a
+/// vertex or an edge with a literal or a parameter read the property without
+/// converting it to a `TypedValue` and compare integers, doubles and strings
+/// directly.
+///
+/// The semantics are the ones of `ExpressionEvaluator`. Expressions which
+/// aren't compiled (e.g. function calls or list comprehensions) are handed to
+/// the evaluator, so any expression can be compiled.
+class CompiledExpression {
+ public:
+  /// Values of the parameters used by the expression, resolved for a single
+  /// execution.
+  using Parameters = std::vector<TypedValue>;
+
+  /// State a node is evaluated with.
+  struct Runtime {
+    Frame *frame;
+    const EvaluationContext *ctx;
+    ExpressionEvaluator *evaluator;
+    const Parameters *parameters;
+  };
+
+  using Node = std::function<TypedValue(const Runtime &)>;
+
+  /// Returns nullptr if no part of `expression` can be compiled, in which case
+  /// it should just be evaluated by the `ExpressionEvaluator`.
+  static std::unique_ptr<CompiledExpression> Compile(Expression *expression, const SymbolTable &symbol_table);
+
+  Parameters BindParameters(const EvaluationContext &ctx) const;
+
+  /// Evaluates the expression on the frame `evaluator` currently points to.
+  /// `parameters` must come from `BindParameters` with the evaluator's context.
+  TypedValue Evaluate(ExpressionEvaluator &evaluator, const Parameters &parameters) const;
+
+ private:
+  CompiledExpression(Node root, std::vector<int32_t> parameter_positions)
+      : root_(std::move(root)), parameter_positions_(std::move(parameter_positions)) {}
+
+  Node root_;
+  // Token positions of the parameters, indexed by their slot in `Parameters`.
+  std::vector<int32_t> parameter_positions_;
+};
+
+/// Compiled form of an expression owned by a logical operator.
+///
+/// Plans are kept in the plan cache and executed many times, possibly
+/// concurrently. The expression is compiled by the first execution which
+/// finds the plan hot and shared by all the later ones, so one-off queries
+/// don't pay for the compilation.
+class CompiledExpressionCache {
+ public:
+  /// Executions of the owning operator before the expression is compiled.
+  static constexpr uint64_t kExecutionsBeforeCompile = 2;
+
+  CompiledExpressionCache() = default;
+  // Copies start empty, they may belong to a plan with another symbol table.
+  CompiledExpressionCache(const CompiledExpressionCache & /*other*/) {}
+  CompiledExpressionCache &operator=(const CompiledExpressionCache & /*other*/) { return *this; }
+  CompiledExpressionCache(CompiledExpressionCache && /*other*/) noexcept {}
+  CompiledExpressionCache &operator=(CompiledExpressionCache && /*other*/) noexcept { return *this; }
+  ~CompiledExpressionCache() = default;
+
+  /// Registers an execution of the owning operator and returns the compiled
+  /// `expression` if it has been executed often enough, nullptr otherwise.
+  std::shared_ptr<const CompiledExpression> Get(Expression *expression, const SymbolTable &symbol_table);
+
+ private:
+  std::atomic<uint64_t> executions_{0};
+  std::mutex lock_;
+  bool compiled_{false};
+  std::shared_ptr<const CompiledExpression> expression_;
+};
+
+}  // namespace memgraph::query
@@ -11,8 +11,98 @@
 
 #include "query/interpret/eval.hpp"
 
+#include <array>
+#include <optional>
+
+#include "utils/on_scope_exit.hpp"
+
 namespace memgraph::query {
 
+namespace {
+
+struct BatchBinaryOperator {
+  const utils::TypeInfo *type;
+  TypedValue (*apply)(const TypedValue &, const TypedValue &);
+  const char *cypher_op;
+};
+
+// Binary operators which are applied to a whole batch with the same semantics
+// as the corresponding ExpressionEvaluator::Visit overloads.
+const std::array<BatchBinaryOperator, 12> kBatchBinaryOperators{{
+    {&XorOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a ^ b; }, "XOR"},
+    {&AdditionOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a + b; }, "+"},
+    {&SubtractionOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a - b; }, "-"},
+    {&MultiplicationOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a * b; }, "*"},
+    {&DivisionOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a / b; }, "/"},
+    {&ModOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a % b; }, "%"},
+    {&NotEqualOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a != b; }, "<>"},
+    {&EqualOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a == b; }, "="},
+    {&LessOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a < b; }, "<"},
+    {&GreaterOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a > b; }, ">"},
+    {&LessEqualOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a <= b; }, "<="},
+    {&GreaterEqualOperator::kType, [](const TypedValue &a, const TypedValue &b) { return a >= b; }, ">="},
+}};
+
+const BatchBinaryOperator *FindBatchBinaryOperator(const Expression &expression) {
+  for (const auto &op : kBatchBinaryOperators) {
+    if (expression.GetTypeInfo() == *op.type) return &op;
+  }
+  return nullptr;
+}
+
+// Literals, parameters and the batch operators applied only to them have the
+// same value on every row.
+bool IsBatchConstant(const Expression *expression) {
+  if (utils::Downcast<const PrimitiveLiteral>(expression) || utils::Downcast<const ParameterLookup>(expression)) {
+    return true;
+  }
+  if (!FindBatchBinaryOperator(*expression)) return false;
+  const auto *binary = utils::Downcast<const BinaryOperator>(expression);
+  return IsBatchConstant(binary->expression1_) && IsBatchConstant(binary->expression2_);
+}
+
+}  // namespace
+
+void ExpressionEvaluator::EvaluateBatch(Expression *expression, FrameBatch &batch,
+                                        utils::pmr::vector<TypedValue> *results) {
+  auto *const original_frame = frame_;
+  utils::OnScopeExit restore_frame{[this, original_frame] { ResetFrame(original_frame); }};
+
+  results->clear();
+  results->reserve(batch.Size());
+
+  const auto *op = FindBatchBinaryOperator(*expression);
+  auto *binary = op ? utils::Downcast<BinaryOperator>(expression) : nullptr;
+  if (binary && (IsBatchConstant(binary->expression1_) || IsBatchConstant(binary->expression2_))) {
+    const bool constant_lhs = IsBatchConstant(binary->expression1_);
+    auto *variable = constant_lhs ? binary->expression2_ : binary->expression1_;
+    auto *constant_expression = constant_lhs ? binary->expression1_ : binary->expression2_;
+    // The constant is evaluated on the first row, in the same order as the
+    // operands of a single row are, so an empty batch raises no errors and the
+    // first error is the same as without batching.
+    std::optional<TypedValue> constant;
+    for (size_t row = 0; row < batch.Size(); ++row) {
+      ResetFrame(&batch[row]);
+      if (constant_lhs && !constant) constant.emplace(constant_expression->Accept(*this));
+      auto value = variable->Accept(*this);
+      if (!constant) constant.emplace(constant_expression->Accept(*this));
+      const auto &lhs = constant_lhs ? *constant : value;
+      const auto &rhs = constant_lhs ? value : *constant;
+      try {
+        results->emplace_back(op->apply(lhs, rhs));
+      } catch (const TypedValueException &) {
+        throw QueryRuntimeException("Invalid types: {} and {} for '{}'.", lhs.type(), rhs.type(), op->cypher_op);
+      }
+    }
+    return;
+  }
+
+  for (size_t row = 0; row < batch.Size(); ++row) {
+    ResetFrame(&batch[row]);
+    results->emplace_back(expression->Accept(*this));
+  }
+}
+
 int64_t EvaluateInt(ExpressionEvaluator *evaluator, Expression *expr, std::string_view what) {
   TypedValue value = expr->Accept(*evaluator);
   try {
@@ -37,6 +37,7 @@
 #include "utils/frame_change_id.hpp"
 #include "utils/logging.hpp"
 #include "utils/pmr/unordered_map.hpp"
+#include "utils/pmr/vector.hpp"
 
 namespace memgraph::query {
 
@@ -192,8 +193,33 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
 
   utils::MemoryResource *GetMemoryResource() const { return ctx_->memory; }
 
+  Frame *GetFrame() const { return frame_; }
+
+  const EvaluationContext &GetEvaluationContext() const { return *ctx_; }
+
+  /// Reads an own property of a vertex or an edge the same way a property
+  /// lookup expression does, including its errors.
+  template <class TRecordAccessor>
+  storage::PropertyValue LookupProperty(const TRecordAccessor &record_accessor, const PropertyIx &prop) {
+    return GetProperty(record_accessor, prop);
+  }
+
   void ResetPropertyLookupCache() { property_lookup_cache_.clear(); }
 
+  /// Points the evaluator to another frame, e.g. the next row of a @c FrameBatch.
+  void ResetFrame(Frame *frame) {
+    frame_ = frame;
+    property_lookup_cache_.clear();
+  }
+
+  /// Evaluates `expression` on every row of `batch` and stores one result per
+  /// row in `results`. When `expression` is a comparison or an arithmetic
+  /// operator with an operand built only from literals and parameters, that
+  /// operand is evaluated only once, on the first row, and the operator is then
+  /// applied in a single loop over the rows. The evaluator is pointed back to
+  /// its original frame afterwards.
+  void EvaluateBatch(Expression *expression, FrameBatch &batch, utils::pmr::vector<TypedValue> *results);
+
   TypedValue Visit(NamedExpression &named_expression) override {
     const auto &symbol = symbol_table_->at(named_expression);
     auto value = named_expression.expression_->Accept(*this);
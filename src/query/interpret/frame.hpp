@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "query/frontend/semantic/symbol_table.hpp"
@@ -42,4 +44,85 @@ class Frame {
   utils::pmr::vector<TypedValue> elems_;
 };
 
+/// A batch of rows produced by @c plan::Cursor::PullBatch.
+///
+/// Every row is a complete frame, so expressions are evaluated on it with the
+/// regular @c ExpressionEvaluator. Row frames are allocated once and reused
+/// between batches. Cursors which still produce one row at a time do so on
+/// @c frame() and the result is then copied into the batch.
+class FrameBatch {
+ public:
+  static constexpr size_t kDefaultCapacity = 1024;
+
+  FrameBatch(int64_t frame_size, size_t capacity, utils::MemoryResource *memory)
+      : frame_(frame_size, memory), limit_(capacity) {
+    MG_ASSERT(capacity > 0);
+    rows_.reserve(capacity);
+    for (size_t i = 0; i < capacity; ++i) {
+      rows_.emplace_back(frame_size, memory);
+    }
+  }
+
+  Frame &operator[](size_t row) { return rows_[row]; }
+  const Frame &operator[](size_t row) const { return rows_[row]; }
+
+  size_t Size() const { return size_; }
+  size_t Capacity() const { return rows_.size(); }
+  bool Empty() const { return size_ == 0; }
+  bool Full() const { return size_ == limit_; }
+
+  /// Makes the batch full once it has `rows` rows, or at its capacity if that
+  /// is smaller, so no more rows than needed are pulled into it.
+  void SetLimit(size_t rows) {
+    MG_ASSERT(rows > 0);
+    limit_ = std::min(rows, rows_.size());
+  }
+
+  /// Frame on which the row-at-a-time cursors below the batched part of the
+  /// pipeline operate.
+  Frame &frame() { return frame_; }
+
+  /// Appends a copy of `frame` to the batch.
+  void PushBack(Frame &frame) {
+    DMG_ASSERT(!Full(), "Pushing into a full FrameBatch");
+    auto &row = rows_[size_++].elems();
+    std::copy(frame.elems().begin(), frame.elems().end(), row.begin());
+  }
+
+  /// Keeps only the rows for which `keep(row)` is true, preserving their order.
+  template <typename TFunc>
+  void KeepIf(TFunc &&keep) {
+    size_t kept = 0;
+    for (size_t row = 0; row < size_; ++row) {
+      if (!keep(row)) continue;
+      if (kept != row) std::swap(rows_[kept], rows_[row]);
+      ++kept;
+    }
+    size_ = kept;
+  }
+
+  /// Drops the rows, but keeps @c frame() and the exhausted flag.
+  void Clear() { size_ = 0; }
+
+  /// Prepares the batch for a new pass over the input, starting from the
+  /// values in `frame`.
+  void Reset(Frame &frame) {
+    size_ = 0;
+    exhausted_ = false;
+    std::copy(frame.elems().begin(), frame.elems().end(), frame_.elems().begin());
+  }
+
+  /// Marks that the row-at-a-time input has been exhausted, so the cursor which
+  /// observed it must not pull from it again until the next @c Reset.
+  void MarkExhausted() { exhausted_ = true; }
+  bool IsExhausted() const { return exhausted_; }
+
+ private:
+  Frame frame_;
+  std::vector<Frame> rows_;
+  size_t limit_;
+  size_t size_{0};
+  bool exhausted_{false};
+};
+
 }  // namespace memgraph::query
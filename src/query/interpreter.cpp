@@ -1769,8 +1769,29 @@ struct PullPlan {
   // we have to keep track of any unsent results from previous `PullPlan::Pull`
   // manually by using this flag.
   bool has_unsent_results_ = false;
+
+  // Rows of read-only plans which scan vertices are pulled in batches, see
+  // CanPullInBatches. The batch lives as long as the plan, so the cursors
+  // below it keep their state between the calls to `Pull`.
+  std::optional<FrameBatch> batch_;
 };
 
+/// Produce on top of a scan, optionally followed by expands and filters, is
+/// pulled in batches, which those operators process without a virtual call per
+/// row. Only plans which don't write are batched, because the rows of a batch
+/// are read before any of them is returned.
+bool CanPullInBatches(const plan::LogicalOperator &root) {
+  if (root.GetTypeInfo() != plan::Produce::kType) return false;
+  auto rw_type_checker = plan::ReadWriteTypeChecker();
+  rw_type_checker.InferRWType(const_cast<plan::LogicalOperator &>(root));
+  if (rw_type_checker.type != plan::ReadWriteTypeChecker::RWType::R) return false;
+  const auto *op = static_cast<const plan::Produce &>(root).input().get();
+  while (op->GetTypeInfo() == plan::Filter::kType || op->GetTypeInfo() == plan::Expand::kType) {
+    op = op->input().get();
+  }
+  return utils::IsSubtype(*op, plan::ScanAll::kType);
+}
+
 PullPlan::PullPlan(const std::shared_ptr<PlanWrapper> plan, const Parameters &parameters, const bool is_profile_query,
                    DbAccessor *dba, InterpreterContext *interpreter_context, utils::MemoryResource *execution_memory,
                    std::shared_ptr<QueryUserOrRole> user_or_role, std::atomic<TransactionStatus> *transaction_status,
@@ -1806,6 +1827,11 @@ PullPlan::PullPlan(const std::shared_ptr<PlanWrapper> plan, const Parameters &pa
   ctx_.trigger_context_collector = trigger_context_collector;
   ctx_.frame_change_collector = frame_change_collector;
   ctx_.evaluation_context.memory = execution_memory;
+  // PROFILE gathers its statistics per pulled row.
+  if (!is_profile_query && CanPullInBatches(plan->plan())) {
+    batch_.emplace(plan->symbol_table().max_position(), FrameBatch::kDefaultCapacity, execution_memory);
+    batch_->Reset(frame_);
+  }
 }
 
 std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *stream, std::optional<int> n,
@@ -1850,21 +1876,55 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
     ++i;
   }
 
-  for (; !n || i < n; ++i) {
-    if (!pull_result()) {
-      break;
+  if (batch_) {
+    // The batch is limited to the rows which are still requested and the one
+    // after them, so no more rows are evaluated than when pulling one by one.
+    // That extra row is left in the frame, same as below.
+    has_unsent_results_ = false;
+    bool exhausted = false;
+    while (!exhausted && (!n || i < n)) {
+      batch_->SetLimit(n ? static_cast<size_t>(*n - i) + 1 : FrameBatch::kDefaultCapacity);
+      exhausted = !cursor_->PullBatch(*batch_, ctx_);
+      for (size_t row = 0; row < batch_->Size(); ++row) {
+        auto &row_frame = (*batch_)[row];
+        if (n && i == *n) {
+          std::copy(row_frame.elems().begin(), row_frame.elems().end(), frame_.elems().begin());
+          has_unsent_results_ = true;
+          break;
+        }
+        if (!output_symbols.empty()) {
+          for (auto const j : ranges::views::iota(0UL, output_symbols.size())) {
+            values[j] = row_frame[output_symbols[j]];
+          }
+          stream->Result(values);
+        }
+        ++i;
+      }
     }
+    if (!has_unsent_results_ && i == n) {
+      batch_->SetLimit(1);
+      if (cursor_->PullBatch(*batch_, ctx_)) {
+        std::copy((*batch_)[0].elems().begin(), (*batch_)[0].elems().end(), frame_.elems().begin());
+        has_unsent_results_ = true;
+      }
+    }
+  } else {
+    for (; !n || i < n; ++i) {
+      if (!pull_result()) {
+        break;
+      }
 
-    if (!output_symbols.empty()) {
-      stream_values();
+      if (!output_symbols.empty()) {
+        stream_values();
+      }
     }
-  }
 
-  // If we finished because we streamed the requested n results,
-  // we try to pull the next result to see if there is more.
-  // If there is additional result, we leave the pulled result in the frame
-  // and set the flag to true.
-  has_unsent_results_ = i == n && pull_result();
+    // If we finished because we streamed the requested n results,
+    // we try to pull the next result to see if there is more.
+    // If there is additional result, we leave the pulled result in the frame
+    // and set the flag to true.
+    has_unsent_results_ = i == n && pull_result();
+  }
 
   execution_time_ += timer.Elapsed();
 
@@ -2379,6 +2439,7 @@ std::vector<std::vector<TypedValue>> AnalyzeGraphQueryHandler::AnalyzeGraphCreat
                                                .statistic = chi_squared_stat,
                                                .avg_group_size = avg_group_size,
                                                .avg_degree = average_degree};
+          storage::SetValueDistribution(index_stats, values_map);
           execution_db_accessor->SetIndexStats(label_property.first, label_property.second, index_stats);
           label_property_stats.push_back(std::make_pair(label_property, index_stats));
         });
@@ -2386,6 +2447,8 @@ std::vector<std::vector<TypedValue>> AnalyzeGraphQueryHandler::AnalyzeGraphCreat
     return label_property_stats;
   };
 
+  // Composite label+properties indices get no statistics, the planner estimates their prefix scans by counting the
+  // matching entries in the index itself.
   auto index_info = execution_db_accessor->ListAllIndices();
 
   std::vector<storage::LabelId> label_indices_info = index_info.label;
@@ -2576,8 +2639,20 @@ PreparedQuery PrepareAnalyzeGraphQuery(ParsedQuery parsed_query, bool in_explici
                        RWType::NONE};
 }
 
+// Whether the index of a CREATE INDEX query is built online, before the query
+// takes unique access to the storage which then only makes the index visible.
+bool BuildsIndexOnline(IndexQuery *index_query, CurrentDB &current_db) {
+  return index_query->action_ == IndexQuery::Action::CREATE && index_query->properties_.size() <= 1 &&
+         (*current_db.db_acc_)->storage()->BuildsIndexOnline();
+}
+
+// When `build_online` is set, the query has no DB transaction yet. The index is
+// then built when the query is executed, after it was authorized, and only
+// afterwards the transaction with `isolation_level_override` takes unique
+// access to the storage.
 PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_transaction,
-                                std::vector<Notification> *notifications, CurrentDB &current_db) {
+                                std::vector<Notification> *notifications, CurrentDB &current_db, bool build_online,
+                                std::optional<storage::IsolationLevel> isolation_level_override) {
   if (in_explicit_transaction) {
     throw IndexInMulticommandTxException();
   }
@@ -2589,8 +2664,7 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
   MG_ASSERT(current_db.db_acc_, "Index query expects a current DB");
   auto &db_acc = *current_db.db_acc_;
 
-  MG_ASSERT(current_db.db_transactional_accessor_, "Index query expects a current DB transaction");
-  auto *dba = &*current_db.execution_db_accessor_;
+  MG_ASSERT(build_online || current_db.db_transactional_accessor_, "Index query expects a current DB transaction");
 
   // Creating an index influences computed plan costs.
   auto invalidate_plan_cache = [plan_cache = db_acc->plan_cache()] {
@@ -2610,10 +2684,6 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
   }
   auto properties_stringified = utils::Join(properties_string, ", ");
 
-  if (properties.size() > 1) {
-    throw utils::NotYetImplemented("index on multiple properties");
-  }
-
   Notification index_notification(SeverityLevel::INFO);
   switch (index_query->action_) {
     case IndexQuery::Action::CREATE: {
@@ -2622,11 +2692,26 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
           fmt::format("Created index on label {} on properties {}.", index_query->label_.name, properties_stringified);
 
       // TODO: not just storage + invalidate_plan_cache. Need a DB transaction (for replication)
-      handler = [dba, label, properties_stringified = std::move(properties_stringified),
-                 label_name = index_query->label_.name, properties = std::move(properties),
+      handler = [&current_db, build_online, isolation_level_override, storage, label,
+                 properties_stringified = std::move(properties_stringified), label_name = index_query->label_.name,
+                 properties = std::move(properties),
                  invalidate_plan_cache = std::move(invalidate_plan_cache)](Notification &index_notification) {
-        MG_ASSERT(properties.size() <= 1U);
-        auto maybe_index_error = properties.empty() ? dba->CreateIndex(label) : dba->CreateIndex(label, properties[0]);
+        if (build_online) {
+          std::optional<storage::PropertyId> property;
+          if (!properties.empty()) property = properties[0];
+          storage->BuildIndexOnline(replication_coordination_glue::ReplicationRole::MAIN, label, property);
+          // Until the transaction below creates it, the built index is only
+          // registered and has to be dropped if the query fails.
+          utils::OnScopeExit abort_build{[&] { storage->AbortIndexOnline(label, property); }};
+          current_db.SetupDatabaseTransaction(isolation_level_override, false, true);
+          abort_build.Disable();
+        }
+        auto *dba = &*current_db.execution_db_accessor_;
+        auto maybe_index_error = [&] {
+          // Indices on multiple properties are composite indices.
+          if (properties.size() > 1) return dba->CreateIndex(label, properties);
+          return properties.empty() ? dba->CreateIndex(label) : dba->CreateIndex(label, properties[0]);
+        }();
         utils::OnScopeExit invalidator(invalidate_plan_cache);
 
         if (maybe_index_error.HasError()) {
@@ -2643,11 +2728,14 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
       index_notification.title = fmt::format("Dropped index on label {} on properties {}.", index_query->label_.name,
                                              utils::Join(properties_string, ", "));
       // TODO: not just storage + invalidate_plan_cache. Need a DB transaction (for replication)
-      handler = [dba, label, properties_stringified = std::move(properties_stringified),
-                 label_name = index_query->label_.name, properties = std::move(properties),
+      handler = [dba = &*current_db.execution_db_accessor_, label,
+                 properties_stringified = std::move(properties_stringified), label_name = index_query->label_.name,
+                 properties = std::move(properties),
                  invalidate_plan_cache = std::move(invalidate_plan_cache)](Notification &index_notification) {
-        MG_ASSERT(properties.size() <= 1U);
-        auto maybe_index_error = properties.empty() ? dba->DropIndex(label) : dba->DropIndex(label, properties[0]);
+        auto maybe_index_error = [&] {
+          if (properties.size() > 1) return dba->DropIndex(label, properties);
+          return properties.empty() ? dba->DropIndex(label) : dba->DropIndex(label, properties[0]);
+        }();
         utils::OnScopeExit invalidator(invalidate_plan_cache);
 
         if (maybe_index_error.HasError()) {
@@ -2693,36 +2781,43 @@ PreparedQuery PrepareEdgeIndexQuery(ParsedQuery parsed_query, bool in_explicit_t
 
   auto *storage = db_acc->storage();
   auto edge_type = storage->NameToEdgeType(index_query->edge_type_.name);
+  std::optional<storage::PropertyId> property;
+  auto index_name = fmt::format("edge-type {}", index_query->edge_type_.name);
+  if (!index_query->properties_.empty()) {
+    MG_ASSERT(index_query->properties_.size() == 1, "Edge index can be created on a single property");
+    property = storage->NameToProperty(index_query->properties_[0].name);
+    index_name += fmt::format(" on property {}", index_query->properties_[0].name);
+  }
 
   Notification index_notification(SeverityLevel::INFO);
   switch (index_query->action_) {
     case EdgeIndexQuery::Action::CREATE: {
       index_notification.code = NotificationCode::CREATE_INDEX;
-      index_notification.title = fmt::format("Created index on edge-type {}.", index_query->edge_type_.name);
+      index_notification.title = fmt::format("Created index on {}.", index_name);
 
-      handler = [dba, edge_type, label_name = index_query->edge_type_.name,
+      handler = [dba, edge_type, property, index_name,
                  invalidate_plan_cache = std::move(invalidate_plan_cache)](Notification &index_notification) {
-        auto maybe_index_error = dba->CreateIndex(edge_type);
+        auto maybe_index_error = property ? dba->CreateIndex(edge_type, *property) : dba->CreateIndex(edge_type);
         utils::OnScopeExit invalidator(invalidate_plan_cache);
 
         if (maybe_index_error.HasError()) {
           index_notification.code = NotificationCode::EXISTENT_INDEX;
-          index_notification.title = fmt::format("Index on edge-type {} already exists.", label_name);
+          index_notification.title = fmt::format("Index on {} already exists.", index_name);
         }
       };
       break;
     }
     case EdgeIndexQuery::Action::DROP: {
       index_notification.code = NotificationCode::DROP_INDEX;
-      index_notification.title = fmt::format("Dropped index on edge-type {}.", index_query->edge_type_.name);
-      handler = [dba, edge_type, label_name = index_query->edge_type_.name,
+      index_notification.title = fmt::format("Dropped index on {}.", index_name);
+      handler = [dba, edge_type, property, index_name,
                  invalidate_plan_cache = std::move(invalidate_plan_cache)](Notification &index_notification) {
-        auto maybe_index_error = dba->DropIndex(edge_type);
+        auto maybe_index_error = property ? dba->DropIndex(edge_type, *property) : dba->DropIndex(edge_type);
         utils::OnScopeExit invalidator(invalidate_plan_cache);
 
         if (maybe_index_error.HasError()) {
           index_notification.code = NotificationCode::NONEXISTENT_INDEX;
-          index_notification.title = fmt::format("Index on edge-type {} doesn't exist.", label_name);
+          index_notification.title = fmt::format("Index on {} doesn't exist.", index_name);
         }
       };
       break;
@@ -3614,12 +3709,17 @@ PreparedQuery PrepareDatabaseInfoQuery(ParsedQuery parsed_query, bool in_explici
         auto *storage = database->storage();
         const std::string_view label_index_mark{"label"};
         const std::string_view label_property_index_mark{"label+property"};
+        const std::string_view label_properties_index_mark{"label+properties"};
+        const std::string_view label_property_hash_index_mark{"label+property (hash)"};
         const std::string_view edge_type_index_mark{"edge-type"};
+        const std::string_view edge_type_property_index_mark{"edge-type+property"};
         const std::string_view text_index_mark{"text"};
         auto info = dba->ListAllIndices();
         auto storage_acc = database->Access();
         std::vector<std::vector<TypedValue>> results;
-        results.reserve(info.label.size() + info.label_property.size() + info.text_indices.size());
+        results.reserve(info.label.size() + info.label_property.size() + info.text_indices.size() +
+                        info.label_properties.size() + info.label_property_hash.size() + info.edge_type.size() +
+                        info.edge_type_property.size());
         for (const auto &item : info.label) {
           results.push_back({TypedValue(label_index_mark), TypedValue(storage->LabelToName(item)), TypedValue(),
                              TypedValue(static_cast<int>(storage_acc->ApproximateVertexCount(item)))});
@@ -3630,10 +3730,30 @@ PreparedQuery PrepareDatabaseInfoQuery(ParsedQuery parsed_query, bool in_explici
                TypedValue(storage->PropertyToName(item.second)),
                TypedValue(static_cast<int>(storage_acc->ApproximateVertexCount(item.first, item.second)))});
         }
+        for (const auto &[label, property] : info.label_property_hash) {
+          results.push_back({TypedValue(label_property_hash_index_mark), TypedValue(storage->LabelToName(label)),
+                             TypedValue(storage->PropertyToName(property)), TypedValue()});
+        }
+        for (const auto &[label, properties] : info.label_properties) {
+          std::vector<TypedValue> property_names;
+          property_names.reserve(properties.size());
+          for (const auto &property : properties) {
+            property_names.emplace_back(storage->PropertyToName(property));
+          }
+          results.push_back({TypedValue(label_properties_index_mark), TypedValue(storage->LabelToName(label)),
+                             TypedValue(std::move(property_names)),
+                             TypedValue(static_cast<int>(storage_acc->ApproximateVertexCount(label, properties, {})))});
+        }
         for (const auto &item : info.edge_type) {
           results.push_back({TypedValue(edge_type_index_mark), TypedValue(storage->EdgeTypeToName(item)), TypedValue(),
                              TypedValue(static_cast<int>(storage_acc->ApproximateEdgeCount(item)))});
         }
+        for (const auto &[edge_type, property] : info.edge_type_property) {
+          results.push_back(
+              {TypedValue(edge_type_property_index_mark), TypedValue(storage->EdgeTypeToName(edge_type)),
+               TypedValue(storage->PropertyToName(property)),
+               TypedValue(static_cast<int>(storage_acc->ApproximateEdgeCount(edge_type, property)))});
+        }
         for (const auto &[index_name, label] : info.text_indices) {
           results.push_back({TypedValue(fmt::format("{} (name: {})", text_index_mark, index_name)),
                              TypedValue(storage->LabelToName(label)), TypedValue(), TypedValue()});
@@ -3652,6 +3772,13 @@ PreparedQuery PrepareDatabaseInfoQuery(ParsedQuery parsed_query, bool in_explici
             return label_1 < label_2;
           }
 
+          if (record_1[2].IsList()) {
+            const auto &properties_1 = record_1[2].ValueList();
+            const auto &properties_2 = record_2[2].ValueList();
+            return std::lexicographical_compare(
+                properties_1.begin(), properties_1.end(), properties_2.begin(), properties_2.end(),
+                [](const auto &lhs, const auto &rhs) { return lhs.ValueString() < rhs.ValueString(); });
+          }
           return record_1[2].ValueString() < record_2[2].ValueString();
         });
 
@@ -4424,6 +4551,8 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
         utils::Downcast<TextIndexQuery>(parsed_query.query) || utils::Downcast<DatabaseInfoQuery>(parsed_query.query) ||
         utils::Downcast<ConstraintQuery>(parsed_query.query);
 
+    bool build_index_online = false;
+    std::optional<storage::IsolationLevel> index_isolation_level_override;
     if (!in_explicit_transaction_ && requires_db_transaction) {
       // TODO: ATM only a single database, will change when we have multiple database transactions
       bool could_commit = utils::Downcast<CypherQuery>(parsed_query.query) != nullptr;
@@ -4432,7 +4561,15 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
                     utils::Downcast<TextIndexQuery>(parsed_query.query) != nullptr ||
                     utils::Downcast<ConstraintQuery>(parsed_query.query) != nullptr ||
                     upper_case_query.find(kSchemaAssert) != std::string::npos;
-      SetupDatabaseTransaction(could_commit, unique);
+      // An index built online takes unique access to the storage only when
+      // the query is executed, after it was authorized.
+      if (auto *index_query = utils::Downcast<IndexQuery>(parsed_query.query);
+          index_query && interpreter_context_->repl_state->IsMain() && BuildsIndexOnline(index_query, current_db_)) {
+        build_index_online = true;
+        index_isolation_level_override = GetIsolationLevelOverride();
+      } else {
+        SetupDatabaseTransaction(could_commit, unique);
+      }
     }
 
 #ifdef MG_ENTERPRISE
@@ -4462,8 +4599,9 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
     } else if (utils::Downcast<DumpQuery>(parsed_query.query)) {
       prepared_query = PrepareDumpQuery(std::move(parsed_query), current_db_);
     } else if (utils::Downcast<IndexQuery>(parsed_query.query)) {
-      prepared_query = PrepareIndexQuery(std::move(parsed_query), in_explicit_transaction_,
-                                         &query_execution->notifications, current_db_);
+      prepared_query =
+          PrepareIndexQuery(std::move(parsed_query), in_explicit_transaction_, &query_execution->notifications,
+                            current_db_, build_index_online, index_isolation_level_override);
     } else if (utils::Downcast<EdgeIndexQuery>(parsed_query.query)) {
       prepared_query = PrepareEdgeIndexQuery(std::move(parsed_query), in_explicit_transaction_,
                                              &query_execution->notifications, current_db_);
@@ -16,6 +16,7 @@
 #include "query/plan/operator.hpp"
 #include "query/plan/rewrite/index_lookup.hpp"
 #include "query/typed_value.hpp"
+#include "storage/v2/indices/label_property_index_stats.hpp"
 #include "utils/algorithm.hpp"
 #include "utils/math.hpp"
 
@@ -90,10 +91,12 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     static constexpr double MakeScanAllByLabelPropertyValue{1.1};
     static constexpr double MakeScanAllByLabelPropertyRange{1.1};
     static constexpr double MakeScanAllByLabelProperty{1.1};
+    static constexpr double MakeScanAllByLabelProperties{1.1};
     static constexpr double kExpand{2.0};
     static constexpr double kExpandVariable{3.0};
     static constexpr double kFilter{1.5};
     static constexpr double kEdgeUniquenessFilter{1.5};
+    static constexpr double kHashJoin{1.5};
     static constexpr double kUnwind{1.3};
     static constexpr double kForeach{1.0};
     static constexpr double kUnion{1.0};
@@ -156,12 +159,17 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
 
     auto property_value = ConstPropertyValue(logical_op.expression_);
     double factor = 1.0;
-    if (property_value)
+    if (HasValueDistribution(index_stats)) {
+      // ANALYZE GRAPH knows the most common values, which the value index
+      // estimates poorly, and how many vertices share any other value
+      factor = property_value ? storage::EstimateValueCount(*index_stats, *property_value) : index_stats->avg_group_size;
+    } else if (property_value) {
       // get the exact influence based on ScanAll(label, property, value)
       factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.property_, property_value.value());
-    else
+    } else {
       // estimate the influence as ScanAll(label, property) * filtering
       factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.property_) * CardParam::kFilter;
+    }
 
     cardinality_ *= factor;
 
@@ -185,8 +193,16 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     auto lower = BoundToPropertyValue(logical_op.lower_bound_);
     auto upper = BoundToPropertyValue(logical_op.upper_bound_);
 
-    int64_t factor = 1;
-    if (upper || lower)
+    // the histogram from ANALYZE GRAPH is used for numeric bounds
+    std::optional<double> histogram_factor;
+    if ((upper || lower) && HasValueDistribution(index_stats)) {
+      histogram_factor = storage::EstimateRangeCount(*index_stats, lower, upper);
+    }
+
+    double factor = 1;
+    if (histogram_factor)
+      factor = *histogram_factor;
+    else if (upper || lower)
       // if we have either Bound<PropertyValue>, use the value index
       factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.property_, lower, upper);
     else
@@ -224,6 +240,26 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PostVisit(ScanAllByLabelProperties &logical_op) override {
+    // the index estimates the count for the longest constant prefix, the
+    // filtering constant is applied for each value which isn't a constant
+    std::vector<storage::PropertyValue> prefix;
+    for (auto *expression : logical_op.prefix_expressions_) {
+      auto property_value = ConstPropertyValue(expression);
+      if (!property_value) break;
+      prefix.push_back(std::move(*property_value));
+    }
+    double factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.properties_, prefix);
+    for (auto i = prefix.size(); i < logical_op.prefix_expressions_.size(); ++i) factor *= CardParam::kFilter;
+    if (logical_op.lower_bound_ || logical_op.upper_bound_) factor *= CardParam::kFilter;
+
+    cardinality_ *= factor;
+
+    // ScanAll performs some work for every element that is produced
+    IncrementCost(CostParam::MakeScanAllByLabelProperties);
+    return true;
+  }
+
   // TODO: Cost estimate ScanAllById?
 
   bool PostVisit(Expand &expand) override {
@@ -378,13 +414,16 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     // Get the cost of the main branch
     op.left_op_->Accept(*this);
 
-    // add cost from the right branch and multiply cardinalities
+    // The right branch is pulled and hashed once, unlike the sub branch of an
+    // IndexedJoin, and every row of the main branch probes the hash table
     CostEstimation right_cost_estimation = EstimateCostOnBranch(&op.right_op_);
-    IncrementCost(right_cost_estimation.cost);
+    cost_ += right_cost_estimation.cost + CostParam::kHashJoin * right_cost_estimation.cardinality;
+    IncrementCost(CostParam::kHashJoin);
 
+    // the join condition filters the pairs as the Filter it replaced would
     double right_cardinality =
         !utils::ApproxEqualDecimal(right_cost_estimation.cardinality, 0.0) ? right_cost_estimation.cardinality : 1;
-    cardinality_ *= right_cardinality;
+    cardinality_ *= right_cardinality * CardParam::kFilter;
 
     return false;
   }
@@ -454,6 +493,10 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     return std::nullopt;
   }
 
+  static bool HasValueDistribution(const std::optional<storage::LabelPropertyIndexStats> &index_stats) {
+    return index_stats && storage::HasValueDistribution(*index_stats);
+  }
+
   bool HasStatsFor(const Symbol &symbol) const { return utils::Contains(scopes_.back().symbol_stats, symbol.name()); }
 
   std::optional<SymbolStatistics> GetStatsFor(const Symbol &symbol) {
@@ -111,12 +111,21 @@ class PlanHintsProvider final : public HierarchicalLogicalOperatorVisitor {
   bool PreVisit(ScanAllByLabelProperty & /*unused*/) override { return true; }
   bool PostVisit(ScanAllByLabelProperty & /*unused*/) override { return true; }
 
+  bool PreVisit(ScanAllByLabelProperties & /*unused*/) override { return true; }
+  bool PostVisit(ScanAllByLabelProperties & /*unused*/) override { return true; }
+
   bool PreVisit(ScanAllById & /*unused*/) override { return true; }
   bool PostVisit(ScanAllById & /*unused*/) override { return true; }
 
   bool PreVisit(ScanAllByEdgeType & /*unused*/) override { return true; }
   bool PostVisit(ScanAllByEdgeType & /*unused*/) override { return true; }
 
+  bool PreVisit(ScanAllByEdgeTypePropertyValue & /*unused*/) override { return true; }
+  bool PostVisit(ScanAllByEdgeTypePropertyValue & /*unused*/) override { return true; }
+
+  bool PreVisit(ScanAllByEdgeTypePropertyRange & /*unused*/) override { return true; }
+  bool PostVisit(ScanAllByEdgeTypePropertyRange & /*unused*/) override { return true; }
+
   bool PreVisit(ConstructNamedPath & /*unused*/) override { return true; }
   bool PostVisit(ConstructNamedPath & /*unused*/) override { return true; }
 
@@ -162,6 +171,9 @@ class PlanHintsProvider final : public HierarchicalLogicalOperatorVisitor {
   bool PreVisit(OrderBy & /*unused*/) override { return true; }
   bool PostVisit(OrderBy & /*unused*/) override { return true; }
 
+  bool PreVisit(TopK & /*unused*/) override { return true; }
+  bool PostVisit(TopK & /*unused*/) override { return true; }
+
   bool PreVisit(Unwind & /*unused*/) override { return true; }
   bool PostVisit(Unwind & /*unused*/) override { return true; }
 
@@ -12,13 +12,16 @@
 #include "query/plan/operator.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cstdint>
+#include <exception>
 #include <limits>
 #include <optional>
 #include <queue>
 #include <random>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
@@ -33,6 +36,7 @@
 
 #include "csv/parsing.hpp"
 #include "flags/experimental.hpp"
+#include "flags/query.hpp"
 #include "license/license.hpp"
 #include "query/auth_checker.hpp"
 #include "query/context.hpp"
@@ -43,7 +47,9 @@
 #include "query/graph.hpp"
 #include "query/interpret/eval.hpp"
 #include "query/path.hpp"
+#include "query/plan/read_write_type_checker.hpp"
 #include "query/plan/scoped_profile.hpp"
+#include "query/plan/spill.hpp"
 #include "query/procedure/cypher_types.hpp"
 #include "query/procedure/mg_procedure_impl.hpp"
 #include "query/procedure/module.hpp"
@@ -70,8 +76,10 @@
 #include "utils/pmr/vector.hpp"
 #include "utils/readable_size.hpp"
 #include "utils/string.hpp"
+#include "utils/synchronized.hpp"
 #include "utils/tag.hpp"
 #include "utils/temporal.hpp"
+#include "utils/thread_pool.hpp"
 #include "utils/typeinfo.hpp"
 
 // macro for the default implementation of LogicalOperator::Accept
@@ -108,8 +116,11 @@ extern const Event ScanAllByLabelOperator;
 extern const Event ScanAllByLabelPropertyRangeOperator;
 extern const Event ScanAllByLabelPropertyValueOperator;
 extern const Event ScanAllByLabelPropertyOperator;
+extern const Event ScanAllByLabelPropertiesOperator;
 extern const Event ScanAllByIdOperator;
 extern const Event ScanAllByEdgeTypeOperator;
+extern const Event ScanAllByEdgeTypePropertyValueOperator;
+extern const Event ScanAllByEdgeTypePropertyRangeOperator;
 extern const Event ExpandOperator;
 extern const Event ExpandVariableOperator;
 extern const Event ConstructNamedPathOperator;
@@ -127,6 +138,7 @@ extern const Event AggregateOperator;
 extern const Event SkipOperator;
 extern const Event LimitOperator;
 extern const Event OrderByOperator;
+extern const Event TopKOperator;
 extern const Event MergeOperator;
 extern const Event OptionalOperator;
 extern const Event UnwindOperator;
@@ -161,10 +173,9 @@ struct TypedValueVectorEqual {
   }
 };
 
-// Returns boolean result of evaluating filter expression. Null is treated as
+// Returns boolean result of an evaluated filter expression. Null is treated as
 // false. Other non boolean values raise a QueryRuntimeException.
-bool EvaluateFilter(ExpressionEvaluator &evaluator, Expression *filter) {
-  TypedValue result = filter->Accept(evaluator);
+bool IsFilterSatisfied(const TypedValue &result) {
   // Null is treated like false.
   if (result.IsNull()) return false;
   if (result.type() != TypedValue::Type::Bool)
@@ -172,6 +183,12 @@ bool EvaluateFilter(ExpressionEvaluator &evaluator, Expression *filter) {
   return result.ValueBool();
 }
 
+// Returns boolean result of evaluating filter expression. Null is treated as
+// false. Other non boolean values raise a QueryRuntimeException.
+bool EvaluateFilter(ExpressionEvaluator &evaluator, Expression *filter) {
+  return IsFilterSatisfied(filter->Accept(evaluator));
+}
+
 template <typename T>
 uint64_t ComputeProfilingKey(const T *obj) {
   static_assert(sizeof(T *) == sizeof(uint64_t));
@@ -182,6 +199,23 @@ inline void AbortCheck(ExecutionContext const &context) {
   if (auto const reason = MustAbort(context); reason != AbortReason::NO_ABORT) throw HintedAbortError(reason);
 }
 
+// Fills the batch with the rows `pull_next` produces one at a time on
+// FrameBatch::frame, marking the batch exhausted once `pull_next` fails.
+template <typename TPullNext>
+bool FillBatch(FrameBatch &batch, TPullNext &&pull_next) {
+  batch.Clear();
+  if (batch.IsExhausted()) return false;
+  auto &frame = batch.frame();
+  while (!batch.Full()) {
+    if (!pull_next(frame)) {
+      batch.MarkExhausted();
+      break;
+    }
+    batch.PushBack(frame);
+  }
+  return !batch.Empty();
+}
+
 std::vector<storage::LabelId> EvaluateLabels(const std::vector<StorageLabelType> &labels,
                                              ExpressionEvaluator &evaluator, DbAccessor *dba) {
   std::vector<storage::LabelId> result;
@@ -203,6 +237,10 @@ std::vector<storage::LabelId> EvaluateLabels(const std::vector<StorageLabelType>
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define SCOPED_PROFILE_OP_BY_REF(ref) ScopedProfile profile{ComputeProfilingKey(this), ref, &context};
 
+bool Cursor::PullBatch(FrameBatch &batch, ExecutionContext &context) {
+  return FillBatch(batch, [&](Frame &frame) { return Pull(frame, context); });
+}
+
 bool Once::OnceCursor::Pull(Frame &, ExecutionContext &context) {
   OOMExceptionEnabler oom_exception;
   SCOPED_PROFILE_OP("Once");
@@ -483,6 +521,18 @@ class ScanAllCursor : public Cursor {
 
     AbortCheck(context);
 
+    return PullNext(frame, context);
+  }
+
+  bool PullBatch(FrameBatch &batch, ExecutionContext &context) override {
+    OOMExceptionEnabler oom_exception;
+
+    AbortCheck(context);
+
+    return FillBatch(batch, [&](Frame &frame) { return PullNext(frame, context); });
+  }
+
+  bool PullNext(Frame &frame, ExecutionContext &context) {
     while (!vertices_ || vertices_it_.value() == vertices_end_it_.value()) {
       if (!input_cursor_->Pull(frame, context)) return false;
       // We need a getter function, because in case of exhausting a lazy
@@ -664,6 +714,39 @@ std::vector<Symbol> ScanAllByEdgeType::ModifiedSymbols(const SymbolTable &table)
 // TODO(buda): Implement ScanAllByLabelProperty operator to iterate over
 // vertices that have the label and some value for the given property.
 
+namespace {
+
+std::optional<utils::Bound<storage::PropertyValue>> EvaluateBound(
+    ExpressionEvaluator &evaluator, const std::optional<utils::Bound<Expression *>> &bound) {
+  if (!bound) return std::nullopt;
+  const auto &value = bound->value()->Accept(evaluator);
+  try {
+    const auto &property_value = storage::PropertyValue(value);
+    switch (property_value.type()) {
+      case storage::PropertyValue::Type::Bool:
+      case storage::PropertyValue::Type::List:
+      case storage::PropertyValue::Type::Map:
+        // Prevent indexed lookup with something that would fail if we did
+        // the original filter with `operator<`. Note, for some reason,
+        // Cypher does not support comparing boolean values.
+        throw QueryRuntimeException("Invalid type {} for '<'.", value.type());
+      case storage::PropertyValue::Type::Null:
+      case storage::PropertyValue::Type::Int:
+      case storage::PropertyValue::Type::Double:
+      case storage::PropertyValue::Type::String:
+      case storage::PropertyValue::Type::TemporalData:
+        // These are all fine, there's also Point, Date and Time data types
+        // which were added to Cypher, but we don't have support for those
+        // yet.
+        return std::make_optional(utils::Bound<storage::PropertyValue>(property_value, bound->type()));
+    }
+  } catch (const TypedValueException &) {
+    throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
+  }
+}
+
+}  // namespace
+
 ScanAllByLabelPropertyRange::ScanAllByLabelPropertyRange(const std::shared_ptr<LogicalOperator> &input,
                                                          Symbol output_symbol, storage::LabelId label,
                                                          storage::PropertyId property, std::string property_name,
@@ -687,35 +770,8 @@ UniqueCursorPtr ScanAllByLabelPropertyRange::MakeCursor(utils::MemoryResource *m
       -> std::optional<decltype(context.db_accessor->Vertices(view_, label_, property_, std::nullopt, std::nullopt))> {
     auto *db = context.db_accessor;
     ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor, view_);
-    auto convert = [&evaluator](const auto &bound) -> std::optional<utils::Bound<storage::PropertyValue>> {
-      if (!bound) return std::nullopt;
-      const auto &value = bound->value()->Accept(evaluator);
-      try {
-        const auto &property_value = storage::PropertyValue(value);
-        switch (property_value.type()) {
-          case storage::PropertyValue::Type::Bool:
-          case storage::PropertyValue::Type::List:
-          case storage::PropertyValue::Type::Map:
-            // Prevent indexed lookup with something that would fail if we did
-            // the original filter with `operator<`. Note, for some reason,
-            // Cypher does not support comparing boolean values.
-            throw QueryRuntimeException("Invalid type {} for '<'.", value.type());
-          case storage::PropertyValue::Type::Null:
-          case storage::PropertyValue::Type::Int:
-          case storage::PropertyValue::Type::Double:
-          case storage::PropertyValue::Type::String:
-          case storage::PropertyValue::Type::TemporalData:
-            // These are all fine, there's also Point, Date and Time data types
-            // which were added to Cypher, but we don't have support for those
-            // yet.
-            return std::make_optional(utils::Bound<storage::PropertyValue>(property_value, bound->type()));
-        }
-      } catch (const TypedValueException &) {
-        throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
-      }
-    };
-    auto maybe_lower = convert(lower_bound_);
-    auto maybe_upper = convert(upper_bound_);
+    auto maybe_lower = EvaluateBound(evaluator, lower_bound_);
+    auto maybe_upper = EvaluateBound(evaluator, upper_bound_);
     // If any bound is null, then the comparison would result in nulls. This
     // is treated as not satisfying the filter, so return no vertices.
     if (maybe_lower && maybe_lower->value().IsNull()) return std::nullopt;
@@ -758,6 +814,71 @@ UniqueCursorPtr ScanAllByLabelPropertyValue::MakeCursor(utils::MemoryResource *m
       mem, *this, output_symbol_, input_->MakeCursor(mem), view_, std::move(vertices), "ScanAllByLabelPropertyValue");
 }
 
+ScanAllByEdgeTypePropertyValue::ScanAllByEdgeTypePropertyValue(const std::shared_ptr<LogicalOperator> &input,
+                                                               Symbol output_symbol, storage::EdgeTypeId edge_type,
+                                                               storage::PropertyId property, std::string property_name,
+                                                               Expression *expression, storage::View view)
+    : ScanAllByEdgeType(input, std::move(output_symbol), edge_type, view),
+      property_(property),
+      property_name_(std::move(property_name)),
+      expression_(expression) {
+  DMG_ASSERT(expression, "Expression is not optional.");
+}
+
+ACCEPT_WITH_INPUT(ScanAllByEdgeTypePropertyValue)
+
+UniqueCursorPtr ScanAllByEdgeTypePropertyValue::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ScanAllByEdgeTypePropertyValueOperator);
+
+  auto edges = [this](Frame &frame, ExecutionContext &context)
+      -> std::optional<decltype(context.db_accessor->Edges(view_, edge_type_, property_, storage::PropertyValue()))> {
+    auto *db = context.db_accessor;
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor, view_);
+    auto value = expression_->Accept(evaluator);
+    if (value.IsNull()) return std::nullopt;
+    if (!value.IsPropertyValue()) {
+      throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
+    }
+    return std::make_optional(db->Edges(view_, edge_type_, property_, storage::PropertyValue(value)));
+  };
+  return MakeUniqueCursorPtr<ScanAllByEdgeTypeCursor<decltype(edges)>>(
+      mem, *this, output_symbol_, input_->MakeCursor(mem), view_, std::move(edges), "ScanAllByEdgeTypePropertyValue");
+}
+
+ScanAllByEdgeTypePropertyRange::ScanAllByEdgeTypePropertyRange(const std::shared_ptr<LogicalOperator> &input,
+                                                               Symbol output_symbol, storage::EdgeTypeId edge_type,
+                                                               storage::PropertyId property, std::string property_name,
+                                                               std::optional<Bound> lower_bound,
+                                                               std::optional<Bound> upper_bound, storage::View view)
+    : ScanAllByEdgeType(input, std::move(output_symbol), edge_type, view),
+      property_(property),
+      property_name_(std::move(property_name)),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound) {
+  MG_ASSERT(lower_bound_ || upper_bound_, "Only one bound can be left out");
+}
+
+ACCEPT_WITH_INPUT(ScanAllByEdgeTypePropertyRange)
+
+UniqueCursorPtr ScanAllByEdgeTypePropertyRange::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ScanAllByEdgeTypePropertyRangeOperator);
+
+  auto edges = [this](Frame &frame, ExecutionContext &context)
+      -> std::optional<decltype(context.db_accessor->Edges(view_, edge_type_, property_, std::nullopt, std::nullopt))> {
+    auto *db = context.db_accessor;
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor, view_);
+    auto maybe_lower = EvaluateBound(evaluator, lower_bound_);
+    auto maybe_upper = EvaluateBound(evaluator, upper_bound_);
+    // If any bound is null, then the comparison would result in nulls. This
+    // is treated as not satisfying the filter, so return no edges.
+    if (maybe_lower && maybe_lower->value().IsNull()) return std::nullopt;
+    if (maybe_upper && maybe_upper->value().IsNull()) return std::nullopt;
+    return std::make_optional(db->Edges(view_, edge_type_, property_, maybe_lower, maybe_upper));
+  };
+  return MakeUniqueCursorPtr<ScanAllByEdgeTypeCursor<decltype(edges)>>(
+      mem, *this, output_symbol_, input_->MakeCursor(mem), view_, std::move(edges), "ScanAllByEdgeTypePropertyRange");
+}
+
 ScanAllByLabelProperty::ScanAllByLabelProperty(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol,
                                                storage::LabelId label, storage::PropertyId property,
                                                std::string property_name, storage::View view)
@@ -779,6 +900,54 @@ UniqueCursorPtr ScanAllByLabelProperty::MakeCursor(utils::MemoryResource *mem) c
                                                                 view_, std::move(vertices), "ScanAllByLabelProperty");
 }
 
+ScanAllByLabelProperties::ScanAllByLabelProperties(const std::shared_ptr<LogicalOperator> &input,
+                                                   Symbol output_symbol, storage::LabelId label,
+                                                   std::vector<storage::PropertyId> properties,
+                                                   std::vector<Expression *> prefix_expressions,
+                                                   std::optional<Bound> lower_bound, std::optional<Bound> upper_bound,
+                                                   storage::View view)
+    : ScanAll(input, output_symbol, view),
+      label_(label),
+      properties_(std::move(properties)),
+      prefix_expressions_(std::move(prefix_expressions)),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound) {
+  MG_ASSERT(!prefix_expressions_.empty() || lower_bound_ || upper_bound_, "Composite index scan needs a prefix");
+  MG_ASSERT(prefix_expressions_.size() + (lower_bound_ || upper_bound_ ? 1 : 0) <= properties_.size(),
+            "Composite index scan on more values than there are index properties");
+}
+
+ACCEPT_WITH_INPUT(ScanAllByLabelProperties)
+
+UniqueCursorPtr ScanAllByLabelProperties::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ScanAllByLabelPropertiesOperator);
+
+  auto vertices = [this](Frame &frame, ExecutionContext &context)
+      -> std::optional<decltype(context.db_accessor->Vertices(view_, label_, properties_, {}, std::nullopt,
+                                                               std::nullopt))> {
+    auto *db = context.db_accessor;
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor, view_);
+    std::vector<storage::PropertyValue> prefix;
+    prefix.reserve(prefix_expressions_.size());
+    for (auto *expression : prefix_expressions_) {
+      auto value = expression->Accept(evaluator);
+      // Equality with null is never true.
+      if (value.IsNull()) return std::nullopt;
+      if (!value.IsPropertyValue()) {
+        throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
+      }
+      prefix.emplace_back(value);
+    }
+    auto maybe_lower = EvaluateBound(evaluator, lower_bound_);
+    auto maybe_upper = EvaluateBound(evaluator, upper_bound_);
+    if (maybe_lower && maybe_lower->value().IsNull()) return std::nullopt;
+    if (maybe_upper && maybe_upper->value().IsNull()) return std::nullopt;
+    return std::make_optional(db->Vertices(view_, label_, properties_, prefix, maybe_lower, maybe_upper));
+  };
+  return MakeUniqueCursorPtr<ScanAllCursor<decltype(vertices)>>(
+      mem, *this, output_symbol_, input_->MakeCursor(mem), view_, std::move(vertices), "ScanAllByLabelProperties");
+}
+
 ScanAllById::ScanAllById(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol, Expression *expression,
                          storage::View view)
     : ScanAll(input, output_symbol, view), expression_(expression) {
@@ -869,6 +1038,16 @@ bool Expand::ExpandCursor::Pull(Frame &frame, ExecutionContext &context) {
   OOMExceptionEnabler oom_exception;
   SCOPED_PROFILE_OP_BY_REF(self_);
 
+  return PullNext(frame, context);
+}
+
+bool Expand::ExpandCursor::PullBatch(FrameBatch &batch, ExecutionContext &context) {
+  OOMExceptionEnabler oom_exception;
+
+  return FillBatch(batch, [&](Frame &frame) { return PullNext(frame, context); });
+}
+
+bool Expand::ExpandCursor::PullNext(Frame &frame, ExecutionContext &context) {
   // A helper function for expanding a node from an edge.
   auto pull_node = [this, &frame]<EdgeAtom::Direction direction>(const EdgeAccessor &new_edge,
                                                                  utils::tag_value<direction>) {
@@ -1633,6 +1812,11 @@ class STShortestPathCursor : public query::plan::Cursor {
   }
 };
 
+namespace {
+bool CanEvaluateConcurrently(Expression *expression);
+std::shared_ptr<utils::ThreadPool> ParallelExecutionPool();
+}  // namespace
+
 class SingleSourceShortestPathCursor : public query::plan::Cursor {
  public:
   SingleSourceShortestPathCursor(const ExpandVariable &self, utils::MemoryResource *mem)
@@ -1640,7 +1824,9 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
         input_cursor_(self_.input()->MakeCursor(mem)),
         processed_(mem),
         to_visit_next_(mem),
-        to_visit_current_(mem) {
+        to_visit_current_(mem),
+        can_expand_levels_in_parallel_(!self_.filter_lambda_.accumulated_path_symbol &&
+                                       CanEvaluateConcurrently(self_.filter_lambda_.expression)) {
     MG_ASSERT(!self_.common_.existing_node,
               "Single source shortest path algorithm "
               "should not be used when `existing_node` "
@@ -1727,7 +1913,10 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
     while (true) {
       AbortCheck(context);
       // if we have nothing to visit on the current depth, switch to next
-      if (to_visit_current_.empty()) to_visit_current_.swap(to_visit_next_);
+      if (to_visit_current_.empty()) {
+        to_visit_current_.swap(to_visit_next_);
+        current_level_expanded_ = ExpandLevelInParallel(frame, context);
+      }
 
       // if current is still empty, it means both are empty, so pull from
       // input
@@ -1784,7 +1973,7 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
       }
 
       // expand only if what we've just expanded is less then max depth
-      if (static_cast<int64_t>(edge_list.size()) < upper_bound_) {
+      if (static_cast<int64_t>(edge_list.size()) < upper_bound_ && !current_level_expanded_) {
         if (self_.filter_lambda_.accumulated_path_symbol) {
           MG_ASSERT(curr_acc_path.has_value(), "Expected non-null accumulated path");
           frame[self_.filter_lambda_.accumulated_path_symbol.value()] = std::move(curr_acc_path.value());
@@ -1811,9 +2000,132 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
     processed_.clear();
     to_visit_next_.clear();
     to_visit_current_.clear();
+    current_level_expanded_ = false;
   }
 
  private:
+  // Levels with fewer vertices are expanded on the query thread, one vertex at
+  // a time, as they are pulled.
+  static constexpr size_t kMinParallelLevelSize = 1024;
+
+  /**
+   * Expands all vertices of the level which has just become current on
+   * multiple threads. Each thread reads the edges of a part of the level and
+   * evaluates the filter on them, while `processed_` is only read. The
+   * expansions are then merged on this thread in the order in which the
+   * vertices would be expanded one at a time, so the visited vertices, the
+   * edges they are reached by and the order of the results don't change.
+   * Returns false if the level has to be expanded one vertex at a time.
+   */
+  bool ExpandLevelInParallel(Frame &frame, ExecutionContext &context) {
+    if (!can_expand_levels_in_parallel_ || FLAGS_query_parallel_execution_threads < 2 || context.is_profile_query ||
+        to_visit_current_.size() < kMinParallelLevelSize) {
+      return false;
+    }
+    // Reading edges of the on-disk storage fills the transaction's caches.
+    if (context.db_accessor->GetStorageMode() == storage::StorageMode::ON_DISK_TRANSACTIONAL) return false;
+#ifdef MG_ENTERPRISE
+    // Fine-grained access checks aren't done concurrently.
+    if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker) return false;
+#endif
+    // All vertices of a level are at the same depth.
+    int64_t depth = 0;
+    for (auto vertex = std::get<1>(to_visit_current_.front());; ++depth) {
+      const auto &previous_edge = processed_.find(vertex)->second;
+      if (!previous_edge) break;
+      vertex = previous_edge->From() == vertex ? previous_edge->To() : previous_edge->From();
+    }
+    if (depth >= upper_bound_) return false;
+
+    // More chunks than threads, so that threads which get vertices with fewer
+    // edges pick up the remaining work.
+    constexpr size_t kChunksPerThread = 4;
+    const auto level_size = to_visit_current_.size();
+    const auto num_threads = static_cast<size_t>(FLAGS_query_parallel_execution_threads);
+    const auto num_chunks = std::min(level_size, num_threads * kChunksPerThread);
+    std::vector<std::vector<std::pair<EdgeAccessor, VertexAccessor>>> expansions(num_chunks);
+    std::vector<std::exception_ptr> errors(num_threads);
+    std::atomic<size_t> next_chunk{0};
+    std::atomic<bool> failed{false};
+
+    auto expand_chunks = [&](size_t thread_id) {
+      try {
+        OOMExceptionEnabler oom_exception;
+        auto *memory = utils::NewDeleteResource();
+        Frame thread_frame(static_cast<int64_t>(frame.elems().size()), memory);
+        std::copy(frame.elems().begin(), frame.elems().end(), thread_frame.elems().begin());
+        EvaluationContext evaluation_context = context.evaluation_context;
+        evaluation_context.memory = memory;
+        ExpressionEvaluator evaluator(&thread_frame, context.symbol_table, evaluation_context, context.db_accessor,
+                                      storage::View::OLD);
+
+        auto expand_pair = [&](const EdgeAccessor &edge, const VertexAccessor &vertex, auto &expansion) {
+          // vertices reached earlier on this level are dropped when merging
+          if (processed_.find(vertex) != processed_.end()) return;
+          if (self_.filter_lambda_.expression) {
+            thread_frame[self_.filter_lambda_.inner_edge_symbol] = edge;
+            thread_frame[self_.filter_lambda_.inner_node_symbol] = vertex;
+            evaluator.ResetPropertyLookupCache();
+            TypedValue result = self_.filter_lambda_.expression->Accept(evaluator);
+            if (result.IsNull()) return;
+            if (!result.IsBool()) throw QueryRuntimeException("Expansion condition must evaluate to boolean or null.");
+            if (!result.ValueBool()) return;
+          }
+          expansion.emplace_back(edge, vertex);
+        };
+
+        for (auto chunk_id = next_chunk++; chunk_id < num_chunks && !failed; chunk_id = next_chunk++) {
+          auto &expansion = expansions[chunk_id];
+          // vertices are expanded in the order they are taken from the back of the level
+          for (auto i = level_size * chunk_id / num_chunks; i < level_size * (chunk_id + 1) / num_chunks; ++i) {
+            AbortCheck(context);
+            const auto &vertex = std::get<1>(to_visit_current_[level_size - 1 - i]);
+            if (self_.common_.direction != EdgeAtom::Direction::IN) {
+              auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types)).edges;
+              for (const auto &edge : out_edges) expand_pair(edge, edge.To(), expansion);
+            }
+            if (self_.common_.direction != EdgeAtom::Direction::OUT) {
+              auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types)).edges;
+              for (const auto &edge : in_edges) expand_pair(edge, edge.From(), expansion);
+            }
+          }
+        }
+      } catch (...) {
+        errors[thread_id] = std::current_exception();
+        failed = true;
+      }
+    };
+
+    {
+      context.db_accessor->SetConcurrentReads(true);
+      utils::OnScopeExit concurrent_reads_guard([&] { context.db_accessor->SetConcurrentReads(false); });
+      const auto query_thread = std::this_thread::get_id();
+      const auto pool = ParallelExecutionPool();
+      utils::TaskGroup helpers(*pool);
+      for (size_t thread_id = 1; thread_id < num_threads; ++thread_id) {
+        helpers.Run([&, thread_id] {
+          const bool pool_thread = std::this_thread::get_id() != query_thread;
+          if (pool_thread) context.db_accessor->TrackCurrentThreadAllocations();
+          expand_chunks(thread_id);
+          if (pool_thread) context.db_accessor->UntrackCurrentThreadAllocations();
+        });
+      }
+      expand_chunks(0);
+      helpers.Wait();
+    }
+
+    for (const auto &error : errors) {
+      if (error) std::rethrow_exception(error);
+    }
+    for (const auto &expansion : expansions) {
+      for (const auto &[edge, vertex] : expansion) {
+        if (!processed_.emplace(vertex, edge).second) continue;
+        to_visit_next_.emplace_back(edge, vertex, std::nullopt);
+      }
+    }
+    return true;
+  }
+
   const ExpandVariable &self_;
   const UniqueCursorPtr input_cursor_;
 
@@ -1829,6 +2141,12 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
   // edge, vertex we have yet to visit, for current and next depth and their accumulated paths
   utils::pmr::vector<std::tuple<EdgeAccessor, VertexAccessor, std::optional<Path>>> to_visit_next_;
   utils::pmr::vector<std::tuple<EdgeAccessor, VertexAccessor, std::optional<Path>>> to_visit_current_;
+  // Filters which depend on the accumulated path or keep state are evaluated
+  // one expansion at a time.
+  const bool can_expand_levels_in_parallel_;
+  // Whether the vertices of the current level were already expanded by
+  // ExpandLevelInParallel.
+  bool current_level_expanded_{false};
 };
 
 namespace {
@@ -1883,6 +2201,233 @@ TypedValue CalculateNextWeight(const std::optional<memgraph::query::plan::Expans
   return TypedValue(current_weight, memory) + total_weight;
 }
 
+// Null weights are the minimum for all types, same as in the priority queue comparators below.
+bool WeightLess(const TypedValue &lhs, const TypedValue &rhs) {
+  if (rhs.IsNull()) return false;
+  if (lhs.IsNull()) return true;
+  ValidateWeightTypes(lhs, rhs);
+  return (lhs < rhs).ValueBool();
+}
+
+// Null stands for "nothing accumulated yet" when joining the two halves of a path.
+TypedValue AddWeights(const TypedValue &lhs, const TypedValue &rhs) {
+  if (lhs.IsNull()) return rhs;
+  if (rhs.IsNull()) return lhs;
+  ValidateWeightTypes(lhs, rhs);
+  return lhs + rhs;
+}
+
+/// Dijkstra's algorithm run from both bound endpoints of a weighted expansion at once. The search stops as soon as
+/// the two frontiers can no longer produce a lighter path, so a point-to-point query only settles the vertices around
+/// both endpoints instead of everything closer to the source than the sink.
+///
+/// Walking an edge from the sink's side must cost the same as walking it from the source, which holds only when the
+/// lambdas see nothing but the edge and the vertex it enters (see `IsApplicable`). Both lambdas are always evaluated
+/// with the vertex the edge enters when walked from the source.
+class BidirectionalWeightedSearch {
+ public:
+  enum class Result : uint8_t { FOUND, NO_PATH, UNSUPPORTED };
+
+  BidirectionalWeightedSearch(const ExpandVariable &self, utils::MemoryResource *mem)
+      : self_(self), forward_(mem, false), backward_(mem, true) {}
+
+  static bool IsApplicable(const ExpandVariable &self) {
+    return self.common_.existing_node && !self.upper_bound_ && self.weight_lambda_ &&
+           !self.filter_lambda_.accumulated_path_symbol && !self.filter_lambda_.accumulated_weight_symbol;
+  }
+
+  /// Returns UNSUPPORTED when an edge weight is null. Null weights don't add up (a null edge turns the whole path
+  /// weight into null), so the caller has to fall back to the single-source search. The same goes for an invalid
+  /// weight or a failing lambda: the sink's side walks edges the single-source search may never reach, so the error is
+  /// left for that search to raise if it gets there.
+  Result Run(const VertexAccessor &source, const VertexAccessor &sink, const TypedValue &source_weight, Frame &frame,
+             ExpressionEvaluator &evaluator, const ExecutionContext &context) {
+    try {
+      return Search(source, sink, source_weight, frame, evaluator, context);
+    } catch (const QueryRuntimeException &) {
+      return Result::UNSUPPORTED;
+    } catch (const TypedValueException &) {
+      return Result::UNSUPPORTED;
+    }
+  }
+
+  const TypedValue &TotalWeight() const { return *best_weight_; }
+
+  /// Edges of the found path, in the order the expansion reports them.
+  utils::pmr::vector<TypedValue> PathEdges(utils::MemoryResource *memory) const {
+    utils::pmr::vector<TypedValue> result(memory);
+    auto collect = [&result](const Side &side, VertexAccessor vertex) {
+      while (true) {
+        const auto &edge = side.labels.at(vertex).second;
+        if (!edge) break;
+        vertex = edge->From() == vertex ? edge->To() : edge->From();
+        result.emplace_back(*edge);
+      }
+    };
+    collect(forward_, *meeting_vertex_);
+    std::reverse(result.begin(), result.end());
+    collect(backward_, *meeting_vertex_);
+    if (self_.is_reverse_) std::reverse(result.begin(), result.end());
+    return result;
+  }
+
+  /// Whether a path reaching `vertex` with `weight` can still be extended to the sink within the found total weight.
+  /// Vertices settled from the sink's side have an exact remaining weight, all others need at least the weight of the
+  /// sink's frontier.
+  bool MayLieOnShortestPath(const VertexAccessor &vertex, const TypedValue &weight) const {
+    std::optional<TypedValue> remaining = backward_frontier_;
+    if (auto it = backward_.labels.find(vertex);
+        it != backward_.labels.end() && (!remaining || WeightLess(it->second.first, *remaining))) {
+      remaining = it->second.first;
+    }
+    // Neither reached from the sink nor reachable while its frontier is open.
+    if (!remaining) return false;
+    auto total_weight = AddWeights(weight, *remaining);
+    if (total_weight.IsDouble() || best_weight_->IsDouble()) {
+      // The halves are summed in a different order than the single-source search sums them, so floating point
+      // weights get some slack to never drop a path that ties with the shortest one.
+      auto as_double = [](const TypedValue &value) {
+        return value.IsDouble() ? value.ValueDouble() : static_cast<double>(value.ValueInt());
+      };
+      constexpr double kRelativeSlack = 1e-9;
+      return as_double(total_weight) <= as_double(*best_weight_) * (1 + kRelativeSlack);
+    }
+    return !WeightLess(*best_weight_, total_weight);
+  }
+
+ private:
+  // Weight and the edge used to reach each vertex.
+  using Label = std::pair<TypedValue, std::optional<EdgeAccessor>>;
+  using QueueEntry = std::pair<TypedValue, VertexAccessor>;
+
+  struct QueueComparator {
+    bool operator()(const QueueEntry &lhs, const QueueEntry &rhs) const { return WeightLess(rhs.first, lhs.first); }
+  };
+
+  struct Side {
+    Side(utils::MemoryResource *mem, bool from_sink)
+        : labels(mem), queue(QueueComparator{}, mem), from_sink(from_sink) {}
+
+    void Push(const VertexAccessor &vertex, const TypedValue &weight, const std::optional<EdgeAccessor> &edge) {
+      labels.insert_or_assign(vertex, Label{weight, edge});
+      queue.emplace(weight, vertex);
+    }
+
+    utils::pmr::unordered_map<VertexAccessor, Label> labels;
+    std::priority_queue<QueueEntry, utils::pmr::vector<QueueEntry>, QueueComparator> queue;
+    bool from_sink;
+  };
+
+  Result Search(const VertexAccessor &source, const VertexAccessor &sink, const TypedValue &source_weight, Frame &frame,
+                ExpressionEvaluator &evaluator, const ExecutionContext &context) {
+    Clear();
+    if (source == sink) return Result::NO_PATH;
+
+    forward_.Push(source, source_weight, std::nullopt);
+    backward_.Push(sink, TypedValue(), std::nullopt);
+
+    while (!forward_.queue.empty() && !backward_.queue.empty()) {
+      AbortCheck(context);
+      if (best_weight_ &&
+          !WeightLess(AddWeights(forward_.queue.top().first, backward_.queue.top().first), *best_weight_)) {
+        break;
+      }
+
+      // Grow the smaller frontier, that keeps both balls of roughly the same size.
+      auto &side = forward_.queue.size() <= backward_.queue.size() ? forward_ : backward_;
+      auto &other = &side == &forward_ ? backward_ : forward_;
+      auto [weight, vertex] = side.queue.top();
+      side.queue.pop();
+      // Stale entry, the vertex was reached with a lower weight in the meantime.
+      if (WeightLess(side.labels.at(vertex).first, weight)) continue;
+
+      if (!ExpandVertex(side, other, vertex, weight, frame, evaluator, context)) return Result::UNSUPPORTED;
+    }
+
+    if (!backward_.queue.empty()) backward_frontier_ = backward_.queue.top().first;
+    return best_weight_ ? Result::FOUND : Result::NO_PATH;
+  }
+
+  void Clear() {
+    for (auto *side : {&forward_, &backward_}) {
+      side->labels.clear();
+      while (!side->queue.empty()) side->queue.pop();
+    }
+    best_weight_.reset();
+    meeting_vertex_.reset();
+    backward_frontier_.reset();
+  }
+
+  // Returns false if an edge weight is null.
+  bool ExpandVertex(Side &side, const Side &other, const VertexAccessor &vertex, const TypedValue &weight,
+                    Frame &frame, ExpressionEvaluator &evaluator, const ExecutionContext &context) {
+    auto relax = [&](const EdgeAccessor &edge, const VertexAccessor &next, const VertexAccessor &entered) {
+#ifdef MG_ENTERPRISE
+      if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
+          !(context.auth_checker->Has(entered, storage::View::OLD,
+                                      memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
+            context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
+        return true;
+      }
+#endif
+      frame[self_.weight_lambda_->inner_edge_symbol] = edge;
+      frame[self_.weight_lambda_->inner_node_symbol] = entered;
+      auto edge_weight = self_.weight_lambda_->expression->Accept(evaluator);
+      if (edge_weight.IsNull()) return false;
+      CheckWeightType(edge_weight, evaluator.GetMemoryResource());
+
+      if (self_.filter_lambda_.expression) {
+        frame[self_.filter_lambda_.inner_edge_symbol] = edge;
+        frame[self_.filter_lambda_.inner_node_symbol] = entered;
+        if (!EvaluateFilter(evaluator, self_.filter_lambda_.expression)) return true;
+      }
+
+      auto next_weight = AddWeights(weight, edge_weight);
+      if (auto it = side.labels.find(next); it != side.labels.end() && !WeightLess(next_weight, it->second.first)) {
+        return true;
+      }
+      side.Push(next, next_weight, edge);
+
+      if (auto it = other.labels.find(next); it != other.labels.end()) {
+        auto total_weight = AddWeights(next_weight, it->second.first);
+        if (!best_weight_ || WeightLess(total_weight, *best_weight_)) {
+          best_weight_ = std::move(total_weight);
+          meeting_vertex_ = next;
+        }
+      }
+      return true;
+    };
+
+    // From the sink's side edges are walked against the expansion direction.
+    const bool walk_out_edges = side.from_sink ? self_.common_.direction != EdgeAtom::Direction::OUT
+                                               : self_.common_.direction != EdgeAtom::Direction::IN;
+    const bool walk_in_edges = side.from_sink ? self_.common_.direction != EdgeAtom::Direction::IN
+                                              : self_.common_.direction != EdgeAtom::Direction::OUT;
+    if (walk_out_edges) {
+      auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types)).edges;
+      for (const auto &edge : out_edges) {
+        if (!relax(edge, edge.To(), side.from_sink ? vertex : edge.To())) return false;
+      }
+    }
+    if (walk_in_edges) {
+      auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types)).edges;
+      for (const auto &edge : in_edges) {
+        if (!relax(edge, edge.From(), side.from_sink ? vertex : edge.From())) return false;
+      }
+    }
+    return true;
+  }
+
+  const ExpandVariable &self_;
+  Side forward_;
+  Side backward_;
+  // Lightest path found so far and the vertex where its two halves meet.
+  std::optional<TypedValue> best_weight_;
+  std::optional<VertexAccessor> meeting_vertex_;
+  // Lowest weight still queued on the sink's side when the search stopped, empty if that side ran out of vertices.
+  std::optional<TypedValue> backward_frontier_;
+};
+
 }  // namespace
 
 class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
@@ -1893,7 +2438,8 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
         total_cost_(mem),
         previous_(mem),
         yielded_vertices_(mem),
-        pq_(mem) {}
+        pq_(mem),
+        bidirectional_search_(self, mem) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     OOMExceptionEnabler oom_exception;
@@ -2024,6 +2570,19 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
         TypedValue current_weight =
             CalculateNextWeight(self_.weight_lambda_, /* total_weight */ TypedValue(), evaluator);
 
+        if (BidirectionalWeightedSearch::IsApplicable(self_)) {
+          const auto &node = frame[self_.common_.node_symbol];
+          ExpectType(self_.common_.node_symbol, node, TypedValue::Type::Vertex);
+          const auto result = bidirectional_search_.Run(vertex, node.ValueVertex(), current_weight, frame, evaluator,
+                                                        context);
+          if (result == BidirectionalWeightedSearch::Result::NO_PATH) continue;
+          if (result == BidirectionalWeightedSearch::Result::FOUND) {
+            frame[self_.common_.edge_symbol] = bidirectional_search_.PathEdges(context.evaluation_context.memory);
+            frame[self_.total_weight_.value()] = bidirectional_search_.TotalWeight();
+            return true;
+          }
+        }
+
         // Clear existing data structures.
         previous_.clear();
         total_cost_.clear();
@@ -2162,6 +2721,9 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
                       PriorityQueueComparator>
       pq_;
 
+  // Used instead of the single-source search when both endpoints are bound.
+  BidirectionalWeightedSearch bidirectional_search_;
+
   void ClearQueue() {
     while (!pq_.empty()) pq_.pop();
   }
@@ -2176,7 +2738,8 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
         total_cost_(mem),
         next_edges_(mem),
         traversal_stack_(mem),
-        pq_(mem) {}
+        pq_(mem),
+        bidirectional_search_(self, mem) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     OOMExceptionEnabler oom_exception;
@@ -2224,6 +2787,9 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
         if (!EvaluateFilter(evaluator, self_.filter_lambda_.expression)) return;
       }
 
+      // Paths that can't reach the bound sink within the shortest weight don't need to be expanded.
+      if (prune_by_sink_ && !bidirectional_search_.MayLieOnShortestPath(next_vertex, next_weight)) return;
+
       auto found_it = visited_cost_.find(next_vertex);
       // Check if the vertex has already been processed.
       if (found_it != visited_cost_.end()) {
@@ -2436,6 +3002,21 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
         TypedValue current_weight =
             CalculateNextWeight(self_.weight_lambda_, /* total_weight */ TypedValue(), evaluator);
 
+        // With both endpoints bound, find the shortest weight from both sides first and use it to bound the
+        // expansion, so only vertices that can lie on one of the shortest paths are expanded.
+        prune_by_sink_ = false;
+        if (BidirectionalWeightedSearch::IsApplicable(self_)) {
+          const auto &node = frame[self_.common_.node_symbol];
+          ExpectType(self_.common_.node_symbol, node, TypedValue::Type::Vertex);
+          // Cycles back to the start vertex are left to the single-source search.
+          if (node.ValueVertex() != *start_vertex) {
+            const auto result = bidirectional_search_.Run(*start_vertex, node.ValueVertex(), current_weight, frame,
+                                                          evaluator, context);
+            if (result == BidirectionalWeightedSearch::Result::NO_PATH) continue;
+            prune_by_sink_ = result == BidirectionalWeightedSearch::Result::FOUND;
+          }
+        }
+
         expand_from_vertex(*start_vertex, current_weight, 0);
         visited_cost_.emplace(*start_vertex, 0);
         frame[self_.common_.edge_symbol] = TypedValue::TVector(memory);
@@ -2517,6 +3098,10 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
       PriorityQueueComparator>
       pq_;
 
+  // Bounds the expansion by the shortest weight to the sink when both endpoints are bound.
+  BidirectionalWeightedSearch bidirectional_search_;
+  bool prune_by_sink_{false};
+
   void ClearQueue() {
     while (!pq_.empty()) pq_.pop();
   }
@@ -2685,11 +3270,26 @@ static std::vector<UniqueCursorPtr> MakeCursorVector(const std::vector<std::shar
 Filter::FilterCursor::FilterCursor(const Filter &self, utils::MemoryResource *mem)
     : self_(self),
       input_cursor_(self_.input_->MakeCursor(mem)),
-      pattern_filter_cursors_(MakeCursorVector(self_.pattern_filters_, mem)) {}
+      pattern_filter_cursors_(MakeCursorVector(self_.pattern_filters_, mem)),
+      batch_results_(mem) {}
+
+void Filter::FilterCursor::PrepareExpression(const ExecutionContext &context) {
+  if (expression_prepared_) return;
+  expression_prepared_ = true;
+  if (!FLAGS_query_compile_expressions) return;
+  compiled_expression_ = self_.compiled_expression_.Get(self_.expression_, context.symbol_table);
+  if (compiled_expression_) compiled_parameters_ = compiled_expression_->BindParameters(context.evaluation_context);
+}
+
+bool Filter::FilterCursor::IsSatisfied(ExpressionEvaluator &evaluator) const {
+  if (compiled_expression_) return IsFilterSatisfied(compiled_expression_->Evaluate(evaluator, compiled_parameters_));
+  return EvaluateFilter(evaluator, self_.expression_);
+}
 
 bool Filter::FilterCursor::Pull(Frame &frame, ExecutionContext &context) {
   OOMExceptionEnabler oom_exception;
   SCOPED_PROFILE_OP_BY_REF(self_);
+  PrepareExpression(context);
 
   // Like all filters, newly set values should not affect filtering of old
   // nodes and edges.
@@ -2699,14 +3299,48 @@ bool Filter::FilterCursor::Pull(Frame &frame, ExecutionContext &context) {
     for (const auto &pattern_filter_cursor : pattern_filter_cursors_) {
       pattern_filter_cursor->Pull(frame, context);
     }
-    if (EvaluateFilter(evaluator, self_.expression_)) return true;
+    if (IsSatisfied(evaluator)) return true;
+  }
+  return false;
+}
+
+bool Filter::FilterCursor::PullBatch(FrameBatch &batch, ExecutionContext &context) {
+  OOMExceptionEnabler oom_exception;
+  PrepareExpression(context);
+
+  // Like all filters, newly set values should not affect filtering of old
+  // nodes and edges.
+  ExpressionEvaluator evaluator(&batch.frame(), context.symbol_table, context.evaluation_context, context.db_accessor,
+                                storage::View::OLD, context.frame_change_collector);
+  while (input_cursor_->PullBatch(batch, context)) {
+    if (!pattern_filter_cursors_.empty()) {
+      for (size_t row = 0; row < batch.Size(); ++row) {
+        for (const auto &pattern_filter_cursor : pattern_filter_cursors_) {
+          pattern_filter_cursor->Pull(batch[row], context);
+        }
+      }
+    }
+    if (compiled_expression_) {
+      batch.KeepIf([&](size_t row) {
+        evaluator.ResetFrame(&batch[row]);
+        return IsSatisfied(evaluator);
+      });
+      evaluator.ResetFrame(&batch.frame());
+    } else {
+      evaluator.EvaluateBatch(self_.expression_, batch, &batch_results_);
+      batch.KeepIf([this](size_t row) { return IsFilterSatisfied(batch_results_[row]); });
+    }
+    if (!batch.Empty()) return true;
   }
   return false;
 }
 
 void Filter::FilterCursor::Shutdown() { input_cursor_->Shutdown(); }
 
-void Filter::FilterCursor::Reset() { input_cursor_->Reset(); }
+void Filter::FilterCursor::Reset() {
+  input_cursor_->Reset();
+  batch_results_.clear();
+}
 
 EvaluatePatternFilter::EvaluatePatternFilter(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol)
     : input_(input), output_symbol_(std::move(output_symbol)) {}
@@ -2788,6 +3422,26 @@ bool Produce::ProduceCursor::Pull(Frame &frame, ExecutionContext &context) {
   return false;
 }
 
+bool Produce::ProduceCursor::PullBatch(FrameBatch &batch, ExecutionContext &context) {
+  OOMExceptionEnabler oom_exception;
+
+  if (!input_cursor_->PullBatch(batch, context)) return false;
+
+  // Produce should always yield the latest results.
+  ExpressionEvaluator evaluator(&batch.frame(), context.symbol_table, context.evaluation_context, context.db_accessor,
+                                storage::View::NEW, context.frame_change_collector);
+  for (size_t row = 0; row < batch.Size(); ++row) {
+    evaluator.ResetFrame(&batch[row]);
+    for (auto *named_expr : self_.named_expressions_) {
+      if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(named_expr->name_)) {
+        context.frame_change_collector->ResetTrackingValue(named_expr->name_);
+      }
+      named_expr->Accept(evaluator);
+    }
+  }
+  return true;
+}
+
 void Produce::ProduceCursor::Shutdown() { input_cursor_->Shutdown(); }
 
 void Produce::ProduceCursor::Reset() { input_cursor_->Reset(); }
@@ -3707,6 +4361,72 @@ TypedValue DefaultAggregationOpValue(const Aggregate::Element &element, utils::M
       return TypedValue(query::Graph(memory));
   }
 }
+
+/// Checks whether an expression can be evaluated from multiple threads at
+/// once, each thread having its own frame and evaluator. Pattern expressions
+/// pull their own cursors, while `counter` and user-defined functions keep
+/// state which is shared by the whole query.
+class ConcurrentEvaluationChecker : public HierarchicalTreeVisitor {
+ public:
+  using HierarchicalTreeVisitor::PostVisit;
+  using HierarchicalTreeVisitor::PreVisit;
+  using HierarchicalTreeVisitor::Visit;
+
+  bool PreVisit(Function &function) override {
+    if (function.function_name_.find('.') != std::string::npos ||
+        utils::ToUpperCase(function.function_name_) == "COUNTER") {
+      is_safe_ = false;
+    }
+    return is_safe_;
+  }
+
+  bool PreVisit(Exists & /*exists*/) override {
+    is_safe_ = false;
+    return false;
+  }
+
+  bool PreVisit(PatternComprehension & /*pattern_comprehension*/) override {
+    is_safe_ = false;
+    return false;
+  }
+
+  bool Visit(Identifier & /*identifier*/) override { return true; }
+  bool Visit(PrimitiveLiteral & /*literal*/) override { return true; }
+  bool Visit(ParameterLookup & /*param_lookup*/) override { return true; }
+
+  bool is_safe_{true};
+};
+
+bool CanEvaluateConcurrently(Expression *expression) {
+  if (!expression) return true;
+  ConcurrentEvaluationChecker checker;
+  expression->Accept(checker);
+  return checker.is_safe_;
+}
+
+/// Threads shared by all queries for parallel execution. The thread which
+/// executes the query takes part in the work as well, so the pool has one
+/// thread less than a single query may use. The pool is created anew when the
+/// flags no longer match it, and the queries which still run on the previous
+/// pool keep it alive until they are done.
+std::shared_ptr<utils::ThreadPool> ParallelExecutionPool() {
+  struct Pool {
+    std::shared_ptr<utils::ThreadPool> pool;
+    size_t size{0};
+    bool pin_threads{false};
+  };
+  static utils::Synchronized<Pool> current_pool;
+  const size_t size = std::max<uint64_t>(FLAGS_query_parallel_execution_threads, 2) - 1;
+  const bool pin_threads = FLAGS_query_parallel_execution_pin_threads;
+  return current_pool.WithLock([&](Pool &current) {
+    if (!current.pool || current.size != size || current.pin_threads != pin_threads) {
+      current.pool = std::make_shared<utils::ThreadPool>(size, pin_threads);
+      current.size = size;
+      current.pin_threads = pin_threads;
+    }
+    return current.pool;
+  });
+}
 }  // namespace
 
 class AggregateCursor : public Cursor {
@@ -3714,8 +4434,13 @@ class AggregateCursor : public Cursor {
   AggregateCursor(const Aggregate &self, utils::MemoryResource *mem)
       : self_(self),
         input_cursor_(self_.input_->MakeCursor(mem)),
-        aggregation_(mem),
-        reused_group_by_(self.group_by_.size(), mem) {}
+        aggregation_memory_(mem, std::numeric_limits<size_t>::max()),
+        aggregation_(&aggregation_memory_),
+        unspilled_aggregation_(&aggregation_memory_),
+        reused_group_by_(self.group_by_.size(), mem),
+        pull_input_in_batches_(IsReadOnly(*self_.input_)),
+        parallel_pipeline_(MatchParallelPipeline(self_)),
+        can_spill_(CanSpill(self_, pull_input_in_batches_)) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     OOMExceptionEnabler oom_exception;
@@ -3746,7 +4471,9 @@ class AggregateCursor : public Cursor {
         return true;
       }
     }
-    if (aggregation_it_ == aggregation_.end()) return false;
+    while (aggregation_it_ == aggregation_.end()) {
+      if (!LoadNextPartition(context)) return false;
+    }
 
     // place aggregation values on the frame
     auto aggregation_values_it = aggregation_it_->second.values_.begin();
@@ -3768,6 +4495,11 @@ class AggregateCursor : public Cursor {
     aggregation_.clear();
     aggregation_it_ = aggregation_.begin();
     pulled_all_input_ = false;
+    unspilled_aggregation_.clear();
+    spill_partitions_.clear();
+    next_partition_ = 0;
+    next_spill_check_ = kGroupsBetweenSpillChecks;
+    can_spill_ = CanSpill(self_, pull_input_in_batches_);
   }
 
  private:
@@ -3796,18 +4528,41 @@ class AggregateCursor : public Cursor {
     utils::pmr::vector<TSet> unique_values_;
   };
 
+  // map key is the vector of group-by values
+  // map value is an AggregationValue struct
+  using TAggregation =
+      utils::pmr::unordered_map<utils::pmr::vector<TypedValue>, AggregationValue,
+                                // use FNV collection hashing specialized for a
+                                // vector of TypedValues
+                                utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>,
+                                // custom equality
+                                TypedValueVectorEqual>;
+
+  // The ScanAll -> Filter... part of the input which can be split into chunks
+  // of vertices and aggregated by multiple threads. The scan is either ScanAll
+  // or ScanAllByLabel.
+  struct ParallelPipeline {
+    const ScanAll *scan;
+    std::vector<const Filter *> filters;
+  };
+
+  // New groups are added until this many groups are in memory, then the
+  // memory used by the groups is checked.
+  static constexpr size_t kGroupsBetweenSpillChecks = 1024;
+  // Groups are spilled only when they use at least this much memory, even if
+  // the query is close to its memory limit.
+  static constexpr size_t kMinSpilledBytes = 1024UL * 1024UL;
+  static constexpr size_t kSpillPartitions = 16;
+
   const Aggregate &self_;
   const UniqueCursorPtr input_cursor_;
+  // Memory of the aggregated data, counted to decide when to spill it.
+  utils::MemoryTrackingResource aggregation_memory_;
   // storage for aggregated data
-  // map key is the vector of group-by values
-  // map value is an AggregationValue struct
-  utils::pmr::unordered_map<utils::pmr::vector<TypedValue>, AggregationValue,
-                            // use FNV collection hashing specialized for a
-                            // vector of TypedValues
-                            utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>,
-                            // custom equality
-                            TypedValueVectorEqual>
-      aggregation_;
+  TAggregation aggregation_;
+  // Groups which were still in memory when all the input was aggregated,
+  // merged with the spilled partitions one partition at a time.
+  TAggregation unspilled_aggregation_;
   // this is a for object reuse, to avoid re-allocating this buffer
   utils::pmr::vector<TypedValue> reused_group_by_;
   // iterator over the accumulated cache
@@ -3815,6 +4570,80 @@ class AggregateCursor : public Cursor {
   // this LogicalOp pulls all from the input on it's first pull
   // this switch tracks if this has been performed
   bool pulled_all_input_{false};
+  // Input is pulled in batches only when it doesn't write, because batching
+  // changes when the aggregated expressions are evaluated relative to the
+  // input's side effects.
+  const bool pull_input_in_batches_;
+  std::optional<FrameBatch> input_batch_;
+  const std::optional<ParallelPipeline> parallel_pipeline_;
+  // Groups spilled to disk, partitioned by the hash of their group-by values.
+  std::vector<std::unique_ptr<SpillFile>> spill_partitions_;
+  // The partition which is returned after the current one.
+  size_t next_partition_{0};
+  size_t next_spill_check_{kGroupsBetweenSpillChecks};
+  bool can_spill_;
+  // Memory used by the groups when they were last spilled. It's freed to the
+  // memory resource of the query rather than released, so the memory usage of
+  // the query stays the same after a spill.
+  size_t spilled_bytes_{0};
+
+  static bool IsReadOnly(LogicalOperator &input) {
+    ReadWriteTypeChecker read_write_type_checker;
+    read_write_type_checker.InferRWType(input);
+    return read_write_type_checker.type == ReadWriteTypeChecker::RWType::NONE ||
+           read_write_type_checker.type == ReadWriteTypeChecker::RWType::R;
+  }
+
+  /**
+   * Matches the input against ScanAll or ScanAllByLabel followed by any
+   * number of Filters, where the aggregations can be computed as partial
+   * aggregations which are merged at the end. Such input can be split into
+   * chunks of vertices which are processed in parallel.
+   */
+  static std::optional<ParallelPipeline> MatchParallelPipeline(const Aggregate &self) {
+    for (const auto &elem : self.aggregations_) {
+      switch (elem.op) {
+        case Aggregation::Op::COUNT:
+        case Aggregation::Op::SUM:
+        case Aggregation::Op::AVG:
+        case Aggregation::Op::MIN:
+        case Aggregation::Op::MAX:
+          break;
+        case Aggregation::Op::COLLECT_LIST:
+        case Aggregation::Op::COLLECT_MAP:
+        case Aggregation::Op::PROJECT:
+          return std::nullopt;
+      }
+      if (elem.distinct || !CanEvaluateConcurrently(elem.value)) return std::nullopt;
+    }
+    if (!std::all_of(self.group_by_.begin(), self.group_by_.end(), CanEvaluateConcurrently)) return std::nullopt;
+
+    ParallelPipeline pipeline;
+    const LogicalOperator *input = self.input_.get();
+    while (input->GetTypeInfo() == Filter::kType) {
+      const auto *filter = static_cast<const Filter *>(input);
+      if (!filter->pattern_filters_.empty() || !CanEvaluateConcurrently(filter->expression_)) return std::nullopt;
+      pipeline.filters.push_back(filter);
+      input = filter->input_.get();
+    }
+    if (input->GetTypeInfo() != ScanAll::kType && input->GetTypeInfo() != ScanAllByLabel::kType) return std::nullopt;
+    pipeline.scan = static_cast<const ScanAll *>(input);
+    if (pipeline.scan->input_->GetTypeInfo() != Once::kType) return std::nullopt;
+    return pipeline;
+  }
+
+  /**
+   * Groups can be spilled to disk when their partial aggregations can be
+   * merged, i.e. when the aggregations aren't DISTINCT and don't project
+   * graphs. The input must not write, so that the spilled vertices and edges
+   * are found when the groups are read back.
+   */
+  static bool CanSpill(const Aggregate &self, bool read_only_input) {
+    if (self.group_by_.empty() || !read_only_input) return false;
+    return std::none_of(self.aggregations_.begin(), self.aggregations_.end(), [](const auto &elem) {
+      return elem.distinct || elem.op == Aggregation::Op::PROJECT;
+    });
+  }
 
   /**
    * Pulls from the input operator until exhausted and aggregates the
@@ -3830,13 +4659,47 @@ class AggregateCursor : public Cursor {
                                   storage::View::NEW);
 
     bool pulled = false;
-    while (input_cursor_->Pull(*frame, *context)) {
-      ProcessOne(*frame, &evaluator);
-      pulled = true;
+    if (auto chunks = SplitIntoChunks(*context); chunks.size() > 1) {
+      pulled = ProcessAllInParallel(*frame, *context, chunks);
+    } else if (pull_input_in_batches_ && !context->is_profile_query) {
+      if (!input_batch_) {
+        input_batch_.emplace(static_cast<int64_t>(frame->elems().size()), FrameBatch::kDefaultCapacity,
+                             reused_group_by_.get_allocator().GetMemoryResource());
+      }
+      input_batch_->Reset(*frame);
+      while (input_cursor_->PullBatch(*input_batch_, *context)) {
+        for (size_t row = 0; row < input_batch_->Size(); ++row) {
+          evaluator.ResetFrame(&(*input_batch_)[row]);
+          ProcessOne((*input_batch_)[row], &evaluator);
+          SpillIfNeeded(*context);
+        }
+        pulled = true;
+      }
+    } else {
+      while (input_cursor_->Pull(*frame, *context)) {
+        ProcessOne(*frame, &evaluator);
+        SpillIfNeeded(*context);
+        pulled = true;
+      }
     }
     if (!pulled) return false;
 
-    // post processing
+    if (!spill_partitions_.empty()) {
+      unspilled_aggregation_ = std::move(aggregation_);
+      aggregation_.clear();
+      for (auto &partition : spill_partitions_) partition->Rewind();
+      while (LoadNextPartition(*context) && aggregation_.empty()) {
+      }
+      return true;
+    }
+    PostProcess(*context);
+    return true;
+  }
+
+  /**
+   * Computes the final values of the aggregations in `aggregation_`.
+   */
+  void PostProcess(ExecutionContext &context) {
     for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
       switch (self_.aggregations_[pos].op) {
         case Aggregation::Op::AVG: {
@@ -3844,7 +4707,7 @@ class AggregateCursor : public Cursor {
           for (auto &kv : aggregation_) {
             AggregationValue &agg_value = kv.second;
             auto count = agg_value.counts_[pos];
-            auto *pull_memory = context->evaluation_context.memory;
+            auto *pull_memory = context.evaluation_context.memory;
             if (count > 0) {
               agg_value.values_[pos] = agg_value.values_[pos] / TypedValue(static_cast<double>(count), pull_memory);
             }
@@ -3868,22 +4731,352 @@ class AggregateCursor : public Cursor {
           break;
       }
     }
+  }
+
+  /**
+   * Spills the groups to disk if they use too much memory. The memory is
+   * checked only after a number of new groups has been added.
+   */
+  void SpillIfNeeded(ExecutionContext &context) {
+    if (aggregation_.size() < next_spill_check_) return;
+    next_spill_check_ = aggregation_.size() + kGroupsBetweenSpillChecks;
+    if (!can_spill_ || !ShouldSpill(context, aggregation_memory_.GetAllocatedBytes())) return;
+    Spill();
+    next_spill_check_ = kGroupsBetweenSpillChecks;
+  }
+
+  /**
+   * Checks whether groups which use `allocated` bytes should be spilled. Can be
+   * called from multiple threads.
+   */
+  bool ShouldSpill(ExecutionContext &context, size_t allocated) const {
+    if (FLAGS_query_spill_threshold_mb > 0 && allocated >= FLAGS_query_spill_threshold_mb * 1024UL * 1024UL) {
+      return true;
+    }
+    // Until the new groups outgrow the memory of the last spilled ones, they
+    // don't add to the memory usage of the query.
+    if (allocated < std::max(kMinSpilledBytes, spilled_bytes_)) return false;
+    const auto transaction_id = context.db_accessor->GetTransactionId();
+    if (!transaction_id) return false;
+    // Spill when the query is getting close to its memory limit.
+    const auto usage = memory::GetTransactionMemoryUsage(*transaction_id);
+    return usage && usage->second > 0 && usage->first >= usage->second / 4 * 3;
+  }
+
+  /**
+   * Writes the groups to the spill partitions and removes them from memory.
+   * A group is written to the partition chosen by the hash of its group-by
+   * values, so each group ends up in a single partition no matter how many
+   * times it's spilled. If some group has a value which can't be written to
+   * disk, nothing is spilled anymore.
+   */
+  void Spill() {
+    const auto can_spill_values = [](const auto &values) {
+      return std::all_of(values.begin(), values.end(), SpillFile::CanSpill);
+    };
+    if (!std::all_of(aggregation_.begin(), aggregation_.end(), [&](const auto &group) {
+          return can_spill_values(group.first) && can_spill_values(group.second.values_) &&
+                 can_spill_values(group.second.remember_);
+        })) {
+      can_spill_ = false;
+      return;
+    }
+
+    if (spill_partitions_.empty()) {
+      const auto directory = SpillDirectory();
+      spill_partitions_.reserve(kSpillPartitions);
+      for (size_t i = 0; i < kSpillPartitions; ++i) spill_partitions_.push_back(std::make_unique<SpillFile>(directory));
+    }
+    const auto hash = aggregation_.hash_function();
+    for (const auto &[group_by, agg_value] : aggregation_) {
+      auto &partition = *spill_partitions_[hash(group_by) % kSpillPartitions];
+      for (const auto &value : group_by) partition.Write(value);
+      for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
+        partition.Write(TypedValue(agg_value.counts_[pos]));
+        partition.Write(agg_value.values_[pos]);
+      }
+      for (const auto &value : agg_value.remember_) partition.Write(value);
+    }
+    spilled_bytes_ = aggregation_memory_.GetAllocatedBytes();
+    aggregation_.clear();
+    aggregation_.rehash(0);
+  }
+
+  /**
+   * Replaces the groups in `aggregation_` with the groups of the next spilled
+   * partition, merged with the groups of that partition which were still in
+   * memory at the end. Returns false if there are no more partitions.
+   */
+  bool LoadNextPartition(ExecutionContext &context) {
+    if (next_partition_ == spill_partitions_.size()) return false;
+    const auto partition_id = next_partition_++;
+    // The file is closed once the partition is read.
+    const auto partition = std::move(spill_partitions_[partition_id]);
+    aggregation_.clear();
+
+    auto *dba = context.db_accessor;
+    auto *mem = aggregation_.get_allocator().GetMemoryResource();
+    auto &group_by = reused_group_by_;
+    group_by.resize(self_.group_by_.size());
+    AggregationValue agg_value(mem);
+    agg_value.counts_.resize(self_.aggregations_.size());
+    agg_value.values_.resize(self_.aggregations_.size());
+    agg_value.remember_.resize(self_.remember_.size());
+    TypedValue count(mem);
+    while (partition->Read(&group_by.front(), dba)) {
+      AbortCheck(context);
+      for (size_t i = 1; i < group_by.size(); ++i) partition->Read(&group_by[i], dba);
+      for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
+        partition->Read(&count, dba);
+        agg_value.counts_[pos] = count.ValueInt();
+        partition->Read(&agg_value.values_[pos], dba);
+      }
+      for (auto &value : agg_value.remember_) partition->Read(&value, dba);
+      MergeGroup(group_by, agg_value);
+    }
+
+    // Groups which were in memory at the end come after the spilled ones.
+    const auto hash = aggregation_.hash_function();
+    for (auto it = unspilled_aggregation_.begin(); it != unspilled_aggregation_.end();) {
+      if (hash(it->first) % kSpillPartitions != partition_id) {
+        ++it;
+        continue;
+      }
+      MergeGroup(it->first, it->second);
+      it = unspilled_aggregation_.erase(it);
+    }
+    PostProcess(context);
+    aggregation_it_ = aggregation_.begin();
     return true;
   }
 
+  /**
+   * Splits the vertices scanned by the input into chunks when the input can be
+   * aggregated in parallel. Returns no chunks otherwise.
+   */
+  std::vector<VerticesIterable> SplitIntoChunks(ExecutionContext &context) const {
+    if (!parallel_pipeline_ || FLAGS_query_parallel_execution_threads < 2 || context.is_profile_query) return {};
+#ifdef MG_ENTERPRISE
+    // Fine-grained access checks aren't done by the parallel pipeline.
+    if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker) return {};
+#endif
+    // More chunks than threads, so that threads which get cheaper chunks pick
+    // up the remaining work.
+    constexpr uint64_t kChunksPerThread = 4;
+    const auto num_chunks = FLAGS_query_parallel_execution_threads * kChunksPerThread;
+    const auto *scan = parallel_pipeline_->scan;
+    if (scan->GetTypeInfo() == ScanAllByLabel::kType) {
+      return context.db_accessor->ChunkedVertices(scan->view_, static_cast<const ScanAllByLabel *>(scan)->label_,
+                                                  num_chunks);
+    }
+    return context.db_accessor->ChunkedVertices(scan->view_, num_chunks);
+  }
+
+  /**
+   * Aggregates the chunks of vertices on multiple threads. Each thread
+   * evaluates the filters and aggregates into its own partial aggregation,
+   * which are all merged into `aggregation_` in the end.
+   *
+   * The partial aggregations are counted together with `aggregation_` against
+   * the memory at which groups are spilled. When they grow too big, the threads
+   * stop after their current chunk, the partial aggregations are merged and
+   * the groups spilled, and the remaining chunks are processed afterwards.
+   */
+  bool ProcessAllInParallel(Frame &frame, ExecutionContext &context, std::vector<VerticesIterable> &chunks) {
+    const auto num_threads = std::min<size_t>(FLAGS_query_parallel_execution_threads, chunks.size());
+    // The partial aggregations are filled concurrently, so each one gets its
+    // own tracking resource over the thread-safe new/delete resource.
+    std::vector<std::unique_ptr<utils::MemoryTrackingResource>> partial_memory;
+    std::vector<TAggregation> partial_aggregations;
+    partial_memory.reserve(num_threads);
+    partial_aggregations.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+      partial_memory.push_back(std::make_unique<utils::MemoryTrackingResource>(utils::NewDeleteResource(),
+                                                                               std::numeric_limits<size_t>::max()));
+      partial_aggregations.emplace_back(partial_memory.back().get());
+    }
+    std::vector<std::exception_ptr> errors(num_threads);
+    std::atomic<size_t> next_chunk{0};
+    std::atomic<bool> failed{false};
+    std::atomic<bool> pulled{false};
+    // Bytes used by all the partial aggregations, as last reported by the
+    // threads after each of their chunks.
+    std::atomic<size_t> partial_bytes{0};
+    std::atomic<bool> merge_requested{false};
+
+    auto process_chunks = [&](size_t thread_id, size_t merged_bytes) {
+      try {
+        OOMExceptionEnabler oom_exception;
+        auto *memory = utils::NewDeleteResource();
+        // Symbols bound outside of this branch are visible to the filters.
+        Frame thread_frame(static_cast<int64_t>(frame.elems().size()), memory);
+        std::copy(frame.elems().begin(), frame.elems().end(), thread_frame.elems().begin());
+        EvaluationContext evaluation_context = context.evaluation_context;
+        evaluation_context.memory = memory;
+        ExpressionEvaluator filter_evaluator(&thread_frame, context.symbol_table, evaluation_context,
+                                             context.db_accessor, storage::View::OLD);
+        ExpressionEvaluator evaluator(&thread_frame, context.symbol_table, evaluation_context, context.db_accessor,
+                                      storage::View::NEW);
+        auto &aggregation = partial_aggregations[thread_id];
+        const auto &aggregation_memory = *partial_memory[thread_id];
+        auto reported_bytes = aggregation_memory.GetAllocatedBytes();
+        utils::pmr::vector<TypedValue> group_by(memory);
+        const auto &output_symbol = parallel_pipeline_->scan->output_symbol_;
+
+        while (!failed && !merge_requested) {
+          const auto chunk_id = next_chunk++;
+          if (chunk_id >= chunks.size()) break;
+          for (auto vertex : chunks[chunk_id]) {
+            AbortCheck(context);
+            thread_frame[output_symbol] = vertex;
+            filter_evaluator.ResetPropertyLookupCache();
+            if (!std::all_of(parallel_pipeline_->filters.begin(), parallel_pipeline_->filters.end(),
+                             [&](const Filter *filter) { return EvaluateFilter(filter_evaluator, filter->expression_); }))
+              continue;
+            ProcessOne(thread_frame, &evaluator, &aggregation, &group_by);
+            pulled = true;
+          }
+          // Groups are only added during a chunk, so the bytes don't shrink.
+          const auto allocated = aggregation_memory.GetAllocatedBytes();
+          const auto total_bytes = partial_bytes += allocated - reported_bytes;
+          reported_bytes = allocated;
+          if (can_spill_ && ShouldSpill(context, merged_bytes + total_bytes)) merge_requested = true;
+        }
+      } catch (...) {
+        errors[thread_id] = std::current_exception();
+        failed = true;
+      }
+    };
+
+    do {
+      merge_requested = false;
+      const auto merged_bytes = aggregation_memory_.GetAllocatedBytes();
+      {
+        context.db_accessor->SetConcurrentReads(true);
+        utils::OnScopeExit concurrent_reads_guard([&] { context.db_accessor->SetConcurrentReads(false); });
+        // Helpers which no pool thread has picked up by the time this thread is
+        // done with its share are run here, so a busy pool doesn't stall the query.
+        const auto query_thread = std::this_thread::get_id();
+        const auto pool = ParallelExecutionPool();
+        utils::TaskGroup helpers(*pool);
+        for (size_t thread_id = 1; thread_id < num_threads; ++thread_id) {
+          helpers.Run([&, thread_id, merged_bytes] {
+            const bool pool_thread = std::this_thread::get_id() != query_thread;
+            if (pool_thread) context.db_accessor->TrackCurrentThreadAllocations();
+            process_chunks(thread_id, merged_bytes);
+            if (pool_thread) context.db_accessor->UntrackCurrentThreadAllocations();
+          });
+        }
+        process_chunks(0, merged_bytes);
+        helpers.Wait();
+      }
+
+      for (const auto &error : errors) {
+        if (error) std::rethrow_exception(error);
+      }
+      for (auto &partial_aggregation : partial_aggregations) {
+        Merge(partial_aggregation);
+        partial_aggregation.clear();
+        partial_aggregation.rehash(0);
+        SpillIfNeeded(context);
+      }
+      partial_bytes = 0;
+      for (const auto &memory : partial_memory) partial_bytes += memory->GetAllocatedBytes();
+      if (merge_requested && can_spill_ && ShouldSpill(context, aggregation_memory_.GetAllocatedBytes())) Spill();
+    } while (merge_requested && next_chunk < chunks.size());
+    return pulled;
+  }
+
+  /**
+   * Merges a partial aggregation computed by ProcessAllInParallel into
+   * `aggregation_`.
+   */
+  void Merge(const TAggregation &partial_aggregation) {
+    for (const auto &[group_by, partial_value] : partial_aggregation) MergeGroup(group_by, partial_value);
+  }
+
+  /**
+   * Merges the partial aggregation of a group into `aggregation_`. The
+   * partial aggregation must have been computed from rows which come after
+   * the ones already aggregated for the group.
+   */
+  void MergeGroup(const utils::pmr::vector<TypedValue> &group_by, const AggregationValue &partial_value) {
+    auto *mem = aggregation_.get_allocator().GetMemoryResource();
+    auto res = aggregation_.try_emplace(group_by, mem);
+    auto &agg_value = res.first->second;
+    if (res.second /*was newly inserted*/) {
+      agg_value.counts_.assign(partial_value.counts_.begin(), partial_value.counts_.end());
+      agg_value.values_.assign(partial_value.values_.begin(), partial_value.values_.end());
+      agg_value.remember_.assign(partial_value.remember_.begin(), partial_value.remember_.end());
+      agg_value.unique_values_.resize(self_.aggregations_.size(), AggregationValue::TSet(mem));
+      return;
+    }
+
+    for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
+      const auto partial_count = partial_value.counts_[pos];
+      if (partial_count == 0) continue;
+      auto &value = agg_value.values_[pos];
+      const auto &partial = partial_value.values_[pos];
+      auto &count = agg_value.counts_[pos];
+      if (count == 0) {
+        value = partial;
+        count = partial_count;
+        continue;
+      }
+      count += partial_count;
+      switch (self_.aggregations_[pos].op) {
+        case Aggregation::Op::COUNT:
+          // value is deferred to post-processing
+          break;
+        case Aggregation::Op::MIN:
+          try {
+            if ((partial < value).ValueBool()) value = partial;
+          } catch (const TypedValueException &) {
+            throw QueryRuntimeException("Unable to get MIN of '{}' and '{}'.", partial.type(), value.type());
+          }
+          break;
+        case Aggregation::Op::MAX:
+          try {
+            if ((partial > value).ValueBool()) value = partial;
+          } catch (const TypedValueException &) {
+            throw QueryRuntimeException("Unable to get MAX of '{}' and '{}'.", partial.type(), value.type());
+          }
+          break;
+        case Aggregation::Op::AVG:
+        case Aggregation::Op::SUM:
+          value = value + partial;
+          break;
+        case Aggregation::Op::COLLECT_LIST:
+          value.ValueList().insert(value.ValueList().end(), partial.ValueList().begin(), partial.ValueList().end());
+          break;
+        case Aggregation::Op::COLLECT_MAP:
+          // The first value collected for a key is kept.
+          for (const auto &[key, element] : partial.ValueMap()) value.ValueMap().emplace(key, element);
+          break;
+        case Aggregation::Op::PROJECT:
+          LOG_FATAL("Aggregation can't be merged.");
+      }
+    }
+  }
+
   /**
    * Performs a single accumulation.
    */
   void ProcessOne(const Frame &frame, ExpressionEvaluator *evaluator) {
+    ProcessOne(frame, evaluator, &aggregation_, &reused_group_by_);
+  }
+
+  void ProcessOne(const Frame &frame, ExpressionEvaluator *evaluator, TAggregation *aggregation,
+                  utils::pmr::vector<TypedValue> *group_by) {
     // Preallocated group_by, since most of the time the aggregation key won't be unique
-    reused_group_by_.clear();
+    group_by->clear();
     evaluator->ResetPropertyLookupCache();
 
     for (Expression *expression : self_.group_by_) {
-      reused_group_by_.emplace_back(expression->Accept(*evaluator));
+      group_by->emplace_back(expression->Accept(*evaluator));
     }
-    auto *mem = aggregation_.get_allocator().GetMemoryResource();
-    auto res = aggregation_.try_emplace(reused_group_by_, mem);
+    auto *mem = aggregation->get_allocator().GetMemoryResource();
+    auto res = aggregation->try_emplace(*group_by, mem);
     auto &agg_value = res.first->second;
     if (res.second /*was newly inserted*/) EnsureInitialized(frame, &agg_value);
     Update(evaluator, &agg_value);
@@ -4311,6 +5504,173 @@ UniqueCursorPtr OrderBy::MakeCursor(utils::MemoryResource *mem) const {
   return MakeUniqueCursorPtr<OrderByCursor>(mem, *this, mem);
 }
 
+TopK::TopK(const std::shared_ptr<LogicalOperator> &input, const std::vector<SortItem> &order_by,
+           const std::vector<Symbol> &output_symbols, Expression *skip, Expression *limit)
+    : input_(input), output_symbols_(output_symbols), skip_(skip), limit_(limit) {
+  std::vector<OrderedTypedValueCompare> ordering;
+  ordering.reserve(order_by.size());
+  order_by_.reserve(order_by.size());
+  for (const auto &ordering_expression_pair : order_by) {
+    ordering.emplace_back(ordering_expression_pair.ordering);
+    order_by_.emplace_back(ordering_expression_pair.expression);
+  }
+  compare_ = TypedValueVectorCompare(std::move(ordering));
+}
+
+ACCEPT_WITH_INPUT(TopK)
+
+std::vector<Symbol> TopK::OutputSymbols(const SymbolTable &symbol_table) const {
+  // Propagate this to potential Produce.
+  return input_->OutputSymbols(symbol_table);
+}
+
+std::vector<Symbol> TopK::ModifiedSymbols(const SymbolTable &table) const { return input_->ModifiedSymbols(table); }
+
+class TopKCursor : public Cursor {
+ public:
+  TopKCursor(const TopK &self, utils::MemoryResource *mem)
+      : self_(self),
+        input_cursor_(self_.input_->MakeCursor(mem)),
+        order_by_rows_(mem),
+        output_rows_(mem),
+        arrivals_(mem),
+        heap_(mem),
+        scratch_order_by_(mem) {}
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    OOMExceptionEnabler oom_exception;
+    SCOPED_PROFILE_OP_BY_REF(self_);
+
+    if (!did_pull_all_) [[unlikely]] {
+      did_pull_all_ = true;
+      PullAll(frame, context);
+    }
+
+    if (heap_it_ == heap_.end()) return false;
+
+    AbortCheck(context);
+
+    // place the output values on the frame
+    auto &output_row = output_rows_[*heap_it_];
+    DMG_ASSERT(self_.output_symbols_.size() == output_row.size(),
+               "Number of values does not match the number of output symbols "
+               "in TopK");
+    auto output_sym_it = self_.output_symbols_.begin();
+    for (TypedValue &output : output_row) {
+      if (context.frame_change_collector) {
+        context.frame_change_collector->ResetTrackingValue(output_sym_it->name());
+      }
+      frame[*output_sym_it++] = std::move(output);
+    }
+    heap_it_++;
+    return true;
+  }
+
+  void Shutdown() override { input_cursor_->Shutdown(); }
+
+  void Reset() override {
+    input_cursor_->Reset();
+    did_pull_all_ = false;
+    order_by_rows_.clear();
+    output_rows_.clear();
+    arrivals_.clear();
+    heap_.clear();
+    heap_it_ = heap_.begin();
+  }
+
+ private:
+  void PullAll(Frame &frame, ExecutionContext &context) {
+    // The skip and limit expressions don't contain identifiers so graph view
+    // parameter is not important.
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                  storage::View::OLD);
+    TypedValue limit = self_.limit_->Accept(evaluator);
+    if (limit.type() != TypedValue::Type::Int)
+      throw QueryRuntimeException("Limit on number of returned elements must be an integer.");
+    if (limit.ValueInt() < 0) throw QueryRuntimeException("Limit on number of returned elements must be non-negative.");
+    heap_it_ = heap_.end();
+    // Like Limit, don't pull the input at all.
+    if (limit.ValueInt() == 0) return;
+
+    int64_t skip = 0;
+    if (self_.skip_) {
+      TypedValue to_skip = self_.skip_->Accept(evaluator);
+      if (to_skip.type() != TypedValue::Type::Int)
+        throw QueryRuntimeException("Number of elements to skip must be an integer.");
+      skip = to_skip.ValueInt();
+      if (skip < 0) throw QueryRuntimeException("Number of elements to skip must be non-negative.");
+    }
+    // Both are non-negative int64_t values, so the sum can't overflow.
+    const auto capacity = static_cast<uint64_t>(skip) + static_cast<uint64_t>(limit.ValueInt());
+
+    // `heap_` holds the positions of the kept rows in `order_by_rows_` and
+    // `output_rows_`, ordered so that the row which sorts last is on top.
+    // Once `capacity` rows are kept, a new row is kept only if it sorts
+    // before the top one, whose place it then takes. Equal rows are ordered
+    // by arrival, so the result doesn't depend on which of them were evicted.
+    const auto lex_cmp = self_.compare_.lex_cmp();
+    const auto heap_cmp = [&](size_t lhs, size_t rhs) {
+      if (lex_cmp(order_by_rows_[lhs], order_by_rows_[rhs])) return true;
+      if (lex_cmp(order_by_rows_[rhs], order_by_rows_[lhs])) return false;
+      return arrivals_[lhs] < arrivals_[rhs];
+    };
+    uint64_t arrival = 0;
+
+    while (input_cursor_->Pull(frame, context)) {
+      scratch_order_by_.clear();
+      for (auto const &expression_ptr : self_.order_by_) {
+        scratch_order_by_.emplace_back(expression_ptr->Accept(evaluator));
+      }
+
+      size_t position = 0;
+      if (heap_.size() < capacity) {
+        position = order_by_rows_.size();
+        order_by_rows_.emplace_back(std::move(scratch_order_by_));
+        output_rows_.emplace_back();
+        arrivals_.emplace_back();
+        heap_.push_back(position);
+      } else {
+        if (!lex_cmp(scratch_order_by_, order_by_rows_[heap_.front()])) continue;
+        std::pop_heap(heap_.begin(), heap_.end(), heap_cmp);
+        position = heap_.back();
+        order_by_rows_[position].swap(scratch_order_by_);
+      }
+      arrivals_[position] = arrival++;
+
+      auto &output_row = output_rows_[position];
+      output_row.clear();
+      for (const Symbol &output_sym : self_.output_symbols_) {
+        output_row.emplace_back(frame[output_sym]);
+      }
+      std::push_heap(heap_.begin(), heap_.end(), heap_cmp);
+    }
+
+    // Sorted from the first to the last row, the ones to skip are first.
+    std::sort_heap(heap_.begin(), heap_.end(), heap_cmp);
+    heap_it_ = heap_.begin() + static_cast<std::ptrdiff_t>(std::min<uint64_t>(skip, heap_.size()));
+  }
+
+  const TopK &self_;
+  const UniqueCursorPtr input_cursor_;
+  bool did_pull_all_{false};
+  // Values of the order by expressions and of the output symbols of the rows
+  // which are kept, they are filled on first Pull.
+  utils::pmr::vector<utils::pmr::vector<TypedValue>> order_by_rows_;
+  utils::pmr::vector<utils::pmr::vector<TypedValue>> output_rows_;
+  utils::pmr::vector<uint64_t> arrivals_;
+  utils::pmr::vector<size_t> heap_;
+  // iterator over the heap_, sorted after all input was pulled
+  decltype(heap_.begin()) heap_it_ = heap_.begin();
+  // Values of the order by expressions of the row being pulled.
+  utils::pmr::vector<TypedValue> scratch_order_by_;
+};
+
+UniqueCursorPtr TopK::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::TopKOperator);
+
+  return MakeUniqueCursorPtr<TopKCursor>(mem, *this, mem);
+}
+
 Merge::Merge(const std::shared_ptr<LogicalOperator> &input, const std::shared_ptr<LogicalOperator> &merge_match,
              const std::shared_ptr<LogicalOperator> &merge_create)
     : input_(input ? input : std::make_shared<Once>()), merge_match_(merge_match), merge_create_(merge_create) {}
@@ -22,6 +22,7 @@
 #include "query/common.hpp"
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/semantic/symbol.hpp"
+#include "query/interpret/compiled_expression.hpp"
 #include "query/plan/preprocess.hpp"
 #include "query/typed_value.hpp"
 #include "storage/v2/id_types.hpp"
@@ -29,6 +30,7 @@
 #include "utils/fnv.hpp"
 #include "utils/logging.hpp"
 #include "utils/memory.hpp"
+#include "utils/string.hpp"
 #include "utils/synchronized.hpp"
 #include "utils/visitor.hpp"
 
@@ -37,6 +39,7 @@ namespace memgraph::query {
 struct ExecutionContext;
 class ExpressionEvaluator;
 class Frame;
+class FrameBatch;
 class SymbolTable;
 
 namespace plan {
@@ -60,6 +63,22 @@ class Cursor {
   /// @throws QueryRuntimeException if something went wrong with execution
   virtual bool Pull(Frame &, ExecutionContext &) = 0;
 
+  /// Run iterations of a @c LogicalOperator until the @c FrameBatch is full or
+  /// the input is exhausted.
+  ///
+  /// The default implementation adapts @c Pull by pulling into
+  /// @c FrameBatch::frame and copying every row into the batch, so cursors
+  /// which don't implement batching keep working underneath batched ones.
+  /// Operators which produce rows override this to avoid a virtual call chain
+  /// for every row, while operators which transform rows (e.g. @c Filter)
+  /// process the whole batch in place. The batched mode is never used for
+  /// PROFILE queries, since the profiling data is gathered per @c Pull.
+  ///
+  /// @return false if no rows were pulled into the batch.
+  ///
+  /// @throws QueryRuntimeException if something went wrong with execution
+  virtual bool PullBatch(FrameBatch &, ExecutionContext &);
+
   /// Resets the Cursor to its initial state.
   virtual void Reset() = 0;
 
@@ -93,8 +112,11 @@ class ScanAllByLabel;
 class ScanAllByLabelPropertyRange;
 class ScanAllByLabelPropertyValue;
 class ScanAllByLabelProperty;
+class ScanAllByLabelProperties;
 class ScanAllById;
 class ScanAllByEdgeType;
+class ScanAllByEdgeTypePropertyValue;
+class ScanAllByEdgeTypePropertyRange;
 class Expand;
 class ExpandVariable;
 class ConstructNamedPath;
@@ -112,6 +134,7 @@ class Aggregate;
 class Skip;
 class Limit;
 class OrderBy;
+class TopK;
 class Merge;
 class Optional;
 class Unwind;
@@ -130,11 +153,13 @@ class RollUpApply;
 
 using LogicalOperatorCompositeVisitor =
     utils::CompositeVisitor<Once, CreateNode, CreateExpand, ScanAll, ScanAllByLabel, ScanAllByLabelPropertyRange,
-                            ScanAllByLabelPropertyValue, ScanAllByLabelProperty, ScanAllById, ScanAllByEdgeType, Expand,
+                            ScanAllByLabelPropertyValue, ScanAllByLabelProperty, ScanAllByLabelProperties, ScanAllById,
+                            ScanAllByEdgeType, ScanAllByEdgeTypePropertyValue, ScanAllByEdgeTypePropertyRange, Expand,
                             ExpandVariable, ConstructNamedPath, Filter, Produce, Delete, SetProperty, SetProperties,
                             SetLabels, RemoveProperty, RemoveLabels, EdgeUniquenessFilter, Accumulate, Aggregate, Skip,
-                            Limit, OrderBy, Merge, Optional, Unwind, Distinct, Union, Cartesian, CallProcedure, LoadCsv,
-                            Foreach, EmptyResult, EvaluatePatternFilter, Apply, IndexedJoin, HashJoin, RollUpApply>;
+                            Limit, OrderBy, TopK, Merge, Optional, Unwind, Distinct, Union, Cartesian, CallProcedure,
+                            LoadCsv, Foreach, EmptyResult, EvaluatePatternFilter, Apply, IndexedJoin, HashJoin,
+                            RollUpApply>;
 
 using LogicalOperatorLeafVisitor = utils::LeafVisitor<Once>;
 
@@ -626,6 +651,127 @@ class ScanAllByEdgeType : public memgraph::query::plan::LogicalOperator {
   }
 };
 
+/// Behaves like @c ScanAllByEdgeType, but produces only edges with given
+/// edge type and property value.
+///
+/// @sa ScanAllByEdgeType
+/// @sa ScanAllByEdgeTypePropertyRange
+class ScanAllByEdgeTypePropertyValue : public memgraph::query::plan::ScanAllByEdgeType {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  ScanAllByEdgeTypePropertyValue() = default;
+  /**
+   * Constructs the operator for given edge type and property value.
+   *
+   * @param input Preceding operator which will serve as the input.
+   * @param output_symbol Symbol where the edges will be stored.
+   * @param edge_type Edge type which the edge must have.
+   * @param property Property from which the value will be looked up from.
+   * @param expression Expression producing the value of the edge property.
+   * @param view storage::View used when obtaining edges.
+   */
+  ScanAllByEdgeTypePropertyValue(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol,
+                                 storage::EdgeTypeId edge_type, storage::PropertyId property,
+                                 std::string property_name, Expression *expression,
+                                 storage::View view = storage::View::OLD);
+
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+
+  storage::PropertyId property_;
+  std::string property_name_;
+  Expression *expression_;
+
+  std::string ToString() const override {
+    return fmt::format("ScanAllByEdgeTypePropertyValue ({0} :{1} {{{2}}})", output_symbol_.name(),
+                       dba_->EdgeTypeToName(edge_type_), dba_->PropertyToName(property_));
+  }
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<ScanAllByEdgeTypePropertyValue>();
+    object->input_ = input_ ? input_->Clone(storage) : nullptr;
+    object->output_symbol_ = output_symbol_;
+    object->view_ = view_;
+    object->edge_type_ = edge_type_;
+    object->property_ = property_;
+    object->property_name_ = property_name_;
+    object->expression_ = expression_ ? expression_->Clone(storage) : nullptr;
+    return object;
+  }
+};
+
+/// Behaves like @c ScanAllByEdgeType, but produces only edges with given
+/// edge type and property value which is inside a range (inclusive or
+/// exlusive).
+///
+/// @sa ScanAllByEdgeType
+/// @sa ScanAllByEdgeTypePropertyValue
+class ScanAllByEdgeTypePropertyRange : public memgraph::query::plan::ScanAllByEdgeType {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  /** Bound with expression which when evaluated produces the bound value. */
+  using Bound = utils::Bound<Expression *>;
+  ScanAllByEdgeTypePropertyRange() = default;
+  /**
+   * Constructs the operator for given edge type and property value in range
+   * (inclusive).
+   *
+   * Range bounds are optional, but only one bound can be left out.
+   *
+   * @param input Preceding operator which will serve as the input.
+   * @param output_symbol Symbol where the edges will be stored.
+   * @param edge_type Edge type which the edge must have.
+   * @param property Property from which the value will be looked up from.
+   * @param lower_bound Optional lower @c Bound.
+   * @param upper_bound Optional upper @c Bound.
+   * @param view storage::View used when obtaining edges.
+   */
+  ScanAllByEdgeTypePropertyRange(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol,
+                                 storage::EdgeTypeId edge_type, storage::PropertyId property,
+                                 std::string property_name, std::optional<Bound> lower_bound,
+                                 std::optional<Bound> upper_bound, storage::View view = storage::View::OLD);
+
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+
+  storage::PropertyId property_;
+  std::string property_name_;
+  std::optional<Bound> lower_bound_;
+  std::optional<Bound> upper_bound_;
+
+  std::string ToString() const override {
+    return fmt::format("ScanAllByEdgeTypePropertyRange ({0} :{1} {{{2}}})", output_symbol_.name(),
+                       dba_->EdgeTypeToName(edge_type_), dba_->PropertyToName(property_));
+  }
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<ScanAllByEdgeTypePropertyRange>();
+    object->input_ = input_ ? input_->Clone(storage) : nullptr;
+    object->output_symbol_ = output_symbol_;
+    object->view_ = view_;
+    object->edge_type_ = edge_type_;
+    object->property_ = property_;
+    object->property_name_ = property_name_;
+    if (lower_bound_) {
+      object->lower_bound_.emplace(
+          utils::Bound<Expression *>(lower_bound_->value()->Clone(storage), lower_bound_->type()));
+    } else {
+      object->lower_bound_ = std::nullopt;
+    }
+    if (upper_bound_) {
+      object->upper_bound_.emplace(
+          utils::Bound<Expression *>(upper_bound_->value()->Clone(storage), upper_bound_->type()));
+    } else {
+      object->upper_bound_ = std::nullopt;
+    }
+    return object;
+  }
+};
+
 /// Behaves like @c ScanAll, but produces only vertices with given label and
 /// property value which is inside a range (inclusive or exlusive).
 ///
@@ -790,6 +936,81 @@ class ScanAllByLabelProperty : public memgraph::query::plan::ScanAll {
   }
 };
 
+/// Behaves like @c ScanAll, but produces only vertices from the composite
+/// index on the label and an ordered list of properties. The values of the
+/// first properties are equal to the prefix expressions, and the value of the
+/// property after them is optionally inside a range.
+///
+/// @sa ScanAllByLabelPropertyValue
+/// @sa ScanAllByLabelPropertyRange
+class ScanAllByLabelProperties : public memgraph::query::plan::ScanAll {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  /** Bound with expression which when evaluated produces the bound value. */
+  using Bound = utils::Bound<Expression *>;
+  ScanAllByLabelProperties() = default;
+  /**
+   * Constructs the operator for given label and the prefix of the index
+   * properties.
+   *
+   * @param input Preceding operator which will serve as the input.
+   * @param output_symbol Symbol where the vertices will be stored.
+   * @param label Label which the vertex must have.
+   * @param properties All properties of the index, in the index order.
+   * @param prefix_expressions Expressions producing the values of the first properties.
+   * @param lower_bound Optional lower @c Bound on the property after the prefix.
+   * @param upper_bound Optional upper @c Bound on the property after the prefix.
+   * @param view storage::View used when obtaining vertices.
+   */
+  ScanAllByLabelProperties(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol,
+                           storage::LabelId label, std::vector<storage::PropertyId> properties,
+                           std::vector<Expression *> prefix_expressions, std::optional<Bound> lower_bound,
+                           std::optional<Bound> upper_bound, storage::View view = storage::View::OLD);
+
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+
+  storage::LabelId label_;
+  std::vector<storage::PropertyId> properties_;
+  std::vector<Expression *> prefix_expressions_;
+  std::optional<Bound> lower_bound_;
+  std::optional<Bound> upper_bound_;
+
+  std::string ToString() const override {
+    std::vector<std::string> property_names;
+    property_names.reserve(properties_.size());
+    for (const auto &property : properties_) {
+      property_names.push_back(dba_->PropertyToName(property));
+    }
+    return fmt::format("ScanAllByLabelProperties ({0} :{1} {{{2}}})", output_symbol_.name(), dba_->LabelToName(label_),
+                       utils::Join(property_names, ", "));
+  }
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<ScanAllByLabelProperties>();
+    object->input_ = input_ ? input_->Clone(storage) : nullptr;
+    object->output_symbol_ = output_symbol_;
+    object->view_ = view_;
+    object->label_ = label_;
+    object->properties_ = properties_;
+    object->prefix_expressions_.reserve(prefix_expressions_.size());
+    for (auto *expression : prefix_expressions_) {
+      object->prefix_expressions_.push_back(expression->Clone(storage));
+    }
+    if (lower_bound_) {
+      object->lower_bound_.emplace(
+          utils::Bound<Expression *>(lower_bound_->value()->Clone(storage), lower_bound_->type()));
+    }
+    if (upper_bound_) {
+      object->upper_bound_.emplace(
+          utils::Bound<Expression *>(upper_bound_->value()->Clone(storage), upper_bound_->type()));
+    }
+    return object;
+  }
+};
+
 /// ScanAll producing a single node with ID equal to evaluated expression
 class ScanAllById : public memgraph::query::plan::ScanAll {
  public:
@@ -890,6 +1111,7 @@ class Expand : public memgraph::query::plan::LogicalOperator {
     ExpandCursor(const Expand &, utils::MemoryResource *);
     ExpandCursor(const Expand &, int64_t input_degree, int64_t existing_node_degree, utils::MemoryResource *);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullBatch(FrameBatch &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
     ExpansionInfo GetExpansionInfo(Frame &);
@@ -915,6 +1137,7 @@ class Expand : public memgraph::query::plan::LogicalOperator {
     int64_t prev_existing_degree_{-1};
 
     bool InitEdges(Frame &, ExecutionContext &);
+    bool PullNext(Frame &, ExecutionContext &);
   };
 
   std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
@@ -1225,17 +1448,30 @@ class Filter : public memgraph::query::plan::LogicalOperator {
   }
 
  private:
+  // Shared by all the executions of the plan, see CompiledExpressionCache.
+  mutable CompiledExpressionCache compiled_expression_;
+
   class FilterCursor : public Cursor {
    public:
     FilterCursor(const Filter &, utils::MemoryResource *);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullBatch(FrameBatch &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
 
    private:
+    /// Looks up the compiled filter expression on the first pull.
+    void PrepareExpression(const ExecutionContext &context);
+    bool IsSatisfied(ExpressionEvaluator &evaluator) const;
+
     const Filter &self_;
     const UniqueCursorPtr input_cursor_;
     const std::vector<UniqueCursorPtr> pattern_filter_cursors_;
+    // Reused by every batch pull, so its capacity is allocated only once.
+    utils::pmr::vector<TypedValue> batch_results_;
+    bool expression_prepared_{false};
+    std::shared_ptr<const CompiledExpression> compiled_expression_;
+    CompiledExpression::Parameters compiled_parameters_;
   };
 };
 
@@ -1288,6 +1524,7 @@ class Produce : public memgraph::query::plan::LogicalOperator {
    public:
     ProduceCursor(const Produce &, utils::MemoryResource *);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullBatch(FrameBatch &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
 
@@ -2040,6 +2277,61 @@ class OrderBy : public memgraph::query::plan::LogicalOperator {
   }
 };
 
+/// Logical operator for returning the first rows of the sorted input.
+///
+/// Does the same as an OrderBy followed by an optional Skip and a Limit, but
+/// keeps only the `skip + limit` rows which sort first in a bounded heap
+/// instead of materializing and sorting all the input rows.
+///
+/// Like in Skip and Limit, the skip and limit expressions must NOT use
+/// anything from the Frame. They are evaluated before the first Pull from the
+/// input and the input isn't Pulled at all when the limit is 0.
+class TopK : public memgraph::query::plan::LogicalOperator {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  TopK() = default;
+
+  TopK(const std::shared_ptr<LogicalOperator> &input, const std::vector<SortItem> &order_by,
+       const std::vector<Symbol> &output_symbols, Expression *skip, Expression *limit);
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+  std::vector<Symbol> OutputSymbols(const SymbolTable &) const override;
+  std::vector<Symbol> ModifiedSymbols(const SymbolTable &) const override;
+
+  bool HasSingleInput() const override { return true; }
+  std::shared_ptr<LogicalOperator> input() const override { return input_; }
+  void set_input(std::shared_ptr<LogicalOperator> input) override { input_ = input; }
+
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
+  TypedValueVectorCompare compare_;
+  std::vector<Expression *> order_by_;
+  std::vector<Symbol> output_symbols_;
+  // Optional, no rows are skipped if it's nullptr.
+  Expression *skip_{nullptr};
+  Expression *limit_{nullptr};
+
+  std::string ToString() const override {
+    return fmt::format("TopK {{{}}}",
+                       utils::IterableToString(output_symbols_, ", ", [](const auto &sym) { return sym.name(); }));
+  }
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<TopK>();
+    object->input_ = input_ ? input_->Clone(storage) : nullptr;
+    object->compare_ = compare_;
+    object->order_by_.resize(order_by_.size());
+    for (size_t i = 0; i < order_by_.size(); ++i) {
+      object->order_by_[i] = order_by_[i] ? order_by_[i]->Clone(storage) : nullptr;
+    }
+    object->output_symbols_ = output_symbols_;
+    object->skip_ = skip_ ? skip_->Clone(storage) : nullptr;
+    object->limit_ = limit_ ? limit_->Clone(storage) : nullptr;
+    return object;
+  }
+};
+
 /// Merge operator. For every sucessful Pull from the
 /// input operator a Pull from the merge_match is attempted. All
 /// successfull Pulls from the merge_match are passed on as output.
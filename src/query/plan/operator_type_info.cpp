@@ -47,11 +47,22 @@ constexpr utils::TypeInfo query::plan::ScanAllByLabelPropertyValue::kType{
 constexpr utils::TypeInfo query::plan::ScanAllByLabelProperty::kType{
     utils::TypeId::SCAN_ALL_BY_LABEL_PROPERTY, "ScanAllByLabelProperty", &query::plan::ScanAll::kType};
 
+constexpr utils::TypeInfo query::plan::ScanAllByLabelProperties::kType{
+    utils::TypeId::SCAN_ALL_BY_LABEL_PROPERTIES, "ScanAllByLabelProperties", &query::plan::ScanAll::kType};
+
 constexpr utils::TypeInfo query::plan::ScanAllById::kType{utils::TypeId::SCAN_ALL_BY_ID, "ScanAllById",
                                                           &query::plan::ScanAll::kType};
 constexpr utils::TypeInfo query::plan::ScanAllByEdgeType::kType{utils::TypeId::SCAN_ALL_BY_EDGE_TYPE,
                                                                 "ScanAllByEdgeType", &query::plan::ScanAll::kType};
 
+constexpr utils::TypeInfo query::plan::ScanAllByEdgeTypePropertyValue::kType{
+    utils::TypeId::SCAN_ALL_BY_EDGE_TYPE_PROPERTY_VALUE, "ScanAllByEdgeTypePropertyValue",
+    &query::plan::ScanAllByEdgeType::kType};
+
+constexpr utils::TypeInfo query::plan::ScanAllByEdgeTypePropertyRange::kType{
+    utils::TypeId::SCAN_ALL_BY_EDGE_TYPE_PROPERTY_RANGE, "ScanAllByEdgeTypePropertyRange",
+    &query::plan::ScanAllByEdgeType::kType};
+
 constexpr utils::TypeInfo query::plan::ExpandCommon::kType{utils::TypeId::EXPAND_COMMON, "ExpandCommon", nullptr};
 
 constexpr utils::TypeInfo query::plan::Expand::kType{utils::TypeId::EXPAND, "Expand",
@@ -115,6 +126,8 @@ constexpr utils::TypeInfo query::plan::Limit::kType{utils::TypeId::LIMIT, "Limit
 constexpr utils::TypeInfo query::plan::OrderBy::kType{utils::TypeId::ORDERBY, "OrderBy",
                                                       &query::plan::LogicalOperator::kType};
 
+constexpr utils::TypeInfo query::plan::TopK::kType{utils::TypeId::TOP_K, "TopK", &query::plan::LogicalOperator::kType};
+
 constexpr utils::TypeInfo query::plan::Merge::kType{utils::TypeId::MERGE, "Merge",
                                                     &query::plan::LogicalOperator::kType};
 
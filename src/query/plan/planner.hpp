@@ -51,10 +51,13 @@ class PostProcessor final {
   PostProcessor(Parameters parameters, std::vector<IndexHint> index_hints, TDbAccessor *db)
       : parameters_(std::move(parameters)), index_hints_(IndexHints(index_hints, db)) {}
 
+  /// With `use_indexed_joins` false, a Cartesian isn't turned into an
+  /// IndexedJoin, so it becomes a HashJoin if it has an equality condition.
   template <class TPlanningContext>
-  std::unique_ptr<LogicalOperator> Rewrite(std::unique_ptr<LogicalOperator> plan, TPlanningContext *context) {
-    auto index_lookup_plan =
-        RewriteWithIndexLookup(std::move(plan), context->symbol_table, context->ast_storage, context->db, index_hints_);
+  std::unique_ptr<LogicalOperator> Rewrite(std::unique_ptr<LogicalOperator> plan, TPlanningContext *context,
+                                           bool use_indexed_joins = true) {
+    auto index_lookup_plan = RewriteWithIndexLookup(std::move(plan), context->symbol_table, context->ast_storage,
+                                                    context->db, index_hints_, use_indexed_joins);
     auto join_plan =
         RewriteWithJoinRewriter(std::move(index_lookup_plan), context->symbol_table, context->ast_storage, context->db);
     auto edge_index_plan = RewriteWithEdgeTypeIndexRewriter(std::move(join_plan), context->symbol_table,
@@ -110,21 +113,17 @@ auto MakeLogicalPlan(TPlanningContext *context, TPlanPostProcess *post_process,
 
   std::optional<ProcessedPlan> curr_plan;
   if (use_variable_planner) {
-    auto plans = MakeLogicalPlanForSingleQuery<VariableStartPlanner>(query_parts, context);
-    for (auto plan : plans) {
-      // Plans are generated lazily and the current plan will disappear, so
-      // it's ok to move it.
-      auto rewritten_plan = post_process->Rewrite(std::move(plan), context);
+    auto consider_plan = [&](ProcessedPlan rewritten_plan) {
       auto plan_cost = post_process->EstimatePlanCost(rewritten_plan, &vertex_counts, *context->symbol_table);
       // if we have a plan that uses index hints, we reject all the plans that don't use index hinting because we want
       // to force the plan using the index hints to be executed
-      if (curr_uses_index_hint && !plan_cost.use_index_hints) continue;
+      if (curr_uses_index_hint && !plan_cost.use_index_hints) return;
       // if a plan uses index hints, and there is currently not yet a plan that utilizes it, we will take it regardless
       if (plan_cost.use_index_hints && !curr_uses_index_hint) {
         curr_uses_index_hint = plan_cost.use_index_hints;
         curr_plan.emplace(std::move(rewritten_plan));
         total_cost = plan_cost.cost;
-        continue;
+        return;
       }
       // if both plans either use or don't use index hints, we want to use the one with the least cost
       if (!curr_plan || plan_cost.cost < total_cost) {
@@ -132,6 +131,20 @@ auto MakeLogicalPlan(TPlanningContext *context, TPlanPostProcess *post_process,
         curr_plan.emplace(std::move(rewritten_plan));
         total_cost = plan_cost.cost;
       }
+    };
+    auto plans = MakeLogicalPlanForSingleQuery<VariableStartPlanner>(query_parts, context);
+    for (auto plan : plans) {
+      // A join of two branches can look up the vertices of one branch in an
+      // index by the values of the other one, or hash one of the branches.
+      // Both are costed and the IndexedJoin is kept if they cost the same.
+      std::unique_ptr<LogicalOperator> hash_join_plan;
+      if (HasCartesian(*plan)) hash_join_plan = plan->Clone(context->ast_storage);
+      // Plans are generated lazily and the current plan will disappear, so
+      // it's ok to move it.
+      consider_plan(post_process->Rewrite(std::move(plan), context));
+      if (hash_join_plan) {
+        consider_plan(post_process->Rewrite(std::move(hash_join_plan), context, /*use_indexed_joins=*/false));
+      }
     }
   } else {
     auto plan = MakeLogicalPlanForSingleQuery<RuleBasedPlanner>(query_parts, context);
@@ -148,6 +161,7 @@ auto MakeLogicalPlan(TPlanningContext *context, TPlanPostProcess *post_process,
 template <class TPlanningContext>
 auto MakeLogicalPlan(TPlanningContext *context, const Parameters &parameters, bool use_variable_planner) {
   PostProcessor post_processor(parameters, context->query->index_hints_, context->db);
+  context->parameters = &parameters;
   return MakeLogicalPlan(context, &post_processor, use_variable_planner);
 }
 
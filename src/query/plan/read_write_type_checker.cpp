@@ -36,6 +36,7 @@ PRE_VISIT(ScanAllByLabel, RWType::R, true)
 PRE_VISIT(ScanAllByLabelPropertyRange, RWType::R, true)
 PRE_VISIT(ScanAllByLabelPropertyValue, RWType::R, true)
 PRE_VISIT(ScanAllByLabelProperty, RWType::R, true)
+PRE_VISIT(ScanAllByLabelProperties, RWType::R, true)
 PRE_VISIT(ScanAllById, RWType::R, true)
 
 PRE_VISIT(Expand, RWType::R, true)
@@ -62,6 +63,7 @@ PRE_VISIT(Aggregate, RWType::NONE, true)
 PRE_VISIT(Skip, RWType::NONE, true)
 PRE_VISIT(Limit, RWType::NONE, true)
 PRE_VISIT(OrderBy, RWType::NONE, true)
+PRE_VISIT(TopK, RWType::NONE, true)
 PRE_VISIT(Distinct, RWType::NONE, true)
 
 bool ReadWriteTypeChecker::PreVisit(Union &op) {
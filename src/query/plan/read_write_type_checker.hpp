@@ -59,6 +59,7 @@ struct ReadWriteTypeChecker : public virtual HierarchicalLogicalOperatorVisitor
   bool PreVisit(ScanAllByLabelPropertyValue &) override;
   bool PreVisit(ScanAllByLabelPropertyRange &) override;
   bool PreVisit(ScanAllByLabelProperty &) override;
+  bool PreVisit(ScanAllByLabelProperties &) override;
   bool PreVisit(ScanAllById &) override;
 
   bool PreVisit(Expand &) override;
@@ -80,6 +81,7 @@ struct ReadWriteTypeChecker : public virtual HierarchicalLogicalOperatorVisitor
   bool PreVisit(Skip &) override;
   bool PreVisit(Limit &) override;
   bool PreVisit(OrderBy &) override;
+  bool PreVisit(TopK &) override;
   bool PreVisit(Distinct &) override;
   bool PreVisit(Union &) override;
 
@@ -11,8 +11,9 @@
 
 /// @file
 /// This file provides a plan rewriter which replaces `ScanAll` and `Expand`
-/// operations with `ScanAllByEdgeType` if possible. The public entrypoint is
-/// `RewriteWithEdgeTypeIndexRewriter`.
+/// operations with `ScanAllByEdgeType` if possible, or with an edge-type+property
+/// index scan if the edge is filtered by an indexed property. The public
+/// entrypoint is `RewriteWithEdgeTypeIndexRewriter`.
 
 #pragma once
 
@@ -51,8 +52,19 @@ class EdgeTypeIndexRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
-  bool PostVisit(Filter & /*op*/) override {
+  // Remove the filter expressions which are satisfied by an indexed edge scan,
+  // and the whole Filter if nothing is left of it.
+  bool PostVisit(Filter &op) override {
     prev_ops_.pop_back();
+    ExpressionRemovalResult removal = RemoveExpressions(op.expression_, filter_exprs_for_removal_);
+    op.expression_ = removal.trimmed_expression;
+    if (op.expression_) {
+      Filters leftover_filters;
+      leftover_filters.CollectFilterExpression(op.expression_, *symbol_table_);
+      op.all_filters_ = std::move(leftover_filters);
+    } else {
+      SetOnParent(op.input());
+    }
     return true;
   }
 
@@ -85,9 +97,15 @@ class EdgeTypeIndexRewriter final : public HierarchicalLogicalOperatorVisitor {
       const bool expansion_is_named = !(op.common_.edge_symbol.IsSymbolAnonym());
       const bool expdanded_node_not_named = op.common_.node_symbol.IsSymbolAnonym();
 
+      const bool filters_only_on_edge = FiltersOnlyUse(op.common_.edge_symbol);
+
       edge_type_index_exist = only_one_edge_type ? db_->EdgeTypeIndexExists(op.common_.edge_types.front()) : false;
+      if (only_one_edge_type) {
+        edge_property_filter_ = FindEdgeTypePropertyFilter(op.common_.edge_types.front(), op.common_.edge_symbol);
+      }
 
-      scanall_under_expand_ = only_one_edge_type && expansion_is_named && expdanded_node_not_named;
+      scanall_under_expand_ =
+          only_one_edge_type && expansion_is_named && expdanded_node_not_named && filters_only_on_edge;
     }
 
     return true;
@@ -236,6 +254,15 @@ class EdgeTypeIndexRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PreVisit(ScanAllByLabelProperties &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(ScanAllByLabelProperties &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
   bool PreVisit(ScanAllById &op) override {
     prev_ops_.push_back(&op);
     return true;
@@ -254,6 +281,24 @@ class EdgeTypeIndexRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PreVisit(ScanAllByEdgeTypePropertyValue &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(ScanAllByEdgeTypePropertyValue &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
+  bool PreVisit(ScanAllByEdgeTypePropertyRange &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(ScanAllByEdgeTypePropertyRange &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
   bool PreVisit(ConstructNamedPath &op) override {
     prev_ops_.push_back(&op);
     return true;
@@ -268,6 +313,12 @@ class EdgeTypeIndexRewriter final : public HierarchicalLogicalOperatorVisitor {
 
     if (op.input()->GetTypeInfo() == Expand::kType) {
       expand_under_produce_ = true;
+    } else if (op.input()->GetTypeInfo() == Filter::kType &&
+               op.input()->input()->GetTypeInfo() == Expand::kType) {
+      // Only the Filter directly above the Expand is considered, filters
+      // further up may be separated from it by operators such as Limit.
+      expand_under_produce_ = true;
+      filters_.CollectFilterExpression(static_cast<Filter *>(op.input().get())->expression_, *symbol_table_);
     }
 
     return true;
@@ -394,6 +445,15 @@ class EdgeTypeIndexRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PreVisit(TopK &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(TopK &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
   bool PreVisit(Unwind &op) override {
     prev_ops_.push_back(&op);
     return true;
@@ -492,12 +552,43 @@ class EdgeTypeIndexRewriter final : public HierarchicalLogicalOperatorVisitor {
   std::unordered_set<Symbol> cartesian_symbols_;
 
   bool EdgeTypeIndexingPossible() const {
-    return expand_under_produce_ && scanall_under_expand_ && once_under_scanall_ && edge_type_index_exist;
+    return expand_under_produce_ && scanall_under_expand_ && once_under_scanall_ &&
+           (edge_type_index_exist || edge_property_filter_);
   }
   bool expand_under_produce_ = false;
   bool scanall_under_expand_ = false;
   bool once_under_scanall_ = false;
   bool edge_type_index_exist = false;
+  // Property filter on the expanded edge which can be answered by an
+  // edge-type+property index.
+  std::optional<FilterInfo> edge_property_filter_;
+
+  // The expanded vertices are dropped from the plan, so nothing else may be
+  // filtering on them.
+  bool FiltersOnlyUse(const Symbol &edge_symbol) const {
+    return std::ranges::all_of(filters_, [&edge_symbol](const auto &filter) {
+      return std::ranges::all_of(filter.used_symbols,
+                                 [&edge_symbol](const auto &symbol) { return symbol == edge_symbol; });
+    });
+  }
+
+  std::optional<FilterInfo> FindEdgeTypePropertyFilter(storage::EdgeTypeId edge_type, const Symbol &edge_symbol) {
+    std::optional<FilterInfo> found;
+    for (const auto &filter : filters_.PropertyFilters(edge_symbol)) {
+      const auto &property_filter = *filter.property_filter;
+      if (property_filter.is_symbol_in_value_) continue;
+      if (property_filter.type_ != PropertyFilter::Type::EQUAL && property_filter.type_ != PropertyFilter::Type::RANGE) {
+        continue;
+      }
+      if (!db_->EdgeTypePropertyIndexExists(edge_type, db_->NameToProperty(property_filter.property_.name))) continue;
+      // Prefer point lookups over range scans.
+      if (!found || (property_filter.type_ == PropertyFilter::Type::EQUAL &&
+                     found->property_filter->type_ != PropertyFilter::Type::EQUAL)) {
+        found = filter;
+      }
+    }
+    return found;
+  }
 
   bool DefaultPreVisit() override {
     throw utils::NotYetImplemented("Operator not yet covered by EdgeTypeIndexRewriter");
@@ -510,6 +601,20 @@ class EdgeTypeIndexRewriter final : public HierarchicalLogicalOperatorVisitor {
 
     // Extract edge_type from symbol
     auto edge_type = expand.common_.edge_types.front();
+
+    if (edge_property_filter_) {
+      const auto &property_filter = *edge_property_filter_->property_filter;
+      const auto property = db_->NameToProperty(property_filter.property_.name);
+      filter_exprs_for_removal_.insert(edge_property_filter_->expression);
+      if (property_filter.type_ == PropertyFilter::Type::EQUAL) {
+        return std::make_unique<ScanAllByEdgeTypePropertyValue>(input, output_symbol, edge_type, property,
+                                                                property_filter.property_.name,
+                                                                property_filter.value_, view);
+      }
+      return std::make_unique<ScanAllByEdgeTypePropertyRange>(
+          input, output_symbol, edge_type, property, property_filter.property_.name, property_filter.lower_bound_,
+          property_filter.upper_bound_, view);
+    }
     return std::make_unique<ScanAllByEdgeType>(input, output_symbol, edge_type, view);
   }
 
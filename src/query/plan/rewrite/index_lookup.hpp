@@ -108,8 +108,13 @@ struct HashPair {
 template <class TDbAccessor>
 class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
  public:
-  IndexLookupRewriter(SymbolTable *symbol_table, AstStorage *ast_storage, TDbAccessor *db, IndexHints index_hints)
-      : symbol_table_(symbol_table), ast_storage_(ast_storage), db_(db), index_hints_(std::move(index_hints)) {}
+  IndexLookupRewriter(SymbolTable *symbol_table, AstStorage *ast_storage, TDbAccessor *db, IndexHints index_hints,
+                      bool use_indexed_joins = true)
+      : symbol_table_(symbol_table),
+        ast_storage_(ast_storage),
+        db_(db),
+        index_hints_(std::move(index_hints)),
+        use_indexed_joins_(use_indexed_joins) {}
 
   using HierarchicalLogicalOperatorVisitor::PostVisit;
   using HierarchicalLogicalOperatorVisitor::PreVisit;
@@ -285,7 +290,9 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     // we add the symbols that we encountered in the left part of the cartesian
     // the reason for that is that in right part of the cartesian, we could be
     // possibly using an indexed operation instead of a scan all
-    additional_bound_symbols_.insert(op.left_symbols_.begin(), op.left_symbols_.end());
+    if (use_indexed_joins_) {
+      additional_bound_symbols_.insert(op.left_symbols_.begin(), op.left_symbols_.end());
+    }
     op.right_op_->Accept(*this);
 
     return false;
@@ -380,6 +387,15 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PreVisit(ScanAllByLabelProperties &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(ScanAllByLabelProperties &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
   bool PreVisit(ScanAllById &op) override {
     prev_ops_.push_back(&op);
     return true;
@@ -524,6 +540,15 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PreVisit(TopK &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(TopK &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
   bool PreVisit(Unwind &op) override {
     prev_ops_.push_back(&op);
     return true;
@@ -620,6 +645,9 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
   std::unordered_set<Expression *> filter_exprs_for_removal_;
   std::vector<LogicalOperator *> prev_ops_;
   IndexHints index_hints_;
+  // If false, the right branch of a Cartesian doesn't look up vertices by the
+  // values of the left one, so the join is left to the JoinRewriter.
+  bool use_indexed_joins_;
 
   // additional symbols that are present from other non-main branches but have influence on indexing
   std::unordered_set<Symbol> additional_bound_symbols_;
@@ -632,6 +660,16 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     std::optional<storage::LabelPropertyIndexStats> index_stats;
   };
 
+  struct LabelPropertiesIndex {
+    LabelIx label;
+    std::vector<storage::PropertyId> properties;
+    // Equality filters on the first properties of the index, in their order.
+    std::vector<FilterInfo> prefix_filters;
+    // Range filter on the property which follows the prefix.
+    std::optional<FilterInfo> range_filter;
+    int64_t vertex_count;
+  };
+
   bool DefaultPreVisit() override { throw utils::NotYetImplemented("optimizing index lookup"); }
 
   void SetOnParent(const std::shared_ptr<LogicalOperator> &input) {
@@ -660,7 +698,7 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
   }
 
   void RewriteBranch(std::shared_ptr<LogicalOperator> *branch) {
-    IndexLookupRewriter<TDbAccessor> rewriter(symbol_table_, ast_storage_, db_, index_hints_);
+    IndexLookupRewriter<TDbAccessor> rewriter(symbol_table_, ast_storage_, db_, index_hints_, use_indexed_joins_);
     (*branch)->Accept(rewriter);
     if (rewriter.new_root_) {
       *branch = rewriter.new_root_;
@@ -721,7 +759,12 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
 
         const auto &property = filter.property_filter->property_;
         if (!db_->LabelPropertyIndexExists(GetLabel(label), GetProperty(property))) {
-          continue;
+          // A hash index only answers lookups by value.
+          const auto type = filter.property_filter->type_;
+          if ((type != PropertyFilter::Type::EQUAL && type != PropertyFilter::Type::IN) ||
+              !db_->LabelPropertyHashIndexExists(GetLabel(label), GetProperty(property))) {
+            continue;
+          }
         }
         candidate_indices.emplace_back(
             IndexHint{.index_type_ = IndexHint::IndexType::LABEL_PROPERTY, .label_ = label, .property_ = property},
@@ -817,6 +860,67 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     return found;
   }
 
+  // Finds the label+properties index which matches the longest prefix of its
+  // properties with equality filters, optionally followed by a range filter on
+  // the next property. An index matching a single property is used only if
+  // there is no label+property index on it. Among the indices matching the
+  // same number of properties, the one with less vertices is chosen. If the
+  // index cannot be found, nullopt is returned.
+  std::optional<LabelPropertiesIndex> FindBestLabelPropertiesIndex(const Symbol &symbol,
+                                                                   const std::unordered_set<Symbol> &bound_symbols,
+                                                                   const std::unordered_set<LabelIx> &labels) {
+    // Index hints name label+property indices, respect them.
+    if (!index_hints_.label_property_index_hints_.empty()) return std::nullopt;
+
+    auto are_bound = [&bound_symbols](const auto &used_symbols) {
+      for (const auto &used_symbol : used_symbols) {
+        if (!utils::Contains(bound_symbols, used_symbol)) {
+          return false;
+        }
+      }
+      return true;
+    };
+    const auto property_filters = filters_.PropertyFilters(symbol);
+    auto find_filter = [&](storage::PropertyId property, PropertyFilter::Type type) -> std::optional<FilterInfo> {
+      for (const auto &filter : property_filters) {
+        const auto &property_filter = *filter.property_filter;
+        if (property_filter.type_ != type || property_filter.is_symbol_in_value_ || !are_bound(filter.used_symbols)) {
+          continue;
+        }
+        if (GetProperty(property_filter.property_) == property) return filter;
+      }
+      return std::nullopt;
+    };
+
+    std::optional<LabelPropertiesIndex> found;
+    for (const auto &label : labels) {
+      for (auto &properties : db_->LabelPropertyCompositeIndices(GetLabel(label))) {
+        std::vector<FilterInfo> prefix_filters;
+        for (const auto property : properties) {
+          auto filter = find_filter(property, PropertyFilter::Type::EQUAL);
+          if (!filter) break;
+          prefix_filters.push_back(std::move(*filter));
+        }
+        std::optional<FilterInfo> range_filter;
+        if (prefix_filters.size() < properties.size()) {
+          range_filter = find_filter(properties[prefix_filters.size()], PropertyFilter::Type::RANGE);
+        }
+        const auto matched = prefix_filters.size() + (range_filter ? 1 : 0);
+        if (matched == 0) continue;
+        if (matched == 1 && db_->LabelPropertyIndexExists(GetLabel(label), properties[0])) continue;
+
+        const int64_t vertex_count = db_->VerticesCount(GetLabel(label), properties, {});
+        if (found) {
+          const auto found_matched = found->prefix_filters.size() + (found->range_filter ? 1 : 0);
+          if (matched < found_matched || (matched == found_matched && vertex_count >= found->vertex_count)) continue;
+        }
+        found = LabelPropertiesIndex{label, std::move(properties), std::move(prefix_filters), std::move(range_filter),
+                                     vertex_count};
+      }
+    }
+    return found;
+  }
+
   // Creates a ScanAll by the best possible index for the `node_symbol`. If the node
   // does not have at least a label, no indexed lookup can be created and
   // `nullptr` is returned. The operator is chained after `input`. Optional
@@ -859,6 +963,32 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
       // Without labels, we cannot generate any indexed ScanAll.
       return nullptr;
     }
+    auto found_composite_index = FindBestLabelPropertiesIndex(node_symbol, bound_symbols, labels);
+    if (found_composite_index &&
+        // Use label+properties index if we satisfy max_vertex_count.
+        (!max_vertex_count || *max_vertex_count >= found_composite_index->vertex_count)) {
+      std::vector<Expression *> prefix_expressions;
+      for (const auto &filter : found_composite_index->prefix_filters) {
+        prefix_expressions.push_back(filter.property_filter->value_);
+        filter_exprs_for_removal_.insert(filter.expression);
+        filters_.EraseFilter(filter);
+      }
+      std::optional<PropertyFilter::Bound> lower_bound;
+      std::optional<PropertyFilter::Bound> upper_bound;
+      if (found_composite_index->range_filter) {
+        const auto &range_filter = *found_composite_index->range_filter;
+        lower_bound = range_filter.property_filter->lower_bound_;
+        upper_bound = range_filter.property_filter->upper_bound_;
+        filter_exprs_for_removal_.insert(range_filter.expression);
+        filters_.EraseFilter(range_filter);
+      }
+      std::vector<Expression *> removed_expressions;
+      filters_.EraseLabelFilter(node_symbol, found_composite_index->label, &removed_expressions);
+      filter_exprs_for_removal_.insert(removed_expressions.begin(), removed_expressions.end());
+      return std::make_unique<ScanAllByLabelProperties>(input, node_symbol, GetLabel(found_composite_index->label),
+                                                        std::move(found_composite_index->properties),
+                                                        std::move(prefix_expressions), lower_bound, upper_bound, view);
+    }
     auto found_index = FindBestLabelPropertyIndex(node_symbol, bound_symbols);
     if (found_index &&
         // Use label+property index if we satisfy max_vertex_count.
@@ -927,8 +1057,9 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
 template <class TDbAccessor>
 std::unique_ptr<LogicalOperator> RewriteWithIndexLookup(std::unique_ptr<LogicalOperator> root_op,
                                                         SymbolTable *symbol_table, AstStorage *ast_storage,
-                                                        TDbAccessor *db, IndexHints index_hints) {
-  impl::IndexLookupRewriter<TDbAccessor> rewriter(symbol_table, ast_storage, db, index_hints);
+                                                        TDbAccessor *db, IndexHints index_hints,
+                                                        bool use_indexed_joins = true) {
+  impl::IndexLookupRewriter<TDbAccessor> rewriter(symbol_table, ast_storage, db, index_hints, use_indexed_joins);
   root_op->Accept(rewriter);
   if (rewriter.new_root_) {
     // This shouldn't happen in real use case, because IndexLookupRewriter
@@ -240,6 +240,15 @@ class JoinRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PreVisit(ScanAllByLabelProperties &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(ScanAllByLabelProperties &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
   bool PreVisit(ScanAllById &op) override {
     prev_ops_.push_back(&op);
     return true;
@@ -384,6 +393,15 @@ class JoinRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PreVisit(TopK &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(TopK &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
   bool PreVisit(Unwind &op) override {
     prev_ops_.push_back(&op);
     return true;
@@ -559,8 +577,32 @@ class JoinRewriter final : public HierarchicalLogicalOperatorVisitor {
   }
 };
 
+class CartesianFinder final : public HierarchicalLogicalOperatorVisitor {
+ public:
+  using HierarchicalLogicalOperatorVisitor::PostVisit;
+  using HierarchicalLogicalOperatorVisitor::PreVisit;
+  using HierarchicalLogicalOperatorVisitor::Visit;
+
+  bool Visit(Once &) override { return true; }
+
+  bool PreVisit(Cartesian &) override {
+    found_ = true;
+    return false;
+  }
+
+  bool found_{false};
+};
+
 }  // namespace impl
 
+/// Returns true if the plan has a Cartesian, which the rewriters can turn
+/// either into an IndexedJoin or into a HashJoin.
+inline bool HasCartesian(LogicalOperator &plan) {
+  impl::CartesianFinder finder;
+  plan.Accept(finder);
+  return finder.found_;
+}
+
 template <class TDbAccessor>
 std::unique_ptr<LogicalOperator> RewriteWithJoinRewriter(std::unique_ptr<LogicalOperator> root_op,
                                                          SymbolTable *symbol_table, AstStorage *ast_storage,
@@ -525,16 +525,23 @@ std::unique_ptr<LogicalOperator> GenReturnBody(std::unique_ptr<LogicalOperator>
   }
   // Like Where, OrderBy can read from symbols established by named expressions
   // in Produce, so it must come after it.
-  if (!body.order_by().empty()) {
-    last_op = std::make_unique<OrderBy>(std::move(last_op), body.order_by(), body.output_symbols());
-  }
-  // Finally, Skip and Limit must come after OrderBy.
-  if (body.skip()) {
-    last_op = std::make_unique<Skip>(std::move(last_op), body.skip());
-  }
-  // Limit is always after Skip.
-  if (body.limit()) {
-    last_op = std::make_unique<Limit>(std::move(last_op), body.limit());
+  if (!body.order_by().empty() && body.limit()) {
+    // Only the first skip + limit rows are ever returned, so they are kept in
+    // a bounded heap instead of sorting the whole input.
+    last_op =
+        std::make_unique<TopK>(std::move(last_op), body.order_by(), body.output_symbols(), body.skip(), body.limit());
+  } else {
+    if (!body.order_by().empty()) {
+      last_op = std::make_unique<OrderBy>(std::move(last_op), body.order_by(), body.output_symbols());
+    }
+    // Finally, Skip and Limit must come after OrderBy.
+    if (body.skip()) {
+      last_op = std::make_unique<Skip>(std::move(last_op), body.skip());
+    }
+    // Limit is always after Skip.
+    if (body.limit()) {
+      last_op = std::make_unique<Limit>(std::move(last_op), body.limit());
+    }
   }
   // Where may see new symbols so it comes after we generate Produce and in
   // general, comes after any OrderBy, Skip or Limit.
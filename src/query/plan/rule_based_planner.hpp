@@ -19,6 +19,7 @@
 #include "flags/run_time_configurable.hpp"
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/ast/ast_visitor.hpp"
+#include "query/parameters.hpp"
 #include "query/plan/operator.hpp"
 #include "query/plan/preprocess.hpp"
 #include "utils/exceptions.hpp"
@@ -51,6 +52,9 @@ struct PlanningContext {
   /// written information.
   std::unordered_set<Symbol> bound_symbols{};
   bool is_write_query{false};
+  /// @brief Values of the query parameters, used for estimating how many
+  /// vertices a filter matches. May be null.
+  const Parameters *parameters{nullptr};
 };
 
 template <class TDbAccessor>
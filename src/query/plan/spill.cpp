@@ -0,0 +1,271 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/plan/spill.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <system_error>
+
+#include <fmt/format.h>
+
+#include "flags/general.hpp"
+#include "query/db_accessor.hpp"
+#include "query/exceptions.hpp"
+#include "query/path.hpp"
+#include "storage/v2/id_types.hpp"
+#include "utils/file.hpp"
+#include "utils/temporal.hpp"
+
+namespace memgraph::query::plan {
+
+namespace {
+constexpr size_t kSpillBufferSize = 64UL * 1024UL;
+}  // namespace
+
+std::filesystem::path SpillDirectory() { return std::filesystem::path(FLAGS_data_directory) / "query_spill"; }
+
+SpillFile::SpillFile(const std::filesystem::path &directory) : buffer_(std::make_unique<char[]>(kSpillBufferSize)) {
+  static std::atomic<uint64_t> next_file_id{0};
+  if (!utils::EnsureDir(directory)) {
+    throw QueryRuntimeException("Couldn't create the directory {} for spilling query results to disk.",
+                                directory.string());
+  }
+  path_ = directory / fmt::format("spill_{}", next_file_id++);
+  // The buffer has to be set before the file is opened.
+  file_.rdbuf()->pubsetbuf(buffer_.get(), kSpillBufferSize);
+  file_.open(path_, std::ios::in | std::ios::out | std::ios::trunc | std::ios::binary);
+  if (!file_.is_open()) {
+    throw QueryRuntimeException("Couldn't create the file {} for spilling query results to disk.", path_.string());
+  }
+  // The open stream keeps the file alive until it's closed.
+  std::error_code error;
+  std::filesystem::remove(path_, error);
+}
+
+bool SpillFile::CanSpill(const TypedValue &value) {
+  switch (value.type()) {
+    case TypedValue::Type::List:
+      return std::all_of(value.ValueList().begin(), value.ValueList().end(), CanSpill);
+    case TypedValue::Type::Map:
+      return std::all_of(value.ValueMap().begin(), value.ValueMap().end(),
+                         [](const auto &entry) { return CanSpill(entry.second); });
+    case TypedValue::Type::Graph:
+    case TypedValue::Type::Function:
+      return false;
+    default:
+      return true;
+  }
+}
+
+void SpillFile::Write(const TypedValue &value) {
+  WriteValue(value);
+  CheckStream();
+  ++size_;
+}
+
+void SpillFile::Rewind() {
+  file_.flush();
+  file_.seekg(0);
+  CheckStream();
+  read_ = 0;
+}
+
+bool SpillFile::Read(TypedValue *value, DbAccessor *dba) {
+  if (read_ == size_) return false;
+  *value = ReadValue(dba, value->GetMemoryResource());
+  CheckStream();
+  ++read_;
+  return true;
+}
+
+void SpillFile::CheckStream() const {
+  if (file_.fail()) {
+    throw QueryRuntimeException("Couldn't access the file {} with spilled query results.", path_.string());
+  }
+}
+
+template <typename T>
+void SpillFile::WritePrimitive(T value) {
+  file_.write(reinterpret_cast<const char *>(&value), sizeof(value));
+  bytes_ += sizeof(value);
+}
+
+template <typename T>
+T SpillFile::ReadPrimitive() {
+  T value{};
+  file_.read(reinterpret_cast<char *>(&value), sizeof(value));
+  return value;
+}
+
+void SpillFile::WriteString(std::string_view value) {
+  WritePrimitive<uint64_t>(value.size());
+  file_.write(value.data(), static_cast<std::streamsize>(value.size()));
+  bytes_ += value.size();
+}
+
+std::string SpillFile::ReadString() {
+  std::string value(ReadPrimitive<uint64_t>(), '\0');
+  file_.read(value.data(), static_cast<std::streamsize>(value.size()));
+  return value;
+}
+
+void SpillFile::WriteValue(const TypedValue &value) {
+  WritePrimitive(static_cast<uint8_t>(value.type()));
+  switch (value.type()) {
+    case TypedValue::Type::Null:
+      return;
+    case TypedValue::Type::Bool:
+      WritePrimitive(value.ValueBool());
+      return;
+    case TypedValue::Type::Int:
+      WritePrimitive(value.ValueInt());
+      return;
+    case TypedValue::Type::Double:
+      WritePrimitive(value.ValueDouble());
+      return;
+    case TypedValue::Type::String:
+      WriteString(value.ValueString());
+      return;
+    case TypedValue::Type::List:
+      WritePrimitive<uint64_t>(value.ValueList().size());
+      for (const auto &element : value.ValueList()) WriteValue(element);
+      return;
+    case TypedValue::Type::Map:
+      WritePrimitive<uint64_t>(value.ValueMap().size());
+      for (const auto &[key, element] : value.ValueMap()) {
+        WriteString(key);
+        WriteValue(element);
+      }
+      return;
+    case TypedValue::Type::Vertex:
+      WritePrimitive(value.ValueVertex().Gid().AsUint());
+      return;
+    case TypedValue::Type::Edge:
+      WriteEdge(value.ValueEdge());
+      return;
+    case TypedValue::Type::Path: {
+      const auto &path = value.ValuePath();
+      WritePrimitive<uint64_t>(path.edges().size());
+      WritePrimitive(path.vertices().front().Gid().AsUint());
+      for (size_t i = 0; i < path.edges().size(); ++i) {
+        WriteEdge(path.edges()[i]);
+        WritePrimitive(path.vertices()[i + 1].Gid().AsUint());
+      }
+      return;
+    }
+    case TypedValue::Type::Date:
+      WritePrimitive(value.ValueDate().MicrosecondsSinceEpoch());
+      return;
+    case TypedValue::Type::LocalTime:
+      WritePrimitive(value.ValueLocalTime().MicrosecondsSinceEpoch());
+      return;
+    case TypedValue::Type::LocalDateTime:
+      WritePrimitive(value.ValueLocalDateTime().MicrosecondsSinceEpoch());
+      return;
+    case TypedValue::Type::Duration:
+      WritePrimitive(value.ValueDuration().microseconds);
+      return;
+    case TypedValue::Type::Graph:
+    case TypedValue::Type::Function:
+      throw QueryRuntimeException("Graphs and functions can't be spilled to disk.");
+  }
+}
+
+VertexAccessor SpillFile::ReadVertex(DbAccessor *dba) {
+  const auto gid = storage::Gid::FromUint(ReadPrimitive<uint64_t>());
+  CheckStream();
+  // Vertices deleted by the query are still visible in the old view.
+  auto vertex = dba->FindVertex(gid, storage::View::NEW);
+  if (!vertex) vertex = dba->FindVertex(gid, storage::View::OLD);
+  if (!vertex) throw QueryRuntimeException("Couldn't find a spilled vertex.");
+  return *vertex;
+}
+
+void SpillFile::WriteEdge(const EdgeAccessor &edge) {
+  WritePrimitive(edge.Gid().AsUint());
+  WritePrimitive(edge.EdgeType().AsUint());
+  WritePrimitive(edge.From().Gid().AsUint());
+  WritePrimitive(edge.To().Gid().AsUint());
+}
+
+EdgeAccessor SpillFile::ReadEdge(DbAccessor *dba) {
+  const auto gid = storage::Gid::FromUint(ReadPrimitive<uint64_t>());
+  const auto edge_type = storage::EdgeTypeId::FromUint(ReadPrimitive<uint64_t>());
+  auto from = ReadVertex(dba);
+  auto to = ReadVertex(dba);
+  auto edge = dba->FindEdge(gid, storage::View::NEW, edge_type, &from, &to);
+  if (!edge) edge = dba->FindEdge(gid, storage::View::OLD, edge_type, &from, &to);
+  if (!edge) throw QueryRuntimeException("Couldn't find a spilled edge.");
+  return *edge;
+}
+
+TypedValue SpillFile::ReadValue(DbAccessor *dba, utils::MemoryResource *memory) {
+  const auto type = static_cast<TypedValue::Type>(ReadPrimitive<uint8_t>());
+  CheckStream();
+  switch (type) {
+    case TypedValue::Type::Null:
+      return TypedValue(memory);
+    case TypedValue::Type::Bool:
+      return TypedValue(ReadPrimitive<bool>(), memory);
+    case TypedValue::Type::Int:
+      return TypedValue(ReadPrimitive<int64_t>(), memory);
+    case TypedValue::Type::Double:
+      return TypedValue(ReadPrimitive<double>(), memory);
+    case TypedValue::Type::String:
+      return TypedValue(ReadString(), memory);
+    case TypedValue::Type::List: {
+      const auto size = ReadPrimitive<uint64_t>();
+      CheckStream();
+      TypedValue::TVector list(memory);
+      list.reserve(size);
+      for (uint64_t i = 0; i < size; ++i) list.emplace_back(ReadValue(dba, memory));
+      return TypedValue(std::move(list), memory);
+    }
+    case TypedValue::Type::Map: {
+      const auto size = ReadPrimitive<uint64_t>();
+      CheckStream();
+      TypedValue::TMap map(memory);
+      for (uint64_t i = 0; i < size; ++i) {
+        auto key = ReadString();
+        map.emplace(key, ReadValue(dba, memory));
+      }
+      return TypedValue(std::move(map), memory);
+    }
+    case TypedValue::Type::Vertex:
+      return TypedValue(ReadVertex(dba), memory);
+    case TypedValue::Type::Edge:
+      return TypedValue(ReadEdge(dba), memory);
+    case TypedValue::Type::Path: {
+      const auto size = ReadPrimitive<uint64_t>();
+      Path path(ReadVertex(dba), memory);
+      for (uint64_t i = 0; i < size; ++i) {
+        path.Expand(ReadEdge(dba));
+        path.Expand(ReadVertex(dba));
+      }
+      return TypedValue(std::move(path), memory);
+    }
+    case TypedValue::Type::Date:
+      return TypedValue(utils::Date(ReadPrimitive<int64_t>()), memory);
+    case TypedValue::Type::LocalTime:
+      return TypedValue(utils::LocalTime(ReadPrimitive<int64_t>()), memory);
+    case TypedValue::Type::LocalDateTime:
+      return TypedValue(utils::LocalDateTime(ReadPrimitive<int64_t>()), memory);
+    case TypedValue::Type::Duration:
+      return TypedValue(utils::Duration(ReadPrimitive<int64_t>()), memory);
+    case TypedValue::Type::Graph:
+    case TypedValue::Type::Function:
+      break;
+  }
+  throw QueryRuntimeException("Couldn't access the file {} with spilled query results.", path_.string());
+}
+
+}  // namespace memgraph::query::plan
@@ -0,0 +1,99 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "query/typed_value.hpp"
+
+namespace memgraph::query {
+class DbAccessor;
+}  // namespace memgraph::query
+
+namespace memgraph::query::plan {
+
+/// Directory under the data directory in which operators spill their
+/// intermediate results.
+std::filesystem::path SpillDirectory();
+
+/// Temporary file to which an operator spills values it can't keep in memory.
+///
+/// Values are written one after another and, after `Rewind`, read back in the
+/// order in which they were written; the caller knows how many values make up
+/// a row. Vertices and edges are written as their ids and looked up in the
+/// transaction when they are read back, paths as their vertices and edges.
+/// Graphs and functions can't be spilled, see `CanSpill`.
+///
+/// The file is unlinked as soon as it is created, so it doesn't outlive the
+/// object even if the process crashes.
+class SpillFile {
+ public:
+  /// Creates the file in `directory`, creating the directory if needed.
+  /// @throw QueryRuntimeException if the file can't be created.
+  explicit SpillFile(const std::filesystem::path &directory);
+
+  SpillFile(const SpillFile &) = delete;
+  SpillFile(SpillFile &&) = delete;
+  SpillFile &operator=(const SpillFile &) = delete;
+  SpillFile &operator=(SpillFile &&) = delete;
+  ~SpillFile() = default;
+
+  static bool CanSpill(const TypedValue &value);
+
+  /// @throw QueryRuntimeException if the value can't be written.
+  void Write(const TypedValue &value);
+
+  /// Switches the file from writing to reading from its beginning.
+  void Rewind();
+
+  /// Reads the next value into `value`, allocating it with the memory
+  /// resource of `value`. Returns false when there are no more values.
+  /// @throw QueryRuntimeException if the value can't be read, or if a vertex
+  /// or an edge isn't visible to the transaction of `dba` anymore.
+  bool Read(TypedValue *value, DbAccessor *dba);
+
+  /// Number of values written to the file.
+  uint64_t Size() const { return size_; }
+
+  /// Number of bytes written to the file.
+  uint64_t Bytes() const { return bytes_; }
+
+ private:
+  void WriteValue(const TypedValue &value);
+  TypedValue ReadValue(DbAccessor *dba, utils::MemoryResource *memory);
+
+  template <typename T>
+  void WritePrimitive(T value);
+  template <typename T>
+  T ReadPrimitive();
+  void WriteString(std::string_view value);
+  std::string ReadString();
+
+  void WriteEdge(const EdgeAccessor &edge);
+  VertexAccessor ReadVertex(DbAccessor *dba);
+  EdgeAccessor ReadEdge(DbAccessor *dba);
+
+  void CheckStream() const;
+
+  std::filesystem::path path_;
+  std::unique_ptr<char[]> buffer_;
+  std::fstream file_;
+  uint64_t size_{0};
+  uint64_t bytes_{0};
+  uint64_t read_{0};
+};
+
+}  // namespace memgraph::query::plan
@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2024 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -11,6 +11,7 @@
 
 #include "query/plan/variable_start_planner.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <queue>
 #include <utility>
@@ -102,30 +103,62 @@ void AddNextExpansions(const Symbol &node_symbol, const Matching &matching, cons
 // among remaining expansions and the process continues. This is done until all
 // matching.expansions are used.
 std::vector<Expansion> ExpansionsFrom(const NodeAtom *start_node, const Matching &matching,
-                                      const SymbolTable &symbol_table) {
+                                      const SymbolTable &symbol_table,
+                                      const NodeCardinalityEstimator &estimate_cardinality) {
   // Make a copy of node_symbol_to_expansions, because we will modify it as
   // expansions are chained.
   auto node_symbol_to_expansions = matching.node_symbol_to_expansions;
   std::unordered_set<size_t> seen_expansions;
   std::queue<Expansion> next_expansions;
   std::unordered_set<Symbol> expanded_symbols({symbol_table.at(*start_node->identifier_)});
-  auto add_next_expansions = [&](const auto *node) {
-    AddNextExpansions(symbol_table.at(*node->identifier_), matching, symbol_table, expanded_symbols,
-                      node_symbol_to_expansions, seen_expansions, next_expansions);
+  auto add_next_expansions = [&](const Symbol &node_symbol) {
+    AddNextExpansions(node_symbol, matching, symbol_table, expanded_symbols, node_symbol_to_expansions,
+                      seen_expansions, next_expansions);
   };
-  add_next_expansions(start_node);
+  add_next_expansions(symbol_table.at(*start_node->identifier_));
   // Potential optimization: expansions and next_expansions could be merge into
   // a single vector and an index could be used to determine from which should
   // additional expansions be added.
   std::vector<Expansion> expansions;
-  while (!next_expansions.empty()) {
-    auto expansion = next_expansions.front();
-    next_expansions.pop();
-    expansions.emplace_back(expansion);
-    add_next_expansions(expansion.node1);
-    if (expansion.node2) {
-      add_next_expansions(expansion.node2);
+  auto chain_expansions = [&] {
+    while (!next_expansions.empty()) {
+      auto expansion = next_expansions.front();
+      next_expansions.pop();
+      expansions.emplace_back(expansion);
+      add_next_expansions(symbol_table.at(*expansion.node1->identifier_));
+      if (expansion.node2) {
+        add_next_expansions(symbol_table.at(*expansion.node2->identifier_));
+      }
+    }
+  };
+  chain_expansions();
+  // The remaining expansions are parts of the pattern which aren't connected
+  // to the ones expanded so far. Every such part is joined with the ones
+  // before it, so they are ordered by how many vertices their starting node is
+  // expected to match, the smallest first, and each is chained from that node.
+  while (estimate_cardinality && !node_symbol_to_expansions.empty()) {
+    std::vector<std::pair<double, Symbol>> starts;
+    std::unordered_set<Symbol> candidates;
+    for (size_t i = 0; i < matching.expansions.size(); ++i) {
+      if (seen_expansions.find(i) != seen_expansions.end()) continue;
+      const auto &expansion = matching.expansions[i];
+      for (const auto *node : {expansion.node1, expansion.node2}) {
+        if (!node) continue;
+        const auto &node_symbol = symbol_table.at(*node->identifier_);
+        if (candidates.insert(node_symbol).second) {
+          starts.emplace_back(estimate_cardinality(node_symbol, matching.filters), node_symbol);
+        }
+      }
+    }
+    // Ties keep the order of the pattern.
+    std::stable_sort(starts.begin(), starts.end(),
+                     [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+    for (const auto &[cardinality, node_symbol] : starts) {
+      add_next_expansions(node_symbol);
+      if (!next_expansions.empty()) break;
     }
+    if (next_expansions.empty()) break;
+    chain_expansions();
   }
   if (!node_symbol_to_expansions.empty()) {
     // We could pick a new starting expansion, but to avoid runtime
@@ -171,8 +204,12 @@ FilterMatching ToFilterMatching(Matching &matching) {
 
 }  // namespace
 
-VaryMatchingStart::VaryMatchingStart(Matching matching, const SymbolTable &symbol_table)
-    : matching_(matching), symbol_table_(symbol_table), nodes_(ExpansionNodes(matching.expansions, symbol_table)) {}
+VaryMatchingStart::VaryMatchingStart(Matching matching, const SymbolTable &symbol_table,
+                                     NodeCardinalityEstimator estimate_cardinality)
+    : matching_(matching),
+      symbol_table_(symbol_table),
+      estimate_cardinality_(std::move(estimate_cardinality)),
+      nodes_(ExpansionNodes(matching.expansions, symbol_table)) {}
 
 VaryMatchingStart::iterator::iterator(VaryMatchingStart *self, bool is_done)
     : self_(self),
@@ -185,7 +222,8 @@ VaryMatchingStart::iterator::iterator(VaryMatchingStart *self, bool is_done)
     // Overwrite the original matching expansions with the new ones by
     // generating it from the first start node.
     start_nodes_it_ = self_->nodes_.begin();
-    current_matching_.expansions = ExpansionsFrom(**start_nodes_it_, self_->matching_, self_->symbol_table_);
+    current_matching_.expansions =
+        ExpansionsFrom(**start_nodes_it_, self_->matching_, self_->symbol_table_, self_->estimate_cardinality_);
   }
   DMG_ASSERT(start_nodes_it_ || self_->nodes_.empty(),
              "start_nodes_it_ should only be nullopt when self_->nodes_ is empty");
@@ -209,22 +247,25 @@ VaryMatchingStart::iterator &VaryMatchingStart::iterator::operator++() {
     return *this;
   }
   const auto &start_node = **start_nodes_it_;
-  current_matching_.expansions = ExpansionsFrom(start_node, self_->matching_, self_->symbol_table_);
+  current_matching_.expansions =
+      ExpansionsFrom(start_node, self_->matching_, self_->symbol_table_, self_->estimate_cardinality_);
   return *this;
 }
 
 CartesianProduct<VaryMatchingStart> VaryMultiMatchingStarts(const std::vector<Matching> &matchings,
-                                                            const SymbolTable &symbol_table) {
+                                                            const SymbolTable &symbol_table,
+                                                            const NodeCardinalityEstimator &estimate_cardinality) {
   std::vector<VaryMatchingStart> variants;
   variants.reserve(matchings.size());
   for (const auto &matching : matchings) {
-    variants.emplace_back(matching, symbol_table);
+    variants.emplace_back(matching, symbol_table, estimate_cardinality);
   }
   return MakeCartesianProduct(std::move(variants));
 }
 
 CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &matching,
-                                                             const SymbolTable &symbol_table) {
+                                                             const SymbolTable &symbol_table,
+                                                             const NodeCardinalityEstimator &estimate_cardinality) {
   auto filter_matchings_cnt = 0;
   for (const auto &filter : matching.filters) {
     filter_matchings_cnt += static_cast<int>(filter.matchings.size());
@@ -235,19 +276,20 @@ CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &mat
 
   for (const auto &filter : matching.filters) {
     for (const auto &filter_matching : filter.matchings) {
-      variants.emplace_back(filter_matching, symbol_table);
+      variants.emplace_back(filter_matching, symbol_table, estimate_cardinality);
     }
   }
 
   return MakeCartesianProduct(std::move(variants));
 }
 
-VaryQueryPartMatching::VaryQueryPartMatching(SingleQueryPart query_part, const SymbolTable &symbol_table)
+VaryQueryPartMatching::VaryQueryPartMatching(SingleQueryPart query_part, const SymbolTable &symbol_table,
+                                             const NodeCardinalityEstimator &estimate_cardinality)
     : query_part_(std::move(query_part)),
-      matchings_(VaryMatchingStart(query_part_.matching, symbol_table)),
-      optional_matchings_(VaryMultiMatchingStarts(query_part_.optional_matching, symbol_table)),
-      merge_matchings_(VaryMultiMatchingStarts(query_part_.merge_matching, symbol_table)),
-      filter_matchings_(VaryFilterMatchingStarts(query_part_.matching, symbol_table)) {}
+      matchings_(VaryMatchingStart(query_part_.matching, symbol_table, estimate_cardinality)),
+      optional_matchings_(VaryMultiMatchingStarts(query_part_.optional_matching, symbol_table, estimate_cardinality)),
+      merge_matchings_(VaryMultiMatchingStarts(query_part_.merge_matching, symbol_table, estimate_cardinality)),
+      filter_matchings_(VaryFilterMatchingStarts(query_part_.matching, symbol_table, estimate_cardinality)) {}
 
 VaryQueryPartMatching::iterator::iterator(SingleQueryPart query_part, VaryMatchingStart::iterator matchings_begin,
                                           VaryMatchingStart::iterator matchings_end,
@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2024 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -12,10 +12,15 @@
 /// @file
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+
 #include "cppitertools/imap.hpp"
 #include "cppitertools/slice.hpp"
 #include "gflags/gflags.h"
 
+#include "query/plan/cost_estimator.hpp"
 #include "query/plan/rule_based_planner.hpp"
 
 DECLARE_uint64(query_max_plans);
@@ -178,11 +183,18 @@ class NodeSymbolEqual {
   const SymbolTable &symbol_table_;
 };
 
+// Estimates the number of vertices a node of the pattern matches on its own,
+// used for ordering the disconnected parts of a matching.
+using NodeCardinalityEstimator = std::function<double(const Symbol &, const Filters &)>;
+
 // Generates n matchings, where n is the number of nodes to match. Each Matching
-// will have a different node as a starting node for expansion.
+// will have a different node as a starting node for expansion. The parts of
+// the matching which aren't connected to the starting node follow in the order
+// of their estimated cardinality, if an estimator is given, otherwise in the
+// order of the pattern.
 class VaryMatchingStart {
  public:
-  VaryMatchingStart(Matching, const SymbolTable &);
+  VaryMatchingStart(Matching, const SymbolTable &, NodeCardinalityEstimator = {});
 
   class iterator {
    public:
@@ -222,21 +234,24 @@ class VaryMatchingStart {
   friend class iterator;
   Matching matching_;
   const SymbolTable &symbol_table_;
+  NodeCardinalityEstimator estimate_cardinality_;
   std::unordered_set<NodeAtom *, NodeSymbolHash, NodeSymbolEqual> nodes_;
 };
 
 // Similar to VaryMatchingStart, but varies the starting nodes for all given
 // matchings. After all matchings produce multiple alternative starts, the
 // Cartesian product of all of them is returned.
-CartesianProduct<VaryMatchingStart> VaryMultiMatchingStarts(const std::vector<Matching> &, const SymbolTable &);
+CartesianProduct<VaryMatchingStart> VaryMultiMatchingStarts(const std::vector<Matching> &, const SymbolTable &,
+                                                            const NodeCardinalityEstimator & = {});
 
-CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &matching, const SymbolTable &symbol_table);
+CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &matching, const SymbolTable &symbol_table,
+                                                             const NodeCardinalityEstimator & = {});
 
 // Produces alternative query parts out of a single part by varying how each
 // graph matching is done.
 class VaryQueryPartMatching {
  public:
-  VaryQueryPartMatching(SingleQueryPart, const SymbolTable &);
+  VaryQueryPartMatching(SingleQueryPart, const SymbolTable &, const NodeCardinalityEstimator & = {});
 
   class iterator {
    public:
@@ -299,6 +314,80 @@ class VaryQueryPartMatching {
 
 }  // namespace impl
 
+/// Estimates the number of vertices a node matches from the indexes the
+/// planner could scan it by. Equality and range filters with constant values
+/// are estimated from the value distribution collected by ANALYZE GRAPH, the
+/// same as the cost estimator does for the index scans. Nodes which can't be
+/// looked up in an index get an infinite estimate, which keeps them in the
+/// order of the pattern.
+template <class TDbAccessor>
+impl::NodeCardinalityEstimator MakeNodeCardinalityEstimator(TDbAccessor *db, const Parameters *parameters) {
+  return [db, parameters](const Symbol &symbol, const Filters &filters) {
+    if (!filters.IdFilters(symbol).empty()) return 1.0;
+    auto const_value = [parameters](const Expression *expression) -> std::optional<storage::PropertyValue> {
+      if (const auto *literal = utils::Downcast<const PrimitiveLiteral>(expression)) return literal->value_;
+      if (const auto *param_lookup = utils::Downcast<const ParameterLookup>(expression); param_lookup && parameters) {
+        return parameters->AtTokenPosition(param_lookup->token_position_);
+      }
+      return std::nullopt;
+    };
+    auto const_bound = [&](const std::optional<PropertyFilter::Bound> &bound)
+        -> std::optional<utils::Bound<storage::PropertyValue>> {
+      if (!bound) return std::nullopt;
+      auto value = const_value(bound->value());
+      if (!value) return std::nullopt;
+      return utils::Bound<storage::PropertyValue>(std::move(*value), bound->type());
+    };
+    auto cardinality = std::numeric_limits<double>::infinity();
+    for (const auto &label_ix : filters.FilteredLabels(symbol)) {
+      const auto label = db->NameToLabel(label_ix.name);
+      if (db->LabelIndexExists(label)) {
+        cardinality = std::min(cardinality, static_cast<double>(db->VerticesCount(label)));
+      }
+      for (const auto &filter : filters.PropertyFilters(symbol)) {
+        const auto &property_filter = *filter.property_filter;
+        if (property_filter.is_symbol_in_value_) continue;
+        const auto property = db->NameToProperty(property_filter.property_.name);
+        const bool range_index = db->LabelPropertyIndexExists(label, property);
+        const bool is_equal = property_filter.type_ == PropertyFilter::Type::EQUAL;
+        if (!range_index && !(is_equal && db->LabelPropertyHashIndexExists(label, property))) continue;
+        const auto stats = db->GetIndexStats(label, property);
+        const bool has_distribution = range_index && stats && storage::HasValueDistribution(*stats);
+        if (is_equal) {
+          const auto value = const_value(property_filter.value_);
+          double matched = 0;
+          if (has_distribution) {
+            matched = value ? storage::EstimateValueCount(*stats, *value) : stats->avg_group_size;
+          } else if (value && range_index) {
+            matched = static_cast<double>(db->VerticesCount(label, property, *value));
+          } else if (stats) {
+            matched = stats->avg_group_size;
+          } else {
+            matched = static_cast<double>(db->VerticesCount(label, property)) *
+                      CostEstimator<TDbAccessor>::CardParam::kFilter;
+          }
+          cardinality = std::min(cardinality, matched);
+        } else if (property_filter.type_ == PropertyFilter::Type::RANGE) {
+          const auto lower = const_bound(property_filter.lower_bound_);
+          const auto upper = const_bound(property_filter.upper_bound_);
+          // A bound which isn't a constant filters as much as a Filter would.
+          const bool all_bounds_const =
+              (!property_filter.lower_bound_ || lower) && (!property_filter.upper_bound_ || upper);
+          std::optional<double> matched;
+          if (has_distribution && (lower || upper)) matched = storage::EstimateRangeCount(*stats, lower, upper);
+          if (!matched) {
+            matched = (lower || upper) ? static_cast<double>(db->VerticesCount(label, property, lower, upper))
+                                       : static_cast<double>(db->VerticesCount(label, property));
+          }
+          if (!all_bounds_const) *matched *= CostEstimator<TDbAccessor>::CardParam::kFilter;
+          cardinality = std::min(cardinality, *matched);
+        }
+      }
+    }
+    return cardinality;
+  };
+}
+
 /// @brief Planner which generates multiple plans by changing the order of graph
 /// traversal.
 ///
@@ -319,7 +408,8 @@ class VariableStartPlanner {
     auto single_query_parts = ExtractSingleQueryParts(std::make_unique<QueryParts>(query_parts));
 
     for (const auto &single_query_part : single_query_parts) {
-      varying_query_matchings.emplace_back(single_query_part, symbol_table);
+      varying_query_matchings.emplace_back(single_query_part, symbol_table,
+                                           MakeNodeCardinalityEstimator(context_->db, context_->parameters));
     }
 
     return iter::slice(MakeCartesianProduct(std::move(varying_query_matchings)), 0UL, FLAGS_query_max_plans);
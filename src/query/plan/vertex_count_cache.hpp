@@ -72,14 +72,31 @@ class VertexCountCache {
     return bounds_vertex_count.at(bounds);
   }
 
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties,
+                        const std::vector<storage::PropertyValue> &prefix) {
+    return db_->VerticesCount(label, properties, prefix);
+  }
+
   bool LabelIndexExists(storage::LabelId label) { return db_->LabelIndexExists(label); }
 
   bool LabelPropertyIndexExists(storage::LabelId label, storage::PropertyId property) {
     return db_->LabelPropertyIndexExists(label, property);
   }
 
+  bool LabelPropertyHashIndexExists(storage::LabelId label, storage::PropertyId property) {
+    return db_->LabelPropertyHashIndexExists(label, property);
+  }
+
+  std::vector<std::vector<storage::PropertyId>> LabelPropertyCompositeIndices(storage::LabelId label) {
+    return db_->LabelPropertyCompositeIndices(label);
+  }
+
   bool EdgeTypeIndexExists(storage::EdgeTypeId edge_type) { return db_->EdgeTypeIndexExists(edge_type); }
 
+  bool EdgeTypePropertyIndexExists(storage::EdgeTypeId edge_type, storage::PropertyId property) {
+    return db_->EdgeTypePropertyIndexExists(edge_type, property);
+  }
+
   std::optional<storage::LabelIndexStats> GetIndexStats(const storage::LabelId &label) const {
     return db_->GetIndexStats(label);
   }
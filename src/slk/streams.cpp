@@ -14,6 +14,7 @@
 #include <cstring>
 #include <utility>
 
+#include "utils/compression.hpp"
 #include "utils/logging.hpp"
 
 namespace memgraph::slk {
@@ -45,6 +46,11 @@ void Builder::FlushSegment(bool final_segment) {
   if (!final_segment && pos_ < kSegmentMaxDataSize) return;
   MG_ASSERT(pos_ > 0, "Trying to flush out a segment that has no data in it!");
 
+  if (compress_ && pos_ >= kSegmentMinCompressedDataSize && FlushCompressedSegment(final_segment)) {
+    pos_ = 0;
+    return;
+  }
+
   size_t total_size = sizeof(SegmentSize) + pos_;
 
   SegmentSize size = pos_;
@@ -61,6 +67,27 @@ void Builder::FlushSegment(bool final_segment) {
   pos_ = 0;
 }
 
+bool Builder::FlushCompressedSegment(bool final_segment) {
+  compressed_segment_.resize(sizeof(SegmentSize) + sizeof(SegmentSize));
+  utils::ZlibCompress({segment_.data() + sizeof(SegmentSize), pos_}, compressed_segment_);
+
+  // The stored data consists of the uncompressed size and the compressed data.
+  const size_t stored_size = compressed_segment_.size() - sizeof(SegmentSize);
+  if (stored_size >= pos_) return false;
+
+  SegmentSize size = stored_size | kSegmentCompressedFlag;
+  memcpy(compressed_segment_.data(), &size, sizeof(SegmentSize));
+  SegmentSize data_size = pos_;
+  memcpy(compressed_segment_.data() + sizeof(SegmentSize), &data_size, sizeof(SegmentSize));
+
+  if (final_segment) {
+    compressed_segment_.resize(compressed_segment_.size() + sizeof(SegmentSize), 0);
+  }
+
+  write_func_(compressed_segment_.data(), compressed_segment_.size(), !final_segment);
+  return true;
+}
+
 Reader::Reader(const uint8_t *data, size_t size) : data_(data), size_(size) {}
 
 void Reader::Load(uint8_t *data, uint64_t size) {
@@ -71,8 +98,8 @@ void Reader::Load(uint8_t *data, uint64_t size) {
     if (to_read > have_) {
       to_read = have_;
     }
-    memcpy(data + offset, data_ + pos_, to_read);
-    pos_ += to_read;
+    memcpy(data + offset, segment_, to_read);
+    segment_ += to_read;
     have_ -= to_read;
     offset += to_read;
     size -= to_read;
@@ -81,6 +108,14 @@ void Reader::Load(uint8_t *data, uint64_t size) {
 
 void Reader::Finalize() { GetSegment(true); }
 
+bool Reader::HasMoreData() const {
+  if (have_ != 0) return true;
+  SegmentSize len = 0;
+  if (pos_ + sizeof(SegmentSize) > size_) return false;
+  memcpy(&len, data_ + pos_, sizeof(SegmentSize));
+  return len != 0;
+}
+
 void Reader::GetSegment(bool should_be_final) {
   if (have_ != 0) {
     if (should_be_final) {
@@ -103,14 +138,36 @@ void Reader::GetSegment(bool should_be_final) {
     throw SlkReaderException("Got an empty SLK segment when expecting a non-empty segment!");
   }
 
-  // The position is incremented after the checks above so that the new
-  // segment can be reread if some of the above checks fail.
-  pos_ += sizeof(SegmentSize);
-
-  if (pos_ + len > size_) {
+  const bool compressed = (len & kSegmentCompressedFlag) != 0;
+  len &= ~kSegmentCompressedFlag;
+  if (pos_ + sizeof(SegmentSize) + len > size_) {
     throw SlkReaderException("There isn't enough data in the SLK stream!");
   }
-  have_ = len;
+
+  const uint8_t *segment = data_ + pos_ + sizeof(SegmentSize);
+  size_t have = len;
+  if (compressed) {
+    SegmentSize data_size = 0;
+    if (len < sizeof(SegmentSize)) {
+      throw SlkReaderException("Size of the uncompressed data missing in SLK stream!");
+    }
+    memcpy(&data_size, segment, sizeof(SegmentSize));
+    if (data_size == 0 || data_size > kSegmentMaxDataSize) {
+      throw SlkReaderException("Invalid size of the uncompressed data in SLK stream!");
+    }
+    decompressed_segment_.resize(data_size);
+    if (!utils::ZlibDecompress({segment + sizeof(SegmentSize), len - sizeof(SegmentSize)}, decompressed_segment_)) {
+      throw SlkReaderException("Couldn't decompress the SLK segment!");
+    }
+    segment = decompressed_segment_.data();
+    have = data_size;
+  }
+
+  // The position is incremented after the checks above so that the new
+  // segment can be reread if some of the above checks fail.
+  pos_ += sizeof(SegmentSize) + len;
+  segment_ = segment;
+  have_ = have;
 }
 
 StreamInfo CheckStreamComplete(const uint8_t *data, size_t size) {
@@ -128,6 +185,7 @@ StreamInfo CheckStreamComplete(const uint8_t *data, size_t size) {
     if (len == 0) {
       break;
     }
+    len &= ~kSegmentCompressedFlag;
 
     if (pos + len > size) {
       return {StreamStatus::PARTIAL, pos + kSegmentMaxTotalSize, data_size};
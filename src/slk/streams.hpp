@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <functional>
 #include <limits>
+#include <vector>
 
 #include "utils/exceptions.hpp"
 
@@ -31,6 +32,14 @@ const uint64_t kSegmentMaxTotalSize = kSegmentMaxDataSize + sizeof(SegmentSize)
 static_assert(kSegmentMaxDataSize <= std::numeric_limits<SegmentSize>::max(),
               "The SLK segment can't be larger than the type used to store its size!");
 
+// The highest bit of the `size` field marks a compressed segment. Smaller
+// segments aren't compressed because zlib can't do much with them.
+const SegmentSize kSegmentCompressedFlag = SegmentSize{1} << 31;
+const uint64_t kSegmentMinCompressedDataSize = 4096;
+
+static_assert(kSegmentMaxDataSize < kSegmentCompressedFlag,
+              "The SLK segment size mustn't overlap with the compressed segment flag!");
+
 /// SLK splits binary data into segments. Segments are used to avoid the need to
 /// have all of the encoded data in memory at once during the building process.
 /// That enables streaming during the building process and makes the whole
@@ -42,13 +51,21 @@ static_assert(kSegmentMaxDataSize <= std::numeric_limits<SegmentSize>::max(),
 /// size of `kSegmentMaxDataSize`. The `size` field itself has a size of
 /// `sizeof(SegmentSize)`. A segment of size 0 indicates that we have reached
 /// the end of a stream and that there is no more data to be read/written.
+///
+/// If compression is enabled on the `Builder`, a segment can be stored
+/// compressed with zlib. Its `size` field then has `kSegmentCompressedFlag` set
+/// and its data starts with the size of the uncompressed data, followed by the
+/// compressed data. The `Reader` decompresses such segments transparently.
 
 /// Builder used to create a SLK segment stream.
 class Builder {
  public:
   explicit Builder(std::function<void(const uint8_t *, size_t, bool)> write_func);
   Builder(Builder &&other, std::function<void(const uint8_t *, size_t, bool)> write_func)
-      : write_func_{std::move(write_func)}, pos_{std::exchange(other.pos_, 0)}, segment_{other.segment_} {
+      : write_func_{std::move(write_func)},
+        pos_{std::exchange(other.pos_, 0)},
+        segment_{other.segment_},
+        compress_{other.compress_} {
     other.write_func_ = [](const uint8_t *, size_t, bool) { /* Moved builder is defunct, no write possible */ };
   }
 
@@ -58,12 +75,20 @@ class Builder {
   /// Function that should be called after all `slk::Save` operations are done.
   void Finalize();
 
+  /// Compress the segments that are flushed from now on. A segment is still
+  /// written uncompressed if compressing it doesn't make it smaller.
+  void EnableCompression() { compress_ = true; }
+
  private:
   void FlushSegment(bool final_segment);
 
+  bool FlushCompressedSegment(bool final_segment);
+
   std::function<void(const uint8_t *, size_t, bool)> write_func_;
   size_t pos_{0};
   std::array<uint8_t, kSegmentMaxTotalSize> segment_;
+  bool compress_{false};
+  std::vector<uint8_t> compressed_segment_;
 };
 
 /// Exception that will be thrown if segments can't be decoded from the byte
@@ -85,6 +110,11 @@ class Reader {
   /// Function that should be called after all `slk::Load` operations are done.
   void Finalize();
 
+  /// Returns whether there is still data to load. Newer peers can append fields
+  /// to a message which older peers don't send, and this lets them be loaded
+  /// only when they are there.
+  bool HasMoreData() const;
+
  private:
   void GetSegment(bool should_be_final = false);
 
@@ -92,7 +122,9 @@ class Reader {
   size_t size_;
 
   size_t pos_{0};
+  const uint8_t *segment_{nullptr};
   size_t have_{0};
+  std::vector<uint8_t> decompressed_segment_;
 };
 
 /// Stream status that is returned by the `CheckStreamComplete` function.
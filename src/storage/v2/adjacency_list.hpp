@@ -0,0 +1,365 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "storage/v2/edge_ref.hpp"
+#include "storage/v2/id_types.hpp"
+#include "utils/logging.hpp"
+
+namespace memgraph::storage {
+
+// Forward declaration because we only store a pointer here.
+struct Vertex;
+
+/// Compact container for the edges attached to one side of a vertex.
+///
+/// Edges are grouped by edge type. The whole list lives in a single heap block
+/// referenced by one pointer:
+///
+///   | Header | Group[group_capacity] | Entry[capacity] |
+///
+/// Each group stores its edge type and the (exclusive) end offset of its slice
+/// in the entry array, so the edge type isn't repeated for every edge. An entry
+/// is only the opposing vertex and the edge reference (16B instead of the 24B of
+/// a `std::tuple<EdgeTypeId, Vertex *, EdgeRef>`), and an empty list costs just
+/// the pointer instead of the three pointers of a `std::vector`.
+///
+/// Iteration order: edges come grouped by edge type, in increasing order of the
+/// edge type id, and not in the order in which they were inserted. The order of
+/// edges within a type is unspecified: inserting or erasing an edge moves at
+/// most one entry of each group that follows the modified one, so it can change
+/// the order of edges of other types too. An edge whose type is changed is
+/// erased and inserted again, so it moves to the slice of its new type.
+///
+/// Iteration yields `std::tuple<EdgeTypeId, Vertex *, EdgeRef>` by value, so
+/// existing structured bindings keep working; `equal_range` gives the slice of a
+/// single edge type.
+///
+/// Sizes are 32-bit to keep the header small; a list can hold at most
+/// `max_size()` edges and exceeding it is a fatal error.
+///
+/// The container isn't thread-safe, it is guarded by the owning vertex's lock.
+class AdjacencyList final {
+ public:
+  using value_type = std::tuple<EdgeTypeId, Vertex *, EdgeRef>;
+  using size_type = uint32_t;
+
+ private:
+  struct Header {
+    size_type size;
+    size_type capacity;
+    size_type num_groups;
+    size_type group_capacity;
+  };
+
+  struct Group {
+    EdgeTypeId edge_type;
+    size_type end;
+  };
+
+  struct Entry {
+    Vertex *vertex;
+    EdgeRef ref;
+  };
+
+  static_assert(sizeof(Header) == 16);
+  static_assert(sizeof(Group) == 8);
+  static_assert(sizeof(Entry) == 16);
+  static_assert(std::is_trivially_copyable_v<Group> && std::is_trivially_copyable_v<Entry>);
+
+  static Group *GroupsOf(Header *header) { return reinterpret_cast<Group *>(header + 1); }
+  static const Group *GroupsOf(const Header *header) { return reinterpret_cast<const Group *>(header + 1); }
+  static Entry *EntriesOf(Header *header) {
+    return reinterpret_cast<Entry *>(GroupsOf(header) + header->group_capacity);
+  }
+  static const Entry *EntriesOf(const Header *header) {
+    return reinterpret_cast<const Entry *>(GroupsOf(header) + header->group_capacity);
+  }
+  static size_type GroupBegin(const Header *header, size_type group) {
+    return group == 0 ? 0 : GroupsOf(header)[group - 1].end;
+  }
+
+ public:
+  class Iterator final {
+   public:
+    using value_type = AdjacencyList::value_type;
+    using reference = value_type;
+    using difference_type = std::ptrdiff_t;
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+
+    // NOLINTNEXTLINE(modernize-use-default-member-init)
+    Iterator() : header_(nullptr), pos_(0), group_(0) {}
+
+    value_type operator*() const {
+      const auto &entry = EntriesOf(header_)[pos_];
+      return {GroupsOf(header_)[group_].edge_type, entry.vertex, entry.ref};
+    }
+
+    Iterator &operator++() {
+      ++pos_;
+      const auto *groups = GroupsOf(header_);
+      while (group_ < header_->num_groups && pos_ >= groups[group_].end) ++group_;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    friend bool operator==(const Iterator &lhs, const Iterator &rhs) { return lhs.pos_ == rhs.pos_; }
+
+   private:
+    friend class AdjacencyList;
+
+    Iterator(const Header *header, size_type pos, size_type group) : header_(header), pos_(pos), group_(group) {}
+
+    const Header *header_;
+    size_type pos_;
+    size_type group_;
+  };
+
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+
+  AdjacencyList() = default;
+
+  AdjacencyList(const AdjacencyList &other) {
+    if (other.empty()) return;
+    auto *header = Allocate(other.header_->size, other.header_->num_groups);
+    header->size = other.header_->size;
+    header->num_groups = other.header_->num_groups;
+    std::copy_n(GroupsOf(other.header_), header->num_groups, GroupsOf(header));
+    std::copy_n(EntriesOf(other.header_), header->size, EntriesOf(header));
+    header_ = header;
+  }
+
+  AdjacencyList(AdjacencyList &&other) noexcept : header_(std::exchange(other.header_, nullptr)) {}
+
+  AdjacencyList &operator=(const AdjacencyList &other) {
+    if (this != &other) {
+      AdjacencyList copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  AdjacencyList &operator=(AdjacencyList &&other) noexcept {
+    if (this != &other) {
+      Deallocate(std::exchange(header_, std::exchange(other.header_, nullptr)));
+    }
+    return *this;
+  }
+
+  ~AdjacencyList() { Deallocate(header_); }
+
+  void swap(AdjacencyList &other) noexcept { std::swap(header_, other.header_); }
+
+  size_type size() const { return header_ ? header_->size : 0; }
+  bool empty() const { return size() == 0; }
+  size_type capacity() const { return header_ ? header_->capacity : 0; }
+  static constexpr size_type max_size() { return std::numeric_limits<size_type>::max(); }
+
+  /// Number of distinct edge types in the list.
+  size_type num_edge_types() const { return header_ ? header_->num_groups : 0; }
+
+  Iterator begin() const { return {header_, 0, 0}; }
+  Iterator end() const { return {header_, size(), num_edge_types()}; }
+
+  /// Returns the slice holding all edges of the given type.
+  std::ranges::subrange<Iterator> equal_range(EdgeTypeId edge_type) const {
+    auto [group, found] = FindGroup(edge_type);
+    if (!found) return {end(), end()};
+    return {Iterator{header_, GroupBegin(header_, group), group},
+            Iterator{header_, GroupsOf(header_)[group].end, group + 1}};
+  }
+
+  /// Returns the position of the given edge or `end()`. Only the slice of the
+  /// edge's type is scanned.
+  Iterator find(const value_type &link) const {
+    const auto &[edge_type, vertex, ref] = link;
+    auto [group, found] = FindGroup(edge_type);
+    if (!found) return end();
+    const auto *entries = EntriesOf(header_);
+    const auto group_end = GroupsOf(header_)[group].end;
+    for (auto pos = GroupBegin(header_, group); pos != group_end; ++pos) {
+      if (entries[pos].vertex == vertex && entries[pos].ref == ref) return {header_, pos, group};
+    }
+    return end();
+  }
+
+  value_type back() const {
+    const auto *groups = GroupsOf(header_);
+    const auto &entry = EntriesOf(header_)[header_->size - 1];
+    return {groups[header_->num_groups - 1].edge_type, entry.vertex, entry.ref};
+  }
+
+  /// Adds an edge to the slice of its type. Provides the strong exception
+  /// guarantee: if the allocation fails the list is left unchanged.
+  void emplace(EdgeTypeId edge_type, Vertex *vertex, EdgeRef ref) {
+    MG_ASSERT(size() < max_size(), "A vertex can't have more than {} edges in one direction!", max_size());
+    auto [group, found] = FindGroup(edge_type);
+    Reserve(size() + 1, num_edge_types() + (found ? 0 : 1));
+
+    auto *groups = GroupsOf(header_);
+    auto *entries = EntriesOf(header_);
+    if (!found) {
+      std::copy_backward(groups + group, groups + header_->num_groups, groups + header_->num_groups + 1);
+      std::construct_at(groups + group, Group{edge_type, GroupBegin(header_, group)});
+      ++header_->num_groups;
+    }
+
+    // Open a hole at the end of the target group by moving the first entry of
+    // every following group to that group's end, starting from the last one.
+    auto hole = header_->size;
+    for (auto i = header_->num_groups - 1; i > group; --i) {
+      const auto group_begin = groups[i - 1].end;
+      std::construct_at(entries + hole, entries[group_begin]);
+      hole = group_begin;
+      ++groups[i].end;
+    }
+    std::construct_at(entries + hole, Entry{vertex, ref});
+    ++groups[group].end;
+    ++header_->size;
+  }
+
+  void insert(const value_type &link) { std::apply([this](auto... args) { emplace(args...); }, link); }
+
+  /// Removes the edge at the given position. Iterators to the erased edge and
+  /// to edges following its group are invalidated.
+  void erase(Iterator it) {
+    auto *groups = GroupsOf(header_);
+    auto *entries = EntriesOf(header_);
+    auto group = it.group_;
+
+    // Fill the hole with the last entry of the same group and then pull the
+    // hole towards the end by moving the last entry of every following group.
+    auto hole = it.pos_;
+    for (auto i = group; i < header_->num_groups; ++i) {
+      const auto last = --groups[i].end;
+      entries[hole] = entries[last];
+      hole = last;
+    }
+    --header_->size;
+    if (groups[group].end == GroupBegin(header_, group)) {
+      std::copy(groups + group + 1, groups + header_->num_groups, groups + group);
+      --header_->num_groups;
+    }
+  }
+
+  void pop_back() {
+    auto *groups = GroupsOf(header_);
+    --header_->size;
+    auto &last_group = groups[header_->num_groups - 1];
+    if (--last_group.end == GroupBegin(header_, header_->num_groups - 1)) --header_->num_groups;
+  }
+
+  /// Removes all edges for which `pred(value_type)` holds in a single pass.
+  /// Returns the number of removed edges.
+  template <typename TPred>
+  size_type erase_if(TPred &&pred) {
+    if (empty()) return 0;
+    auto *groups = GroupsOf(header_);
+    auto *entries = EntriesOf(header_);
+    size_type write_pos = 0;
+    size_type write_group = 0;
+    size_type read_pos = 0;
+    for (size_type group = 0; group < header_->num_groups; ++group) {
+      const auto edge_type = groups[group].edge_type;
+      for (; read_pos < groups[group].end; ++read_pos) {
+        const auto &entry = entries[read_pos];
+        if (pred(value_type{edge_type, entry.vertex, entry.ref})) continue;
+        entries[write_pos++] = entry;
+      }
+      if (write_pos != GroupBegin(header_, write_group)) {
+        groups[write_group++] = Group{edge_type, write_pos};
+      }
+    }
+    const auto removed = header_->size - write_pos;
+    header_->size = write_pos;
+    header_->num_groups = write_group;
+    return removed;
+  }
+
+  void reserve(size_type new_capacity) { Reserve(new_capacity, num_edge_types()); }
+
+  void clear() {
+    if (!header_) return;
+    header_->size = 0;
+    header_->num_groups = 0;
+  }
+
+ private:
+  /// Returns the index of the group with the given edge type, or the index at
+  /// which it should be inserted together with `false`.
+  std::pair<size_type, bool> FindGroup(EdgeTypeId edge_type) const {
+    if (!header_) return {0, false};
+    const auto *groups = GroupsOf(header_);
+    const auto *groups_end = groups + header_->num_groups;
+    const auto *it = std::lower_bound(groups, groups_end, edge_type,
+                                      [](const Group &group, EdgeTypeId type) { return group.edge_type < type; });
+    return {static_cast<size_type>(it - groups), it != groups_end && it->edge_type == edge_type};
+  }
+
+  static Header *Allocate(size_type capacity, size_type group_capacity) {
+    const auto bytes = sizeof(Header) + group_capacity * sizeof(Group) + capacity * sizeof(Entry);
+    auto *header = static_cast<Header *>(::operator new(bytes));
+    return std::construct_at(header, Header{0, capacity, 0, group_capacity});
+  }
+
+  static void Deallocate(Header *header) { ::operator delete(header); }
+
+  void Reserve(size_type capacity, size_type group_capacity) {
+    const auto old_capacity = this->capacity();
+    const auto old_group_capacity = header_ ? header_->group_capacity : 0;
+    if (capacity <= old_capacity && group_capacity <= old_group_capacity) return;
+    // Grow by 1.5x instead of 2x; adjacency lists are the bulk of the graph's
+    // memory so the slack matters more than the extra reallocations.
+    const auto grow = [](size_type requested, size_type old) {
+      const auto grown = std::min<uint64_t>(uint64_t{old} + old / 2, max_size());
+      return std::max(requested, static_cast<size_type>(grown));
+    };
+    capacity = grow(capacity, old_capacity);
+    group_capacity = grow(group_capacity, old_group_capacity);
+
+    auto *header = Allocate(capacity, group_capacity);
+    if (header_) {
+      header->size = header_->size;
+      header->num_groups = header_->num_groups;
+      std::copy_n(GroupsOf(header_), header_->num_groups, GroupsOf(header));
+      std::copy_n(EntriesOf(header_), header_->size, EntriesOf(header));
+      Deallocate(header_);
+    }
+    header_ = header;
+  }
+
+  Header *header_{nullptr};
+};
+
+static_assert(sizeof(AdjacencyList) == sizeof(void *));
+static_assert(std::forward_iterator<AdjacencyList::Iterator>);
+
+}  // namespace memgraph::storage
@@ -14,8 +14,10 @@
 namespace memgraph::storage {
 
 auto AdvanceToVisibleVertex(utils::SkipList<Vertex>::Iterator it, utils::SkipList<Vertex>::Iterator end,
-                            std::optional<VertexAccessor> *vertex, Storage *storage, Transaction *tx, View view) {
+                            std::optional<Gid> chunk_end, std::optional<VertexAccessor> *vertex, Storage *storage,
+                            Transaction *tx, View view) {
   while (it != end) {
+    if (chunk_end && !(*it < *chunk_end)) return end;
     if (not VertexAccessor::IsVisible(&*it, tx, view)) {
       ++it;
       continue;
@@ -28,15 +30,15 @@ auto AdvanceToVisibleVertex(utils::SkipList<Vertex>::Iterator it, utils::SkipLis
 
 AllVerticesIterable::Iterator::Iterator(AllVerticesIterable *self, utils::SkipList<Vertex>::Iterator it)
     : self_(self),
-      it_(AdvanceToVisibleVertex(it, self->vertices_accessor_.end(), &self->vertex_, self->storage_, self->transaction_,
-                                 self->view_)) {}
+      it_(AdvanceToVisibleVertex(it, self->vertices_accessor_.end(), self->chunk_end_, &self->vertex_, self->storage_,
+                                 self->transaction_, self->view_)) {}
 
 VertexAccessor const &AllVerticesIterable::Iterator::operator*() const { return *self_->vertex_; }
 
 AllVerticesIterable::Iterator &AllVerticesIterable::Iterator::operator++() {
   ++it_;
-  it_ = AdvanceToVisibleVertex(it_, self_->vertices_accessor_.end(), &self_->vertex_, self_->storage_,
-                               self_->transaction_, self_->view_);
+  it_ = AdvanceToVisibleVertex(it_, self_->vertices_accessor_.end(), self_->chunk_end_, &self_->vertex_,
+                               self_->storage_, self_->transaction_, self_->view_);
   return *this;
 }
 
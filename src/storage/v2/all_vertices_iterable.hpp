@@ -24,6 +24,8 @@ class AllVerticesIterable final {
   Transaction *transaction_;
   View view_;
   std::optional<VertexAccessor> vertex_;
+  std::optional<utils::SkipList<Vertex>::Iterator> chunk_begin_;
+  std::optional<Gid> chunk_end_;
 
  public:
   class Iterator final {
@@ -46,7 +48,19 @@ class AllVerticesIterable final {
                       View view)
       : vertices_accessor_(std::move(vertices_accessor)), storage_(storage), transaction_(transaction), view_(view) {}
 
-  Iterator begin() { return {this, vertices_accessor_.begin()}; }
+  /// Iterates only over the vertices starting at `chunk_begin` whose gid is
+  /// less than `chunk_end`. A missing `chunk_end` denotes the end of the list.
+  /// @see utils::SkipList::Accessor::chunk_boundaries
+  AllVerticesIterable(utils::SkipList<Vertex>::Accessor vertices_accessor, utils::SkipList<Vertex>::Iterator chunk_begin,
+                      std::optional<Gid> chunk_end, Storage *storage, Transaction *transaction, View view)
+      : vertices_accessor_(std::move(vertices_accessor)),
+        storage_(storage),
+        transaction_(transaction),
+        view_(view),
+        chunk_begin_(chunk_begin),
+        chunk_end_(chunk_end) {}
+
+  Iterator begin() { return {this, chunk_begin_ ? *chunk_begin_ : vertices_accessor_.begin()}; }
   Iterator end() { return {this, vertices_accessor_.end()}; }
 };
 
@@ -0,0 +1,31 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/commit_sequencer.hpp"
+
+namespace memgraph::storage {
+
+void CommitSequencer::WaitPublished(uint64_t tickets) const {
+  // Without commits in flight nothing has to wait.
+  if (published_.load(std::memory_order_acquire) >= tickets) return;
+  auto guard = std::unique_lock{mutex_};
+  published_cv_.wait(guard, [&] { return published_.load(std::memory_order_acquire) >= tickets; });
+}
+
+void CommitSequencer::Publish() {
+  {
+    auto guard = std::lock_guard{mutex_};
+    published_.fetch_add(1, std::memory_order_acq_rel);
+  }
+  published_cv_.notify_all();
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,63 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace memgraph::storage {
+
+/// Orders the publication of committed transactions.
+///
+/// A committing transaction takes a ticket together with its commit timestamp
+/// while holding the engine lock, so tickets are ordered like commit
+/// timestamps. The work that has to be done in commit timestamp order (writing
+/// the WAL, replicating and making the changes visible) is done once the
+/// ticket's turn comes, i.e. when all tickets before it are published, without
+/// holding the engine lock. Everything else is done concurrently by the
+/// committing transactions.
+///
+/// The sequencer is also BasicLockable: `lock` takes a ticket and waits for its
+/// turn, which waits for all transactions that already got a commit timestamp
+/// to be published and keeps the following ones from being published until
+/// `unlock`.
+///
+/// This class is thread-safe.
+class CommitSequencer final {
+ public:
+  /// Hands out the next ticket.
+  uint64_t NextTicket() { return issued_.fetch_add(1, std::memory_order_acq_rel); }
+
+  /// Number of tickets handed out so far.
+  uint64_t IssuedTickets() const { return issued_.load(std::memory_order_acquire); }
+
+  /// Blocks until the first `tickets` tickets are published. The turn of a
+  /// ticket comes after `WaitPublished(ticket)`.
+  void WaitPublished(uint64_t tickets) const;
+
+  /// Publishes the ticket whose turn it is and lets the next one proceed.
+  void Publish();
+
+  void lock() { WaitPublished(NextTicket()); }
+  void unlock() { Publish(); }
+
+ private:
+  std::atomic<uint64_t> issued_{0};
+  std::atomic<uint64_t> published_{0};
+
+  mutable std::mutex mutex_;
+  mutable std::condition_variable published_cv_;
+};
+
+}  // namespace memgraph::storage
@@ -14,6 +14,9 @@
 #include <chrono>
 #include <cstdint>
 #include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "flags/replication.hpp"
 #include "storage/v2/isolation_level.hpp"
@@ -74,6 +77,8 @@ struct Config {
 
     Type type{Type::PERIODIC};
     std::chrono::milliseconds interval{std::chrono::milliseconds(1000)};
+    uint64_t threads{1};                       // GC phases are split into tasks run on this many threads
+    std::chrono::milliseconds step_budget{0};  // time a GC run may spend unlinking deltas, 0 is unbounded
     friend bool operator==(const Gc &lrh, const Gc &rhs) = default;
   } gc;  // SYSTEM FLAG
 
@@ -91,12 +96,16 @@ struct Config {
 
     uint64_t wal_file_size_kibibytes{20 * 1024};  // PER DATABASE
     uint64_t wal_file_flush_every_n_tx{100000};   // PER DATABASE
+    bool wal_group_commit{false};                 // PER DATABASE
+    bool compression{false};                      // PER DATABASE
 
     bool snapshot_on_exit{false};                      // PER DATABASE
     bool restore_replication_state_on_startup{false};  // PER INSTANCE
+    bool replication_compression{false};               // PER INSTANCE
 
     uint64_t items_per_batch{1'000'000};  // PER DATABASE
     uint64_t recovery_thread_count{8};    // PER INSTANCE SYSTEM FLAG
+    uint64_t snapshot_thread_count{1};    // PER INSTANCE SYSTEM FLAG
 
     // deprecated
     bool allow_parallel_index_creation{false};  // KILL
@@ -122,6 +131,33 @@ struct Config {
     friend bool operator==(const DiskConfig &lrh, const DiskConfig &rhs) = default;
   } disk;
 
+  struct PropertyColumnCache {
+    // (label, property) name pairs whose scalar values are mirrored into dense per-vertex columns.
+    std::vector<std::pair<std::string, std::string>> columns;
+    friend bool operator==(const PropertyColumnCache &lrh, const PropertyColumnCache &rhs) = default;
+  } property_column_cache;  // PER DATABASE
+
+  struct HashIndices {
+    // (label, property) name pairs which get a hash index for equality lookups.
+    std::vector<std::pair<std::string, std::string>> label_properties;
+    friend bool operator==(const HashIndices &lrh, const HashIndices &rhs) = default;
+  } hash_indices;  // PER DATABASE
+
+  struct VertexDirectory {
+    // Keep a dense gid -> vertex table next to the vertex skip list, so vertices are found by gid in constant time.
+    bool enabled{false};
+    friend bool operator==(const VertexDirectory &lrh, const VertexDirectory &rhs) = default;
+  } vertex_directory;  // PER DATABASE
+
+  struct IndexCreation {
+    // Threads which build a label or label+property index created by a query, 1 builds it on the query's thread.
+    uint64_t thread_count{1};
+    // Populate a label or label+property index created by a query while other transactions keep running, and
+    // only take unique access to register it and to make it visible.
+    bool online{false};
+    friend bool operator==(const IndexCreation &lrh, const IndexCreation &rhs) = default;
+  } index_creation;  // PER DATABASE
+
   SalientConfig salient;
 
   bool force_on_disk{false};  // TODO: cleanup.... remove + make the default storage_mode ON_DISK_TRANSACTIONAL if true
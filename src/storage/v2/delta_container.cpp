@@ -0,0 +1,162 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/delta_container.hpp"
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+
+#include "utils/spin_lock.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+
+// Deltas are usually created by query threads and destroyed by the GC thread,
+// so most of the recycled slabs go through the shared pool. The per-thread
+// cache saves the lock for threads which do both.
+constexpr std::size_t kThreadCacheBytes = 1UL << 20U;
+constexpr std::size_t kSharedPoolBytes = 64UL << 20U;
+
+/// Free slabs of each size class, linked through their own memory.
+class FreeSlabs final {
+ public:
+  void *Pop(uint32_t size_class) {
+    auto *slab = heads_[size_class];
+    if (slab == nullptr) return nullptr;
+    heads_[size_class] = slab->next;
+    bytes_ -= slab->bytes;
+    return slab;
+  }
+
+  /// Keeps the slab unless that would exceed `limit` bytes.
+  bool TryPush(void *memory, uint32_t size_class, std::size_t bytes, std::size_t limit) {
+    if (bytes_ + bytes > limit) return false;
+    heads_[size_class] = new (memory) FreeSlab{.next = heads_[size_class], .bytes = bytes};
+    bytes_ += bytes;
+    return true;
+  }
+
+  template <typename TCallback>
+  void Drain(TCallback &&callback) {
+    for (uint32_t size_class = 0; size_class < heads_.size(); ++size_class) {
+      while (heads_[size_class] != nullptr) {
+        auto const bytes = heads_[size_class]->bytes;
+        callback(Pop(size_class), size_class, bytes);
+      }
+    }
+  }
+
+ private:
+  struct FreeSlab {
+    FreeSlab *next;
+    std::size_t bytes;
+  };
+
+  std::array<FreeSlab *, DeltaContainer::kSlabSizeClasses> heads_{};
+  std::size_t bytes_{0};
+};
+
+class SharedSlabPool final {
+ public:
+  void *Pop(uint32_t size_class) {
+    auto guard = std::lock_guard{lock_};
+    return free_slabs_.Pop(size_class);
+  }
+
+  bool TryPush(void *memory, uint32_t size_class, std::size_t bytes) {
+    auto guard = std::lock_guard{lock_};
+    return free_slabs_.TryPush(memory, size_class, bytes, kSharedPoolBytes);
+  }
+
+ private:
+  utils::SpinLock lock_;
+  FreeSlabs free_slabs_;
+};
+
+SharedSlabPool &GetSharedSlabPool() {
+  static SharedSlabPool pool;
+  return pool;
+}
+
+void FreeSlabMemory(void *slab, uint32_t size_class, std::size_t bytes) {
+  if (GetSharedSlabPool().TryPush(slab, size_class, bytes)) return;
+  ::operator delete(slab, bytes);
+}
+
+// Set once the thread's cache is destroyed. Deltas destroyed later on the same
+// thread, e.g. by static objects, go straight to the shared pool.
+thread_local bool thread_slab_cache_destroyed = false;
+
+class ThreadSlabCache final {
+ public:
+  ThreadSlabCache() = default;
+  ThreadSlabCache(const ThreadSlabCache &) = delete;
+  ThreadSlabCache(ThreadSlabCache &&) = delete;
+  ThreadSlabCache &operator=(const ThreadSlabCache &) = delete;
+  ThreadSlabCache &operator=(ThreadSlabCache &&) = delete;
+
+  // Hand the cached slabs over to the threads which are still running.
+  ~ThreadSlabCache() {
+    thread_slab_cache_destroyed = true;
+    free_slabs.Drain(FreeSlabMemory);
+  }
+
+  FreeSlabs free_slabs;
+};
+
+thread_local ThreadSlabCache thread_slab_cache;
+
+void *AcquireSlabMemory(uint32_t size_class, std::size_t bytes) {
+  if (!thread_slab_cache_destroyed) [[likely]] {
+    if (auto *slab = thread_slab_cache.free_slabs.Pop(size_class)) return slab;
+  }
+  if (auto *slab = GetSharedSlabPool().Pop(size_class)) return slab;
+  return ::operator new(bytes);
+}
+
+void ReleaseSlabMemory(void *slab, uint32_t size_class, std::size_t bytes) {
+  if (!thread_slab_cache_destroyed &&
+      thread_slab_cache.free_slabs.TryPush(slab, size_class, bytes, kThreadCacheBytes)) [[likely]] {
+    return;
+  }
+  FreeSlabMemory(slab, size_class, bytes);
+}
+
+}  // namespace
+
+void DeltaContainer::clear() noexcept {
+  auto *slab = std::exchange(head_, nullptr);
+  tail_ = nullptr;
+  size_ = 0;
+  while (slab != nullptr) {
+    auto *next = slab->next;
+    std::destroy_n(slab->Data(), slab->size);
+    ReleaseSlab(slab);
+    slab = next;
+  }
+}
+
+DeltaContainer::Slab *DeltaContainer::AcquireSlab(uint32_t size_class) {
+  auto *memory = AcquireSlabMemory(size_class, SlabBytes(size_class));
+  return new (memory) Slab{.size_class = size_class};
+}
+
+void DeltaContainer::ReleaseSlab(Slab *slab) noexcept {
+  auto const size_class = slab->size_class;
+  std::destroy_at(slab);
+  ReleaseSlabMemory(slab, size_class, SlabBytes(size_class));
+}
+
+}  // namespace memgraph::storage
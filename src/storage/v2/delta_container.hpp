@@ -0,0 +1,170 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "storage/v2/delta.hpp"
+
+namespace memgraph::storage {
+
+/// Append-only container of the deltas created by a transaction.
+///
+/// Deltas are linked into version chains by pointers, so they never move once
+/// they are created. They are stored in slabs which grow with the transaction:
+/// the first slab fits `kMinSlabCapacity` deltas and every following one twice
+/// as many as the previous one, up to `kMaxSlabCapacity`. When the deltas are
+/// destroyed, which is done once the GC proves they are unreachable, the slabs
+/// are returned to a pool with a small per-thread cache and reused by the
+/// following transactions instead of going through the global allocator.
+///
+/// The container isn't thread-safe.
+class DeltaContainer final {
+  struct alignas(Delta) Slab {
+    Slab *next{nullptr};
+    uint32_t size_class;
+    uint32_t size{0};
+
+    Delta *Data() { return reinterpret_cast<Delta *>(this + 1); }
+  };
+  static_assert(sizeof(Slab) % alignof(Delta) == 0);
+  static_assert(alignof(Slab) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+
+ public:
+  static constexpr uint32_t kMinSlabCapacity = 8;
+  static constexpr uint32_t kSlabSizeClasses = 8;
+  static constexpr uint32_t kMaxSlabCapacity = kMinSlabCapacity << (kSlabSizeClasses - 1);
+
+  template <bool IsConst>
+  class Iterator final {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Delta;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const Delta *, Delta *>;
+    using reference = std::conditional_t<IsConst, const Delta &, Delta &>;
+
+    Iterator() = default;
+
+    reference operator*() const { return slab_->Data()[index_]; }
+    pointer operator->() const { return &slab_->Data()[index_]; }
+
+    Iterator &operator++() {
+      if (++index_ == slab_->size) {
+        slab_ = slab_->next;
+        index_ = 0;
+      }
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto old = *this;
+      ++*this;
+      return old;
+    }
+
+    friend bool operator==(const Iterator &lhs, const Iterator &rhs) = default;
+
+   private:
+    friend class DeltaContainer;
+
+    explicit Iterator(Slab *slab) : slab_(slab) {}
+
+    Slab *slab_{nullptr};
+    uint32_t index_{0};
+  };
+
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  DeltaContainer() = default;
+
+  DeltaContainer(DeltaContainer &&other) noexcept
+      : head_(std::exchange(other.head_, nullptr)),
+        tail_(std::exchange(other.tail_, nullptr)),
+        size_(std::exchange(other.size_, 0)) {}
+
+  DeltaContainer &operator=(DeltaContainer &&other) noexcept {
+    if (this != &other) {
+      clear();
+      head_ = std::exchange(other.head_, nullptr);
+      tail_ = std::exchange(other.tail_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+  }
+
+  DeltaContainer(const DeltaContainer &) = delete;
+  DeltaContainer &operator=(const DeltaContainer &) = delete;
+
+  ~DeltaContainer() { clear(); }
+
+  /// @throw std::bad_alloc
+  template <typename... Args>
+  Delta &emplace_back(Args &&...args) {
+    if (tail_ != nullptr && tail_->size < SlabCapacity(tail_->size_class)) [[likely]] {
+      auto *delta = new (tail_->Data() + tail_->size) Delta(std::forward<Args>(args)...);
+      ++tail_->size;
+      ++size_;
+      return *delta;
+    }
+
+    auto *slab = AcquireSlab(tail_ == nullptr ? 0 : std::min(tail_->size_class + 1, kSlabSizeClasses - 1));
+    Delta *delta = nullptr;
+    try {
+      delta = new (slab->Data()) Delta(std::forward<Args>(args)...);
+    } catch (...) {
+      ReleaseSlab(slab);
+      throw;
+    }
+    // The slab is linked only once it holds a delta, so the iterators never
+    // see an empty slab.
+    slab->size = 1;
+    (tail_ == nullptr ? head_ : tail_->next) = slab;
+    tail_ = slab;
+    ++size_;
+    return *delta;
+  }
+
+  /// Destroys all deltas and returns their slabs to the pool.
+  void clear() noexcept;
+
+  bool empty() const { return size_ == 0; }
+  std::size_t size() const { return size_; }
+
+  iterator begin() { return iterator{head_}; }
+  iterator end() { return iterator{}; }
+  const_iterator begin() const { return const_iterator{head_}; }
+  const_iterator end() const { return const_iterator{}; }
+
+ private:
+  static constexpr uint32_t SlabCapacity(uint32_t size_class) { return kMinSlabCapacity << size_class; }
+  static constexpr std::size_t SlabBytes(uint32_t size_class) {
+    return sizeof(Slab) + SlabCapacity(size_class) * sizeof(Delta);
+  }
+
+  /// @throw std::bad_alloc
+  static Slab *AcquireSlab(uint32_t size_class);
+  static void ReleaseSlab(Slab *slab) noexcept;
+
+  Slab *head_{nullptr};
+  Slab *tail_{nullptr};
+  std::size_t size_{0};
+};
+
+}  // namespace memgraph::storage
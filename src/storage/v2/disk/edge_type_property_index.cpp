@@ -0,0 +1,60 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#include "edge_type_property_index.hpp"
+
+#include "utils/logging.hpp"
+
+namespace memgraph::storage {
+
+bool DiskEdgeTypePropertyIndex::DropIndex(EdgeTypeId /*edge_type*/, PropertyId /*property*/) {
+  spdlog::warn("Edge-type+property index related operations are not yet supported using on-disk storage mode.");
+  return false;
+}
+
+bool DiskEdgeTypePropertyIndex::IndexExists(EdgeTypeId /*edge_type*/, PropertyId /*property*/) const {
+  return false;
+}
+
+std::vector<std::pair<EdgeTypeId, PropertyId>> DiskEdgeTypePropertyIndex::ListIndices() const { return {}; }
+
+uint64_t DiskEdgeTypePropertyIndex::ApproximateEdgeCount(EdgeTypeId /*edge_type*/, PropertyId /*property*/) const {
+  spdlog::warn("Edge-type+property index related operations are not yet supported using on-disk storage mode.");
+  return 0U;
+}
+
+uint64_t DiskEdgeTypePropertyIndex::ApproximateEdgeCount(EdgeTypeId /*edge_type*/, PropertyId /*property*/,
+                                                         const PropertyValue & /*value*/) const {
+  spdlog::warn("Edge-type+property index related operations are not yet supported using on-disk storage mode.");
+  return 0U;
+}
+
+uint64_t DiskEdgeTypePropertyIndex::ApproximateEdgeCount(
+    EdgeTypeId /*edge_type*/, PropertyId /*property*/, const std::optional<utils::Bound<PropertyValue>> & /*lower*/,
+    const std::optional<utils::Bound<PropertyValue>> & /*upper*/) const {
+  spdlog::warn("Edge-type+property index related operations are not yet supported using on-disk storage mode.");
+  return 0U;
+}
+
+// There are no edge-type+property indices in the on-disk storage, so the hooks
+// have nothing to update.
+void DiskEdgeTypePropertyIndex::UpdateOnSetProperty(EdgeTypeId /*edge_type*/, PropertyId /*property*/,
+                                                    const PropertyValue & /*value*/, Vertex * /*from_vertex*/,
+                                                    Vertex * /*to_vertex*/, Edge * /*edge*/,
+                                                    const Transaction & /*tx*/) {}
+
+void DiskEdgeTypePropertyIndex::UpdateOnEdgeModification(Vertex * /*old_from*/, Vertex * /*old_to*/,
+                                                         Vertex * /*new_from*/, Vertex * /*new_to*/,
+                                                         EdgeRef /*edge_ref*/, EdgeTypeId /*edge_type*/,
+                                                         const Transaction & /*tx*/) {}
+
+}  // namespace memgraph::storage
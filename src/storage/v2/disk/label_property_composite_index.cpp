@@ -0,0 +1,53 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "label_property_composite_index.hpp"
+
+#include "utils/logging.hpp"
+
+namespace memgraph::storage {
+
+// There are no composite indices in the on-disk storage, so the hooks have
+// nothing to update.
+void DiskLabelPropertyCompositeIndex::UpdateOnAddLabel(LabelId /*added_label*/, Vertex * /*vertex_after_update*/,
+                                                       const Transaction & /*tx*/) {}
+
+void DiskLabelPropertyCompositeIndex::UpdateOnSetProperty(PropertyId /*property*/, const PropertyValue & /*value*/,
+                                                          Vertex * /*vertex*/, const Transaction & /*tx*/) {}
+
+bool DiskLabelPropertyCompositeIndex::DropIndex(LabelId /*label*/, const std::vector<PropertyId> & /*properties*/) {
+  spdlog::warn("Composite index related operations are not yet supported using on-disk storage mode.");
+  return false;
+}
+
+bool DiskLabelPropertyCompositeIndex::IndexExists(LabelId /*label*/,
+                                                  const std::vector<PropertyId> & /*properties*/) const {
+  return false;
+}
+
+std::vector<std::pair<LabelId, std::vector<PropertyId>>> DiskLabelPropertyCompositeIndex::ListIndices() const {
+  return {};
+}
+
+uint64_t DiskLabelPropertyCompositeIndex::ApproximateVertexCount(
+    LabelId /*label*/, const std::vector<PropertyId> & /*properties*/) const {
+  spdlog::warn("Composite index related operations are not yet supported using on-disk storage mode.");
+  return 0U;
+}
+
+uint64_t DiskLabelPropertyCompositeIndex::ApproximateVertexCount(
+    LabelId /*label*/, const std::vector<PropertyId> & /*properties*/,
+    const std::vector<PropertyValue> & /*prefix*/) const {
+  spdlog::warn("Composite index related operations are not yet supported using on-disk storage mode.");
+  return 0U;
+}
+
+}  // namespace memgraph::storage
@@ -810,11 +810,38 @@ void DiskStorage::LoadVerticesFromDiskLabelPropertyIndexForIntervalSearch(
   }
 }
 
+VerticesIterable DiskStorage::DiskAccessor::Vertices(
+    LabelId /*label*/, const std::vector<PropertyId> & /*properties*/, const std::vector<PropertyValue> & /*prefix*/,
+    const std::optional<utils::Bound<PropertyValue>> & /*lower_bound*/,
+    const std::optional<utils::Bound<PropertyValue>> & /*upper_bound*/, View /*view*/) {
+  throw utils::NotYetImplemented(
+      "Composite index related operations are not yet supported using on-disk storage mode.");
+}
+
 EdgesIterable DiskStorage::DiskAccessor::Edges(EdgeTypeId /*edge_type*/, View /*view*/) {
   throw utils::NotYetImplemented(
       "Edge-type index related operations are not yet supported using on-disk storage mode.");
 }
 
+EdgesIterable DiskStorage::DiskAccessor::Edges(EdgeTypeId /*edge_type*/, PropertyId /*property*/, View /*view*/) {
+  throw utils::NotYetImplemented(
+      "Edge-type+property index related operations are not yet supported using on-disk storage mode.");
+}
+
+EdgesIterable DiskStorage::DiskAccessor::Edges(EdgeTypeId /*edge_type*/, PropertyId /*property*/,
+                                               const PropertyValue & /*value*/, View /*view*/) {
+  throw utils::NotYetImplemented(
+      "Edge-type+property index related operations are not yet supported using on-disk storage mode.");
+}
+
+EdgesIterable DiskStorage::DiskAccessor::Edges(EdgeTypeId /*edge_type*/, PropertyId /*property*/,
+                                               const std::optional<utils::Bound<PropertyValue>> & /*lower_bound*/,
+                                               const std::optional<utils::Bound<PropertyValue>> & /*upper_bound*/,
+                                               View /*view*/) {
+  throw utils::NotYetImplemented(
+      "Edge-type+property index related operations are not yet supported using on-disk storage mode.");
+}
+
 uint64_t DiskStorage::DiskAccessor::ApproximateVertexCount() const {
   auto *disk_storage = static_cast<DiskStorage *>(storage_);
   return disk_storage->vertex_count_.load(std::memory_order_acquire);
@@ -825,6 +852,24 @@ uint64_t DiskStorage::DiskAccessor::ApproximateEdgeCount(EdgeTypeId /*edge_type*
   return 0U;
 }
 
+uint64_t DiskStorage::DiskAccessor::ApproximateEdgeCount(EdgeTypeId /*edge_type*/, PropertyId /*property*/) const {
+  spdlog::info("Edge-type+property index related operations are not yet supported using on-disk storage mode.");
+  return 0U;
+}
+
+uint64_t DiskStorage::DiskAccessor::ApproximateEdgeCount(EdgeTypeId /*edge_type*/, PropertyId /*property*/,
+                                                         const PropertyValue & /*value*/) const {
+  spdlog::info("Edge-type+property index related operations are not yet supported using on-disk storage mode.");
+  return 0U;
+}
+
+uint64_t DiskStorage::DiskAccessor::ApproximateEdgeCount(
+    EdgeTypeId /*edge_type*/, PropertyId /*property*/, const std::optional<utils::Bound<PropertyValue>> & /*lower*/,
+    const std::optional<utils::Bound<PropertyValue>> & /*upper*/) const {
+  spdlog::info("Edge-type+property index related operations are not yet supported using on-disk storage mode.");
+  return 0U;
+}
+
 uint64_t DiskStorage::GetDiskSpaceUsage() const {
   uint64_t main_disk_storage_size = utils::GetDirDiskUsage(config_.disk.main_storage_directory);
   uint64_t index_disk_storage_size = utils::GetDirDiskUsage(config_.disk.label_index_directory) +
@@ -982,10 +1027,10 @@ Result<EdgeAccessor> DiskStorage::DiskAccessor::CreateEdge(VertexAccessor *from,
   transaction_.AddModifiedEdge(gid, modified_edge);
 
   CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge);
-  from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
+  from_vertex->out_edges.emplace(edge_type, to_vertex, edge);
 
   CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge);
-  to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+  to_vertex->in_edges.emplace(edge_type, from_vertex, edge);
 
   transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
   transaction_.manyDeltasCache.Invalidate(to_vertex, edge_type, EdgeDirection::IN);
@@ -1430,8 +1475,8 @@ std::optional<EdgeAccessor> DiskStorage::CreateEdgeFromDisk(const VertexAccessor
   if (transaction->AddModifiedEdge(gid, modified_edge)) {
     spdlog::trace("Edge {} added to out edges of vertex with gid {}", gid.ToString(), from_vertex->gid.AsUint());
     spdlog::trace("Edge {} added to in edges of vertex with gid {}", gid.ToString(), to_vertex->gid.AsUint());
-    from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
-    to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+    from_vertex->out_edges.emplace(edge_type, to_vertex, edge);
+    to_vertex->in_edges.emplace(edge_type, from_vertex, edge);
     transaction->manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
     transaction->manyDeltasCache.Invalidate(to_vertex, edge_type, EdgeDirection::IN);
   }
@@ -1661,6 +1706,14 @@ utils::BasicResult<StorageManipulationError, void> DiskStorage::DiskAccessor::Co
         case MetadataDelta::Action::EDGE_INDEX_DROP: {
           throw utils::NotYetImplemented("Edge-type indexing is not yet implemented on on-disk storage mode.");
         }
+        case MetadataDelta::Action::EDGE_PROPERTY_INDEX_CREATE:
+        case MetadataDelta::Action::EDGE_PROPERTY_INDEX_DROP: {
+          throw utils::NotYetImplemented("Edge-type+property indexing is not yet implemented on on-disk storage mode.");
+        }
+        case MetadataDelta::Action::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+        case MetadataDelta::Action::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+          throw utils::NotYetImplemented("Composite indexing is not yet implemented on on-disk storage mode.");
+        }
         case MetadataDelta::Action::LABEL_INDEX_STATS_SET: {
           throw utils::NotYetImplemented("SetIndexStats(stats) is not implemented for DiskStorage.");
         } break;
@@ -1961,6 +2014,18 @@ utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DiskAccessor:
       "Edge-type index related operations are not yet supported using on-disk storage mode.");
 }
 
+utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DiskAccessor::CreateIndex(
+    EdgeTypeId /*edge_type*/, PropertyId /*property*/) {
+  throw utils::NotYetImplemented(
+      "Edge-type+property index related operations are not yet supported using on-disk storage mode.");
+}
+
+utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DiskAccessor::CreateIndex(
+    LabelId /*label*/, std::vector<PropertyId> /*properties*/) {
+  throw utils::NotYetImplemented(
+      "Composite index related operations are not yet supported using on-disk storage mode.");
+}
+
 utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DiskAccessor::DropIndex(LabelId label) {
   MG_ASSERT(unique_guard_.owns_lock(), "Create index requires a unique access to the storage!");
   auto *on_disk = static_cast<DiskStorage *>(storage_);
@@ -1994,6 +2059,18 @@ utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DiskAccessor:
       "Edge-type index related operations are not yet supported using on-disk storage mode.");
 }
 
+utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DiskAccessor::DropIndex(
+    EdgeTypeId /*edge_type*/, PropertyId /*property*/) {
+  throw utils::NotYetImplemented(
+      "Edge-type+property index related operations are not yet supported using on-disk storage mode.");
+}
+
+utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DiskAccessor::DropIndex(
+    LabelId /*label*/, std::vector<PropertyId> /*properties*/) {
+  throw utils::NotYetImplemented(
+      "Composite index related operations are not yet supported using on-disk storage mode.");
+}
+
 utils::BasicResult<StorageExistenceConstraintDefinitionError, void>
 DiskStorage::DiskAccessor::CreateExistenceConstraint(LabelId label, PropertyId property) {
   MG_ASSERT(unique_guard_.owns_lock(), "Create existence constraint requires a unique access to the storage!");
@@ -2109,6 +2186,12 @@ bool DiskStorage::DiskAccessor::EdgeTypeIndexExists(EdgeTypeId /*edge_type*/) co
   return false;
 }
 
+bool DiskStorage::DiskAccessor::EdgeTypePropertyIndexExists(EdgeTypeId /*edge_type*/,
+                                                            PropertyId /*property*/) const {
+  spdlog::info("Edge-type+property index related operations are not yet supported using on-disk storage mode.");
+  return false;
+}
+
 IndicesInfo DiskStorage::DiskAccessor::ListAllIndices() const {
   auto *on_disk = static_cast<DiskStorage *>(storage_);
   auto *disk_label_index = static_cast<DiskLabelIndex *>(on_disk->indices_.label_index_.get());
@@ -2118,7 +2201,10 @@ IndicesInfo DiskStorage::DiskAccessor::ListAllIndices() const {
   return {disk_label_index->ListIndices(),
           disk_label_property_index->ListIndices(),
           {/* edge type indices */},
-          text_index.ListIndices()};
+          {/* edge type+property indices */},
+          text_index.ListIndices(),
+          {/* label+properties indices */},
+          {/* label+property hash indices */}};
 }
 ConstraintsInfo DiskStorage::DiskAccessor::ListAllConstraints() const {
   auto *disk_storage = static_cast<DiskStorage *>(storage_);
@@ -72,8 +72,21 @@ class DiskStorage final : public Storage {
                               const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                               const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
 
+    VerticesIterable Vertices(LabelId label, const std::vector<PropertyId> &properties,
+                              const std::vector<PropertyValue> &prefix,
+                              const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                              const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
+
     EdgesIterable Edges(EdgeTypeId edge_type, View view) override;
 
+    EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property, View view) override;
+
+    EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value, View view) override;
+
+    EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property,
+                        const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                        const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
+
     uint64_t ApproximateVertexCount() const override;
 
     uint64_t ApproximateVertexCount(LabelId /*label*/) const override { return 10; }
@@ -91,8 +104,22 @@ class DiskStorage final : public Storage {
       return 10;
     }
 
+    uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                    const std::vector<PropertyValue> &prefix) const override {
+      auto *disk_storage = static_cast<DiskStorage *>(storage_);
+      return disk_storage->indices_.label_property_composite_index_->ApproximateVertexCount(label, properties, prefix);
+    }
+
     uint64_t ApproximateEdgeCount(EdgeTypeId edge_type) const override;
 
+    uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property) const override;
+
+    uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value) const override;
+
+    uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property,
+                                  const std::optional<utils::Bound<PropertyValue>> &lower,
+                                  const std::optional<utils::Bound<PropertyValue>> &upper) const override;
+
     std::optional<storage::LabelIndexStats> GetIndexStats(const storage::LabelId & /*label*/) const override {
       return {};
     }
@@ -144,8 +171,15 @@ class DiskStorage final : public Storage {
       return disk_storage->indices_.label_property_index_->IndexExists(label, property);
     }
 
+    bool LabelPropertyCompositeIndexExists(LabelId label, const std::vector<PropertyId> &properties) const override {
+      auto *disk_storage = static_cast<DiskStorage *>(storage_);
+      return disk_storage->indices_.label_property_composite_index_->IndexExists(label, properties);
+    }
+
     bool EdgeTypeIndexExists(EdgeTypeId edge_type) const override;
 
+    bool EdgeTypePropertyIndexExists(EdgeTypeId edge_type, PropertyId property) const override;
+
     IndicesInfo ListAllIndices() const override;
 
     ConstraintsInfo ListAllConstraints() const override;
@@ -166,12 +200,24 @@ class DiskStorage final : public Storage {
 
     utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(EdgeTypeId edge_type) override;
 
+    utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(EdgeTypeId edge_type,
+                                                                      PropertyId property) override;
+
+    utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(LabelId label,
+                                                                      std::vector<PropertyId> properties) override;
+
     utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(LabelId label) override;
 
     utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(LabelId label, PropertyId property) override;
 
     utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(EdgeTypeId edge_type) override;
 
+    utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(EdgeTypeId edge_type,
+                                                                    PropertyId property) override;
+
+    utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(LabelId label,
+                                                                    std::vector<PropertyId> properties) override;
+
     utils::BasicResult<StorageExistenceConstraintDefinitionError, void> CreateExistenceConstraint(
         LabelId label, PropertyId property) override;
 
@@ -32,7 +32,9 @@
 #include "storage/v2/durability/snapshot.hpp"
 #include "storage/v2/durability/wal.hpp"
 #include "storage/v2/inmemory/edge_type_index.hpp"
+#include "storage/v2/inmemory/edge_type_property_index.hpp"
 #include "storage/v2/inmemory/label_index.hpp"
+#include "storage/v2/inmemory/label_property_composite_index.hpp"
 #include "storage/v2/inmemory/label_property_index.hpp"
 #include "storage/v2/inmemory/unique_constraints.hpp"
 #include "storage/v2/name_id_mapper.hpp"
@@ -41,6 +43,7 @@
 #include "utils/logging.hpp"
 #include "utils/memory_tracker.hpp"
 #include "utils/message.hpp"
+#include "utils/string.hpp"
 #include "utils/timer.hpp"
 namespace memgraph::metrics {
 extern const Event SnapshotRecoveryLatency_us;
@@ -201,6 +204,23 @@ void RecoverIndicesAndStats(const RecoveredIndicesAndConstraints::IndicesMetadat
   }
   spdlog::info("Label+property indices statistics are recreated.");
 
+  // Recover label+properties indices.
+  spdlog::info("Recreating {} label+properties indices from metadata.", indices_metadata.label_properties.size());
+  auto *mem_label_property_composite_index =
+      static_cast<InMemoryLabelPropertyCompositeIndex *>(indices->label_property_composite_index_.get());
+  for (const auto &[label, properties] : indices_metadata.label_properties) {
+    if (!mem_label_property_composite_index->CreateIndex(label, properties, vertices->access(), parallel_exec_info))
+      throw RecoveryFailure("The label+properties index must be created here!");
+    std::vector<std::string> property_names;
+    property_names.reserve(properties.size());
+    for (const auto property : properties) {
+      property_names.push_back(name_id_mapper->IdToName(property.AsUint()));
+    }
+    spdlog::info("Index on :{}({}) is recreated from metadata", name_id_mapper->IdToName(label.AsUint()),
+                 utils::Join(property_names, ", "));
+  }
+  spdlog::info("Label+properties indices are recreated.");
+
   // Recover edge-type indices.
   spdlog::info("Recreating {} edge-type indices from metadata.", indices_metadata.edge.size());
   auto *mem_edge_type_index = static_cast<InMemoryEdgeTypeIndex *>(indices->edge_type_index_.get());
@@ -212,6 +232,20 @@ void RecoverIndicesAndStats(const RecoveredIndicesAndConstraints::IndicesMetadat
   }
   spdlog::info("Edge-type indices are recreated.");
 
+  // Recover edge-type + property indices.
+  spdlog::info("Recreating {} edge-type + property indices from metadata.",
+               indices_metadata.edge_type_property.size());
+  auto *mem_edge_type_property_index =
+      static_cast<InMemoryEdgeTypePropertyIndex *>(indices->edge_type_property_index_.get());
+  for (const auto &[edge_type, property] : indices_metadata.edge_type_property) {
+    if (!mem_edge_type_property_index->CreateIndex(edge_type, property, vertices->access())) {
+      throw RecoveryFailure("The edge-type + property index must be created here!");
+    }
+    spdlog::info("Index on :{}({}) is recreated from metadata", name_id_mapper->IdToName(edge_type.AsUint()),
+                 name_id_mapper->IdToName(property.AsUint()));
+  }
+  spdlog::info("Edge-type + property indices are recreated.");
+
   if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
     // Recover text indices.
     spdlog::info("Recreating {} text indices from metadata.", indices_metadata.text_indices.size());
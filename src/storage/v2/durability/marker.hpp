@@ -66,6 +66,10 @@ enum class Marker : uint8_t {
   DELTA_EDGE_TYPE_INDEX_DROP = 0x66,
   DELTA_TEXT_INDEX_CREATE = 0x67,
   DELTA_TEXT_INDEX_DROP = 0x68,
+  DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE = 0x69,
+  DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP = 0x6a,
+  DELTA_EDGE_TYPE_PROPERTY_INDEX_CREATE = 0x6b,
+  DELTA_EDGE_TYPE_PROPERTY_INDEX_DROP = 0x6c,
 
   VALUE_FALSE = 0x00,
   VALUE_TRUE = 0xff,
@@ -110,8 +114,12 @@ static const Marker kMarkersAll[] = {
     Marker::DELTA_LABEL_PROPERTY_INDEX_STATS_CLEAR,
     Marker::DELTA_LABEL_PROPERTY_INDEX_CREATE,
     Marker::DELTA_LABEL_PROPERTY_INDEX_DROP,
+    Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE,
+    Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP,
     Marker::DELTA_EDGE_TYPE_INDEX_CREATE,
     Marker::DELTA_EDGE_TYPE_INDEX_DROP,
+    Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_CREATE,
+    Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_DROP,
     Marker::DELTA_TEXT_INDEX_CREATE,
     Marker::DELTA_TEXT_INDEX_DROP,
     Marker::DELTA_EXISTENCE_CONSTRAINT_CREATE,
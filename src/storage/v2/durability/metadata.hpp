@@ -43,7 +43,9 @@ struct RecoveredIndicesAndConstraints {
     std::vector<std::pair<LabelId, PropertyId>> label_property;
     std::vector<std::pair<LabelId, LabelIndexStats>> label_stats;
     std::vector<std::pair<LabelId, std::pair<PropertyId, LabelPropertyIndexStats>>> label_property_stats;
+    std::vector<std::pair<LabelId, std::vector<PropertyId>>> label_properties;
     std::vector<EdgeTypeId> edge;
+    std::vector<std::pair<EdgeTypeId, PropertyId>> edge_type_property;
     std::vector<std::pair<std::string, LabelId>> text_indices;
   } indices;
 
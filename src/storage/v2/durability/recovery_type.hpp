@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2024 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -17,6 +17,8 @@
 
 namespace memgraph::storage::durability {
 struct ParallelizedSchemaCreationInfo {
+  // Batches of vertices given by their first gid and size. Index creation
+  // splits the vertices into chunks itself if there are none.
   std::vector<std::pair<Gid, uint64_t>> vertex_recovery_info;
   uint64_t thread_count;
 };
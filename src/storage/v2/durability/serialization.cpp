@@ -11,8 +11,16 @@
 
 #include "storage/v2/durability/serialization.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <set>
+
 #include "storage/v2/temporal.hpp"
+#include "utils/compression.hpp"
 #include "utils/endian.hpp"
+#include "utils/logging.hpp"
 
 namespace memgraph::storage::durability {
 
@@ -21,136 +29,552 @@ namespace memgraph::storage::durability {
 //////////////////////////
 
 namespace {
-void WriteSize(Encoder *encoder, uint64_t size) {
+// The file and the buffer encoders produce the same encoding, they only differ
+// in where `Write` puts the bytes.
+
+template <typename TEncoder>
+void WriteSize(TEncoder *encoder, uint64_t size) {
   size = utils::HostToLittleEndian(size);
   encoder->Write(reinterpret_cast<const uint8_t *>(&size), sizeof(size));
 }
-}  // namespace
-
-void Encoder::Initialize(const std::filesystem::path &path, const std::string_view magic, uint64_t version) {
-  file_.Open(path, utils::OutputFile::Mode::OVERWRITE_EXISTING);
-  Write(reinterpret_cast<const uint8_t *>(magic.data()), magic.size());
-  auto version_encoded = utils::HostToLittleEndian(version);
-  Write(reinterpret_cast<const uint8_t *>(&version_encoded), sizeof(version_encoded));
-}
-
-void Encoder::OpenExisting(const std::filesystem::path &path) {
-  file_.Open(path, utils::OutputFile::Mode::APPEND_TO_EXISTING);
-}
-
-void Encoder::Close() {
-  if (file_.IsOpen()) {
-    file_.Close();
-  }
-}
 
-void Encoder::Write(const uint8_t *data, uint64_t size) { file_.Write(data, size); }
-
-void Encoder::WriteMarker(Marker marker) {
+template <typename TEncoder>
+void EncodeMarker(TEncoder *encoder, Marker marker) {
   auto value = static_cast<uint8_t>(marker);
-  Write(&value, sizeof(value));
+  encoder->Write(&value, sizeof(value));
 }
 
-void Encoder::WriteBool(bool value) {
-  WriteMarker(Marker::TYPE_BOOL);
+template <typename TEncoder>
+void EncodeBool(TEncoder *encoder, bool value) {
+  EncodeMarker(encoder, Marker::TYPE_BOOL);
   if (value) {
-    WriteMarker(Marker::VALUE_TRUE);
+    EncodeMarker(encoder, Marker::VALUE_TRUE);
   } else {
-    WriteMarker(Marker::VALUE_FALSE);
+    EncodeMarker(encoder, Marker::VALUE_FALSE);
   }
 }
 
-void Encoder::WriteUint(uint64_t value) {
+template <typename TEncoder>
+void EncodeUint(TEncoder *encoder, uint64_t value) {
   value = utils::HostToLittleEndian(value);
-  WriteMarker(Marker::TYPE_INT);
-  Write(reinterpret_cast<const uint8_t *>(&value), sizeof(value));
+  EncodeMarker(encoder, Marker::TYPE_INT);
+  encoder->Write(reinterpret_cast<const uint8_t *>(&value), sizeof(value));
 }
 
-void Encoder::WriteDouble(double value) {
+template <typename TEncoder>
+void EncodeDouble(TEncoder *encoder, double value) {
   auto value_uint = utils::MemcpyCast<uint64_t>(value);
   value_uint = utils::HostToLittleEndian(value_uint);
-  WriteMarker(Marker::TYPE_DOUBLE);
-  Write(reinterpret_cast<const uint8_t *>(&value_uint), sizeof(value_uint));
+  EncodeMarker(encoder, Marker::TYPE_DOUBLE);
+  encoder->Write(reinterpret_cast<const uint8_t *>(&value_uint), sizeof(value_uint));
 }
 
-void Encoder::WriteString(const std::string_view value) {
-  WriteMarker(Marker::TYPE_STRING);
-  WriteSize(this, value.size());
-  Write(reinterpret_cast<const uint8_t *>(value.data()), value.size());
+template <typename TEncoder>
+void EncodeString(TEncoder *encoder, const std::string_view value) {
+  EncodeMarker(encoder, Marker::TYPE_STRING);
+  WriteSize(encoder, value.size());
+  encoder->Write(reinterpret_cast<const uint8_t *>(value.data()), value.size());
 }
 
-void Encoder::WritePropertyValue(const PropertyValue &value) {
-  WriteMarker(Marker::TYPE_PROPERTY_VALUE);
+template <typename TEncoder>
+void EncodePropertyValue(TEncoder *encoder, const PropertyValue &value) {
+  EncodeMarker(encoder, Marker::TYPE_PROPERTY_VALUE);
   switch (value.type()) {
     case PropertyValue::Type::Null: {
-      WriteMarker(Marker::TYPE_NULL);
+      EncodeMarker(encoder, Marker::TYPE_NULL);
       break;
     }
     case PropertyValue::Type::Bool: {
-      WriteBool(value.ValueBool());
+      EncodeBool(encoder, value.ValueBool());
       break;
     }
     case PropertyValue::Type::Int: {
-      WriteUint(utils::MemcpyCast<uint64_t>(value.ValueInt()));
+      EncodeUint(encoder, utils::MemcpyCast<uint64_t>(value.ValueInt()));
       break;
     }
     case PropertyValue::Type::Double: {
-      WriteDouble(value.ValueDouble());
+      EncodeDouble(encoder, value.ValueDouble());
       break;
     }
     case PropertyValue::Type::String: {
-      WriteString(value.ValueString());
+      EncodeString(encoder, value.ValueString());
       break;
     }
     case PropertyValue::Type::List: {
       const auto &list = value.ValueList();
-      WriteMarker(Marker::TYPE_LIST);
-      WriteSize(this, list.size());
+      EncodeMarker(encoder, Marker::TYPE_LIST);
+      WriteSize(encoder, list.size());
       for (const auto &item : list) {
-        WritePropertyValue(item);
+        EncodePropertyValue(encoder, item);
       }
       break;
     }
     case PropertyValue::Type::Map: {
       const auto &map = value.ValueMap();
-      WriteMarker(Marker::TYPE_MAP);
-      WriteSize(this, map.size());
+      EncodeMarker(encoder, Marker::TYPE_MAP);
+      WriteSize(encoder, map.size());
       for (const auto &item : map) {
-        WriteString(item.first);
-        WritePropertyValue(item.second);
+        EncodeString(encoder, item.first);
+        EncodePropertyValue(encoder, item.second);
       }
       break;
     }
     case PropertyValue::Type::TemporalData: {
       const auto temporal_data = value.ValueTemporalData();
-      WriteMarker(Marker::TYPE_TEMPORAL_DATA);
-      WriteUint(static_cast<uint64_t>(temporal_data.type));
-      WriteUint(utils::MemcpyCast<uint64_t>(temporal_data.microseconds));
+      EncodeMarker(encoder, Marker::TYPE_TEMPORAL_DATA);
+      EncodeUint(encoder, static_cast<uint64_t>(temporal_data.type));
+      EncodeUint(encoder, utils::MemcpyCast<uint64_t>(temporal_data.microseconds));
       break;
     }
   }
 }
 
-uint64_t Encoder::GetPosition() { return file_.GetPosition(); }
+// Compressed files consist of the uncompressed header, the blocks and, once
+// the file is finalized, the block index:
+//   block: position (u64), size (u32), stored size (u32), CRC-32 of the stored
+//          data (u32), stored data
+//   index: position and file offset (u64 each) of every block, size of the
+//          uncompressed file (u64), number of blocks (u64), file offset of the
+//          index (u64), CRC-32 of the index up to here (u32), `kBlockIndexMagic`
+// Data which doesn't compress is stored as is, which is the case exactly when
+// the stored size of a block equals its size. A block changed after it was
+// written is written again and the index points to its last copy. Files
+// without a valid index (e.g. the current WAL file, whose data can end with
+// the magic by chance) are read by scanning the blocks up to the first
+// incomplete one.
+constexpr uint64_t kBlockSize = 256UL * 1024;
+constexpr uint64_t kBlockHeaderSize = sizeof(uint64_t) + 3 * sizeof(uint32_t);
+constexpr uint64_t kBlockIndexEntrySize = 2 * sizeof(uint64_t);
+constexpr std::string_view kBlockIndexMagic{"MGbi"};
+constexpr uint64_t kBlockIndexTrailerSize = 3 * sizeof(uint64_t) + sizeof(uint32_t) + kBlockIndexMagic.size();
 
-void Encoder::SetPosition(uint64_t position) { file_.SetPosition(utils::OutputFile::Position::SET, position); }
+struct BlockHeader {
+  uint64_t position;
+  uint32_t size;
+  uint32_t stored_size;
+  uint32_t checksum;
+};
 
-void Encoder::Sync() { file_.Sync(); }
+template <typename T>
+void PutLittleEndian(uint8_t *&out, T value) {
+  value = utils::HostToLittleEndian(value);
+  memcpy(out, &value, sizeof(value));
+  out += sizeof(value);
+}
+
+template <typename T>
+T GetLittleEndian(const uint8_t *&in) {
+  T value;
+  memcpy(&value, in, sizeof(value));
+  in += sizeof(value);
+  return utils::LittleEndianToHost(value);
+}
+
+std::array<uint8_t, kBlockHeaderSize> EncodeBlockHeader(const BlockHeader &header) {
+  std::array<uint8_t, kBlockHeaderSize> buffer;
+  auto *out = buffer.data();
+  PutLittleEndian(out, header.position);
+  PutLittleEndian(out, header.size);
+  PutLittleEndian(out, header.stored_size);
+  PutLittleEndian(out, header.checksum);
+  return buffer;
+}
+
+std::optional<BlockHeader> ReadBlockHeader(utils::InputFile &file, uint64_t file_offset) {
+  std::array<uint8_t, kBlockHeaderSize> buffer;
+  if (!file.SetPosition(utils::InputFile::Position::SET, file_offset)) return std::nullopt;
+  if (!file.Read(buffer.data(), buffer.size())) return std::nullopt;
+  const auto *in = buffer.data();
+  BlockHeader header{};
+  header.position = GetLittleEndian<uint64_t>(in);
+  header.size = GetLittleEndian<uint32_t>(in);
+  header.stored_size = GetLittleEndian<uint32_t>(in);
+  header.checksum = GetLittleEndian<uint32_t>(in);
+  if (header.size == 0 || header.size > kBlockSize || header.stored_size > header.size) return std::nullopt;
+  return header;
+}
+
+/// Reads the block at `file_offset` and decompresses its data into `data`.
+/// Returns `std::nullopt` if the block is incomplete or corrupted.
+std::optional<BlockHeader> ReadBlock(utils::InputFile &file, uint64_t file_offset, std::vector<uint8_t> &stored,
+                                     std::vector<uint8_t> &data) {
+  auto header = ReadBlockHeader(file, file_offset);
+  if (!header) return std::nullopt;
+  stored.resize(header->stored_size);
+  if (!file.Read(stored.data(), stored.size())) return std::nullopt;
+  if (utils::Crc32(stored) != header->checksum) return std::nullopt;
+  if (header->stored_size == header->size) {
+    data.assign(stored.begin(), stored.end());
+  } else {
+    data.resize(header->size);
+    if (!utils::ZlibDecompress(stored, data)) return std::nullopt;
+  }
+  return header;
+}
+}  // namespace
+
+void Encoder::Initialize(const std::filesystem::path &path, const std::string_view magic, uint64_t version,
+                         FileCompression compression) {
+  file_.Open(path, utils::OutputFile::Mode::OVERWRITE_EXISTING);
+  Write(reinterpret_cast<const uint8_t *>(magic.data()), magic.size());
+  auto version_encoded = utils::HostToLittleEndian(version);
+  Write(reinterpret_cast<const uint8_t *>(&version_encoded), sizeof(version_encoded));
+  if (version < kCompressionVersion) {
+    MG_ASSERT(compression == FileCompression::NONE, "Version {} doesn't support compression!", version);
+    return;
+  }
+  auto compression_encoded = static_cast<uint8_t>(compression);
+  Write(&compression_encoded, sizeof(compression_encoded));
+  if (compression != FileCompression::NONE) {
+    compressed_ = true;
+    file_size_ = magic.size() + sizeof(version_encoded) + sizeof(compression_encoded);
+    block_start_ = file_size_;
+    block_.reserve(kBlockSize);
+  }
+}
+
+void Encoder::OpenExisting(const std::filesystem::path &path, const std::string_view magic) {
+  Decoder existing;
+  MG_ASSERT(existing.Initialize(path, std::string{magic}), "Couldn't read the header of {}!", path);
+  file_.Open(path, utils::OutputFile::Mode::APPEND_TO_EXISTING);
+  if (existing.compressed_) {
+    compressed_ = true;
+    file_size_ = file_.GetSize();
+    written_blocks_ = std::move(existing.blocks_);
+    block_start_ = existing.size_;
+    block_.reserve(kBlockSize);
+  }
+}
+
+void Encoder::Close() {
+  if (file_.IsOpen()) {
+    if (compressed_) WriteBlock();
+    file_.Close();
+  }
+}
+
+void Encoder::Write(const uint8_t *data, uint64_t size) {
+  if (!compressed_) {
+    file_.Write(data, size);
+    return;
+  }
+  if (patch_position_) {
+    const auto patch_size = std::min(size, block_start_ - *patch_position_);
+    if (patch_size > 0) patches_.emplace_back(*patch_position_, std::vector<uint8_t>(data, data + patch_size));
+    *patch_position_ += patch_size;
+    data += patch_size;
+    size -= patch_size;
+    if (*patch_position_ < block_start_) return;
+    // The rest overwrites the pending data.
+    patch_position_.reset();
+    block_offset_ = 0;
+  }
+  while (size > 0) {
+    // The full block is written only now, so that it can still be changed in
+    // place after `SetPosition`.
+    if (block_offset_ == kBlockSize) WriteBlock();
+    const auto to_write = std::min(size, kBlockSize - block_offset_);
+    const auto to_overwrite = std::min(to_write, block_.size() - block_offset_);
+    // The image can only be extended, so it is compressed again if the data it
+    // holds changes.
+    if (to_overwrite > 0 && block_offset_ < image_data_size_) ResetPendingImage();
+    std::copy_n(data, to_overwrite, block_.begin() + static_cast<int64_t>(block_offset_));
+    block_.insert(block_.end(), data + to_overwrite, data + to_write);
+    block_offset_ += to_write;
+    data += to_write;
+    size -= to_write;
+  }
+}
+
+void Encoder::WriteBlock() {
+  if (block_.empty()) return;
+  written_blocks_.push_back(CompressedBlock{.position = block_start_, .file_offset = file_size_});
+  WriteBlock(block_start_, block_);
+  block_start_ += block_.size();
+  block_.clear();
+  block_offset_ = 0;
+  ResetPendingImage();
+}
+
+void Encoder::WriteBlock(uint64_t position, std::span<const uint8_t> data) {
+  compressed_block_.clear();
+  utils::ZlibCompress(data, compressed_block_);
+  const auto stored = compressed_block_.size() < data.size() ? std::span<const uint8_t>{compressed_block_} : data;
+  file_size_ += WriteBlockImage(position, data.size(), stored, utils::Crc32(stored));
+  written_image_size_ = 0;
+}
+
+uint64_t Encoder::WriteBlockImage(uint64_t position, uint64_t size, std::span<const uint8_t> stored,
+                                  uint32_t checksum) {
+  if (written_image_size_ > 0) {
+    file_.SetPosition(utils::OutputFile::Position::SET, static_cast<ssize_t>(file_size_));
+  }
+  WriteBlockHeader(position, size, stored.size(), checksum);
+  file_.Write(stored.data(), stored.size());
+  const uint64_t image_size = kBlockHeaderSize + stored.size();
+  // A shorter block would leave the end of the image behind.
+  if (image_size < written_image_size_) file_.Truncate();
+  return image_size;
+}
+
+void Encoder::WriteBlockHeader(uint64_t position, uint64_t size, uint64_t stored_size, uint32_t checksum) {
+  const auto header = EncodeBlockHeader(BlockHeader{.position = position,
+                                                    .size = static_cast<uint32_t>(size),
+                                                    .stored_size = static_cast<uint32_t>(stored_size),
+                                                    .checksum = checksum});
+  file_.Write(header.data(), header.size());
+}
+
+void Encoder::WritePendingImage() {
+  const auto old_image_size = image_.size();
+  image_stream_.Flush({block_.data() + image_data_size_, block_.size() - image_data_size_}, image_);
+  image_checksum_ = utils::Crc32({image_.data() + old_image_size, image_.size() - old_image_size}, image_checksum_);
+  image_data_size_ = block_.size();
+
+  if (image_.size() >= block_.size()) {
+    // Too little data to be compressed yet.
+    written_image_size_ = WriteBlockImage(block_start_, block_.size(), block_, utils::Crc32(block_));
+    written_image_stored_ = 0;
+  } else if (written_image_stored_ == 0) {
+    written_image_size_ = WriteBlockImage(block_start_, block_.size(), image_, image_checksum_);
+    written_image_stored_ = image_.size();
+  } else {
+    // The new compressed data is appended before the header is updated, so a
+    // crash in between leaves the previous image intact.
+    file_.SetPosition(utils::OutputFile::Position::SET,
+                      static_cast<ssize_t>(file_size_ + kBlockHeaderSize + written_image_stored_));
+    file_.Write(image_.data() + written_image_stored_, image_.size() - written_image_stored_);
+    file_.SetPosition(utils::OutputFile::Position::SET, static_cast<ssize_t>(file_size_));
+    WriteBlockHeader(block_start_, block_.size(), image_.size(), image_checksum_);
+    written_image_size_ = kBlockHeaderSize + image_.size();
+    written_image_stored_ = image_.size();
+  }
+}
+
+void Encoder::ResetPendingImage() {
+  if (image_data_size_ > 0) image_stream_.Reset();
+  image_.clear();
+  image_data_size_ = 0;
+  image_checksum_ = 0;
+  written_image_stored_ = 0;
+}
+
+void Encoder::FinalizeBlocks() {
+  WriteBlock();
+
+  if (!patches_.empty()) {
+    auto block_index = [this](uint64_t position) {
+      auto it = std::ranges::upper_bound(written_blocks_, position, {}, &CompressedBlock::position);
+      MG_ASSERT(it != written_blocks_.begin(), "Position {} of {} isn't in a block!", position, file_.path());
+      return static_cast<size_t>(std::distance(written_blocks_.begin(), it) - 1);
+    };
+    std::set<size_t> changed_blocks;
+    for (const auto &[position, bytes] : patches_) {
+      for (auto i = block_index(position); i <= block_index(position + bytes.size() - 1); ++i) {
+        changed_blocks.insert(i);
+      }
+    }
+
+    // The changed blocks are read back, so everything has to be written out.
+    file_.Sync();
+    utils::InputFile file;
+    MG_ASSERT(file.Open(file_.path()), "Couldn't open {} for reading!", file_.path());
+    std::vector<uint8_t> data;
+    for (auto i : changed_blocks) {
+      auto &block = written_blocks_[i];
+      MG_ASSERT(ReadBlock(file, block.file_offset, compressed_block_, data), "Couldn't read back a block of {}!",
+                file_.path());
+      const auto block_end = block.position + data.size();
+      for (const auto &[position, bytes] : patches_) {
+        const auto from = std::max(position, block.position);
+        const auto to = std::min(position + bytes.size(), block_end);
+        if (from >= to) continue;
+        std::copy(bytes.begin() + static_cast<int64_t>(from - position),
+                  bytes.begin() + static_cast<int64_t>(to - position),
+                  data.begin() + static_cast<int64_t>(from - block.position));
+      }
+      block.file_offset = file_size_;
+      WriteBlock(block.position, data);
+    }
+    file.Close();
+    patches_.clear();
+    patch_position_.reset();
+  }
+
+  std::vector<uint8_t> index(written_blocks_.size() * kBlockIndexEntrySize + kBlockIndexTrailerSize);
+  auto *out = index.data();
+  for (const auto &block : written_blocks_) {
+    PutLittleEndian(out, block.position);
+    PutLittleEndian(out, block.file_offset);
+  }
+  PutLittleEndian(out, block_start_);
+  PutLittleEndian(out, static_cast<uint64_t>(written_blocks_.size()));
+  PutLittleEndian(out, file_size_);
+  PutLittleEndian(out, utils::Crc32({index.data(), static_cast<size_t>(out - index.data())}));
+  memcpy(out, kBlockIndexMagic.data(), kBlockIndexMagic.size());
+  file_.Write(index.data(), index.size());
+  file_size_ += index.size();
+}
+
+void Encoder::WriteMarker(Marker marker) { EncodeMarker(this, marker); }
+
+void Encoder::WriteBool(bool value) { EncodeBool(this, value); }
+
+void Encoder::WriteUint(uint64_t value) { EncodeUint(this, value); }
+
+void Encoder::WriteDouble(double value) { EncodeDouble(this, value); }
+
+void Encoder::WriteString(const std::string_view value) { EncodeString(this, value); }
+
+void Encoder::WritePropertyValue(const PropertyValue &value) { EncodePropertyValue(this, value); }
+
+uint64_t Encoder::GetPosition() {
+  if (!compressed_) return file_.GetPosition();
+  return patch_position_ ? *patch_position_ : block_start_ + block_offset_;
+}
+
+void Encoder::SetPosition(uint64_t position) {
+  if (!compressed_) {
+    file_.SetPosition(utils::OutputFile::Position::SET, position);
+    return;
+  }
+  if (position < block_start_) {
+    patch_position_ = position;
+    return;
+  }
+  MG_ASSERT(position <= block_start_ + block_.size(), "Position {} is past the end of {}!", position, file_.path());
+  patch_position_.reset();
+  block_offset_ = position - block_start_;
+}
+
+void Encoder::Sync() {
+  if (compressed_ && block_.size() != image_data_size_) WritePendingImage();
+  file_.Sync();
+}
+
+int Encoder::FlushAndDuplicateDescriptor() {
+  if (compressed_ && block_.size() != image_data_size_) WritePendingImage();
+  return file_.FlushAndDuplicateDescriptor();
+}
 
 void Encoder::Finalize() {
+  if (compressed_) FinalizeBlocks();
   file_.Sync();
   file_.Close();
 }
 
-void Encoder::DisableFlushing() { file_.DisableFlushing(); }
+void Encoder::DisableFlushing() {
+  // The file is read while flushing is disabled, so the pending data has to
+  // be in it.
+  if (compressed_) WriteBlock();
+  file_.DisableFlushing();
+}
 
 void Encoder::EnableFlushing() { file_.EnableFlushing(); }
 
-void Encoder::TryFlushing() { file_.TryFlushing(); }
+void Encoder::TryFlushing() {
+  // While the flushing is disabled the file is being read and must only grow,
+  // so the image isn't rewritten then.
+  if (!file_.TryFlushing() || !compressed_ || block_.size() == image_data_size_) return;
+  // The WAL is flushed after each commit. So that a crash doesn't lose the
+  // commits in the pending block, its current image is written at the end of
+  // the file like a whole block, and each flush updates it until the block is
+  // full. Writing a new block on each flush instead would leave the commits
+  // barely compressed.
+  WritePendingImage();
+  file_.TryFlushing();
+}
 
 std::pair<const uint8_t *, size_t> Encoder::CurrentFileBuffer() const { return file_.CurrentBuffer(); }
 
-size_t Encoder::GetSize() { return file_.GetSize(); }
+size_t Encoder::GetSize() {
+  if (!compressed_) return file_.GetSize();
+  return file_size_ + block_.size();
+}
+
+/////////////////////////////////////
+// ConcurrentAppender implementation.
+/////////////////////////////////////
+
+ConcurrentAppender::ConcurrentAppender(Encoder &encoder) : encoder_(&encoder) {
+  MG_ASSERT(!encoder.patch_position_, "Can't append to {} while changing its data!", encoder.file_.path());
+  // The buffered data is written out by setting the position, so that it
+  // isn't written over the appended data later.
+  if (encoder.compressed_) {
+    // The appended blocks follow the pending data.
+    encoder.WriteBlock();
+    position_ = encoder.block_start_;
+    file_size_ = encoder.file_size_;
+    encoder.file_.SetPosition(utils::OutputFile::Position::SET, static_cast<ssize_t>(encoder.file_size_));
+  } else {
+    position_ = encoder.file_.GetPosition();
+  }
+}
+
+ConcurrentAppender::~ConcurrentAppender() {
+  auto &encoder = *encoder_;
+  if (!encoder.compressed_) {
+    encoder.file_.SetPosition(utils::OutputFile::Position::SET, static_cast<ssize_t>(position_.load()));
+    return;
+  }
+  std::ranges::sort(blocks_, {}, &CompressedBlock::position);
+  encoder.written_blocks_.insert(encoder.written_blocks_.end(), blocks_.begin(), blocks_.end());
+  encoder.block_start_ = position_;
+  encoder.file_size_ = file_size_;
+  encoder.file_.SetPosition(utils::OutputFile::Position::SET, static_cast<ssize_t>(encoder.file_size_));
+}
+
+uint64_t ConcurrentAppender::Append(std::span<const uint8_t> data) {
+  const auto position = position_.fetch_add(data.size());
+  if (!encoder_->compressed_) {
+    encoder_->file_.WriteAt(data.data(), data.size(), position);
+    return position;
+  }
+
+  // The blocks are compressed one after another into a single buffer, which
+  // is written at the space reserved for it at the end of the file.
+  std::vector<uint8_t> stored_blocks;
+  std::vector<CompressedBlock> blocks;
+  std::vector<uint8_t> compressed;
+  for (uint64_t offset = 0; offset < data.size(); offset += kBlockSize) {
+    const auto block = data.subspan(offset, std::min(kBlockSize, data.size() - offset));
+    compressed.clear();
+    utils::ZlibCompress(block, compressed);
+    const auto stored = compressed.size() < block.size() ? std::span<const uint8_t>{compressed} : block;
+    blocks.push_back(CompressedBlock{.position = position + offset, .file_offset = stored_blocks.size()});
+    const auto header = EncodeBlockHeader(BlockHeader{.position = position + offset,
+                                                      .size = static_cast<uint32_t>(block.size()),
+                                                      .stored_size = static_cast<uint32_t>(stored.size()),
+                                                      .checksum = utils::Crc32(stored)});
+    stored_blocks.insert(stored_blocks.end(), header.begin(), header.end());
+    stored_blocks.insert(stored_blocks.end(), stored.begin(), stored.end());
+  }
+  const auto file_offset = file_size_.fetch_add(stored_blocks.size());
+  encoder_->file_.WriteAt(stored_blocks.data(), stored_blocks.size(), file_offset);
+
+  for (auto &block : blocks) block.file_offset += file_offset;
+  std::lock_guard guard(blocks_lock_);
+  blocks_.insert(blocks_.end(), blocks.begin(), blocks.end());
+  return position;
+}
+
+////////////////////////////////
+// BufferEncoder implementation.
+////////////////////////////////
+
+void BufferEncoder::Write(const uint8_t *data, uint64_t size) { buffer_.insert(buffer_.end(), data, data + size); }
+
+void BufferEncoder::WriteMarker(Marker marker) { EncodeMarker(this, marker); }
+
+void BufferEncoder::WriteBool(bool value) { EncodeBool(this, value); }
+
+void BufferEncoder::WriteUint(uint64_t value) { EncodeUint(this, value); }
+
+void BufferEncoder::WriteDouble(double value) { EncodeDouble(this, value); }
+
+void BufferEncoder::WriteString(const std::string_view value) { EncodeString(this, value); }
+
+void BufferEncoder::WritePropertyValue(const PropertyValue &value) { EncodePropertyValue(this, value); }
 
 //////////////////////////
 // Decoder implementation.
@@ -181,12 +605,120 @@ std::optional<uint64_t> Decoder::Initialize(const std::filesystem::path &path, c
   if (file_magic != magic) return std::nullopt;
   uint64_t version_encoded;
   if (!Read(reinterpret_cast<uint8_t *>(&version_encoded), sizeof(version_encoded))) return std::nullopt;
-  return utils::LittleEndianToHost(version_encoded);
+  const auto version = utils::LittleEndianToHost(version_encoded);
+  if (version < kCompressionVersion) return version;
+
+  uint8_t compression;
+  if (!Read(&compression, sizeof(compression))) return std::nullopt;
+  switch (static_cast<FileCompression>(compression)) {
+    case FileCompression::NONE:
+      return version;
+    case FileCompression::ZLIB:
+      break;
+    default:
+      return std::nullopt;
+  }
+  compressed_ = true;
+  data_position_ = file_.GetPosition();
+  position_ = data_position_;
+  if (!LoadBlockIndex()) return std::nullopt;
+  return version;
+}
+
+bool Decoder::LoadBlockIndex() {
+  const auto file_size = file_.GetSize();
+  if (ReadBlockIndex(file_size)) return true;
+
+  // Otherwise the blocks are scanned up to the first incomplete one, the same
+  // as the data of an uncompressed file is read up to the first invalid part.
+  blocks_.clear();
+  size_ = data_position_;
+  uint64_t file_offset = data_position_;
+  while (file_offset + kBlockHeaderSize <= file_size) {
+    const auto header = ReadBlockHeader(file_, file_offset);
+    if (!header || header->position != size_) break;
+    if (file_offset + kBlockHeaderSize + header->stored_size > file_size) break;
+    blocks_.push_back(CompressedBlock{.position = header->position, .file_offset = file_offset});
+    size_ += header->size;
+    file_offset += kBlockHeaderSize + header->stored_size;
+  }
+  return true;
 }
 
-bool Decoder::Read(uint8_t *data, size_t size) { return file_.Read(data, size); }
+bool Decoder::ReadBlockIndex(uint64_t file_size) {
+  if (file_size < data_position_ + kBlockIndexTrailerSize) return false;
+  std::array<uint8_t, kBlockIndexTrailerSize> trailer;
+  if (!file_.SetPosition(utils::InputFile::Position::SET, file_size - trailer.size())) return false;
+  if (!file_.Read(trailer.data(), trailer.size())) return false;
+  const auto *in = trailer.data();
+  const auto size = GetLittleEndian<uint64_t>(in);
+  const auto num_blocks = GetLittleEndian<uint64_t>(in);
+  const auto index_offset = GetLittleEndian<uint64_t>(in);
+  const auto checksum = GetLittleEndian<uint32_t>(in);
+  if (std::string_view{reinterpret_cast<const char *>(in), kBlockIndexMagic.size()} != kBlockIndexMagic) return false;
 
-bool Decoder::Peek(uint8_t *data, size_t size) { return file_.Peek(data, size); }
+  // Data of an unfinalized file can end with the magic, so everything else
+  // has to be checked before the index is trusted.
+  if (index_offset < data_position_ || index_offset > file_size - trailer.size()) return false;
+  const auto index_size = file_size - trailer.size() - index_offset;
+  if (index_size % kBlockIndexEntrySize != 0 || index_size / kBlockIndexEntrySize != num_blocks) return false;
+  std::vector<uint8_t> index(index_size);
+  if (!file_.SetPosition(utils::InputFile::Position::SET, index_offset)) return false;
+  if (!file_.Read(index.data(), index.size())) return false;
+  if (utils::Crc32({trailer.data(), 3 * sizeof(uint64_t)}, utils::Crc32(index)) != checksum) return false;
+
+  in = index.data();
+  blocks_.resize(num_blocks);
+  for (auto &block : blocks_) {
+    block.position = GetLittleEndian<uint64_t>(in);
+    block.file_offset = GetLittleEndian<uint64_t>(in);
+    if (block.file_offset < data_position_ || block.file_offset >= index_offset) return false;
+  }
+  size_ = size;
+  const auto ordered = std::ranges::adjacent_find(blocks_, std::greater_equal{}, &CompressedBlock::position);
+  if (ordered != blocks_.end()) return false;
+  return blocks_.empty() ? size_ == data_position_
+                         : blocks_.front().position == data_position_ && blocks_.back().position < size_;
+}
+
+bool Decoder::LoadBlock() {
+  if (current_block_) {
+    const auto &block = blocks_[*current_block_];
+    if (position_ >= block.position && position_ < block.position + block_.size()) return true;
+  }
+  auto it = std::ranges::upper_bound(blocks_, position_, {}, &CompressedBlock::position);
+  if (it == blocks_.begin()) return false;
+  --it;
+  const auto block_end = std::next(it) == blocks_.end() ? size_ : std::next(it)->position;
+  if (position_ >= block_end) return false;
+  current_block_.reset();
+  const auto header = ReadBlock(file_, it->file_offset, compressed_block_, block_);
+  if (!header || header->position != it->position || it->position + header->size != block_end) return false;
+  current_block_ = static_cast<size_t>(std::distance(blocks_.begin(), it));
+  return true;
+}
+
+bool Decoder::Read(uint8_t *data, size_t size) {
+  if (!compressed_) return file_.Read(data, size);
+  while (size > 0) {
+    if (!LoadBlock()) return false;
+    const auto offset = position_ - blocks_[*current_block_].position;
+    const auto to_read = std::min<uint64_t>(size, block_.size() - offset);
+    memcpy(data, block_.data() + offset, to_read);
+    position_ += to_read;
+    data += to_read;
+    size -= to_read;
+  }
+  return true;
+}
+
+bool Decoder::Peek(uint8_t *data, size_t size) {
+  if (!compressed_) return file_.Peek(data, size);
+  const auto position = position_;
+  const auto success = Read(data, size);
+  position_ = position;
+  return success;
+}
 
 std::optional<Marker> Decoder::PeekMarker() {
   uint8_t value;
@@ -351,6 +883,10 @@ std::optional<PropertyValue> Decoder::ReadPropertyValue() {
     case Marker::DELTA_LABEL_PROPERTY_INDEX_STATS_CLEAR:
     case Marker::DELTA_LABEL_PROPERTY_INDEX_CREATE:
     case Marker::DELTA_LABEL_PROPERTY_INDEX_DROP:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+    case Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_CREATE:
+    case Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_DROP:
     case Marker::DELTA_EDGE_TYPE_INDEX_CREATE:
     case Marker::DELTA_EDGE_TYPE_INDEX_DROP:
     case Marker::DELTA_TEXT_INDEX_CREATE:
@@ -459,6 +995,10 @@ bool Decoder::SkipPropertyValue() {
     case Marker::DELTA_LABEL_PROPERTY_INDEX_STATS_CLEAR:
     case Marker::DELTA_LABEL_PROPERTY_INDEX_CREATE:
     case Marker::DELTA_LABEL_PROPERTY_INDEX_DROP:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+    case Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_CREATE:
+    case Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_DROP:
     case Marker::DELTA_EDGE_TYPE_INDEX_CREATE:
     case Marker::DELTA_EDGE_TYPE_INDEX_DROP:
     case Marker::DELTA_TEXT_INDEX_CREATE:
@@ -473,10 +1013,21 @@ bool Decoder::SkipPropertyValue() {
   }
 }
 
-std::optional<uint64_t> Decoder::GetSize() { return file_.GetSize(); }
+std::optional<uint64_t> Decoder::GetSize() {
+  if (compressed_) return size_;
+  return file_.GetSize();
+}
 
-std::optional<uint64_t> Decoder::GetPosition() { return file_.GetPosition(); }
+std::optional<uint64_t> Decoder::GetPosition() {
+  if (compressed_) return position_;
+  return file_.GetPosition();
+}
 
-bool Decoder::SetPosition(uint64_t position) { return !!file_.SetPosition(utils::InputFile::Position::SET, position); }
+bool Decoder::SetPosition(uint64_t position) {
+  if (!compressed_) return !!file_.SetPosition(utils::InputFile::Position::SET, position);
+  if (position < data_position_ || position > size_) return false;
+  position_ = position;
+  return true;
+}
 
 }  // namespace memgraph::storage::durability
@@ -11,18 +11,42 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <filesystem>
+#include <mutex>
+#include <optional>
+#include <span>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include "storage/v2/config.hpp"
 #include "storage/v2/durability/marker.hpp"
+#include "storage/v2/durability/version.hpp"
 #include "storage/v2/name_id_mapper.hpp"
 #include "storage/v2/property_value.hpp"
+#include "utils/compression.hpp"
 #include "utils/file.hpp"
 
 namespace memgraph::storage::durability {
 
+/// Compression of the data following the header of a snapshot/WAL file, which
+/// is stored in the header since `kCompressionVersion`.
+///
+/// Compressed data is split into blocks which are compressed independently
+/// and carry a checksum, so that a file can be read from any position and by
+/// multiple decoders at once. The positions used by `Encoder` and `Decoder`
+/// are always positions in the uncompressed file.
+enum class FileCompression : uint8_t { NONE = 0, ZLIB = 1 };
+
+/// Block of a compressed file, located by its position in the uncompressed
+/// file and by the offset of its header in the compressed file.
+struct CompressedBlock {
+  uint64_t position;
+  uint64_t file_offset;
+};
+
 /// Encoder interface class. Used to implement streams to different targets
 /// (e.g. file and network).
 class BaseEncoder {
@@ -41,9 +65,12 @@ class BaseEncoder {
 /// Encoder that is used to generate a snapshot/WAL.
 class Encoder final : public BaseEncoder {
  public:
-  void Initialize(const std::filesystem::path &path, std::string_view magic, uint64_t version);
+  // `compression` has to be `NONE` for versions older than `kCompressionVersion`.
+  void Initialize(const std::filesystem::path &path, std::string_view magic, uint64_t version,
+                  FileCompression compression = FileCompression::NONE);
 
-  void OpenExisting(const std::filesystem::path &path);
+  // Opens an unfinalized file to append to it.
+  void OpenExisting(const std::filesystem::path &path, std::string_view magic);
 
   void Close();
   // Main write function, the only one that is allowed to write to the `file_`
@@ -60,24 +87,124 @@ class Encoder final : public BaseEncoder {
   uint64_t GetPosition();
   void SetPosition(uint64_t position);
 
+  // Pending compressed data is synced as an image of its block, the same as
+  // in `TryFlushing`.
   void Sync();
 
+  // Write the internal buffer and get a duplicate of the file descriptor
+  // which can be synced from another thread. Pending compressed data is
+  // written out as an image of its block, the same as in `TryFlushing`.
+  int FlushAndDuplicateDescriptor();
+
   void Finalize();
 
   // Disable flushing of the internal buffer.
   void DisableFlushing();
   // Enable flushing of the internal buffer.
   void EnableFlushing();
-  // Try flushing the internal buffer.
+  // Try flushing the internal buffer. Pending compressed data is written out
+  // as an image of its block, which is overwritten until the block is full.
   void TryFlushing();
   // Get the current internal buffer with its size.
   std::pair<const uint8_t *, size_t> CurrentFileBuffer() const;
 
-  // Get the total size of the current file.
+  // Get the total size of the current file. Data which isn't compressed yet
+  // is counted with its uncompressed size.
   size_t GetSize();
 
  private:
+  friend class ConcurrentAppender;
+
+  // Compresses the pending data into a new block. Compressed data is written
+  // out only in whole blocks or as the image of the pending block, so this
+  // has to be done before the file is read.
+  void WriteBlock();
+  void WriteBlock(uint64_t position, std::span<const uint8_t> data);
+  // Writes a block over the image of the pending block, if there is one, and
+  // returns its size in the file.
+  uint64_t WriteBlockImage(uint64_t position, uint64_t size, std::span<const uint8_t> stored, uint32_t checksum);
+  void WriteBlockHeader(uint64_t position, uint64_t size, uint64_t stored_size, uint32_t checksum);
+  // Writes out the image of the pending block, see `TryFlushing`.
+  void WritePendingImage();
+  void ResetPendingImage();
+  // Writes the blocks changed after they were written again and appends the
+  // block index.
+  void FinalizeBlocks();
+
   utils::OutputFile file_;
+
+  // State of compressed files, where `file_` only holds whole blocks.
+  bool compressed_{false};
+  uint64_t file_size_{0};
+  std::vector<CompressedBlock> written_blocks_;
+  // Pending data which starts at `block_start_`, written at `block_offset_`.
+  std::vector<uint8_t> block_;
+  uint64_t block_start_{0};
+  uint64_t block_offset_{0};
+  // Image of the pending block which is kept at `file_size_` by
+  // `TryFlushing`. `image_` holds the compressed data of the first
+  // `image_data_size_` bytes of `block_`, of which `written_image_stored_`
+  // bytes are in the file. The image in the file is stored uncompressed if
+  // `written_image_stored_` is 0.
+  utils::ZlibStream image_stream_;
+  std::vector<uint8_t> image_;
+  uint64_t image_data_size_{0};
+  uint32_t image_checksum_{0};
+  uint64_t written_image_size_{0};
+  uint64_t written_image_stored_{0};
+  // Changes of data which was already written, applied on `Finalize`.
+  std::vector<std::pair<uint64_t, std::vector<uint8_t>>> patches_;
+  std::optional<uint64_t> patch_position_;
+  std::vector<uint8_t> compressed_block_;
+};
+
+/// Appends data to the file of an `Encoder` from multiple threads at once,
+/// each at the end of the file as it is when the data is appended. The data of
+/// a compressed file is compressed by the appending thread in blocks of its
+/// own. The encoder mustn't be used while the appender exists.
+class ConcurrentAppender {
+ public:
+  explicit ConcurrentAppender(Encoder &encoder);
+  ~ConcurrentAppender();
+
+  ConcurrentAppender(const ConcurrentAppender &) = delete;
+  ConcurrentAppender &operator=(const ConcurrentAppender &) = delete;
+  ConcurrentAppender(ConcurrentAppender &&) = delete;
+  ConcurrentAppender &operator=(ConcurrentAppender &&) = delete;
+
+  // Appends `data` and returns its position in the uncompressed file. Can be
+  // called concurrently.
+  uint64_t Append(std::span<const uint8_t> data);
+
+ private:
+  Encoder *encoder_;
+  // End of the uncompressed file and, for compressed files, of the file itself.
+  std::atomic<uint64_t> position_{0};
+  std::atomic<uint64_t> file_size_{0};
+  std::mutex blocks_lock_;
+  std::vector<CompressedBlock> blocks_;
+};
+
+/// Encoder that keeps the snapshot/WAL encoding in memory, so that it can be
+/// prepared without holding any locks and written with `Encoder::Write` later.
+class BufferEncoder final : public BaseEncoder {
+ public:
+  void Write(const uint8_t *data, uint64_t size);
+
+  void WriteMarker(Marker marker) override;
+  void WriteBool(bool value) override;
+  void WriteUint(uint64_t value) override;
+  void WriteDouble(double value) override;
+  void WriteString(std::string_view value) override;
+  void WritePropertyValue(const PropertyValue &value) override;
+
+  const std::vector<uint8_t> &Buffer() const { return buffer_; }
+
+  // Drops the encoded data, keeping the memory for the next encoding.
+  void Clear() { buffer_.clear(); }
+
+ private:
+  std::vector<uint8_t> buffer_;
 };
 
 /// Decoder interface class. Used to implement streams from different sources
@@ -125,7 +252,27 @@ class Decoder final : public BaseDecoder {
   bool SetPosition(uint64_t position);
 
  private:
+  friend class Encoder;
+
+  bool LoadBlockIndex();
+  // Reads the block index of a finalized file. Returns false if the file
+  // doesn't end with a valid index.
+  bool ReadBlockIndex(uint64_t file_size);
+  // Makes the block which contains `position_` the current one.
+  bool LoadBlock();
+
   utils::InputFile file_;
+
+  // State of compressed files. `blocks_` are ordered by their position and
+  // `block_` holds the decompressed data of `blocks_[current_block_]`.
+  bool compressed_{false};
+  uint64_t position_{0};
+  uint64_t size_{0};
+  uint64_t data_position_{0};
+  std::vector<CompressedBlock> blocks_;
+  std::optional<size_t> current_block_;
+  std::vector<uint8_t> block_;
+  std::vector<uint8_t> compressed_block_;
 };
 
 }  // namespace memgraph::storage::durability
@@ -11,7 +11,9 @@
 
 #include "storage/v2/durability/snapshot.hpp"
 
+#include <exception>
 #include <thread>
+#include <type_traits>
 
 #include "flags/experimental.hpp"
 #include "flags/run_time_configurable.hpp"
@@ -39,6 +41,7 @@
 #include "utils/file_locker.hpp"
 #include "utils/logging.hpp"
 #include "utils/message.hpp"
+#include "utils/on_scope_exit.hpp"
 #include "utils/spin_lock.hpp"
 #include "utils/synchronized.hpp"
 
@@ -85,6 +88,15 @@ namespace memgraph::storage::durability {
 //     * label+property indices
 //         * label
 //         * property
+//     * label+properties indices (from version 19)
+//         * label
+//         * properties count
+//         * properties in the order of the index
+//     * edge-type indices
+//         * edge type
+//     * edge-type+property indices (from version 20)
+//         * edge type
+//         * property
 //
 // 7) Constraints
 //     * existence constraints
@@ -115,6 +127,9 @@ namespace memgraph::storage::durability {
 //     * vertex batch infos
 //        * starting offset of the batch
 //        * number of vertices in the batch
+//    Batch infos are ordered by the gids of their objects, but snapshots
+//    written by multiple threads can have the batches in any order in the
+//    file.
 //
 // IMPORTANT: When changing snapshot encoding/decoding bump the snapshot/WAL
 // version in `version.hpp`.
@@ -546,7 +561,7 @@ LoadPartialConnectivityResult LoadPartialConnectivity(const std::filesystem::pat
             edge_ref = EdgeRef(&*edge);
           }
         }
-        vertex.in_edges.emplace_back(get_edge_type_from_id(*edge_type), &*from_vertex, edge_ref);
+        vertex.in_edges.emplace(get_edge_type_from_id(*edge_type), &*from_vertex, edge_ref);
       }
     }
 
@@ -581,7 +596,7 @@ LoadPartialConnectivityResult LoadPartialConnectivity(const std::filesystem::pat
             edge_ref = EdgeRef(&*edge);
           }
         }
-        vertex.out_edges.emplace_back(get_edge_type_from_id(*edge_type), &*to_vertex, edge_ref);
+        vertex.out_edges.emplace(get_edge_type_from_id(*edge_type), &*to_vertex, edge_ref);
         // Increment edge count. We only increment the count here because the
         // information is duplicated in in_edges.
         edge_count++;
@@ -907,7 +922,7 @@ RecoveredSnapshot LoadSnapshotVersion14(const std::filesystem::path &path, utils
           }
           SPDLOG_TRACE("Recovered inbound edge {} with label \"{}\" from vertex {}.", *edge_gid,
                        name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)), from_vertex->gid.AsUint());
-          vertex.in_edges.emplace_back(get_edge_type_from_id(*edge_type), &*from_vertex, edge_ref);
+          vertex.in_edges.emplace(get_edge_type_from_id(*edge_type), &*from_vertex, edge_ref);
         }
       }
 
@@ -943,7 +958,7 @@ RecoveredSnapshot LoadSnapshotVersion14(const std::filesystem::path &path, utils
           }
           SPDLOG_TRACE("Recovered outbound edge {} with label \"{}\" to vertex {}.", *edge_gid,
                        name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)), to_vertex->gid.AsUint());
-          vertex.out_edges.emplace_back(get_edge_type_from_id(*edge_type), &*to_vertex, edge_ref);
+          vertex.out_edges.emplace(get_edge_type_from_id(*edge_type), &*to_vertex, edge_ref);
         }
         // Increment edge count. We only increment the count here because the
         // information is duplicated in in_edges.
@@ -1971,11 +1986,33 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
           throw RecoveryFailure("Couldn't read average group size for label property index statistics!");
         const auto avg_degree = snapshot.ReadDouble();
         if (!avg_degree) throw RecoveryFailure("Couldn't read average degree for label property index statistics!");
+        LabelPropertyIndexStats stats{*count, *distinct_values_count, *statistic, *avg_group_size, *avg_degree};
+        if (*version >= kIndexStatsDistributionVersion) {
+          const auto histogram_count = snapshot.ReadUint();
+          const auto histogram_size = snapshot.ReadUint();
+          if (!histogram_count || !histogram_size)
+            throw RecoveryFailure("Couldn't read histogram for label property index statistics!");
+          stats.histogram_count = *histogram_count;
+          for (uint64_t j = 0; j < *histogram_size; ++j) {
+            const auto bound = snapshot.ReadDouble();
+            if (!bound) throw RecoveryFailure("Couldn't read histogram for label property index statistics!");
+            stats.histogram_bounds.push_back(*bound);
+          }
+          const auto most_common_values_size = snapshot.ReadUint();
+          if (!most_common_values_size)
+            throw RecoveryFailure("Couldn't read most common values for label property index statistics!");
+          for (uint64_t j = 0; j < *most_common_values_size; ++j) {
+            const auto hash = snapshot.ReadUint();
+            const auto value_count = snapshot.ReadUint();
+            if (!hash || !value_count)
+              throw RecoveryFailure("Couldn't read most common values for label property index statistics!");
+            stats.most_common_values.emplace_back(*hash, *value_count);
+          }
+        }
         const auto label_id = get_label_from_id(*label);
         const auto property_id = get_property_from_id(*property);
-        indices_constraints.indices.label_property_stats.emplace_back(
-            label_id, std::make_pair(property_id, LabelPropertyIndexStats{*count, *distinct_values_count, *statistic,
-                                                                          *avg_group_size, *avg_degree}));
+        indices_constraints.indices.label_property_stats.emplace_back(label_id,
+                                                                      std::make_pair(property_id, std::move(stats)));
         SPDLOG_TRACE("Recovered metadata of label+property index statistics for :{}({})",
                      name_id_mapper->IdToName(snapshot_id_map.at(*label)),
                      name_id_mapper->IdToName(snapshot_id_map.at(*property)));
@@ -1983,6 +2020,32 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
       spdlog::info("Metadata of label+property indices are recovered.");
     }
 
+    // Recover label+properties indices.
+    if (*version >= kCompositeIndexVersion) {
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Couldn't recover the number of label properties indices!");
+      spdlog::info("Recovering metadata of {} label+properties indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto label = snapshot.ReadUint();
+        if (!label) throw RecoveryFailure("Couldn't read label for label properties index!");
+        auto properties_count = snapshot.ReadUint();
+        if (!properties_count) throw RecoveryFailure("Couldn't read properties count for label properties index!");
+        std::vector<PropertyId> properties;
+        properties.reserve(*properties_count);
+        for (uint64_t j = 0; j < *properties_count; ++j) {
+          auto property = snapshot.ReadUint();
+          if (!property) throw RecoveryFailure("Couldn't read property for label properties index!");
+          properties.push_back(get_property_from_id(*property));
+        }
+        AddRecoveredIndexConstraint(&indices_constraints.indices.label_properties,
+                                    {get_label_from_id(*label), std::move(properties)},
+                                    "The label+properties index already exists!");
+        SPDLOG_TRACE("Recovered metadata of label+properties index for :{}",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*label)));
+      }
+      spdlog::info("Metadata of label+properties indices are recovered.");
+    }
+
     // Recover edge-type indices.
     spdlog::info("Recovering metadata of indices.");
     if (!snapshot.SetPosition(info.offset_edge_indices)) throw RecoveryFailure("Couldn't read data from snapshot!");
@@ -2006,6 +2069,26 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
       spdlog::info("Metadata of edge-type indices are recovered.");
     }
 
+    // Recover edge-type + property indices.
+    if (*version >= kEdgeTypePropertyIndexVersion) {
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Couldn't read the number of edge-type + property indices");
+      spdlog::info("Recovering metadata of {} edge-type + property indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto edge_type = snapshot.ReadUint();
+        if (!edge_type) throw RecoveryFailure("Couldn't read edge-type of edge-type + property index!");
+        auto property = snapshot.ReadUint();
+        if (!property) throw RecoveryFailure("Couldn't read property of edge-type + property index!");
+        AddRecoveredIndexConstraint(&indices_constraints.indices.edge_type_property,
+                                    {get_edge_type_from_id(*edge_type), get_property_from_id(*property)},
+                                    "The edge-type + property index already exists!");
+        SPDLOG_TRACE("Recovered metadata of edge-type + property index for :{}({})",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)),
+                     name_id_mapper->IdToName(snapshot_id_map.at(*property)));
+      }
+      spdlog::info("Metadata of edge-type + property indices are recovered.");
+    }
+
     // Recover text indices.
     if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
       auto size = snapshot.ReadUint();
@@ -2209,6 +2292,142 @@ auto EnsureRetentionCountSnapshotsExist(const std::filesystem::path &snapshot_di
   return old_snapshot_files;
 }
 
+namespace {
+
+/// Edges or vertices written to a snapshot (or to a segment of one).
+struct EncodedObjects {
+  std::vector<BatchInfo> batch_infos;
+  uint64_t count{0};
+  std::unordered_set<uint64_t> used_ids;
+};
+
+// More segments than threads, so that threads which get segments with fewer
+// visible objects pick up more of them.
+constexpr uint64_t kSnapshotSegmentsPerThread = 4;
+
+// Objects of a segment are encoded in memory and appended to the snapshot in
+// batches of about this size.
+constexpr uint64_t kSnapshotChunkSize = 4UL * 1024 * 1024;
+
+/// Encodes the objects with gids in `[from, to)` using `encode_object`, which
+/// returns false for objects that aren't visible to the snapshot transaction.
+template <typename TObj, typename TFunc>
+void EncodeObjects(utils::SkipList<TObj> *objects, std::optional<Gid> from, std::optional<Gid> to, Encoder &snapshot,
+                   uint64_t items_per_batch, EncodedObjects &result, const TFunc &encode_object) {
+  auto acc = objects->access();
+  auto it = from ? acc.find_equal_or_greater(*from) : acc.begin();
+  auto items_in_current_batch{0UL};
+  auto batch_start_offset = snapshot.GetPosition();
+  for (; it != acc.end(); ++it) {
+    if (to && !(*it < *to)) break;
+    if (!encode_object(*it, snapshot, result.used_ids)) continue;
+
+    ++result.count;
+    ++items_in_current_batch;
+    if (items_in_current_batch == items_per_batch) {
+      result.batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
+      batch_start_offset = snapshot.GetPosition();
+      items_in_current_batch = 0;
+    }
+  }
+  if (items_in_current_batch > 0) {
+    result.batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
+  }
+}
+
+/// Same as `EncodeObjects`, except that each batch is encoded in memory and
+/// appended to the snapshot with `appender`. Batches are also ended once they
+/// reach `kSnapshotChunkSize`.
+template <typename TObj, typename TFunc>
+void AppendObjects(utils::SkipList<TObj> *objects, std::optional<Gid> from, std::optional<Gid> to,
+                   ConcurrentAppender &appender, uint64_t items_per_batch, EncodedObjects &result,
+                   const TFunc &encode_object) {
+  auto acc = objects->access();
+  auto it = from ? acc.find_equal_or_greater(*from) : acc.begin();
+  BufferEncoder batch;
+  auto items_in_current_batch{0UL};
+  auto append_batch = [&] {
+    result.batch_infos.push_back(BatchInfo{appender.Append(batch.Buffer()), items_in_current_batch});
+    batch.Clear();
+    items_in_current_batch = 0;
+  };
+  for (; it != acc.end(); ++it) {
+    if (to && !(*it < *to)) break;
+    if (!encode_object(*it, batch, result.used_ids)) continue;
+
+    ++result.count;
+    ++items_in_current_batch;
+    if (items_in_current_batch == items_per_batch || batch.Buffer().size() >= kSnapshotChunkSize) append_batch();
+  }
+  if (items_in_current_batch > 0) append_batch();
+}
+
+/// Encodes all visible objects of the skip list into `snapshot`.
+///
+/// With more than one thread, the skip list is split into segments of gids
+/// which are encoded in parallel. Each thread appends the batches of its
+/// segments straight to `snapshot`, compressing them itself if the snapshot
+/// is compressed, so the batches of different segments are interleaved in the
+/// file. The batch infos are still returned in gid order.
+/// The reads of the snapshot transaction must be safe to do concurrently.
+template <typename TObj, typename TFunc>
+EncodedObjects EncodeAllObjects(utils::SkipList<TObj> *objects, Encoder &snapshot, uint64_t thread_count,
+                                uint64_t items_per_batch, const TFunc &encode_object) {
+  EncodedObjects result;
+
+  // Segments are delimited by gids instead of skip list nodes because a
+  // boundary node can be removed from the skip list in the meantime.
+  std::vector<Gid> segment_begins;
+  if (thread_count > 1) {
+    auto acc = objects->access();
+    for (auto it : acc.chunk_boundaries(thread_count * kSnapshotSegmentsPerThread)) {
+      segment_begins.push_back(it->gid);
+    }
+  }
+  if (segment_begins.size() <= 1) {
+    EncodeObjects(objects, std::nullopt, std::nullopt, snapshot, items_per_batch, result, encode_object);
+    return result;
+  }
+
+  const auto num_segments = segment_begins.size();
+  std::vector<EncodedObjects> segments(num_segments);
+  utils::Synchronized<std::exception_ptr, utils::SpinLock> maybe_error{};
+  {
+    ConcurrentAppender appender{snapshot};
+    std::atomic<uint64_t> segment_counter = 0;
+    std::vector<std::jthread> threads;
+    threads.reserve(std::min(thread_count, num_segments));
+    for (uint64_t i = 0; i < std::min(thread_count, num_segments); ++i) {
+      threads.emplace_back([&]() {
+        while (!*maybe_error.Lock()) {
+          const auto segment_index = segment_counter++;
+          if (segment_index >= num_segments) return;
+          try {
+            const auto from = segment_index == 0 ? std::nullopt : std::optional{segment_begins[segment_index]};
+            const auto to = segment_index + 1 < num_segments ? std::optional{segment_begins[segment_index + 1]}
+                                                             : std::nullopt;
+            AppendObjects(objects, from, to, appender, items_per_batch, segments[segment_index], encode_object);
+          } catch (...) {
+            *maybe_error.Lock() = std::current_exception();
+          }
+        }
+      });
+    }
+  }
+  if (auto error = *maybe_error.Lock()) std::rethrow_exception(error);
+
+  for (auto &segment : segments) {
+    result.batch_infos.insert(result.batch_infos.end(), segment.batch_infos.begin(), segment.batch_infos.end());
+    result.count += segment.count;
+    result.used_ids.merge(segment.used_ids);
+  }
+  spdlog::info("Wrote {} {} from {} segments.", result.count, std::is_same_v<TObj, Vertex> ? "vertices" : "edges",
+               num_segments);
+  return result;
+}
+
+}  // namespace
+
 void CreateSnapshot(Storage *storage, Transaction *transaction, const std::filesystem::path &snapshot_directory,
                     const std::filesystem::path &wal_directory, utils::SkipList<Vertex> *vertices,
                     utils::SkipList<Edge> *edges, const std::string &uuid,
@@ -2222,7 +2441,8 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
   auto path = snapshot_directory / MakeSnapshotName(transaction->start_timestamp);
   spdlog::info("Starting snapshot creation to {}", path);
   Encoder snapshot;
-  snapshot.Initialize(path, kSnapshotMagic, kVersion);
+  snapshot.Initialize(path, kSnapshotMagic, kVersion,
+                      storage->config_.durability.compression ? FileCompression::ZLIB : FileCompression::NONE);
 
   // Write placeholder offsets.
   uint64_t offset_offsets = 0;
@@ -2251,9 +2471,12 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
     snapshot.WriteUint(offset_vertex_batches);
   }
 
-  // Object counters.
-  uint64_t edges_count = 0;
-  uint64_t vertices_count = 0;
+  // The objects are encoded concurrently when there are multiple snapshot
+  // threads, so the snapshot transaction must not cache anything meanwhile.
+  const auto thread_count = storage->config_.durability.snapshot_thread_count;
+  const auto items_per_batch = storage->config_.durability.items_per_batch;
+  transaction->manyDeltasCache.SetReadOnly(thread_count > 1);
+  utils::OnScopeExit reset_cache{[transaction] { transaction->manyDeltasCache.SetReadOnly(false); }};
 
   // Mapper data.
   std::unordered_set<uint64_t> used_ids;
@@ -2262,15 +2485,11 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
     snapshot.WriteUint(mapping.AsUint());
   };
 
-  std::vector<BatchInfo> edge_batch_infos;
-  auto items_in_current_batch{0UL};
-  auto batch_start_offset{0UL};
   // Store all edges.
+  EncodedObjects encoded_edges;
   if (storage->config_.salient.items.properties_on_edges) {
     offset_edges = snapshot.GetPosition();
-    batch_start_offset = offset_edges;
-    auto acc = edges->access();
-    for (auto &edge : acc) {
+    auto encode_edge = [storage, transaction](Edge &edge, auto &encoder, std::unordered_set<uint64_t> &used_ids) {
       // The edge visibility check must be done here manually because we don't
       // allow direct access to the edges through the public API.
       bool is_visible = true;
@@ -2301,7 +2520,7 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
           }
         }
       });
-      if (!is_visible) continue;
+      if (!is_visible) return false;
       EdgeRef edge_ref(&edge);
       // Here we create an edge accessor that we will use to get the
       // properties of the edge. The accessor is created with an invalid
@@ -2315,115 +2534,98 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
       MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
 
       // Store the edge.
-      {
-        snapshot.WriteMarker(Marker::SECTION_EDGE);
-        snapshot.WriteUint(edge.gid.AsUint());
-        const auto &props = maybe_props.GetValue();
-        snapshot.WriteUint(props.size());
-        for (const auto &item : props) {
-          write_mapping(item.first);
-          snapshot.WritePropertyValue(item.second);
-        }
-      }
-
-      ++edges_count;
-      ++items_in_current_batch;
-      if (items_in_current_batch == storage->config_.durability.items_per_batch) {
-        edge_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
-        batch_start_offset = snapshot.GetPosition();
-        items_in_current_batch = 0;
-      }
-    }
-  }
-
-  if (items_in_current_batch > 0) {
-    edge_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
+      encoder.WriteMarker(Marker::SECTION_EDGE);
+      encoder.WriteUint(edge.gid.AsUint());
+      const auto &props = maybe_props.GetValue();
+      encoder.WriteUint(props.size());
+      for (const auto &item : props) {
+        used_ids.insert(item.first.AsUint());
+        encoder.WriteUint(item.first.AsUint());
+        encoder.WritePropertyValue(item.second);
+      }
+      return true;
+    };
+    encoded_edges = EncodeAllObjects(edges, snapshot, thread_count, items_per_batch, encode_edge);
+    used_ids.merge(encoded_edges.used_ids);
   }
 
-  std::vector<BatchInfo> vertex_batch_infos;
   // Store all vertices.
-  {
-    items_in_current_batch = 0;
-    offset_vertices = snapshot.GetPosition();
-    batch_start_offset = offset_vertices;
-    auto acc = vertices->access();
-    for (auto &vertex : acc) {
-      // The visibility check is implemented for vertices so we use it here.
-      auto va = VertexAccessor::Create(&vertex, storage, transaction, View::OLD);
-      if (!va) continue;
-
-      // Get vertex data.
-      // TODO (mferencevic): All of these functions could be written into a
-      // single function so that we traverse the undo deltas only once.
-      auto maybe_labels = va->Labels(View::OLD);
-      MG_ASSERT(maybe_labels.HasValue(), "Invalid database state!");
-      auto maybe_props = va->Properties(View::OLD);
-      MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
-      auto maybe_in_edges = va->InEdges(View::OLD);
-      MG_ASSERT(maybe_in_edges.HasValue(), "Invalid database state!");
-      auto maybe_out_edges = va->OutEdges(View::OLD);
-      MG_ASSERT(maybe_out_edges.HasValue(), "Invalid database state!");
+  offset_vertices = snapshot.GetPosition();
+  auto encode_vertex = [storage, transaction](Vertex &vertex, auto &encoder, std::unordered_set<uint64_t> &used_ids) {
+    auto write_mapping = [&encoder, &used_ids](auto mapping) {
+      used_ids.insert(mapping.AsUint());
+      encoder.WriteUint(mapping.AsUint());
+    };
 
-      // Store the vertex.
-      {
-        snapshot.WriteMarker(Marker::SECTION_VERTEX);
-        snapshot.WriteUint(vertex.gid.AsUint());
-        const auto &labels = maybe_labels.GetValue();
-        snapshot.WriteUint(labels.size());
-        for (const auto &item : labels) {
-          write_mapping(item);
-        }
-        const auto &props = maybe_props.GetValue();
-        snapshot.WriteUint(props.size());
-        for (const auto &item : props) {
-          write_mapping(item.first);
-          snapshot.WritePropertyValue(item.second);
-        }
-        const auto &in_edges = maybe_in_edges.GetValue().edges;
-        const auto &out_edges = maybe_out_edges.GetValue().edges;
-
-        if (storage->config_.salient.items.properties_on_edges) {
-          snapshot.WriteUint(in_edges.size());
-          for (const auto &item : in_edges) {
-            snapshot.WriteUint(item.GidPropertiesOnEdges().AsUint());
-            snapshot.WriteUint(item.FromVertex().Gid().AsUint());
-            write_mapping(item.EdgeType());
-          }
-          snapshot.WriteUint(out_edges.size());
-          for (const auto &item : out_edges) {
-            snapshot.WriteUint(item.GidPropertiesOnEdges().AsUint());
-            snapshot.WriteUint(item.ToVertex().Gid().AsUint());
-            write_mapping(item.EdgeType());
-          }
-        } else {
-          snapshot.WriteUint(in_edges.size());
-          for (const auto &item : in_edges) {
-            snapshot.WriteUint(item.GidNoPropertiesOnEdges().AsUint());
-            snapshot.WriteUint(item.FromVertex().Gid().AsUint());
-            write_mapping(item.EdgeType());
-          }
-          snapshot.WriteUint(out_edges.size());
-          for (const auto &item : out_edges) {
-            snapshot.WriteUint(item.GidNoPropertiesOnEdges().AsUint());
-            snapshot.WriteUint(item.ToVertex().Gid().AsUint());
-            write_mapping(item.EdgeType());
-          }
-        }
+    // The visibility check is implemented for vertices so we use it here.
+    auto va = VertexAccessor::Create(&vertex, storage, transaction, View::OLD);
+    if (!va) return false;
+
+    // Get vertex data.
+    // TODO (mferencevic): All of these functions could be written into a
+    // single function so that we traverse the undo deltas only once.
+    auto maybe_labels = va->Labels(View::OLD);
+    MG_ASSERT(maybe_labels.HasValue(), "Invalid database state!");
+    auto maybe_props = va->Properties(View::OLD);
+    MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
+    auto maybe_in_edges = va->InEdges(View::OLD);
+    MG_ASSERT(maybe_in_edges.HasValue(), "Invalid database state!");
+    auto maybe_out_edges = va->OutEdges(View::OLD);
+    MG_ASSERT(maybe_out_edges.HasValue(), "Invalid database state!");
+
+    // Store the vertex.
+    encoder.WriteMarker(Marker::SECTION_VERTEX);
+    encoder.WriteUint(vertex.gid.AsUint());
+    const auto &labels = maybe_labels.GetValue();
+    encoder.WriteUint(labels.size());
+    for (const auto &item : labels) {
+      write_mapping(item);
+    }
+    const auto &props = maybe_props.GetValue();
+    encoder.WriteUint(props.size());
+    for (const auto &item : props) {
+      write_mapping(item.first);
+      encoder.WritePropertyValue(item.second);
+    }
+    const auto &in_edges = maybe_in_edges.GetValue().edges;
+    const auto &out_edges = maybe_out_edges.GetValue().edges;
+
+    if (storage->config_.salient.items.properties_on_edges) {
+      encoder.WriteUint(in_edges.size());
+      for (const auto &item : in_edges) {
+        encoder.WriteUint(item.GidPropertiesOnEdges().AsUint());
+        encoder.WriteUint(item.FromVertex().Gid().AsUint());
+        write_mapping(item.EdgeType());
+      }
+      encoder.WriteUint(out_edges.size());
+      for (const auto &item : out_edges) {
+        encoder.WriteUint(item.GidPropertiesOnEdges().AsUint());
+        encoder.WriteUint(item.ToVertex().Gid().AsUint());
+        write_mapping(item.EdgeType());
       }
-
-      ++vertices_count;
-      ++items_in_current_batch;
-      if (items_in_current_batch == storage->config_.durability.items_per_batch) {
-        vertex_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
-        batch_start_offset = snapshot.GetPosition();
-        items_in_current_batch = 0;
+    } else {
+      encoder.WriteUint(in_edges.size());
+      for (const auto &item : in_edges) {
+        encoder.WriteUint(item.GidNoPropertiesOnEdges().AsUint());
+        encoder.WriteUint(item.FromVertex().Gid().AsUint());
+        write_mapping(item.EdgeType());
+      }
+      encoder.WriteUint(out_edges.size());
+      for (const auto &item : out_edges) {
+        encoder.WriteUint(item.GidNoPropertiesOnEdges().AsUint());
+        encoder.WriteUint(item.ToVertex().Gid().AsUint());
+        write_mapping(item.EdgeType());
       }
     }
+    return true;
+  };
+  auto encoded_vertices = EncodeAllObjects(vertices, snapshot, thread_count, items_per_batch, encode_vertex);
+  used_ids.merge(encoded_vertices.used_ids);
 
-    if (items_in_current_batch > 0) {
-      vertex_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
-    }
-  }
+  const auto edges_count = encoded_edges.count;
+  const auto vertices_count = encoded_vertices.count;
+  const auto &edge_batch_infos = encoded_edges.batch_infos;
+  const auto &vertex_batch_infos = encoded_vertices.batch_infos;
 
   // Write indices.
   {
@@ -2492,6 +2694,14 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
           snapshot.WriteDouble(stats->statistic);
           snapshot.WriteDouble(stats->avg_group_size);
           snapshot.WriteDouble(stats->avg_degree);
+          snapshot.WriteUint(stats->histogram_count);
+          snapshot.WriteUint(stats->histogram_bounds.size());
+          for (const auto bound : stats->histogram_bounds) snapshot.WriteDouble(bound);
+          snapshot.WriteUint(stats->most_common_values.size());
+          for (const auto &[hash, count] : stats->most_common_values) {
+            snapshot.WriteUint(hash);
+            snapshot.WriteUint(count);
+          }
           ++i;
         }
       }
@@ -2503,6 +2713,19 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
       }
     }
 
+    // Write label+properties indices.
+    {
+      auto label_properties = storage->indices_.label_property_composite_index_->ListIndices();
+      snapshot.WriteUint(label_properties.size());
+      for (const auto &[label, properties] : label_properties) {
+        write_mapping(label);
+        snapshot.WriteUint(properties.size());
+        for (const auto property : properties) {
+          write_mapping(property);
+        }
+      }
+    }
+
     // Write edge-type indices.
     offset_edge_indices = snapshot.GetPosition();
     snapshot.WriteMarker(Marker::SECTION_EDGE_INDICES);
@@ -2514,6 +2737,16 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
       }
     }
 
+    // Write edge-type + property indices.
+    {
+      auto edge_type_property = storage->indices_.edge_type_property_index_->ListIndices();
+      snapshot.WriteUint(edge_type_property.size());
+      for (const auto &[edge_type, property] : edge_type_property) {
+        write_mapping(edge_type);
+        write_mapping(property);
+      }
+    }
+
     // Write text indices.
     if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
       auto text_indices = storage->indices_.text_index_.ListIndices();
@@ -23,8 +23,12 @@ enum class StorageMetadataOperation {
   LABEL_PROPERTY_INDEX_DROP,
   LABEL_PROPERTY_INDEX_STATS_SET,
   LABEL_PROPERTY_INDEX_STATS_CLEAR,
+  LABEL_PROPERTY_COMPOSITE_INDEX_CREATE,
+  LABEL_PROPERTY_COMPOSITE_INDEX_DROP,
   EDGE_TYPE_INDEX_CREATE,
   EDGE_TYPE_INDEX_DROP,
+  EDGE_TYPE_PROPERTY_INDEX_CREATE,
+  EDGE_TYPE_PROPERTY_INDEX_DROP,
   TEXT_INDEX_CREATE,
   TEXT_INDEX_DROP,
   EXISTENCE_CONSTRAINT_CREATE,
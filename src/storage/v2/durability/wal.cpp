@@ -71,6 +71,15 @@ namespace memgraph::storage::durability {
 //         * unique constraint create, unique constraint drop
 //              * label name
 //              * property names
+//         * label property composite index create, label property composite
+//           index drop
+//              * label name
+//              * property names in the order of the index
+//         * edge-type index create, edge-type index drop
+//              * edge type name
+//         * edge-type property index create, edge-type property index drop
+//              * edge type name
+//              * property name
 //
 // IMPORTANT: When changing WAL encoding/decoding bump the snapshot/WAL version
 // in `version.hpp`.
@@ -95,10 +104,18 @@ Marker OperationToMarker(StorageMetadataOperation operation) {
       return Marker::DELTA_LABEL_PROPERTY_INDEX_STATS_SET;
     case StorageMetadataOperation::LABEL_PROPERTY_INDEX_STATS_CLEAR:
       return Marker::DELTA_LABEL_PROPERTY_INDEX_STATS_CLEAR;
+    case StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+      return Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE;
+    case StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+      return Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP;
     case StorageMetadataOperation::EDGE_TYPE_INDEX_CREATE:
       return Marker::DELTA_EDGE_TYPE_INDEX_CREATE;
     case StorageMetadataOperation::EDGE_TYPE_INDEX_DROP:
       return Marker::DELTA_EDGE_TYPE_INDEX_DROP;
+    case StorageMetadataOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+      return Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_CREATE;
+    case StorageMetadataOperation::EDGE_TYPE_PROPERTY_INDEX_DROP:
+      return Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_DROP;
     case StorageMetadataOperation::TEXT_INDEX_CREATE:
       return Marker::DELTA_TEXT_INDEX_CREATE;
     case StorageMetadataOperation::TEXT_INDEX_DROP:
@@ -184,10 +201,18 @@ WalDeltaData::Type MarkerToWalDeltaDataType(Marker marker) {
       return WalDeltaData::Type::LABEL_PROPERTY_INDEX_STATS_SET;
     case Marker::DELTA_LABEL_PROPERTY_INDEX_STATS_CLEAR:
       return WalDeltaData::Type::LABEL_PROPERTY_INDEX_STATS_CLEAR;
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+      return WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE;
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+      return WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP;
     case Marker::DELTA_EDGE_TYPE_INDEX_CREATE:
       return WalDeltaData::Type::EDGE_INDEX_CREATE;
     case Marker::DELTA_EDGE_TYPE_INDEX_DROP:
       return WalDeltaData::Type::EDGE_INDEX_DROP;
+    case Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_CREATE:
+      return WalDeltaData::Type::EDGE_PROPERTY_INDEX_CREATE;
+    case Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_DROP:
+      return WalDeltaData::Type::EDGE_PROPERTY_INDEX_DROP;
     case Marker::DELTA_EXISTENCE_CONSTRAINT_CREATE:
       return WalDeltaData::Type::EXISTENCE_CONSTRAINT_CREATE;
     case Marker::DELTA_EXISTENCE_CONSTRAINT_DROP:
@@ -324,6 +349,20 @@ WalDeltaData ReadSkipWalDeltaData(BaseDecoder *decoder) {
       }
       break;
     }
+    case WalDeltaData::Type::EDGE_PROPERTY_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_PROPERTY_INDEX_DROP: {
+      if constexpr (read_data) {
+        auto edge_type = decoder->ReadString();
+        if (!edge_type) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_edge_type_property.edge_type = std::move(*edge_type);
+        auto property = decoder->ReadString();
+        if (!property) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_edge_type_property.property = std::move(*property);
+      } else {
+        if (!decoder->SkipString() || !decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+      }
+      break;
+    }
     case WalDeltaData::Type::LABEL_INDEX_STATS_SET: {
       if constexpr (read_data) {
         auto label = decoder->ReadString();
@@ -392,6 +431,29 @@ WalDeltaData ReadSkipWalDeltaData(BaseDecoder *decoder) {
       }
       break;
     }
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+      if constexpr (read_data) {
+        auto label = decoder->ReadString();
+        if (!label) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_label_ordered_properties.label = std::move(*label);
+        auto properties_count = decoder->ReadUint();
+        if (!properties_count) throw RecoveryFailure("Invalid WAL data!");
+        for (uint64_t i = 0; i < *properties_count; ++i) {
+          auto property = decoder->ReadString();
+          if (!property) throw RecoveryFailure("Invalid WAL data!");
+          delta.operation_label_ordered_properties.properties.emplace_back(std::move(*property));
+        }
+      } else {
+        if (!decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+        auto properties_count = decoder->ReadUint();
+        if (!properties_count) throw RecoveryFailure("Invalid WAL data!");
+        for (uint64_t i = 0; i < *properties_count; ++i) {
+          if (!decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+        }
+      }
+      break;
+    }
     case WalDeltaData::Type::TEXT_INDEX_CREATE:
     case WalDeltaData::Type::TEXT_INDEX_DROP: {
       if constexpr (read_data) {
@@ -572,9 +634,17 @@ bool operator==(const WalDeltaData &a, const WalDeltaData &b) {
     case WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP:
       return a.operation_label_properties.label == b.operation_label_properties.label &&
              a.operation_label_properties.properties == b.operation_label_properties.properties;
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+      return a.operation_label_ordered_properties.label == b.operation_label_ordered_properties.label &&
+             a.operation_label_ordered_properties.properties == b.operation_label_ordered_properties.properties;
     case WalDeltaData::Type::EDGE_INDEX_CREATE:
     case WalDeltaData::Type::EDGE_INDEX_DROP:
       return a.operation_edge_type.edge_type == b.operation_edge_type.edge_type;
+    case WalDeltaData::Type::EDGE_PROPERTY_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_PROPERTY_INDEX_DROP:
+      return a.operation_edge_type_property.edge_type == b.operation_edge_type_property.edge_type &&
+             a.operation_edge_type_property.property == b.operation_edge_type_property.property;
   }
 }
 bool operator!=(const WalDeltaData &a, const WalDeltaData &b) { return !(a == b); }
@@ -758,7 +828,11 @@ void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, Storage
       break;
     }
     case StorageMetadataOperation::EDGE_TYPE_INDEX_CREATE:
-    case StorageMetadataOperation::EDGE_TYPE_INDEX_DROP: {
+    case StorageMetadataOperation::EDGE_TYPE_INDEX_DROP:
+    case StorageMetadataOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+    case StorageMetadataOperation::EDGE_TYPE_PROPERTY_INDEX_DROP:
+    case StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
       MG_ASSERT(false, "Invalid function  call!");
     }
     case StorageMetadataOperation::TEXT_INDEX_CREATE:
@@ -795,12 +869,44 @@ void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, Storage
     case StorageMetadataOperation::EXISTENCE_CONSTRAINT_CREATE:
     case StorageMetadataOperation::EXISTENCE_CONSTRAINT_DROP:
     case StorageMetadataOperation::LABEL_PROPERTY_INDEX_STATS_SET:
+    case StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+    case StorageMetadataOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+    case StorageMetadataOperation::EDGE_TYPE_PROPERTY_INDEX_DROP:
     case StorageMetadataOperation::UNIQUE_CONSTRAINT_CREATE:
     case StorageMetadataOperation::UNIQUE_CONSTRAINT_DROP:
       MG_ASSERT(false, "Invalid function call!");
   }
 }
 
+void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, StorageMetadataOperation operation,
+                     EdgeTypeId edge_type, PropertyId property, uint64_t timestamp) {
+  MG_ASSERT(operation == StorageMetadataOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE ||
+                operation == StorageMetadataOperation::EDGE_TYPE_PROPERTY_INDEX_DROP,
+            "Invalid function call!");
+  encoder->WriteMarker(Marker::SECTION_DELTA);
+  encoder->WriteUint(timestamp);
+  encoder->WriteMarker(OperationToMarker(operation));
+  encoder->WriteString(name_id_mapper->IdToName(edge_type.AsUint()));
+  encoder->WriteString(name_id_mapper->IdToName(property.AsUint()));
+}
+
+void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, StorageMetadataOperation operation,
+                     LabelId label, const std::vector<PropertyId> &properties, uint64_t timestamp) {
+  MG_ASSERT(operation == StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE ||
+                operation == StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP,
+            "Invalid function call!");
+  MG_ASSERT(!properties.empty(), "Invalid function call!");
+  encoder->WriteMarker(Marker::SECTION_DELTA);
+  encoder->WriteUint(timestamp);
+  encoder->WriteMarker(OperationToMarker(operation));
+  encoder->WriteString(name_id_mapper->IdToName(label.AsUint()));
+  encoder->WriteUint(properties.size());
+  for (const auto &property : properties) {
+    encoder->WriteString(name_id_mapper->IdToName(property.AsUint()));
+  }
+}
+
 RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConstraints *indices_constraints,
                      const std::optional<uint64_t> last_loaded_timestamp, utils::SkipList<Vertex> *vertices,
                      utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
@@ -902,15 +1008,15 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
           }
           {
             std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*to_vertex, edge_ref};
-            auto it = std::find(from_vertex->out_edges.begin(), from_vertex->out_edges.end(), link);
+            auto it = from_vertex->out_edges.find(link);
             if (it != from_vertex->out_edges.end()) throw RecoveryFailure("The from vertex already has this edge!");
-            from_vertex->out_edges.push_back(link);
+            from_vertex->out_edges.insert(link);
           }
           {
             std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*from_vertex, edge_ref};
-            auto it = std::find(to_vertex->in_edges.begin(), to_vertex->in_edges.end(), link);
+            auto it = to_vertex->in_edges.find(link);
             if (it != to_vertex->in_edges.end()) throw RecoveryFailure("The to vertex already has this edge!");
-            to_vertex->in_edges.push_back(link);
+            to_vertex->in_edges.insert(link);
           }
 
           ret.next_edge_id = std::max(ret.next_edge_id, edge_gid.AsUint() + 1);
@@ -936,17 +1042,15 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
           }
           {
             std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*to_vertex, edge_ref};
-            auto it = std::find(from_vertex->out_edges.begin(), from_vertex->out_edges.end(), link);
+            auto it = from_vertex->out_edges.find(link);
             if (it == from_vertex->out_edges.end()) throw RecoveryFailure("The from vertex doesn't have this edge!");
-            std::swap(*it, from_vertex->out_edges.back());
-            from_vertex->out_edges.pop_back();
+            from_vertex->out_edges.erase(it);
           }
           {
             std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*from_vertex, edge_ref};
-            auto it = std::find(to_vertex->in_edges.begin(), to_vertex->in_edges.end(), link);
+            auto it = to_vertex->in_edges.find(link);
             if (it == to_vertex->in_edges.end()) throw RecoveryFailure("The to vertex doesn't have this edge!");
-            std::swap(*it, to_vertex->in_edges.back());
-            to_vertex->in_edges.pop_back();
+            to_vertex->in_edges.erase(it);
           }
           if (items.properties_on_edges) {
             if (!edge_acc.remove(edge_gid)) throw RecoveryFailure("The edge must be removed here!");
@@ -994,6 +1098,22 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
                                          "The edge-type index doesn't exist!");
           break;
         }
+        case WalDeltaData::Type::EDGE_PROPERTY_INDEX_CREATE: {
+          auto edge_type_id =
+              EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.edge_type));
+          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.property));
+          AddRecoveredIndexConstraint(&indices_constraints->indices.edge_type_property, {edge_type_id, property_id},
+                                      "The edge-type property index already exists!");
+          break;
+        }
+        case WalDeltaData::Type::EDGE_PROPERTY_INDEX_DROP: {
+          auto edge_type_id =
+              EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.edge_type));
+          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.property));
+          RemoveRecoveredIndexConstraint(&indices_constraints->indices.edge_type_property, {edge_type_id, property_id},
+                                         "The edge-type property index doesn't exist!");
+          break;
+        }
         case WalDeltaData::Type::LABEL_INDEX_STATS_SET: {
           auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_stats.label));
           LabelIndexStats stats{};
@@ -1040,6 +1160,26 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
                                     "The label index stats doesn't exist!");
           break;
         }
+        case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE: {
+          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_ordered_properties.label));
+          std::vector<PropertyId> property_ids;
+          for (const auto &prop : delta.operation_label_ordered_properties.properties) {
+            property_ids.push_back(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
+          }
+          AddRecoveredIndexConstraint(&indices_constraints->indices.label_properties, {label_id, property_ids},
+                                      "The label property composite index already exists!");
+          break;
+        }
+        case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_ordered_properties.label));
+          std::vector<PropertyId> property_ids;
+          for (const auto &prop : delta.operation_label_ordered_properties.properties) {
+            property_ids.push_back(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
+          }
+          RemoveRecoveredIndexConstraint(&indices_constraints->indices.label_properties, {label_id, property_ids},
+                                         "The label property composite index doesn't exist!");
+          break;
+        }
         case WalDeltaData::Type::TEXT_INDEX_CREATE: {
           auto index_name = delta.operation_text.index_name;
           auto label = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_text.label));
@@ -1105,7 +1245,7 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
 
 WalFile::WalFile(const std::filesystem::path &wal_directory, const std::string_view uuid,
                  const std::string_view epoch_id, SalientConfig::Items items, NameIdMapper *name_id_mapper,
-                 uint64_t seq_num, utils::FileRetainer *file_retainer)
+                 uint64_t seq_num, utils::FileRetainer *file_retainer, FileCompression compression)
     : items_(items),
       name_id_mapper_(name_id_mapper),
       path_(wal_directory / MakeWalName()),
@@ -1118,7 +1258,7 @@ WalFile::WalFile(const std::filesystem::path &wal_directory, const std::string_v
   utils::EnsureDirOrDie(wal_directory);
 
   // Initialize the WAL file.
-  wal_.Initialize(path_, kWalMagic, kVersion);
+  wal_.Initialize(path_, kWalMagic, kVersion, compression);
 
   // Write placeholder offsets.
   uint64_t offset_offsets = 0;
@@ -1158,7 +1298,7 @@ WalFile::WalFile(std::filesystem::path current_wal_path, SalientConfig::Items it
       count_(count),
       seq_num_(seq_num),
       file_retainer_(file_retainer) {
-  wal_.OpenExisting(path_);
+  wal_.OpenExisting(path_, kWalMagic);
 }
 
 void WalFile::FinalizeWal() {
@@ -1197,6 +1337,14 @@ void WalFile::AppendDelta(const Delta &delta, const Edge &edge, uint64_t timesta
   UpdateStats(timestamp);
 }
 
+void WalFile::AppendDeltas(const EncodedDeltas &deltas, uint64_t timestamp) {
+  const auto &buffer = deltas.encoder.Buffer();
+  wal_.Write(buffer.data(), buffer.size());
+  if (deltas.count == 0) return;
+  UpdateStats(timestamp);
+  count_ += deltas.count - 1;
+}
+
 void WalFile::AppendTransactionEnd(uint64_t timestamp) {
   EncodeTransactionEnd(&wal_, timestamp);
   UpdateStats(timestamp);
@@ -1215,8 +1363,22 @@ void WalFile::AppendOperation(StorageMetadataOperation operation, EdgeTypeId edg
   UpdateStats(timestamp);
 }
 
+void WalFile::AppendOperation(StorageMetadataOperation operation, EdgeTypeId edge_type, PropertyId property,
+                              uint64_t timestamp) {
+  EncodeOperation(&wal_, name_id_mapper_, operation, edge_type, property, timestamp);
+  UpdateStats(timestamp);
+}
+
+void WalFile::AppendOperation(StorageMetadataOperation operation, LabelId label,
+                              const std::vector<PropertyId> &properties, uint64_t timestamp) {
+  EncodeOperation(&wal_, name_id_mapper_, operation, label, properties, timestamp);
+  UpdateStats(timestamp);
+}
+
 void WalFile::Sync() { wal_.Sync(); }
 
+int WalFile::FlushAndDuplicateDescriptor() { return wal_.FlushAndDuplicateDescriptor(); }
+
 uint64_t WalFile::GetSize() { return wal_.GetSize(); }
 
 uint64_t WalFile::SequenceNumber() const { return seq_num_; }
@@ -67,8 +67,12 @@ struct WalDeltaData {
     LABEL_PROPERTY_INDEX_DROP,
     LABEL_PROPERTY_INDEX_STATS_SET,
     LABEL_PROPERTY_INDEX_STATS_CLEAR,
+    LABEL_PROPERTY_COMPOSITE_INDEX_CREATE,
+    LABEL_PROPERTY_COMPOSITE_INDEX_DROP,
     EDGE_INDEX_CREATE,
     EDGE_INDEX_DROP,
+    EDGE_PROPERTY_INDEX_CREATE,
+    EDGE_PROPERTY_INDEX_DROP,
     TEXT_INDEX_CREATE,
     TEXT_INDEX_DROP,
     EXISTENCE_CONSTRAINT_CREATE,
@@ -115,10 +119,20 @@ struct WalDeltaData {
     std::set<std::string, std::less<>> properties;
   } operation_label_properties;
 
+  struct {
+    std::string label;
+    std::vector<std::string> properties;
+  } operation_label_ordered_properties;
+
   struct {
     std::string edge_type;
   } operation_edge_type;
 
+  struct {
+    std::string edge_type;
+    std::string property;
+  } operation_edge_type_property;
+
   struct {
     std::string label;
     std::string stats;
@@ -168,8 +182,12 @@ constexpr bool IsWalDeltaDataTypeTransactionEndVersion15(const WalDeltaData::Typ
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP:
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_STATS_SET:
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_STATS_CLEAR:
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
     case WalDeltaData::Type::EDGE_INDEX_CREATE:
     case WalDeltaData::Type::EDGE_INDEX_DROP:
+    case WalDeltaData::Type::EDGE_PROPERTY_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_PROPERTY_INDEX_DROP:
     case WalDeltaData::Type::TEXT_INDEX_CREATE:
     case WalDeltaData::Type::TEXT_INDEX_DROP:
     case WalDeltaData::Type::EXISTENCE_CONSTRAINT_CREATE:
@@ -229,6 +247,14 @@ void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, Storage
 void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, StorageMetadataOperation operation,
                      EdgeTypeId edge_type, uint64_t timestamp);
 
+/// Function used to encode an operation on an edge-type and one of its properties.
+void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, StorageMetadataOperation operation,
+                     EdgeTypeId edge_type, PropertyId property, uint64_t timestamp);
+
+/// Function used to encode an operation on an ordered list of properties.
+void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, StorageMetadataOperation operation,
+                     LabelId label, const std::vector<PropertyId> &properties, uint64_t timestamp);
+
 /// Function used to load the WAL data into the storage.
 /// @throw RecoveryFailure
 RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConstraints *indices_constraints,
@@ -236,12 +262,19 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
                      utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
                      SalientConfig::Items items);
 
+/// WAL records of the deltas of a single transaction, encoded before the
+/// transaction gets to append them to the WAL file.
+struct EncodedDeltas {
+  BufferEncoder encoder;
+  uint64_t count{0};
+};
+
 /// WalFile class used to append deltas and operations to the WAL file.
 class WalFile {
  public:
   WalFile(const std::filesystem::path &wal_directory, std::string_view uuid, std::string_view epoch_id,
           SalientConfig::Items items, NameIdMapper *name_id_mapper, uint64_t seq_num,
-          utils::FileRetainer *file_retainer);
+          utils::FileRetainer *file_retainer, FileCompression compression = FileCompression::NONE);
   WalFile(std::filesystem::path current_wal_path, SalientConfig::Items items, NameIdMapper *name_id_mapper,
           uint64_t seq_num, uint64_t from_timestamp, uint64_t to_timestamp, uint64_t count,
           utils::FileRetainer *file_retainer);
@@ -255,6 +288,7 @@ class WalFile {
 
   void AppendDelta(const Delta &delta, const Vertex &vertex, uint64_t timestamp);
   void AppendDelta(const Delta &delta, const Edge &edge, uint64_t timestamp);
+  void AppendDeltas(const EncodedDeltas &deltas, uint64_t timestamp);
 
   void AppendTransactionEnd(uint64_t timestamp);
 
@@ -264,8 +298,18 @@ class WalFile {
 
   void AppendOperation(StorageMetadataOperation operation, EdgeTypeId edge_type, uint64_t timestamp);
 
+  void AppendOperation(StorageMetadataOperation operation, EdgeTypeId edge_type, PropertyId property,
+                       uint64_t timestamp);
+
+  void AppendOperation(StorageMetadataOperation operation, LabelId label, const std::vector<PropertyId> &properties,
+                       uint64_t timestamp);
+
   void Sync();
 
+  // Write the internal buffer and get a duplicate of the file descriptor
+  // which can be synced from another thread.
+  int FlushAndDuplicateDescriptor();
+
   uint64_t GetSize();
 
   uint64_t SequenceNumber() const;
@@ -0,0 +1,75 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/durability/wal_group_commit.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include "utils/event_histogram.hpp"
+#include "utils/file.hpp"
+#include "utils/thread.hpp"
+#include "utils/timer.hpp"
+
+namespace memgraph::metrics {
+extern const Event WalGroupCommitSize;
+extern const Event WalSyncLatency_us;
+}  // namespace memgraph::metrics
+
+namespace memgraph::storage::durability {
+
+WalGroupCommit::WalGroupCommit(std::function<SyncRequest()> prepare)
+    : prepare_(std::move(prepare)), flusher_([this](std::stop_token token) { Flush(std::move(token)); }) {}
+
+WalGroupCommit::~WalGroupCommit() {
+  flusher_.request_stop();
+  if (flusher_.joinable()) flusher_.join();
+}
+
+void WalGroupCommit::WaitDurable(uint64_t ticket) {
+  auto guard = std::unique_lock{mutex_};
+  if (durable_ticket_ >= ticket) return;
+  if (requested_ticket_ < ticket) {
+    requested_ticket_ = ticket;
+    flusher_cv_.notify_one();
+  }
+  durable_cv_.wait(guard, [&] { return durable_ticket_ >= ticket; });
+}
+
+void WalGroupCommit::Flush(std::stop_token token) {
+  utils::ThreadSetName("wal flusher");
+  while (true) {
+    {
+      auto guard = std::unique_lock{mutex_};
+      if (!flusher_cv_.wait(guard, token, [this] { return requested_ticket_ > durable_ticket_; })) return;
+    }
+
+    // Transactions which committed while the previous sync was in progress
+    // are picked up here as well, which is what forms the groups.
+    const auto request = prepare_();
+    if (request.fd != -1) {
+      utils::Timer timer;
+      utils::DataSyncAndClose(request.fd);
+      metrics::Measure(metrics::WalSyncLatency_us,
+                       std::chrono::duration_cast<std::chrono::microseconds>(timer.Elapsed()).count());
+    }
+
+    {
+      auto guard = std::lock_guard{mutex_};
+      if (request.ticket <= durable_ticket_) continue;
+      metrics::Measure(metrics::WalGroupCommitSize, request.ticket - durable_ticket_);
+      durable_ticket_ = request.ticket;
+    }
+    durable_cv_.notify_all();
+  }
+}
+
+}  // namespace memgraph::storage::durability
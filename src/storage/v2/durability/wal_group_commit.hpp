@@ -0,0 +1,79 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace memgraph::storage::durability {
+
+/// Makes committed transactions durable in groups.
+///
+/// Committing transactions still write their WAL records while holding the
+/// lock that orders the WAL, but instead of syncing the WAL file themselves
+/// they take a ticket and wait for it (without holding any locks) using
+/// `WaitDurable`. A dedicated flusher thread syncs the WAL once for all the
+/// transactions that are waiting at that moment, and for all the transactions
+/// that committed while the previous sync was in progress.
+class WalGroupCommit {
+ public:
+  struct SyncRequest {
+    // All transactions up to this ticket are written to the file.
+    uint64_t ticket;
+    // Duplicated descriptor of the current WAL file which is synced and closed
+    // by the flusher, or -1 if the WAL file was finalized (and synced) since.
+    int fd;
+  };
+
+  /// `prepare` is called on the flusher thread. It must take the lock that
+  /// orders the WAL, flush the WAL file and return the last ticket together
+  /// with a duplicate of the WAL file descriptor.
+  explicit WalGroupCommit(std::function<SyncRequest()> prepare);
+
+  WalGroupCommit(const WalGroupCommit &) = delete;
+  WalGroupCommit(WalGroupCommit &&) = delete;
+  WalGroupCommit &operator=(const WalGroupCommit &) = delete;
+  WalGroupCommit &operator=(WalGroupCommit &&) = delete;
+
+  ~WalGroupCommit();
+
+  /// Hands out a ticket for a transaction whose WAL records were just written.
+  /// Must be called while holding the lock that orders the WAL.
+  uint64_t Enqueue() { return ++last_ticket_; }
+
+  /// The last ticket handed out. Must be called while holding the lock that
+  /// orders the WAL.
+  uint64_t LastTicket() const { return last_ticket_; }
+
+  /// Blocks until the transaction with the given ticket is synced to disk.
+  void WaitDurable(uint64_t ticket);
+
+ private:
+  void Flush(std::stop_token token);
+
+  std::function<SyncRequest()> prepare_;
+  std::atomic<uint64_t> last_ticket_{0};
+
+  std::mutex mutex_;
+  std::condition_variable_any flusher_cv_;
+  std::condition_variable durable_cv_;
+  uint64_t requested_ticket_{0};
+  uint64_t durable_ticket_{0};
+
+  std::jthread flusher_;
+};
+
+}  // namespace memgraph::storage::durability
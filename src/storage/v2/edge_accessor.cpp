@@ -43,10 +43,12 @@ bool EdgeAccessor::IsVisible(const View view) const {
     Delta *delta = nullptr;
     {
       auto guard = std::shared_lock{from_vertex_->lock};
-      // Initialize deleted by checking if out edges contain edge_
-      deleted = std::find_if(from_vertex_->out_edges.begin(), from_vertex_->out_edges.end(), [&](const auto &out_edge) {
-                  return std::get<2>(out_edge) == edge_;
-                }) == from_vertex_->out_edges.end();
+      // Initialize deleted by checking if out edges contain edge_. The edge is
+      // looked up by its type first, but an accessor from before the edge was
+      // retyped has the old type, so all the out edges are searched otherwise.
+      const auto is_edge = [&](const auto &out_edge) { return std::get<2>(out_edge) == edge_; };
+      deleted = std::ranges::none_of(from_vertex_->out_edges.equal_range(edge_type_), is_edge) &&
+                std::ranges::none_of(from_vertex_->out_edges, is_edge);
       delta = from_vertex_->delta;
     }
     ApplyDeltasForRead(transaction_, delta, view, [&](const Delta &delta) {
@@ -147,6 +149,8 @@ Result<storage::PropertyValue> EdgeAccessor::SetProperty(PropertyId property, co
         edge.ptr->properties.SetProperty(property, value);
       }};
   std::invoke(atomic_memory_block);
+  storage_->indices_.UpdateOnSetProperty(edge_type_, property, value, from_vertex_, to_vertex_, edge_.ptr,
+                                         *transaction_);
 
   if (transaction_->IsDiskStorage()) {
     ModifiedEdgeInfo modified_edge(Delta::Action::SET_PROPERTY, from_vertex_->gid, to_vertex_->gid, edge_type_, edge_);
@@ -173,6 +177,10 @@ Result<bool> EdgeAccessor::InitProperties(const std::map<storage::PropertyId, st
     }
   }};
   std::invoke(atomic_memory_block);
+  for (const auto &[property, value] : properties) {
+    storage_->indices_.UpdateOnSetProperty(edge_type_, property, value, from_vertex_, to_vertex_, edge_.ptr,
+                                           *transaction_);
+  }
 
   return true;
 }
@@ -200,6 +208,12 @@ Result<std::vector<std::tuple<PropertyId, PropertyValue, PropertyValue>>> EdgeAc
         }
       }};
   std::invoke(atomic_memory_block);
+  if (id_old_new_change) {
+    for (const auto &[property, _, new_value] : *id_old_new_change) {
+      storage_->indices_.UpdateOnSetProperty(edge_type_, property, new_value, from_vertex_, to_vertex_, edge_.ptr,
+                                             *transaction_);
+    }
+  }
 
   return id_old_new_change.has_value() ? std::move(id_old_new_change.value()) : ReturnType{};
 }
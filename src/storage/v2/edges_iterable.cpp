@@ -17,12 +17,21 @@ EdgesIterable::EdgesIterable(InMemoryEdgeTypeIndex::Iterable edges) : type_(Type
   new (&in_memory_edges_by_edge_type_) InMemoryEdgeTypeIndex::Iterable(std::move(edges));
 }
 
+EdgesIterable::EdgesIterable(InMemoryEdgeTypePropertyIndex::Iterable edges)
+    : type_(Type::BY_EDGE_TYPE_PROPERTY_IN_MEMORY) {
+  new (&in_memory_edges_by_edge_type_property_) InMemoryEdgeTypePropertyIndex::Iterable(std::move(edges));
+}
+
 EdgesIterable::EdgesIterable(EdgesIterable &&other) noexcept : type_(other.type_) {
   switch (other.type_) {
     case Type::BY_EDGE_TYPE_IN_MEMORY:
       new (&in_memory_edges_by_edge_type_)
           InMemoryEdgeTypeIndex::Iterable(std::move(other.in_memory_edges_by_edge_type_));
       break;
+    case Type::BY_EDGE_TYPE_PROPERTY_IN_MEMORY:
+      new (&in_memory_edges_by_edge_type_property_)
+          InMemoryEdgeTypePropertyIndex::Iterable(std::move(other.in_memory_edges_by_edge_type_property_));
+      break;
   }
 }
 
@@ -34,6 +43,10 @@ EdgesIterable &EdgesIterable::operator=(EdgesIterable &&other) noexcept {
       new (&in_memory_edges_by_edge_type_)
           InMemoryEdgeTypeIndex::Iterable(std::move(other.in_memory_edges_by_edge_type_));
       break;
+    case Type::BY_EDGE_TYPE_PROPERTY_IN_MEMORY:
+      new (&in_memory_edges_by_edge_type_property_)
+          InMemoryEdgeTypePropertyIndex::Iterable(std::move(other.in_memory_edges_by_edge_type_property_));
+      break;
   }
   return *this;
 }
@@ -45,6 +58,9 @@ void EdgesIterable::Destroy() noexcept {
     case Type::BY_EDGE_TYPE_IN_MEMORY:
       in_memory_edges_by_edge_type_.InMemoryEdgeTypeIndex::Iterable::~Iterable();
       break;
+    case Type::BY_EDGE_TYPE_PROPERTY_IN_MEMORY:
+      in_memory_edges_by_edge_type_property_.InMemoryEdgeTypePropertyIndex::Iterable::~Iterable();
+      break;
   }
 }
 
@@ -52,6 +68,8 @@ EdgesIterable::Iterator EdgesIterable::begin() {
   switch (type_) {
     case Type::BY_EDGE_TYPE_IN_MEMORY:
       return Iterator(in_memory_edges_by_edge_type_.begin());
+    case Type::BY_EDGE_TYPE_PROPERTY_IN_MEMORY:
+      return Iterator(in_memory_edges_by_edge_type_property_.begin());
   }
 }
 
@@ -59,6 +77,8 @@ EdgesIterable::Iterator EdgesIterable::end() {
   switch (type_) {
     case Type::BY_EDGE_TYPE_IN_MEMORY:
       return Iterator(in_memory_edges_by_edge_type_.end());
+    case Type::BY_EDGE_TYPE_PROPERTY_IN_MEMORY:
+      return Iterator(in_memory_edges_by_edge_type_property_.end());
   }
 }
 
@@ -67,12 +87,22 @@ EdgesIterable::Iterator::Iterator(InMemoryEdgeTypeIndex::Iterable::Iterator it)
   new (&in_memory_edges_by_edge_type_) InMemoryEdgeTypeIndex::Iterable::Iterator(std::move(it));
 }
 
+EdgesIterable::Iterator::Iterator(InMemoryEdgeTypePropertyIndex::Iterable::Iterator it)
+    : type_(Type::BY_EDGE_TYPE_PROPERTY_IN_MEMORY) {
+  // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+  new (&in_memory_edges_by_edge_type_property_) InMemoryEdgeTypePropertyIndex::Iterable::Iterator(std::move(it));
+}
+
 EdgesIterable::Iterator::Iterator(const EdgesIterable::Iterator &other) : type_(other.type_) {
   switch (other.type_) {
     case Type::BY_EDGE_TYPE_IN_MEMORY:
       new (&in_memory_edges_by_edge_type_)
           InMemoryEdgeTypeIndex::Iterable::Iterator(other.in_memory_edges_by_edge_type_);
       break;
+    case Type::BY_EDGE_TYPE_PROPERTY_IN_MEMORY:
+      new (&in_memory_edges_by_edge_type_property_)
+          InMemoryEdgeTypePropertyIndex::Iterable::Iterator(other.in_memory_edges_by_edge_type_property_);
+      break;
   }
 }
 
@@ -85,6 +115,10 @@ EdgesIterable::Iterator &EdgesIterable::Iterator::operator=(const EdgesIterable:
       new (&in_memory_edges_by_edge_type_)
           InMemoryEdgeTypeIndex::Iterable::Iterator(other.in_memory_edges_by_edge_type_);
       break;
+    case Type::BY_EDGE_TYPE_PROPERTY_IN_MEMORY:
+      new (&in_memory_edges_by_edge_type_property_)
+          InMemoryEdgeTypePropertyIndex::Iterable::Iterator(other.in_memory_edges_by_edge_type_property_);
+      break;
   }
   return *this;
 }
@@ -96,6 +130,11 @@ EdgesIterable::Iterator::Iterator(EdgesIterable::Iterator &&other) noexcept : ty
           // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
           InMemoryEdgeTypeIndex::Iterable::Iterator(std::move(other.in_memory_edges_by_edge_type_));
       break;
+    case Type::BY_EDGE_TYPE_PROPERTY_IN_MEMORY:
+      new (&in_memory_edges_by_edge_type_property_)
+          // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+          InMemoryEdgeTypePropertyIndex::Iterable::Iterator(std::move(other.in_memory_edges_by_edge_type_property_));
+      break;
   }
 }
 
@@ -108,6 +147,11 @@ EdgesIterable::Iterator &EdgesIterable::Iterator::operator=(EdgesIterable::Itera
           // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
           InMemoryEdgeTypeIndex::Iterable::Iterator(std::move(other.in_memory_edges_by_edge_type_));
       break;
+    case Type::BY_EDGE_TYPE_PROPERTY_IN_MEMORY:
+      new (&in_memory_edges_by_edge_type_property_)
+          // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+          InMemoryEdgeTypePropertyIndex::Iterable::Iterator(std::move(other.in_memory_edges_by_edge_type_property_));
+      break;
   }
   return *this;
 }
@@ -119,6 +163,9 @@ void EdgesIterable::Iterator::Destroy() noexcept {
     case Type::BY_EDGE_TYPE_IN_MEMORY:
       in_memory_edges_by_edge_type_.InMemoryEdgeTypeIndex::Iterable::Iterator::~Iterator();
       break;
+    case Type::BY_EDGE_TYPE_PROPERTY_IN_MEMORY:
+      in_memory_edges_by_edge_type_property_.InMemoryEdgeTypePropertyIndex::Iterable::Iterator::~Iterator();
+      break;
   }
 }
 
@@ -127,6 +174,8 @@ EdgeAccessor const &EdgesIterable::Iterator::operator*() const {
     ;
     case Type::BY_EDGE_TYPE_IN_MEMORY:
       return *in_memory_edges_by_edge_type_;
+    case Type::BY_EDGE_TYPE_PROPERTY_IN_MEMORY:
+      return *in_memory_edges_by_edge_type_property_;
   }
 }
 
@@ -135,6 +184,9 @@ EdgesIterable::Iterator &EdgesIterable::Iterator::operator++() {
     case Type::BY_EDGE_TYPE_IN_MEMORY:
       ++in_memory_edges_by_edge_type_;
       break;
+    case Type::BY_EDGE_TYPE_PROPERTY_IN_MEMORY:
+      ++in_memory_edges_by_edge_type_property_;
+      break;
   }
   return *this;
 }
@@ -143,6 +195,8 @@ bool EdgesIterable::Iterator::operator==(const Iterator &other) const {
   switch (type_) {
     case Type::BY_EDGE_TYPE_IN_MEMORY:
       return in_memory_edges_by_edge_type_ == other.in_memory_edges_by_edge_type_;
+    case Type::BY_EDGE_TYPE_PROPERTY_IN_MEMORY:
+      return in_memory_edges_by_edge_type_property_ == other.in_memory_edges_by_edge_type_property_;
   }
 }
 
@@ -0,0 +1,60 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/transaction.hpp"
+#include "utils/bound.hpp"
+
+namespace memgraph::storage {
+
+class EdgeTypePropertyIndex {
+ public:
+  EdgeTypePropertyIndex() = default;
+
+  EdgeTypePropertyIndex(const EdgeTypePropertyIndex &) = delete;
+  EdgeTypePropertyIndex(EdgeTypePropertyIndex &&) = delete;
+  EdgeTypePropertyIndex &operator=(const EdgeTypePropertyIndex &) = delete;
+  EdgeTypePropertyIndex &operator=(EdgeTypePropertyIndex &&) = delete;
+
+  virtual ~EdgeTypePropertyIndex() = default;
+
+  virtual bool DropIndex(EdgeTypeId edge_type, PropertyId property) = 0;
+
+  virtual bool IndexExists(EdgeTypeId edge_type, PropertyId property) const = 0;
+
+  virtual std::vector<std::pair<EdgeTypeId, PropertyId>> ListIndices() const = 0;
+
+  virtual uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property) const = 0;
+
+  virtual uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property,
+                                        const PropertyValue &value) const = 0;
+
+  virtual uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property,
+                                        const std::optional<utils::Bound<PropertyValue>> &lower,
+                                        const std::optional<utils::Bound<PropertyValue>> &upper) const = 0;
+
+  /// This function should be called whenever a property is modified on an edge.
+  /// @throw std::bad_alloc
+  virtual void UpdateOnSetProperty(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value,
+                                   Vertex *from_vertex, Vertex *to_vertex, Edge *edge, const Transaction &tx) = 0;
+
+  virtual void UpdateOnEdgeModification(Vertex *old_from, Vertex *old_to, Vertex *new_from, Vertex *new_to,
+                                        EdgeRef edge_ref, EdgeTypeId edge_type, const Transaction &tx) = 0;
+};
+
+}  // namespace memgraph::storage
@@ -10,13 +10,21 @@
 // licenses/APL.txt.
 
 #include "storage/v2/indices/indices.hpp"
+
+#include <functional>
+
 #include "storage/v2/disk/edge_type_index.hpp"
+#include "storage/v2/disk/edge_type_property_index.hpp"
 #include "storage/v2/disk/label_index.hpp"
+#include "storage/v2/disk/label_property_composite_index.hpp"
 #include "storage/v2/disk/label_property_index.hpp"
 #include "storage/v2/inmemory/edge_type_index.hpp"
+#include "storage/v2/inmemory/edge_type_property_index.hpp"
 #include "storage/v2/inmemory/label_index.hpp"
+#include "storage/v2/inmemory/label_property_composite_index.hpp"
 #include "storage/v2/inmemory/label_property_index.hpp"
 #include "storage/v2/storage.hpp"
+#include "utils/algorithm.hpp"
 
 namespace memgraph::storage {
 
@@ -28,24 +36,64 @@ void Indices::AbortEntries(PropertyId property, std::span<std::pair<PropertyValu
                            uint64_t exact_start_timestamp) const {
   static_cast<InMemoryLabelPropertyIndex *>(label_property_index_.get())
       ->AbortEntries(property, vertices, exact_start_timestamp);
+  label_property_hash_index_.AbortEntries(property, vertices, exact_start_timestamp);
 }
 void Indices::AbortEntries(LabelId label, std::span<std::pair<PropertyValue, Vertex *> const> vertices,
                            uint64_t exact_start_timestamp) const {
   static_cast<InMemoryLabelPropertyIndex *>(label_property_index_.get())
       ->AbortEntries(label, vertices, exact_start_timestamp);
+  label_property_hash_index_.AbortEntries(label, vertices, exact_start_timestamp);
+}
+void Indices::AbortEntries(PropertyId property, std::span<std::pair<PropertyValue, Edge *> const> edges,
+                           uint64_t exact_start_timestamp) const {
+  static_cast<InMemoryEdgeTypePropertyIndex *>(edge_type_property_index_.get())
+      ->AbortEntries(property, edges, exact_start_timestamp);
+}
+void Indices::AbortEntries(const std::pair<LabelId, std::vector<PropertyId>> &label_properties,
+                           std::span<std::pair<std::vector<PropertyValue>, Vertex *> const> vertices,
+                           uint64_t exact_start_timestamp) const {
+  static_cast<InMemoryLabelPropertyCompositeIndex *>(label_property_composite_index_.get())
+      ->AbortEntries(label_properties, vertices, exact_start_timestamp);
 }
 
-void Indices::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token) const {
-  static_cast<InMemoryLabelIndex *>(label_index_.get())->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
-  static_cast<InMemoryLabelPropertyIndex *>(label_property_index_.get())
-      ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
-  static_cast<InMemoryEdgeTypeIndex *>(edge_type_index_.get())
-      ->RemoveObsoleteEntries(oldest_active_start_timestamp, std::move(token));
+void Indices::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token,
+                                    utils::TaskGroup *tasks) const {
+  auto const run = [tasks](std::function<void()> cleanup) {
+    if (tasks) {
+      tasks->Run(std::move(cleanup));
+    } else {
+      cleanup();
+    }
+  };
+  run([this, oldest_active_start_timestamp, token] {
+    static_cast<InMemoryLabelIndex *>(label_index_.get())->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+  });
+  run([this, oldest_active_start_timestamp, token] {
+    static_cast<InMemoryLabelPropertyIndex *>(label_property_index_.get())
+        ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+  });
+  run([this, oldest_active_start_timestamp, token] {
+    static_cast<InMemoryLabelPropertyCompositeIndex *>(label_property_composite_index_.get())
+        ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+  });
+  run([this, oldest_active_start_timestamp, token] {
+    label_property_hash_index_.RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+  });
+  run([this, oldest_active_start_timestamp, token] {
+    static_cast<InMemoryEdgeTypePropertyIndex *>(edge_type_property_index_.get())
+        ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+  });
+  run([this, oldest_active_start_timestamp, token = std::move(token)] {
+    static_cast<InMemoryEdgeTypeIndex *>(edge_type_index_.get())
+        ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+  });
 }
 
 void Indices::UpdateOnAddLabel(LabelId label, Vertex *vertex, const Transaction &tx) const {
   label_index_->UpdateOnAddLabel(label, vertex, tx);
   label_property_index_->UpdateOnAddLabel(label, vertex, tx);
+  label_property_composite_index_->UpdateOnAddLabel(label, vertex, tx);
+  label_property_hash_index_.UpdateOnAddLabel(label, vertex, tx);
 }
 
 void Indices::UpdateOnRemoveLabel(LabelId label, Vertex *vertex, const Transaction &tx) const {
@@ -56,6 +104,13 @@ void Indices::UpdateOnRemoveLabel(LabelId label, Vertex *vertex, const Transacti
 void Indices::UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
                                   const Transaction &tx) const {
   label_property_index_->UpdateOnSetProperty(property, value, vertex, tx);
+  label_property_composite_index_->UpdateOnSetProperty(property, value, vertex, tx);
+  label_property_hash_index_.UpdateOnSetProperty(property, value, vertex, tx);
+}
+
+void Indices::UpdateOnSetProperty(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value,
+                                  Vertex *from_vertex, Vertex *to_vertex, Edge *edge, const Transaction &tx) const {
+  edge_type_property_index_->UpdateOnSetProperty(edge_type, property, value, from_vertex, to_vertex, edge, tx);
 }
 
 void Indices::UpdateOnEdgeCreation(Vertex *from, Vertex *to, EdgeRef edge_ref, EdgeTypeId edge_type,
@@ -63,22 +118,46 @@ void Indices::UpdateOnEdgeCreation(Vertex *from, Vertex *to, EdgeRef edge_ref, E
   edge_type_index_->UpdateOnEdgeCreation(from, to, edge_ref, edge_type, tx);
 }
 
+void Indices::UpdateOnEdgeModification(Vertex *old_from, Vertex *old_to, Vertex *new_from, Vertex *new_to,
+                                       EdgeRef edge_ref, EdgeTypeId edge_type, const Transaction &tx) const {
+  edge_type_index_->UpdateOnEdgeModification(old_from, old_to, new_from, new_to, edge_ref, edge_type, tx);
+  edge_type_property_index_->UpdateOnEdgeModification(old_from, old_to, new_from, new_to, edge_ref, edge_type, tx);
+}
+
 Indices::Indices(const Config &config, StorageMode storage_mode) {
   std::invoke([this, config, storage_mode]() {
     if (storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL || storage_mode == StorageMode::IN_MEMORY_ANALYTICAL) {
       label_index_ = std::make_unique<InMemoryLabelIndex>();
       label_property_index_ = std::make_unique<InMemoryLabelPropertyIndex>();
+      label_property_composite_index_ = std::make_unique<InMemoryLabelPropertyCompositeIndex>();
       edge_type_index_ = std::make_unique<InMemoryEdgeTypeIndex>();
+      edge_type_property_index_ = std::make_unique<InMemoryEdgeTypePropertyIndex>();
     } else {
       label_index_ = std::make_unique<DiskLabelIndex>(config);
       label_property_index_ = std::make_unique<DiskLabelPropertyIndex>(config);
+      label_property_composite_index_ = std::make_unique<DiskLabelPropertyCompositeIndex>();
       edge_type_index_ = std::make_unique<DiskEdgeTypeIndex>();
+      edge_type_property_index_ = std::make_unique<DiskEdgeTypePropertyIndex>();
     }
   });
 }
 
 Indices::IndexStats Indices::Analysis() const {
-  return {static_cast<InMemoryLabelIndex *>(label_index_.get())->Analysis(),
-          static_cast<InMemoryLabelPropertyIndex *>(label_property_index_.get())->Analysis()};
+  IndexStats res{static_cast<InMemoryLabelIndex *>(label_index_.get())->Analysis(),
+                 static_cast<InMemoryLabelPropertyIndex *>(label_property_index_.get())->Analysis()};
+  // Aborts clean the hash indices with the values collected for the label+property indices.
+  for (const auto &[label, property] : label_property_hash_index_.ListIndices()) {
+    auto &properties = res.property_label.l2p[label];
+    if (!utils::Contains(properties, property)) properties.emplace_back(property);
+    auto &labels = res.property_label.p2l[property];
+    if (!utils::Contains(labels, label)) labels.emplace_back(label);
+  }
+  for (const auto &[_, property] : edge_type_property_index_->ListIndices()) {
+    res.edge_property.emplace_back(property);
+  }
+  std::ranges::sort(res.edge_property);
+  res.edge_property.erase(std::unique(res.edge_property.begin(), res.edge_property.end()), res.edge_property.end());
+  res.label_properties = label_property_composite_index_->ListIndices();
+  return res;
 }
 }  // namespace memgraph::storage
@@ -16,10 +16,14 @@
 
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/indices/edge_type_index.hpp"
+#include "storage/v2/indices/edge_type_property_index.hpp"
 #include "storage/v2/indices/label_index.hpp"
+#include "storage/v2/indices/label_property_composite_index.hpp"
 #include "storage/v2/indices/label_property_index.hpp"
 #include "storage/v2/indices/text_index.hpp"
+#include "storage/v2/inmemory/label_property_hash_index.hpp"
 #include "storage/v2/storage_mode.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace memgraph::storage {
 
@@ -33,9 +37,11 @@ struct Indices {
   ~Indices() = default;
 
   /// This function should be called from garbage collection to clean up the
-  /// index.
+  /// index. The indices are independent, so if `tasks` is given each of them
+  /// is cleaned up as a separate task and the caller has to wait for `tasks`.
   /// TODO: unused in disk indices
-  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token) const;
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token,
+                             utils::TaskGroup *tasks = nullptr) const;
 
   /// Surgical removal of entries that were inserted in this transaction
   /// TODO: unused in disk indices
@@ -44,10 +50,17 @@ struct Indices {
                     uint64_t exact_start_timestamp) const;
   void AbortEntries(LabelId label, std::span<std::pair<PropertyValue, Vertex *> const> vertices,
                     uint64_t exact_start_timestamp) const;
+  void AbortEntries(PropertyId property, std::span<std::pair<PropertyValue, Edge *> const> edges,
+                    uint64_t exact_start_timestamp) const;
+  void AbortEntries(const std::pair<LabelId, std::vector<PropertyId>> &label_properties,
+                    std::span<std::pair<std::vector<PropertyValue>, Vertex *> const> vertices,
+                    uint64_t exact_start_timestamp) const;
 
   struct IndexStats {
     std::vector<LabelId> label;
     LabelPropertyIndex::IndexStats property_label;
+    std::vector<PropertyId> edge_property;  // sorted
+    std::vector<std::pair<LabelId, std::vector<PropertyId>>> label_properties;
   };
   IndexStats Analysis() const;
 
@@ -66,13 +79,25 @@ struct Indices {
   void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
                            const Transaction &tx) const;
 
+  /// This function should be called whenever a property is modified on an edge.
+  /// @throw std::bad_alloc
+  void UpdateOnSetProperty(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value, Vertex *from_vertex,
+                           Vertex *to_vertex, Edge *edge, const Transaction &tx) const;
+
   void UpdateOnEdgeCreation(Vertex *from, Vertex *to, EdgeRef edge_ref, EdgeTypeId edge_type,
                             const Transaction &tx) const;
 
+  void UpdateOnEdgeModification(Vertex *old_from, Vertex *old_to, Vertex *new_from, Vertex *new_to, EdgeRef edge_ref,
+                                EdgeTypeId edge_type, const Transaction &tx) const;
+
   std::unique_ptr<LabelIndex> label_index_;
   std::unique_ptr<LabelPropertyIndex> label_property_index_;
+  std::unique_ptr<LabelPropertyCompositeIndex> label_property_composite_index_;
   std::unique_ptr<EdgeTypeIndex> edge_type_index_;
+  std::unique_ptr<EdgeTypePropertyIndex> edge_type_property_index_;
   mutable TextIndex text_index_;
+  // Declared in the storage config, so it's empty with on-disk storage.
+  mutable InMemoryLabelPropertyHashIndex label_property_hash_index_;
 };
 
 }  // namespace memgraph::storage
@@ -9,7 +9,13 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <span>
 #include <thread>
+#include <vector>
+
 #include "storage/v2/delta.hpp"
 #include "storage/v2/durability/recovery_type.hpp"
 #include "storage/v2/mvcc.hpp"
@@ -172,6 +178,77 @@ inline bool AnyVersionHasLabelProperty(const Vertex &vertex, LabelId label, Prop
       });
 }
 
+/// Helper function for building a label-property index while the vertex is
+/// being modified. Calls `callback` with the property value of every reachable
+/// version of the vertex that has the given label and a value of the property.
+/// The same value may be passed more than once.
+template <typename TCallback>
+inline void ForEachVersionLabelPropertyValue(const Vertex &vertex, LabelId label, PropertyId key, uint64_t timestamp,
+                                             const TCallback &callback) {
+  Delta const *delta;
+  bool deleted;
+  bool has_label;
+  PropertyValue value;
+  {
+    auto guard = std::shared_lock{vertex.lock};
+    delta = vertex.delta;
+    deleted = vertex.deleted;
+    has_label = utils::Contains(vertex.labels, label);
+    if (delta == nullptr && (deleted || !has_label)) return;
+    value = vertex.properties.GetProperty(key);
+  }
+
+  if (!deleted && has_label && !value.IsNull()) {
+    callback(value);
+  }
+
+  constexpr auto interesting = ActionSet<Delta::Action::ADD_LABEL, Delta::Action::REMOVE_LABEL,
+                                         Delta::Action::SET_PROPERTY, Delta::Action::RECREATE_OBJECT,
+                                         Delta::Action::DELETE_DESERIALIZED_OBJECT, Delta::Action::DELETE_OBJECT>{};
+  AnyVersionSatisfiesPredicate<interesting>(
+      timestamp, delta, [&has_label, &value, &deleted, &callback, label, key](const Delta &delta) {
+        switch (delta.action) {
+          case Delta::Action::ADD_LABEL:
+            if (delta.label.value == label) {
+              MG_ASSERT(!has_label, "Invalid database state!");
+              has_label = true;
+            }
+            break;
+          case Delta::Action::REMOVE_LABEL:
+            if (delta.label.value == label) {
+              MG_ASSERT(has_label, "Invalid database state!");
+              has_label = false;
+            }
+            break;
+          case Delta::Action::SET_PROPERTY:
+            if (delta.property.key == key) {
+              value = *delta.property.value;
+            }
+            break;
+          case Delta::Action::RECREATE_OBJECT: {
+            MG_ASSERT(deleted, "Invalid database state!");
+            deleted = false;
+            break;
+          }
+          case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+          case Delta::Action::DELETE_OBJECT: {
+            MG_ASSERT(!deleted, "Invalid database state!");
+            deleted = true;
+            break;
+          }
+          case Delta::Action::ADD_IN_EDGE:
+          case Delta::Action::ADD_OUT_EDGE:
+          case Delta::Action::REMOVE_IN_EDGE:
+          case Delta::Action::REMOVE_OUT_EDGE:
+            break;
+        }
+        if (!deleted && has_label && !value.IsNull()) {
+          callback(value);
+        }
+        return false;
+      });
+}
+
 // Helper function for iterating through label-property index. Returns true if
 // this transaction can see the given vertex, and the visible version has the
 // given label and property.
@@ -231,6 +308,113 @@ inline bool CurrentVersionHasLabelProperty(const Vertex &vertex, LabelId label,
   return exists && !deleted && has_label && current_value_equal_to_value;
 }
 
+/// Helper function for label-properties index garbage collection. Returns true
+/// if there's a reachable version of the vertex that has the given label and
+/// property values. A `Null` value matches a missing property.
+inline bool AnyVersionHasLabelProperties(const Vertex &vertex, LabelId label, std::span<PropertyId const> keys,
+                                         std::span<PropertyValue const> values, uint64_t timestamp) {
+  Delta const *delta;
+  bool deleted;
+  bool has_label;
+  std::vector<bool> values_match(keys.size());
+  {
+    auto guard = std::shared_lock{vertex.lock};
+    delta = vertex.delta;
+    deleted = vertex.deleted;
+    has_label = utils::Contains(vertex.labels, label);
+    if (delta == nullptr && (deleted || !has_label)) return false;
+    for (size_t i = 0; i < keys.size(); ++i) {
+      values_match[i] = vertex.properties.IsPropertyEqual(keys[i], values[i]);
+    }
+  }
+
+  auto all_values_match = [&values_match]() { return std::ranges::all_of(values_match, std::identity{}); };
+  if (!deleted && has_label && all_values_match()) {
+    return true;
+  }
+
+  constexpr auto interesting = ActionSet<Delta::Action::ADD_LABEL, Delta::Action::REMOVE_LABEL,
+                                         Delta::Action::SET_PROPERTY, Delta::Action::RECREATE_OBJECT,
+                                         Delta::Action::DELETE_DESERIALIZED_OBJECT, Delta::Action::DELETE_OBJECT>{};
+  return AnyVersionSatisfiesPredicate<interesting>(timestamp, delta, [&, label](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::ADD_LABEL:
+        if (delta.label.value == label) {
+          MG_ASSERT(!has_label, "Invalid database state!");
+          has_label = true;
+        }
+        break;
+      case Delta::Action::REMOVE_LABEL:
+        if (delta.label.value == label) {
+          MG_ASSERT(has_label, "Invalid database state!");
+          has_label = false;
+        }
+        break;
+      case Delta::Action::SET_PROPERTY:
+        for (size_t i = 0; i < keys.size(); ++i) {
+          if (delta.property.key == keys[i]) {
+            values_match[i] = *delta.property.value == values[i];
+          }
+        }
+        break;
+      case Delta::Action::RECREATE_OBJECT: {
+        MG_ASSERT(deleted, "Invalid database state!");
+        deleted = false;
+        break;
+      }
+      case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+      case Delta::Action::DELETE_OBJECT: {
+        MG_ASSERT(!deleted, "Invalid database state!");
+        deleted = true;
+        break;
+      }
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::ADD_OUT_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::REMOVE_OUT_EDGE:
+        break;
+    }
+    return !deleted && has_label && all_values_match();
+  });
+}
+
+// Helper function for iterating through label-properties index. Returns true
+// if this transaction can see the given vertex, and the visible version has
+// the given label and property values.
+inline bool CurrentVersionHasLabelProperties(const Vertex &vertex, LabelId label, std::span<PropertyId const> keys,
+                                             std::span<PropertyValue const> values, Transaction *transaction,
+                                             View view) {
+  bool exists = true;
+  bool deleted = false;
+  bool has_label = false;
+  std::vector<bool> values_match(keys.size());
+  const Delta *delta = nullptr;
+  {
+    auto guard = std::shared_lock{vertex.lock};
+    deleted = vertex.deleted;
+    has_label = utils::Contains(vertex.labels, label);
+    for (size_t i = 0; i < keys.size(); ++i) {
+      values_match[i] = vertex.properties.IsPropertyEqual(keys[i], values[i]);
+    }
+    delta = vertex.delta;
+  }
+
+  if (delta) {
+    ApplyDeltasForRead(transaction, delta, view, [&, label](const Delta &delta) {
+      // clang-format off
+      DeltaDispatch(delta, utils::ChainedOverloaded{
+        Deleted_ActionMethod(deleted),
+        Exists_ActionMethod(exists),
+        HasLabel_ActionMethod(has_label, label),
+        PropertyValuesMatch_ActionMethod(values_match, keys, values)
+      });
+      // clang-format on
+    });
+  }
+
+  return exists && !deleted && has_label && std::ranges::all_of(values_match, std::identity{});
+}
+
 template <typename TIndexAccessor>
 inline void TryInsertLabelIndex(Vertex &vertex, LabelId label, TIndexAccessor &index_accessor) {
   if (vertex.deleted || !utils::Contains(vertex.labels, label)) {
@@ -253,6 +437,47 @@ inline void TryInsertLabelPropertyIndex(Vertex &vertex, std::pair<LabelId, Prope
   index_accessor.insert({std::move(value), &vertex, 0});
 }
 
+/// Inserts the vertex into a label index which is being built while other
+/// transactions modify the vertices, if any version of the vertex visible from
+/// transactions that start after `timestamp` has the label.
+template <typename TIndexAccessor>
+inline void TryInsertLabelIndexOnline(Vertex &vertex, LabelId label, uint64_t timestamp,
+                                      TIndexAccessor &index_accessor) {
+  if (AnyVersionHasLabel(vertex, label, timestamp)) {
+    index_accessor.insert({&vertex, 0});
+  }
+}
+
+/// Label-property counterpart of `TryInsertLabelIndexOnline`, inserts an entry
+/// for every value the property has in those versions.
+template <typename TIndexAccessor>
+inline void TryInsertLabelPropertyIndexOnline(Vertex &vertex, std::pair<LabelId, PropertyId> label_property_pair,
+                                              uint64_t timestamp, TIndexAccessor &index_accessor) {
+  ForEachVersionLabelPropertyValue(vertex, label_property_pair.first, label_property_pair.second, timestamp,
+                                   [&](const PropertyValue &value) { index_accessor.insert({value, &vertex, 0}); });
+}
+
+/// Inserts the vertex into a label-properties index if it has the label and
+/// the first of the properties. Missing values of the other properties are
+/// stored as `Null`.
+template <typename TIndexAccessor>
+inline void TryInsertLabelPropertiesIndex(Vertex &vertex,
+                                          const std::pair<LabelId, std::vector<PropertyId>> &label_properties,
+                                          TIndexAccessor &index_accessor) {
+  if (vertex.deleted || !utils::Contains(vertex.labels, label_properties.first)) {
+    return;
+  }
+  std::vector<PropertyValue> values;
+  values.reserve(label_properties.second.size());
+  for (const auto property : label_properties.second) {
+    values.push_back(vertex.properties.GetProperty(property));
+  }
+  if (values.front().IsNull()) {
+    return;
+  }
+  index_accessor.insert({std::move(values), &vertex, 0});
+}
+
 template <typename TSkiplistIter, typename TIndex, typename TIndexKey, typename TFunc>
 inline void CreateIndexOnSingleThread(utils::SkipList<Vertex>::Accessor &vertices, TSkiplistIter it, TIndex &index,
                                       TIndexKey key, const TFunc &func) {
@@ -269,6 +494,81 @@ inline void CreateIndexOnSingleThread(utils::SkipList<Vertex>::Accessor &vertice
   }
 }
 
+/// Entries of an index collected for a chunk of vertices, which are inserted
+/// into the index once the chunk is done.
+template <typename TEntry>
+struct SortedRun {
+  void insert(TEntry &&entry) { entries.push_back(std::move(entry)); }
+
+  std::vector<TEntry> entries;
+};
+
+// Chunks are a few times more than the threads, so that threads which got
+// smaller chunks take over the rest, but small enough to bound the memory of
+// the runs.
+constexpr uint64_t kIndexCreationChunksPerThread = 4;
+constexpr uint64_t kIndexCreationVerticesPerChunk = 100'000;
+
+/// Builds the index on `thread_count` threads, each of which takes chunks of
+/// the vertex skip list. The entries of a chunk are sorted before they are
+/// inserted, so that consecutive insertions go through the same index skip
+/// list nodes.
+template <typename TIndex, typename TIndexKey, typename TSKiplistIter, typename TFunc>
+inline void CreateIndexFromChunks(utils::SkipList<Vertex>::Accessor &vertices, TSKiplistIter skiplist_iter,
+                                  TIndex &index, TIndexKey key, uint64_t thread_count, const TFunc &func) {
+  using Entry = typename decltype(skiplist_iter->second.access())::value_type;
+
+  // Chunks are delimited by gids, chunk `i` ends where chunk `i + 1` begins.
+  const auto num_chunks =
+      std::max(thread_count * kIndexCreationChunksPerThread, vertices.size() / kIndexCreationVerticesPerChunk);
+  std::vector<Gid> chunk_begins;
+  for (auto it : vertices.chunk_boundaries(num_chunks)) chunk_begins.push_back(it->gid);
+
+  std::atomic<uint64_t> chunk_counter = 0;
+  utils::Synchronized<std::optional<utils::OutOfMemoryException>, utils::SpinLock> maybe_error{};
+  {
+    std::vector<std::jthread> threads;
+    threads.reserve(thread_count);
+
+    for (auto i{0U}; i < std::min<uint64_t>(thread_count, chunk_begins.size()); ++i) {
+      threads.emplace_back([&skiplist_iter, &func, &maybe_error, &chunk_counter, &chunk_begins, &key, &vertices]() {
+        utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+        auto index_accessor = skiplist_iter->second.access();
+        SortedRun<Entry> run;
+        while (!maybe_error.Lock()->has_value()) {
+          const auto chunk = chunk_counter++;
+          if (chunk >= chunk_begins.size()) {
+            return;
+          }
+          try {
+            run.entries.clear();
+            const auto has_end = chunk + 1 < chunk_begins.size();
+            for (auto it = vertices.find_equal_or_greater(chunk_begins[chunk]);
+                 it != vertices.end() && (!has_end || it->gid < chunk_begins[chunk + 1]); ++it) {
+              func(*it, key, run);
+            }
+            std::sort(run.entries.begin(), run.entries.end());
+            for (auto &entry : run.entries) {
+              index_accessor.insert(std::move(entry));
+            }
+          } catch (utils::OutOfMemoryException &failure) {
+            utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+            *maybe_error.Lock() = std::move(failure);
+          }
+        }
+      });
+    }
+  }
+  if (maybe_error.Lock()->has_value()) {
+    utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+    index.erase(skiplist_iter);
+    throw utils::OutOfMemoryException((*maybe_error.Lock())->what());
+  }
+}
+
+/// Builds the index on multiple threads. The threads take the batches of
+/// `parallel_exec_info` or, if there are none, chunks of the vertex skip list,
+/// see `CreateIndexFromChunks`.
 template <typename TIndex, typename TIndexKey, typename TSKiplistIter, typename TFunc>
 inline void CreateIndexOnMultipleThreads(utils::SkipList<Vertex>::Accessor &vertices, TSKiplistIter skiplist_iter,
                                          TIndex &index, TIndexKey key,
@@ -277,12 +577,12 @@ inline void CreateIndexOnMultipleThreads(utils::SkipList<Vertex>::Accessor &vert
   utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
 
   const auto &vertex_batches = parallel_exec_info.vertex_recovery_info;
+  if (vertex_batches.empty()) {
+    CreateIndexFromChunks(vertices, skiplist_iter, index, key, parallel_exec_info.thread_count, func);
+    return;
+  }
   const auto thread_count = std::min(parallel_exec_info.thread_count, vertex_batches.size());
 
-  MG_ASSERT(!vertex_batches.empty(),
-            "The size of batches should always be greater than zero if you want to use the parallel version of index "
-            "creation!");
-
   std::atomic<uint64_t> batch_counter = 0;
 
   utils::Synchronized<std::optional<utils::OutOfMemoryException>, utils::SpinLock> maybe_error{};
@@ -0,0 +1,57 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/transaction.hpp"
+#include "storage/v2/vertex.hpp"
+
+namespace memgraph::storage {
+
+/// Index of the vertices with a label by the values of an ordered list of
+/// properties. A vertex is indexed if it has the first property, the values of
+/// the other properties may be missing. Lookups use a prefix of the
+/// properties.
+class LabelPropertyCompositeIndex {
+ public:
+  LabelPropertyCompositeIndex() = default;
+  LabelPropertyCompositeIndex(const LabelPropertyCompositeIndex &) = delete;
+  LabelPropertyCompositeIndex(LabelPropertyCompositeIndex &&) = delete;
+  LabelPropertyCompositeIndex &operator=(const LabelPropertyCompositeIndex &) = delete;
+  LabelPropertyCompositeIndex &operator=(LabelPropertyCompositeIndex &&) = delete;
+
+  virtual ~LabelPropertyCompositeIndex() = default;
+
+  virtual void UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx) = 0;
+
+  virtual void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
+                                   const Transaction &tx) = 0;
+
+  virtual bool DropIndex(LabelId label, const std::vector<PropertyId> &properties) = 0;
+
+  virtual bool IndexExists(LabelId label, const std::vector<PropertyId> &properties) const = 0;
+
+  virtual std::vector<std::pair<LabelId, std::vector<PropertyId>>> ListIndices() const = 0;
+
+  virtual uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties) const = 0;
+
+  /// Estimated number of indexed vertices whose values of the first
+  /// `prefix.size()` properties are equal to `prefix`.
+  virtual uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                          const std::vector<PropertyValue> &prefix) const = 0;
+};
+
+}  // namespace memgraph::storage
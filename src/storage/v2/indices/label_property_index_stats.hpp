@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2024 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -11,7 +11,20 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <fmt/core.h>
+#include "storage/v2/property_value.hpp"
+#include "utils/bound.hpp"
+#include "utils/fnv.hpp"
 #include "utils/simple_json.hpp"
 
 namespace memgraph::storage {
@@ -19,12 +32,164 @@ namespace memgraph::storage {
 struct LabelPropertyIndexStats {
   uint64_t count, distinct_values_count;
   double statistic, avg_group_size, avg_degree;
+  // Number of numeric values described by `histogram_bounds`.
+  uint64_t histogram_count{0};
+  // Bounds of an equi-depth histogram of the numeric values, bucket `i` spans
+  // from `histogram_bounds[i]` to `histogram_bounds[i + 1]` and holds the same
+  // share of the values as every other bucket.
+  std::vector<double> histogram_bounds{};
+  // Hashes of the most common values, see `MostCommonValueHash`, with their
+  // number of occurrences, the most common first.
+  std::vector<std::pair<uint64_t, uint64_t>> most_common_values{};
 };
 
+constexpr size_t kLabelPropertyIndexStatsHistogramBuckets = 100;
+constexpr size_t kLabelPropertyIndexStatsMostCommonValues = 100;
+
+/// Hash of a value in `LabelPropertyIndexStats::most_common_values`. Integers
+/// and doubles which are equal have the same hash. Statistics are persisted,
+/// so the hash must not change between versions. Values of other types than
+/// booleans, numbers and strings aren't tracked.
+inline std::optional<uint64_t> MostCommonValueHash(const PropertyValue &value) {
+  // -0.0 is formatted differently than 0.0.
+  const auto number_hash = [](double number) { return utils::Fnv(fmt::format("n{}", number == 0 ? 0.0 : number)); };
+  switch (value.type()) {
+    case PropertyValue::Type::Bool:
+      return utils::Fnv(value.ValueBool() ? "b1" : "b0");
+    case PropertyValue::Type::Int:
+      return number_hash(static_cast<double>(value.ValueInt()));
+    case PropertyValue::Type::Double:
+      return number_hash(value.ValueDouble());
+    case PropertyValue::Type::String:
+      return utils::Fnv("s" + value.ValueString());
+    default:
+      return std::nullopt;
+  }
+}
+
+/// Fills the histogram and the most common values of `stats` from the number
+/// of occurrences of every value, which the map keeps sorted.
+inline void SetValueDistribution(LabelPropertyIndexStats &stats, const std::map<PropertyValue, int64_t> &values) {
+  stats.histogram_count = 0;
+  stats.histogram_bounds.clear();
+  stats.most_common_values.clear();
+
+  std::vector<std::pair<double, uint64_t>> numbers;
+  for (const auto &[value, count] : values) {
+    if (value.IsInt()) {
+      numbers.emplace_back(static_cast<double>(value.ValueInt()), count);
+    } else if (value.IsDouble() && std::isfinite(value.ValueDouble())) {
+      numbers.emplace_back(value.ValueDouble(), count);
+    } else {
+      continue;
+    }
+    stats.histogram_count += count;
+  }
+  if (!numbers.empty()) {
+    // Every bound is the value at which the next share of values is reached.
+    const auto buckets = std::min(kLabelPropertyIndexStatsHistogramBuckets, static_cast<size_t>(stats.histogram_count));
+    stats.histogram_bounds.reserve(buckets + 1);
+    stats.histogram_bounds.push_back(numbers.front().first);
+    uint64_t seen = 0;
+    size_t bucket = 1;
+    for (const auto &[number, count] : numbers) {
+      seen += count;
+      while (bucket < buckets && seen * buckets >= bucket * stats.histogram_count) {
+        stats.histogram_bounds.push_back(number);
+        ++bucket;
+      }
+    }
+    stats.histogram_bounds.push_back(numbers.back().first);
+  }
+
+  // Only values which are more common than the average one tell something
+  // the average group size doesn't.
+  for (const auto &[value, count] : values) {
+    if (static_cast<double>(count) <= stats.avg_group_size) continue;
+    if (auto hash = MostCommonValueHash(value)) stats.most_common_values.emplace_back(*hash, count);
+  }
+  std::sort(stats.most_common_values.begin(), stats.most_common_values.end(),
+            [](const auto &lhs, const auto &rhs) { return lhs.second > rhs.second; });
+  if (stats.most_common_values.size() > kLabelPropertyIndexStatsMostCommonValues) {
+    stats.most_common_values.resize(kLabelPropertyIndexStatsMostCommonValues);
+  }
+}
+
+/// Statistics collected by older versions and statistics of values which are
+/// all equally common and not numbers don't describe the values.
+inline bool HasValueDistribution(const LabelPropertyIndexStats &stats) {
+  return !stats.histogram_bounds.empty() || !stats.most_common_values.empty();
+}
+
+/// Estimated number of indexed vertices whose property is equal to `value`.
+inline double EstimateValueCount(const LabelPropertyIndexStats &stats, const PropertyValue &value) {
+  uint64_t most_common_count = 0;
+  if (auto hash = MostCommonValueHash(value)) {
+    for (const auto &[common_hash, count] : stats.most_common_values) {
+      if (common_hash == *hash) return static_cast<double>(count);
+      most_common_count += count;
+    }
+  } else {
+    for (const auto &[common_hash, count] : stats.most_common_values) most_common_count += count;
+  }
+  // The other values are assumed to be equally common. A value is expected to
+  // exist, the statistics may be older than the data.
+  const auto common_values = static_cast<uint64_t>(stats.most_common_values.size());
+  const auto other_values = stats.distinct_values_count - std::min(stats.distinct_values_count, common_values);
+  const auto other_count = static_cast<double>(stats.count - std::min(stats.count, most_common_count));
+  return std::max(1.0, other_values > 0 ? other_count / static_cast<double>(other_values) : 0.0);
+}
+
+/// Estimated number of indexed vertices whose property is in the range, or
+/// nullopt if the histogram can't tell, i.e. if it's empty or if a bound isn't
+/// a number.
+inline std::optional<double> EstimateRangeCount(const LabelPropertyIndexStats &stats,
+                                                const std::optional<utils::Bound<PropertyValue>> &lower,
+                                                const std::optional<utils::Bound<PropertyValue>> &upper) {
+  const auto &bounds = stats.histogram_bounds;
+  if (bounds.size() < 2) return std::nullopt;
+  const auto to_number = [](const std::optional<utils::Bound<PropertyValue>> &bound) -> std::optional<double> {
+    if (!bound) return std::nullopt;
+    if (bound->value().IsInt()) return static_cast<double>(bound->value().ValueInt());
+    if (bound->value().IsDouble()) return bound->value().ValueDouble();
+    return std::nullopt;
+  };
+  const auto lower_number = to_number(lower);
+  const auto upper_number = to_number(upper);
+  if ((lower && !lower_number) || (upper && !upper_number)) return std::nullopt;
+
+  // Share of the values which are less than or equal to `number`, assuming
+  // they are spread evenly within a bucket.
+  const auto buckets = static_cast<double>(bounds.size() - 1);
+  const auto share_up_to = [&](double number) {
+    if (number < bounds.front()) return 0.0;
+    if (number >= bounds.back()) return 1.0;
+    const auto bucket = static_cast<size_t>(std::upper_bound(bounds.begin(), bounds.end(), number) - bounds.begin());
+    const auto width = bounds[bucket] - bounds[bucket - 1];
+    const auto inside = width > 0 ? (number - bounds[bucket - 1]) / width : 1.0;
+    return (static_cast<double>(bucket - 1) + inside) / buckets;
+  };
+  const auto share =
+      (upper_number ? share_up_to(*upper_number) : 1.0) - (lower_number ? share_up_to(*lower_number) : 0.0);
+  return std::max(1.0, share * static_cast<double>(stats.histogram_count));
+}
+
 static inline std::string ToJson(const LabelPropertyIndexStats &in) {
+  std::string histogram;
+  for (const auto bound : in.histogram_bounds) {
+    if (!histogram.empty()) histogram += ' ';
+    histogram += fmt::format("{}", bound);
+  }
+  std::string most_common_values;
+  for (const auto &[hash, count] : in.most_common_values) {
+    if (!most_common_values.empty()) most_common_values += ' ';
+    most_common_values += fmt::format("{} {}", hash, count);
+  }
   return fmt::format(
-      R"({{"count":{}, "distinct_values_count":{}, "statistic":{}, "avg_group_size":{} "avg_degree":{}}})", in.count,
-      in.distinct_values_count, in.statistic, in.avg_group_size, in.avg_degree);
+      R"({{"count":{}, "distinct_values_count":{}, "statistic":{}, "avg_group_size":{}, "avg_degree":{}, )"
+      R"("histogram_count":{}, "histogram":"{}", "most_common_values":"{}"}})",
+      in.count, in.distinct_values_count, in.statistic, in.avg_group_size, in.avg_degree, in.histogram_count,
+      histogram, most_common_values);
 }
 
 static inline bool FromJson(const std::string &json, LabelPropertyIndexStats &out) {
@@ -34,6 +199,21 @@ static inline bool FromJson(const std::string &json, LabelPropertyIndexStats &ou
   res &= utils::GetJsonValue(json, "statistic", out.statistic);
   res &= utils::GetJsonValue(json, "avg_group_size", out.avg_group_size);
   res &= utils::GetJsonValue(json, "avg_degree", out.avg_degree);
+  // Statistics written by older versions don't have the value distribution.
+  out.histogram_count = 0;
+  out.histogram_bounds.clear();
+  out.most_common_values.clear();
+  if (!utils::GetJsonValue(json, "histogram_count", out.histogram_count)) return res;
+  std::string histogram;
+  std::string most_common_values;
+  res &= utils::GetJsonValue(json, "histogram", histogram);
+  res &= utils::GetJsonValue(json, "most_common_values", most_common_values);
+  std::istringstream histogram_stream(histogram);
+  for (double bound = 0; histogram_stream >> bound;) out.histogram_bounds.push_back(bound);
+  std::istringstream most_common_values_stream(most_common_values);
+  uint64_t hash = 0;
+  uint64_t count = 0;
+  while (most_common_values_stream >> hash >> count) out.most_common_values.emplace_back(hash, count);
   return res;
 }
 
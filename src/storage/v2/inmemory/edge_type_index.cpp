@@ -75,7 +75,7 @@ ReturnType VertexDeletedConnectedEdges(Vertex *vertex, Edge *edge, const Transac
       case Delta::Action::ADD_IN_EDGE: {
         if (edge == delta.vertex_edge.edge.ptr) {
           link = {delta.vertex_edge.edge_type, delta.vertex_edge.vertex, delta.vertex_edge.edge};
-          auto it = std::find(vertex->in_edges.begin(), vertex->in_edges.end(), link);
+          auto it = vertex->in_edges.find(*link);
           MG_ASSERT(it == vertex->in_edges.end(), "Invalid database state!");
           break;
         }
@@ -83,7 +83,7 @@ ReturnType VertexDeletedConnectedEdges(Vertex *vertex, Edge *edge, const Transac
       case Delta::Action::ADD_OUT_EDGE: {
         if (edge == delta.vertex_edge.edge.ptr) {
           link = {delta.vertex_edge.edge_type, delta.vertex_edge.vertex, delta.vertex_edge.edge};
-          auto it = std::find(vertex->out_edges.begin(), vertex->out_edges.end(), link);
+          auto it = vertex->out_edges.find(*link);
           MG_ASSERT(it == vertex->out_edges.end(), "Invalid database state!");
           break;
         }
@@ -117,15 +117,12 @@ bool InMemoryEdgeTypeIndex::CreateIndex(EdgeTypeId edge_type, utils::SkipList<Ve
         continue;
       }
 
-      for (auto &edge : from_vertex.out_edges) {
-        const auto type = std::get<kEdgeTypeIdPos>(edge);
-        if (type == edge_type) {
-          auto *to_vertex = std::get<kVertexPos>(edge);
-          if (to_vertex->deleted) {
-            continue;
-          }
-          edge_acc.insert({&from_vertex, to_vertex, std::get<kEdgeRefPos>(edge).ptr, 0});
+      for (const auto &edge : from_vertex.out_edges.equal_range(edge_type)) {
+        auto *to_vertex = std::get<kVertexPos>(edge);
+        if (to_vertex->deleted) {
+          continue;
         }
+        edge_acc.insert({&from_vertex, to_vertex, std::get<kEdgeRefPos>(edge).ptr, 0});
       }
     }
   } catch (const utils::OutOfMemoryException &) {
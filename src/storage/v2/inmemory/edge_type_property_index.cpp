@@ -0,0 +1,488 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/inmemory/edge_type_property_index.hpp"
+
+#include "storage/v2/indices/indices_utils.hpp"
+#include "storage/v2/inmemory/label_property_index.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "utils/counter.hpp"
+#include "utils/logging.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+
+/// Returns true if the edge exists and has the given property value in the
+/// version seen by the transaction.
+bool CurrentVersionHasProperty(const Edge &edge, PropertyId key, const PropertyValue &value,
+                               const Transaction *transaction, View view) {
+  bool exists = true;
+  bool deleted = false;
+  bool current_value_equal_to_value = false;
+  Delta *delta = nullptr;
+  {
+    auto guard = std::shared_lock{edge.lock};
+    deleted = edge.deleted;
+    current_value_equal_to_value = edge.properties.IsPropertyEqual(key, value);
+    delta = edge.delta;
+  }
+  ApplyDeltasForRead(transaction, delta, view, [&](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::SET_PROPERTY:
+        if (delta.property.key == key) {
+          current_value_equal_to_value = *delta.property.value == value;
+        }
+        break;
+      case Delta::Action::RECREATE_OBJECT:
+        deleted = false;
+        break;
+      case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+      case Delta::Action::DELETE_OBJECT:
+        exists = false;
+        break;
+      case Delta::Action::ADD_LABEL:
+      case Delta::Action::REMOVE_LABEL:
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::ADD_OUT_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::REMOVE_OUT_EDGE:
+        break;
+    }
+  });
+  return exists && !deleted && current_value_equal_to_value;
+}
+
+/// Returns true if the edge goes from `from_vertex` to `to_vertex` in the
+/// version seen by the transaction. Entries keep the endpoints the edge had
+/// when they were inserted, which may since have been changed.
+bool CurrentVersionHasLink(const Vertex &from_vertex, Vertex *to_vertex, Edge *edge, EdgeTypeId edge_type,
+                           const Transaction *transaction, View view) {
+  bool linked = false;
+  Delta *delta = nullptr;
+  {
+    auto guard = std::shared_lock{from_vertex.lock};
+    linked = from_vertex.out_edges.find({edge_type, to_vertex, EdgeRef(edge)}) != from_vertex.out_edges.end();
+    delta = from_vertex.delta;
+  }
+  ApplyDeltasForRead(transaction, delta, view, [&](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::ADD_OUT_EDGE:
+        if (delta.vertex_edge.edge.ptr == edge && delta.vertex_edge.vertex == to_vertex) {
+          linked = true;
+        }
+        break;
+      case Delta::Action::REMOVE_OUT_EDGE:
+        if (delta.vertex_edge.edge.ptr == edge && delta.vertex_edge.vertex == to_vertex) {
+          linked = false;
+        }
+        break;
+      case Delta::Action::ADD_LABEL:
+      case Delta::Action::REMOVE_LABEL:
+      case Delta::Action::SET_PROPERTY:
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::RECREATE_OBJECT:
+      case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+      case Delta::Action::DELETE_OBJECT:
+        break;
+    }
+  });
+  return linked;
+}
+
+/// Helper function for garbage collection. Returns true if there's a reachable
+/// version of the edge that has the given property value.
+bool AnyVersionHasProperty(const Edge &edge, PropertyId key, const PropertyValue &value, uint64_t timestamp) {
+  Delta const *delta;
+  bool deleted;
+  bool current_value_equal_to_value;
+  {
+    auto guard = std::shared_lock{edge.lock};
+    delta = edge.delta;
+    deleted = edge.deleted;
+    if (delta == nullptr && deleted) return false;
+    current_value_equal_to_value = edge.properties.IsPropertyEqual(key, value);
+  }
+
+  if (!deleted && current_value_equal_to_value) {
+    return true;
+  }
+
+  constexpr auto interesting = ActionSet<Delta::Action::SET_PROPERTY, Delta::Action::RECREATE_OBJECT,
+                                         Delta::Action::DELETE_DESERIALIZED_OBJECT, Delta::Action::DELETE_OBJECT>{};
+  return AnyVersionSatisfiesPredicate<interesting>(
+      timestamp, delta, [&current_value_equal_to_value, &deleted, key, &value](const Delta &delta) {
+        switch (delta.action) {
+          case Delta::Action::SET_PROPERTY:
+            if (delta.property.key == key) {
+              current_value_equal_to_value = *delta.property.value == value;
+            }
+            break;
+          case Delta::Action::RECREATE_OBJECT:
+            deleted = false;
+            break;
+          case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+          case Delta::Action::DELETE_OBJECT:
+            deleted = true;
+            break;
+          case Delta::Action::ADD_LABEL:
+          case Delta::Action::REMOVE_LABEL:
+          case Delta::Action::ADD_IN_EDGE:
+          case Delta::Action::ADD_OUT_EDGE:
+          case Delta::Action::REMOVE_IN_EDGE:
+          case Delta::Action::REMOVE_OUT_EDGE:
+            break;
+        }
+        return !deleted && current_value_equal_to_value;
+      });
+}
+
+/// Helper function for garbage collection. Returns true if there's a reachable
+/// version of `from_vertex` that has the edge going to `to_vertex`.
+bool AnyVersionHasLink(const Vertex &from_vertex, Vertex *to_vertex, Edge *edge, EdgeTypeId edge_type,
+                       uint64_t timestamp) {
+  Delta const *delta;
+  bool linked;
+  {
+    auto guard = std::shared_lock{from_vertex.lock};
+    delta = from_vertex.delta;
+    linked = from_vertex.out_edges.find({edge_type, to_vertex, EdgeRef(edge)}) != from_vertex.out_edges.end();
+  }
+
+  if (linked) {
+    return true;
+  }
+
+  constexpr auto interesting = ActionSet<Delta::Action::ADD_OUT_EDGE, Delta::Action::REMOVE_OUT_EDGE>{};
+  return AnyVersionSatisfiesPredicate<interesting>(timestamp, delta, [&linked, to_vertex, edge](const Delta &delta) {
+    if (delta.vertex_edge.edge.ptr == edge && delta.vertex_edge.vertex == to_vertex) {
+      linked = delta.action == Delta::Action::ADD_OUT_EDGE;
+    }
+    return linked;
+  });
+}
+
+}  // namespace
+
+bool InMemoryEdgeTypePropertyIndex::Entry::operator<(const Entry &rhs) const {
+  if (value < rhs.value) {
+    return true;
+  }
+  if (rhs.value < value) {
+    return false;
+  }
+  return std::make_tuple(edge, timestamp, from_vertex, to_vertex) <
+         std::make_tuple(rhs.edge, rhs.timestamp, rhs.from_vertex, rhs.to_vertex);
+}
+
+bool InMemoryEdgeTypePropertyIndex::Entry::operator==(const Entry &rhs) const {
+  return value == rhs.value && edge == rhs.edge && timestamp == rhs.timestamp && from_vertex == rhs.from_vertex &&
+         to_vertex == rhs.to_vertex;
+}
+
+bool InMemoryEdgeTypePropertyIndex::Entry::operator<(const PropertyValue &rhs) const { return value < rhs; }
+
+bool InMemoryEdgeTypePropertyIndex::Entry::operator==(const PropertyValue &rhs) const { return value == rhs; }
+
+bool InMemoryEdgeTypePropertyIndex::CreateIndex(EdgeTypeId edge_type, PropertyId property,
+                                                utils::SkipList<Vertex>::Accessor vertices) {
+  auto [it, emplaced] = index_.try_emplace({edge_type, property});
+  if (!emplaced) {
+    return false;
+  }
+
+  utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+  try {
+    auto edge_acc = it->second.access();
+    for (auto &from_vertex : vertices) {
+      if (from_vertex.deleted) {
+        continue;
+      }
+
+      for (const auto &[_, to_vertex, edge_ref] : from_vertex.out_edges.equal_range(edge_type)) {
+        if (to_vertex->deleted) {
+          continue;
+        }
+        auto value = edge_ref.ptr->properties.GetProperty(property);
+        if (value.IsNull()) {
+          continue;
+        }
+        edge_acc.insert({std::move(value), &from_vertex, to_vertex, edge_ref.ptr, 0});
+      }
+    }
+  } catch (const utils::OutOfMemoryException &) {
+    utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+    index_.erase(it);
+    throw;
+  }
+
+  return true;
+}
+
+bool InMemoryEdgeTypePropertyIndex::DropIndex(EdgeTypeId edge_type, PropertyId property) {
+  return index_.erase({edge_type, property}) > 0;
+}
+
+bool InMemoryEdgeTypePropertyIndex::IndexExists(EdgeTypeId edge_type, PropertyId property) const {
+  return index_.find({edge_type, property}) != index_.end();
+}
+
+std::vector<std::pair<EdgeTypeId, PropertyId>> InMemoryEdgeTypePropertyIndex::ListIndices() const {
+  std::vector<std::pair<EdgeTypeId, PropertyId>> ret;
+  ret.reserve(index_.size());
+  for (const auto &[key, _] : index_) {
+    ret.push_back(key);
+  }
+  return ret;
+}
+
+void InMemoryEdgeTypePropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp,
+                                                          std::stop_token token) {
+  auto maybe_stop = utils::ResettableCounter<2048>();
+
+  for (auto &[edge_type_property, index] : index_) {
+    auto [edge_type, property] = edge_type_property;
+    // before starting index, check if stop_requested
+    if (token.stop_requested()) return;
+
+    auto index_acc = index.access();
+    auto it = index_acc.begin();
+    auto end_it = index_acc.end();
+    if (it == end_it) continue;
+    while (true) {
+      // Hot loop, don't check stop_requested every time
+      if (maybe_stop() && token.stop_requested()) return;
+
+      auto next_it = it;
+      ++next_it;
+
+      bool has_next = next_it != end_it;
+      if (it->timestamp < oldest_active_start_timestamp) {
+        bool redundant_duplicate = has_next && it->edge == next_it->edge && it->value == next_it->value &&
+                                   it->from_vertex == next_it->from_vertex && it->to_vertex == next_it->to_vertex;
+        if (redundant_duplicate ||
+            !AnyVersionHasProperty(*it->edge, property, it->value, oldest_active_start_timestamp) ||
+            !AnyVersionHasLink(*it->from_vertex, it->to_vertex, it->edge, edge_type, oldest_active_start_timestamp)) {
+          index_acc.remove(*it);
+        }
+      }
+      if (!has_next) break;
+      it = next_it;
+    }
+  }
+}
+
+void InMemoryEdgeTypePropertyIndex::AbortEntries(PropertyId property,
+                                                 std::span<std::pair<PropertyValue, Edge *> const> edges,
+                                                 uint64_t exact_start_timestamp) {
+  for (auto &[edge_type_property, index] : index_) {
+    if (edge_type_property.second != property) continue;
+
+    auto index_acc = index.access();
+    for (auto const &[value, edge] : edges) {
+      // The endpoints are ordered last, so every entry this transaction
+      // inserted for the edge and value follows the search key.
+      auto it = index_acc.find_equal_or_greater(Entry{value, nullptr, nullptr, edge, exact_start_timestamp});
+      while (it != index_acc.end() && it->edge == edge && it->timestamp == exact_start_timestamp &&
+             it->value == value) {
+        auto const &entry = *it;
+        ++it;
+        index_acc.remove(entry);
+      }
+    }
+  }
+}
+
+uint64_t InMemoryEdgeTypePropertyIndex::ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property) const {
+  auto it = index_.find({edge_type, property});
+  MG_ASSERT(it != index_.end(), "Index for edge-type {} and property {} doesn't exist", edge_type.AsUint(),
+            property.AsUint());
+  return it->second.size();
+}
+
+uint64_t InMemoryEdgeTypePropertyIndex::ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property,
+                                                             const PropertyValue &value) const {
+  auto it = index_.find({edge_type, property});
+  MG_ASSERT(it != index_.end(), "Index for edge-type {} and property {} doesn't exist", edge_type.AsUint(),
+            property.AsUint());
+  auto acc = it->second.access();
+  if (!value.IsNull()) {
+    // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+    return acc.estimate_count(value, utils::SkipListLayerForCountEstimation(acc.size()));
+  }
+  // `Null` is never stored in the index, so it is used to ask for the average
+  // number of edges sharing a value.
+  return acc.estimate_average_number_of_equals(
+      [](const auto &first, const auto &second) { return first.value == second.value; },
+      // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+      utils::SkipListLayerForAverageEqualsEstimation(acc.size()));
+}
+
+uint64_t InMemoryEdgeTypePropertyIndex::ApproximateEdgeCount(
+    EdgeTypeId edge_type, PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower,
+    const std::optional<utils::Bound<PropertyValue>> &upper) const {
+  auto it = index_.find({edge_type, property});
+  MG_ASSERT(it != index_.end(), "Index for edge-type {} and property {} doesn't exist", edge_type.AsUint(),
+            property.AsUint());
+  auto acc = it->second.access();
+  // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+  return acc.estimate_range_count(lower, upper, utils::SkipListLayerForCountEstimation(acc.size()));
+}
+
+void InMemoryEdgeTypePropertyIndex::UpdateOnSetProperty(EdgeTypeId edge_type, PropertyId property,
+                                                        const PropertyValue &value, Vertex *from_vertex,
+                                                        Vertex *to_vertex, Edge *edge, const Transaction &tx) {
+  if (value.IsNull()) {
+    return;
+  }
+
+  auto it = index_.find({edge_type, property});
+  if (it == index_.end()) {
+    return;
+  }
+  auto acc = it->second.access();
+  acc.insert(Entry{value, from_vertex, to_vertex, edge, tx.start_timestamp});
+}
+
+void InMemoryEdgeTypePropertyIndex::UpdateOnEdgeModification(Vertex * /*old_from*/, Vertex * /*old_to*/,
+                                                             Vertex *new_from, Vertex *new_to, EdgeRef edge_ref,
+                                                             EdgeTypeId edge_type, const Transaction &tx) {
+  // The caller holds the edge lock, so its properties can be read directly.
+  for (auto it = index_.lower_bound({edge_type, PropertyId::FromUint(0)});
+       it != index_.end() && it->first.first == edge_type; ++it) {
+    auto value = edge_ref.ptr->properties.GetProperty(it->first.second);
+    if (value.IsNull()) continue;
+    auto acc = it->second.access();
+    acc.insert(Entry{std::move(value), new_from, new_to, edge_ref.ptr, tx.start_timestamp});
+  }
+}
+
+InMemoryEdgeTypePropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor,
+                                                  utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
+                                                  utils::SkipList<Edge>::ConstAccessor edges_accessor,
+                                                  EdgeTypeId edge_type, PropertyId property,
+                                                  const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                                  const std::optional<utils::Bound<PropertyValue>> &upper_bound,
+                                                  View view, Storage *storage, Transaction *transaction)
+    : vertices_pin_accessor_(std::move(vertices_accessor)),
+      edges_pin_accessor_(std::move(edges_accessor)),
+      index_accessor_(std::move(index_accessor)),
+      edge_type_(edge_type),
+      property_(property),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound),
+      view_(view),
+      storage_(storage),
+      transaction_(transaction) {
+  bounds_valid_ = CompleteIndexScanBounds(lower_bound_, upper_bound_);
+}
+
+InMemoryEdgeTypePropertyIndex::Iterable::Iterator::Iterator(Iterable *self,
+                                                            utils::SkipList<Entry>::Iterator index_iterator)
+    : self_(self),
+      index_iterator_(index_iterator),
+      current_edge_accessor_(EdgeRef{nullptr}, EdgeTypeId::FromInt(0), nullptr, nullptr, self_->storage_, nullptr),
+      current_edge_(nullptr) {
+  AdvanceUntilValid();
+}
+
+InMemoryEdgeTypePropertyIndex::Iterable::Iterator &InMemoryEdgeTypePropertyIndex::Iterable::Iterator::operator++() {
+  ++index_iterator_;
+  AdvanceUntilValid();
+  return *this;
+}
+
+void InMemoryEdgeTypePropertyIndex::Iterable::Iterator::AdvanceUntilValid() {
+  for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    if (index_iterator_->edge == current_edge_) {
+      continue;
+    }
+
+    if (self_->lower_bound_) {
+      if (index_iterator_->value < self_->lower_bound_->value()) {
+        continue;
+      }
+      if (!self_->lower_bound_->IsInclusive() && index_iterator_->value == self_->lower_bound_->value()) {
+        continue;
+      }
+    }
+    if (self_->upper_bound_) {
+      if (self_->upper_bound_->value() < index_iterator_->value) {
+        index_iterator_ = self_->index_accessor_.end();
+        break;
+      }
+      if (!self_->upper_bound_->IsInclusive() && index_iterator_->value == self_->upper_bound_->value()) {
+        index_iterator_ = self_->index_accessor_.end();
+        break;
+      }
+    }
+
+    if (!CurrentVersionHasProperty(*index_iterator_->edge, self_->property_, index_iterator_->value,
+                                   self_->transaction_, self_->view_) ||
+        !CurrentVersionHasLink(*index_iterator_->from_vertex, index_iterator_->to_vertex, index_iterator_->edge,
+                               self_->edge_type_, self_->transaction_, self_->view_)) {
+      continue;
+    }
+
+    current_edge_ = index_iterator_->edge;
+    current_edge_accessor_ = EdgeAccessor{EdgeRef(current_edge_), self_->edge_type_,
+                                          index_iterator_->from_vertex, index_iterator_->to_vertex,
+                                          self_->storage_, self_->transaction_};
+    break;
+  }
+}
+
+InMemoryEdgeTypePropertyIndex::Iterable::Iterator InMemoryEdgeTypePropertyIndex::Iterable::begin() {
+  // If the bounds are set and don't have comparable types we don't yield any
+  // items from the index.
+  if (!bounds_valid_) return {this, index_accessor_.end()};
+  auto index_iterator = index_accessor_.begin();
+  if (lower_bound_) {
+    index_iterator = index_accessor_.find_equal_or_greater(lower_bound_->value());
+  }
+  return {this, index_iterator};
+}
+
+InMemoryEdgeTypePropertyIndex::Iterable::Iterator InMemoryEdgeTypePropertyIndex::Iterable::end() {
+  return {this, index_accessor_.end()};
+}
+
+void InMemoryEdgeTypePropertyIndex::RunGC() {
+  for (auto &index_entry : index_) {
+    index_entry.second.run_gc();
+  }
+}
+
+InMemoryEdgeTypePropertyIndex::Iterable InMemoryEdgeTypePropertyIndex::Edges(
+    EdgeTypeId edge_type, PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
+    Transaction *transaction) {
+  DMG_ASSERT(storage->storage_mode_ == StorageMode::IN_MEMORY_TRANSACTIONAL ||
+                 storage->storage_mode_ == StorageMode::IN_MEMORY_ANALYTICAL,
+             "Edge-type+property index trying to access InMemory edges from OnDisk!");
+  const auto *mem_storage = static_cast<InMemoryStorage const *>(storage);
+  auto it = index_.find({edge_type, property});
+  MG_ASSERT(it != index_.end(), "Index for edge-type {} and property {} doesn't exist", edge_type.AsUint(),
+            property.AsUint());
+  return {it->second.access(),
+          mem_storage->vertices_.access(),
+          mem_storage->edges_.access(),
+          edge_type,
+          property,
+          lower_bound,
+          upper_bound,
+          view,
+          storage,
+          transaction};
+}
+
+}  // namespace memgraph::storage
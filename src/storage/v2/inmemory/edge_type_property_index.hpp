@@ -0,0 +1,145 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#pragma once
+
+#include <map>
+#include <optional>
+#include <span>
+#include <utility>
+
+#include "storage/v2/edge_accessor.hpp"
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/indices/edge_type_property_index.hpp"
+#include "storage/v2/property_value.hpp"
+#include "utils/bound.hpp"
+#include "utils/skip_list.hpp"
+
+namespace memgraph::storage {
+
+/// Index of edges by their type and the value of one of their properties.
+/// Entries are ordered by the property value, so point lookups and range
+/// scans only touch the matching part of the index.
+class InMemoryEdgeTypePropertyIndex : public storage::EdgeTypePropertyIndex {
+ private:
+  struct Entry {
+    PropertyValue value;
+    Vertex *from_vertex;
+    Vertex *to_vertex;
+    Edge *edge;
+    uint64_t timestamp;
+
+    bool operator<(const Entry &rhs) const;
+    bool operator==(const Entry &rhs) const;
+
+    bool operator<(const PropertyValue &rhs) const;
+    bool operator==(const PropertyValue &rhs) const;
+  };
+
+ public:
+  InMemoryEdgeTypePropertyIndex() = default;
+
+  /// @throw std::bad_alloc
+  bool CreateIndex(EdgeTypeId edge_type, PropertyId property, utils::SkipList<Vertex>::Accessor vertices);
+
+  /// Returns false if there was no index to drop
+  bool DropIndex(EdgeTypeId edge_type, PropertyId property) override;
+
+  bool IndexExists(EdgeTypeId edge_type, PropertyId property) const override;
+
+  std::vector<std::pair<EdgeTypeId, PropertyId>> ListIndices() const override;
+
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token);
+
+  /// Surgical removal of entries that were inserted in this transaction
+  void AbortEntries(PropertyId property, std::span<std::pair<PropertyValue, Edge *> const> edges,
+                    uint64_t exact_start_timestamp);
+
+  uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property) const override;
+
+  /// Supplying a specific value into the count estimation function will return
+  /// an estimated count of edges which have their property's value set to
+  /// `value`. If the `value` specified is `Null`, then an average number of
+  /// equal elements is returned.
+  uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value) const override;
+
+  uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property,
+                                const std::optional<utils::Bound<PropertyValue>> &lower,
+                                const std::optional<utils::Bound<PropertyValue>> &upper) const override;
+
+  void UpdateOnSetProperty(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value, Vertex *from_vertex,
+                           Vertex *to_vertex, Edge *edge, const Transaction &tx) override;
+
+  /// The entries with the old endpoints are left in place for older
+  /// transactions and are removed by the garbage collector.
+  void UpdateOnEdgeModification(Vertex *old_from, Vertex *old_to, Vertex *new_from, Vertex *new_to, EdgeRef edge_ref,
+                                EdgeTypeId edge_type, const Transaction &tx) override;
+
+  class Iterable {
+   public:
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
+             utils::SkipList<Edge>::ConstAccessor edges_accessor, EdgeTypeId edge_type, PropertyId property,
+             const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+             const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
+             Transaction *transaction);
+
+    class Iterator {
+     public:
+      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
+
+      EdgeAccessor const &operator*() const { return current_edge_accessor_; }
+
+      bool operator==(const Iterator &other) const { return index_iterator_ == other.index_iterator_; }
+      bool operator!=(const Iterator &other) const { return index_iterator_ != other.index_iterator_; }
+
+      Iterator &operator++();
+
+     private:
+      void AdvanceUntilValid();
+
+      Iterable *self_;
+      utils::SkipList<Entry>::Iterator index_iterator_;
+      EdgeAccessor current_edge_accessor_;
+      Edge *current_edge_{nullptr};
+    };
+
+    Iterator begin();
+    Iterator end();
+
+   private:
+    // Entries point to both vertices and edges, so both are kept alive while
+    // the index is being read.
+    utils::SkipList<Vertex>::ConstAccessor vertices_pin_accessor_;
+    utils::SkipList<Edge>::ConstAccessor edges_pin_accessor_;
+    utils::SkipList<Entry>::Accessor index_accessor_;
+    EdgeTypeId edge_type_;
+    PropertyId property_;
+    std::optional<utils::Bound<PropertyValue>> lower_bound_;
+    std::optional<utils::Bound<PropertyValue>> upper_bound_;
+    bool bounds_valid_{true};
+    View view_;
+    Storage *storage_;
+    Transaction *transaction_;
+  };
+
+  void RunGC();
+
+  Iterable Edges(EdgeTypeId edge_type, PropertyId property,
+                 const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                 const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
+                 Transaction *transaction);
+
+ private:
+  std::map<std::pair<EdgeTypeId, PropertyId>, utils::SkipList<Entry>> index_;
+};
+
+}  // namespace memgraph::storage
@@ -45,10 +45,9 @@ bool InMemoryLabelIndex::CreateIndex(
   const auto create_index_par = [this](LabelId label, utils::SkipList<Vertex>::Accessor &vertices,
                                        std::map<LabelId, utils::SkipList<Entry>>::iterator label_it,
                                        const durability::ParallelizedSchemaCreationInfo &parallel_exec_info) {
-    using IndexAccessor = decltype(label_it->second.access());
-
+    // The entries are inserted either into the index or into a sorted run.
     CreateIndexOnMultipleThreads(vertices, label_it, index_, label, parallel_exec_info,
-                                 [](Vertex &vertex, LabelId label, IndexAccessor &index_accessor) {
+                                 [](Vertex &vertex, LabelId label, auto &index_accessor) {
                                    TryInsertLabelIndex(vertex, label, index_accessor);
                                  });
 
@@ -57,8 +56,18 @@ bool InMemoryLabelIndex::CreateIndex(
 
   auto [it, emplaced] = index_.emplace(std::piecewise_construct, std::forward_as_tuple(label), std::forward_as_tuple());
   if (!emplaced) {
-    // Index already exists.
-    return false;
+    auto registered = registered_.find(label);
+    if (registered == registered_.end()) {
+      // Index already exists.
+      return false;
+    }
+    // The index was registered and only has to be populated if that didn't
+    // finish.
+    const bool populated = registered->second.load(std::memory_order_acquire);
+    registered_.erase(registered);
+    if (populated) {
+      return true;
+    }
   }
 
   if (parallel_exec_info) {
@@ -67,14 +76,53 @@ bool InMemoryLabelIndex::CreateIndex(
   return create_index_seq(label, vertices, it);
 }
 
-bool InMemoryLabelIndex::DropIndex(LabelId label) { return index_.erase(label) > 0; }
+bool InMemoryLabelIndex::RegisterIndex(LabelId label) {
+  auto [it, emplaced] = index_.emplace(std::piecewise_construct, std::forward_as_tuple(label), std::forward_as_tuple());
+  if (!emplaced) {
+    return false;
+  }
+  registered_.emplace(std::piecewise_construct, std::forward_as_tuple(label), std::forward_as_tuple(false));
+  return true;
+}
+
+void InMemoryLabelIndex::PopulateIndex(LabelId label, utils::SkipList<Vertex>::Accessor vertices,
+                                       uint64_t timestamp) {
+  auto registered = registered_.find(label);
+  if (registered == registered_.end()) {
+    return;
+  }
+  // Unlike `CreateIndexOnSingleThread`, the index isn't dropped on failure
+  // because that requires unique access.
+  utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+  auto acc = index_.at(label).access();
+  for (Vertex &vertex : vertices) {
+    TryInsertLabelIndexOnline(vertex, label, timestamp, acc);
+  }
+  registered->second.store(true, std::memory_order_release);
+}
+
+bool InMemoryLabelIndex::DropIndex(LabelId label) {
+  // A registered index doesn't exist yet, but it's dropped all the same.
+  registered_.erase(label);
+  return index_.erase(label) > 0;
+}
+
+bool InMemoryLabelIndex::DropRegisteredIndex(LabelId label) {
+  if (registered_.erase(label) == 0) {
+    return false;
+  }
+  return DropIndex(label);
+}
 
-bool InMemoryLabelIndex::IndexExists(LabelId label) const { return index_.find(label) != index_.end(); }
+bool InMemoryLabelIndex::IndexExists(LabelId label) const {
+  return index_.find(label) != index_.end() && !registered_.contains(label);
+}
 
 std::vector<LabelId> InMemoryLabelIndex::ListIndices() const {
   std::vector<LabelId> ret;
   ret.reserve(index_.size());
   for (const auto &item : index_) {
+    if (registered_.contains(item.first)) continue;
     ret.push_back(item.first);
   }
   return ret;
@@ -132,6 +180,19 @@ InMemoryLabelIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_ac
       storage_(storage),
       transaction_(transaction) {}
 
+InMemoryLabelIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor,
+                                       utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
+                                       utils::SkipList<Entry>::Iterator chunk_begin, std::optional<Vertex *> chunk_end,
+                                       LabelId label, View view, Storage *storage, Transaction *transaction)
+    : pin_accessor_(std::move(vertices_accessor)),
+      index_accessor_(std::move(index_accessor)),
+      chunk_begin_(chunk_begin),
+      chunk_end_(chunk_end),
+      label_(label),
+      view_(view),
+      storage_(storage),
+      transaction_(transaction) {}
+
 InMemoryLabelIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator)
     : self_(self),
       index_iterator_(index_iterator),
@@ -148,6 +209,10 @@ InMemoryLabelIndex::Iterable::Iterator &InMemoryLabelIndex::Iterable::Iterator::
 
 void InMemoryLabelIndex::Iterable::Iterator::AdvanceUntilValid() {
   for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    if (self_->chunk_end_ && !(index_iterator_->vertex < *self_->chunk_end_)) {
+      index_iterator_ = self_->index_accessor_.end();
+      break;
+    }
     if (index_iterator_->vertex == current_vertex_) {
       continue;
     }
@@ -192,6 +257,34 @@ InMemoryLabelIndex::Iterable InMemoryLabelIndex::Vertices(
   return {it->second.access(), std::move(vertices_acc), label, view, storage, transaction};
 }
 
+std::vector<InMemoryLabelIndex::Iterable> InMemoryLabelIndex::ChunkedVertices(LabelId label, View view,
+                                                                               uint64_t num_chunks, Storage *storage,
+                                                                               Transaction *transaction) {
+  const auto it = index_.find(label);
+  MG_ASSERT(it != index_.end(), "Index for label {} doesn't exist", label.AsUint());
+  // Chunks are delimited by vertices instead of skip list nodes because a
+  // boundary node can be removed while the chunks are being iterated. A chunk
+  // also starts at the first entry of its vertex, so that the entries of one
+  // vertex are never split between two chunks.
+  std::vector<Vertex *> chunk_begins;
+  {
+    auto index_acc = it->second.access();
+    for (auto entry_it : index_acc.chunk_boundaries(num_chunks)) {
+      if (chunk_begins.empty() || chunk_begins.back() != entry_it->vertex) chunk_begins.push_back(entry_it->vertex);
+    }
+  }
+  std::vector<Iterable> chunks;
+  chunks.reserve(chunk_begins.size());
+  for (size_t i = 0; i < chunk_begins.size(); ++i) {
+    auto index_acc = it->second.access();
+    auto chunk_begin = i == 0 ? index_acc.begin() : index_acc.find_equal_or_greater(Entry{chunk_begins[i], 0});
+    auto chunk_end = i + 1 < chunk_begins.size() ? std::optional<Vertex *>{chunk_begins[i + 1]} : std::nullopt;
+    chunks.emplace_back(std::move(index_acc), static_cast<InMemoryStorage const *>(storage)->vertices_.access(),
+                        chunk_begin, chunk_end, label, view, storage, transaction);
+  }
+  return chunks;
+}
+
 void InMemoryLabelIndex::SetIndexStats(const storage::LabelId &label, const storage::LabelIndexStats &stats) {
   auto locked_stats = stats_.Lock();
   locked_stats->insert_or_assign(label, stats);
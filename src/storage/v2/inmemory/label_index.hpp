@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <span>
 
 #include "storage/v2/constraints/constraints.hpp"
@@ -47,9 +48,26 @@ class InMemoryLabelIndex : public storage::LabelIndex {
   bool CreateIndex(LabelId label, utils::SkipList<Vertex>::Accessor vertices,
                    const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info);
 
+  /// Adds an empty index which writers keep up to date, but which isn't visible
+  /// until it's created with `CreateIndex`. Requires unique access to the
+  /// storage. Returns false if the index already exists.
+  /// @throw std::bad_alloc
+  bool RegisterIndex(LabelId label);
+
+  /// Fills a registered index while other transactions modify the vertices.
+  /// `timestamp` is the start timestamp of the transaction which reads the
+  /// vertices. Does nothing if the index isn't registered.
+  /// @throw std::bad_alloc
+  void PopulateIndex(LabelId label, utils::SkipList<Vertex>::Accessor vertices, uint64_t timestamp);
+
   /// Returns false if there was no index to drop
   bool DropIndex(LabelId label) override;
 
+  /// Drops the index only if it's registered and not created yet, so that an
+  /// interrupted online build doesn't leave it behind. Requires unique access
+  /// to the storage. Returns false if there was no such index.
+  bool DropRegisteredIndex(LabelId label);
+
   bool IndexExists(LabelId label) const override;
 
   std::vector<LabelId> ListIndices() const override;
@@ -66,6 +84,13 @@ class InMemoryLabelIndex : public storage::LabelIndex {
     Iterable(utils::SkipList<Entry>::Accessor index_accessor, utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
              LabelId label, View view, Storage *storage, Transaction *transaction);
 
+    /// Iterates only over the entries starting at `chunk_begin` whose vertex
+    /// is ordered before `chunk_end`. A missing `chunk_end` denotes the end of
+    /// the index.
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
+             utils::SkipList<Entry>::Iterator chunk_begin, std::optional<Vertex *> chunk_end, LabelId label, View view,
+             Storage *storage, Transaction *transaction);
+
     class Iterator {
      public:
       Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
@@ -86,12 +111,14 @@ class InMemoryLabelIndex : public storage::LabelIndex {
       Vertex *current_vertex_;
     };
 
-    Iterator begin() { return {this, index_accessor_.begin()}; }
+    Iterator begin() { return {this, chunk_begin_ ? *chunk_begin_ : index_accessor_.begin()}; }
     Iterator end() { return {this, index_accessor_.end()}; }
 
    private:
     utils::SkipList<Vertex>::ConstAccessor pin_accessor_;
     utils::SkipList<Entry>::Accessor index_accessor_;
+    std::optional<utils::SkipList<Entry>::Iterator> chunk_begin_;
+    std::optional<Vertex *> chunk_end_;
     LabelId label_;
     View view_;
     Storage *storage_;
@@ -107,6 +134,11 @@ class InMemoryLabelIndex : public storage::LabelIndex {
   Iterable Vertices(LabelId label, memgraph::utils::SkipList<memgraph::storage::Vertex>::ConstAccessor vertices_acc,
                     View view, Storage *storage, Transaction *transaction);
 
+  /// Splits the vertices with the label into at most `num_chunks` disjoint
+  /// iterables which can be consumed concurrently.
+  std::vector<Iterable> ChunkedVertices(LabelId label, View view, uint64_t num_chunks, Storage *storage,
+                                        Transaction *transaction);
+
   void SetIndexStats(const storage::LabelId &label, const storage::LabelIndexStats &stats);
 
   std::optional<storage::LabelIndexStats> GetIndexStats(const storage::LabelId &label) const;
@@ -117,6 +149,9 @@ class InMemoryLabelIndex : public storage::LabelIndex {
 
  private:
   std::map<LabelId, utils::SkipList<Entry>> index_;
+  // Registered indices which aren't created yet, with whether they are
+  // populated. The map is only changed with unique access to the storage.
+  std::map<LabelId, std::atomic<bool>> registered_;
   utils::Synchronized<std::map<LabelId, storage::LabelIndexStats>, utils::ReadPrioritizedRWLock> stats_;
 };
 
@@ -0,0 +1,352 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/inmemory/label_property_composite_index.hpp"
+
+#include <algorithm>
+
+#include "storage/v2/indices/indices_utils.hpp"
+#include "storage/v2/inmemory/label_property_index.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "utils/counter.hpp"
+#include "utils/logging.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+
+/// Values of the properties of the vertex, or nullopt if the vertex doesn't
+/// have the first property and isn't indexed.
+std::optional<std::vector<PropertyValue>> IndexedValues(const Vertex &vertex,
+                                                        const std::vector<PropertyId> &properties) {
+  auto first = vertex.properties.GetProperty(properties.front());
+  if (first.IsNull()) return std::nullopt;
+  std::vector<PropertyValue> values;
+  values.reserve(properties.size());
+  values.push_back(std::move(first));
+  for (auto it = std::next(properties.begin()); it != properties.end(); ++it) {
+    values.push_back(vertex.properties.GetProperty(*it));
+  }
+  return values;
+}
+
+}  // namespace
+
+bool InMemoryLabelPropertyCompositeIndex::Entry::operator<(const Entry &rhs) const {
+  if (values < rhs.values) {
+    return true;
+  }
+  if (rhs.values < values) {
+    return false;
+  }
+  return std::make_tuple(vertex, timestamp) < std::make_tuple(rhs.vertex, rhs.timestamp);
+}
+
+bool InMemoryLabelPropertyCompositeIndex::Entry::operator==(const Entry &rhs) const {
+  return values == rhs.values && vertex == rhs.vertex && timestamp == rhs.timestamp;
+}
+
+bool InMemoryLabelPropertyCompositeIndex::Entry::operator<(const std::vector<PropertyValue> &rhs) const {
+  DMG_ASSERT(rhs.size() <= values.size(), "Prefix is longer than the index key!");
+  return std::lexicographical_compare(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(rhs.size()),
+                                      rhs.begin(), rhs.end());
+}
+
+bool InMemoryLabelPropertyCompositeIndex::Entry::operator==(const std::vector<PropertyValue> &rhs) const {
+  DMG_ASSERT(rhs.size() <= values.size(), "Prefix is longer than the index key!");
+  return std::equal(rhs.begin(), rhs.end(), values.begin());
+}
+
+bool InMemoryLabelPropertyCompositeIndex::CreateIndex(
+    LabelId label, const std::vector<PropertyId> &properties, utils::SkipList<Vertex>::Accessor vertices,
+    const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info) {
+  auto [it, emplaced] = index_.emplace(std::piecewise_construct, std::forward_as_tuple(label, properties),
+                                       std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return false;
+  }
+
+  const auto &key = it->first;
+  auto insert = [](Vertex &vertex, const Key &key, auto &index_accessor) {
+    TryInsertLabelPropertiesIndex(vertex, key, index_accessor);
+  };
+  if (parallel_exec_info) {
+    CreateIndexOnMultipleThreads(vertices, it, index_, key, *parallel_exec_info, insert);
+  } else {
+    CreateIndexOnSingleThread(vertices, it, index_, key, insert);
+  }
+
+  // A failed build erases the index, so it's added for the hooks only once
+  // it's built.
+  for (const auto property : key.second) {
+    indices_by_property_[property].emplace_back(&it->first, &it->second);
+  }
+  return true;
+}
+
+void InMemoryLabelPropertyCompositeIndex::UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update,
+                                                           const Transaction &tx) {
+  for (auto &[key, storage] : index_) {
+    if (key.first != added_label) {
+      continue;
+    }
+    auto values = IndexedValues(*vertex_after_update, key.second);
+    if (values) {
+      auto acc = storage.access();
+      acc.insert(Entry{std::move(*values), vertex_after_update, tx.start_timestamp});
+    }
+  }
+}
+
+void InMemoryLabelPropertyCompositeIndex::UpdateOnSetProperty(PropertyId property, const PropertyValue & /*value*/,
+                                                              Vertex *vertex, const Transaction &tx) {
+  auto indices = indices_by_property_.find(property);
+  if (indices == indices_by_property_.end()) {
+    return;
+  }
+
+  // Removing one of the other properties changes the key as well, so unlike
+  // the label-property index `Null` values aren't skipped.
+  for (const auto &[key, storage] : indices->second) {
+    if (!utils::Contains(vertex->labels, key->first)) {
+      continue;
+    }
+    auto values = IndexedValues(*vertex, key->second);
+    if (values) {
+      auto acc = storage->access();
+      acc.insert(Entry{std::move(*values), vertex, tx.start_timestamp});
+    }
+  }
+}
+
+bool InMemoryLabelPropertyCompositeIndex::DropIndex(LabelId label, const std::vector<PropertyId> &properties) {
+  auto it = index_.find({label, properties});
+  if (it == index_.end()) {
+    return false;
+  }
+  for (const auto property : properties) {
+    auto indices = indices_by_property_.find(property);
+    if (indices == indices_by_property_.end()) continue;
+    std::erase_if(indices->second, [&](const auto &index) { return index.first == &it->first; });
+    if (indices->second.empty()) {
+      indices_by_property_.erase(indices);
+    }
+  }
+  index_.erase(it);
+  return true;
+}
+
+bool InMemoryLabelPropertyCompositeIndex::IndexExists(LabelId label, const std::vector<PropertyId> &properties) const {
+  return index_.find({label, properties}) != index_.end();
+}
+
+std::vector<std::pair<LabelId, std::vector<PropertyId>>> InMemoryLabelPropertyCompositeIndex::ListIndices() const {
+  std::vector<std::pair<LabelId, std::vector<PropertyId>>> ret;
+  ret.reserve(index_.size());
+  for (const auto &item : index_) {
+    ret.push_back(item.first);
+  }
+  return ret;
+}
+
+void InMemoryLabelPropertyCompositeIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp,
+                                                                std::stop_token token) {
+  auto maybe_stop = utils::ResettableCounter<2048>();
+
+  for (auto &[key, index] : index_) {
+    const auto &[label_id, properties] = key;
+    if (token.stop_requested()) return;
+
+    auto index_acc = index.access();
+    auto it = index_acc.begin();
+    auto end_it = index_acc.end();
+    if (it == end_it) continue;
+    while (true) {
+      // Hot loop, don't check stop_requested every time
+      if (maybe_stop() && token.stop_requested()) return;
+
+      auto next_it = it;
+      ++next_it;
+
+      bool has_next = next_it != end_it;
+      if (it->timestamp < oldest_active_start_timestamp) {
+        bool redundant_duplicate = has_next && it->vertex == next_it->vertex && it->values == next_it->values;
+        if (redundant_duplicate || !AnyVersionHasLabelProperties(*it->vertex, label_id, properties, it->values,
+                                                                 oldest_active_start_timestamp)) {
+          index_acc.remove(*it);
+        }
+      }
+      if (!has_next) break;
+      it = next_it;
+    }
+  }
+}
+
+void InMemoryLabelPropertyCompositeIndex::AbortEntries(
+    const Key &key, std::span<std::pair<std::vector<PropertyValue>, Vertex *> const> vertices,
+    uint64_t exact_start_timestamp) {
+  auto const it = index_.find(key);
+  if (it == index_.end()) return;
+
+  auto index_acc = it->second.access();
+  for (const auto &[values, vertex] : vertices) {
+    index_acc.remove(Entry{values, vertex, exact_start_timestamp});
+  }
+}
+
+InMemoryLabelPropertyCompositeIndex::Iterable::Iterator::Iterator(Iterable *self,
+                                                                  utils::SkipList<Entry>::Iterator index_iterator)
+    : self_(self),
+      index_iterator_(index_iterator),
+      current_vertex_accessor_(nullptr, self_->storage_, nullptr),
+      current_vertex_(nullptr) {
+  AdvanceUntilValid();
+}
+
+InMemoryLabelPropertyCompositeIndex::Iterable::Iterator &
+InMemoryLabelPropertyCompositeIndex::Iterable::Iterator::operator++() {
+  ++index_iterator_;
+  AdvanceUntilValid();
+  return *this;
+}
+
+void InMemoryLabelPropertyCompositeIndex::Iterable::Iterator::AdvanceUntilValid() {
+  for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    if (index_iterator_->vertex == current_vertex_) {
+      continue;
+    }
+
+    // The scan starts at the prefix, so the first entry with a different
+    // prefix is past all of the matching entries.
+    if (!(*index_iterator_ == self_->prefix_)) {
+      index_iterator_ = self_->index_accessor_.end();
+      break;
+    }
+
+    // The bounds are only set if the index has a property after the prefix.
+    const auto &value = self_->lower_bound_ || self_->upper_bound_ ? index_iterator_->values[self_->prefix_.size()]
+                                                                   : index_iterator_->values.front();
+    if (self_->lower_bound_) {
+      if (value < self_->lower_bound_->value()) {
+        continue;
+      }
+      if (!self_->lower_bound_->IsInclusive() && value == self_->lower_bound_->value()) {
+        continue;
+      }
+    }
+    if (self_->upper_bound_) {
+      if (self_->upper_bound_->value() < value) {
+        index_iterator_ = self_->index_accessor_.end();
+        break;
+      }
+      if (!self_->upper_bound_->IsInclusive() && value == self_->upper_bound_->value()) {
+        index_iterator_ = self_->index_accessor_.end();
+        break;
+      }
+    }
+
+    if (CurrentVersionHasLabelProperties(*index_iterator_->vertex, self_->label_, self_->properties_,
+                                         index_iterator_->values, self_->transaction_, self_->view_)) {
+      current_vertex_ = index_iterator_->vertex;
+      current_vertex_accessor_ = VertexAccessor(current_vertex_, self_->storage_, self_->transaction_);
+      break;
+    }
+  }
+}
+
+InMemoryLabelPropertyCompositeIndex::Iterable::Iterable(
+    utils::SkipList<Entry>::Accessor index_accessor, utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
+    LabelId label, const std::vector<PropertyId> &properties, std::vector<PropertyValue> prefix,
+    const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
+    Transaction *transaction)
+    : pin_accessor_(std::move(vertices_accessor)),
+      index_accessor_(std::move(index_accessor)),
+      label_(label),
+      properties_(properties),
+      prefix_(std::move(prefix)),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound),
+      view_(view),
+      storage_(storage),
+      transaction_(transaction) {
+  // `Null` isn't indexed, so a prefix containing it matches nothing.
+  bounds_valid_ = std::ranges::none_of(prefix_, [](const auto &value) { return value.IsNull(); }) &&
+                  CompleteIndexScanBounds(lower_bound_, upper_bound_);
+}
+
+InMemoryLabelPropertyCompositeIndex::Iterable::Iterator InMemoryLabelPropertyCompositeIndex::Iterable::begin() {
+  // If the bounds are set and don't have comparable types we don't yield any
+  // items from the index.
+  if (!bounds_valid_) return {this, index_accessor_.end()};
+  auto index_iterator = index_accessor_.begin();
+  if (lower_bound_) {
+    auto key = prefix_;
+    key.push_back(lower_bound_->value());
+    index_iterator = index_accessor_.find_equal_or_greater(key);
+  } else if (!prefix_.empty()) {
+    index_iterator = index_accessor_.find_equal_or_greater(prefix_);
+  }
+  return {this, index_iterator};
+}
+
+InMemoryLabelPropertyCompositeIndex::Iterable::Iterator InMemoryLabelPropertyCompositeIndex::Iterable::end() {
+  return {this, index_accessor_.end()};
+}
+
+uint64_t InMemoryLabelPropertyCompositeIndex::ApproximateVertexCount(LabelId label,
+                                                                     const std::vector<PropertyId> &properties) const {
+  auto it = index_.find({label, properties});
+  MG_ASSERT(it != index_.end(), "Index for label {} and {} properties doesn't exist", label.AsUint(),
+            properties.size());
+  return it->second.size();
+}
+
+uint64_t InMemoryLabelPropertyCompositeIndex::ApproximateVertexCount(LabelId label,
+                                                                     const std::vector<PropertyId> &properties,
+                                                                     const std::vector<PropertyValue> &prefix) const {
+  auto it = index_.find({label, properties});
+  MG_ASSERT(it != index_.end(), "Index for label {} and {} properties doesn't exist", label.AsUint(),
+            properties.size());
+  auto acc = it->second.access();
+  if (prefix.empty()) {
+    return acc.size();
+  }
+  // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+  return acc.estimate_count(prefix, utils::SkipListLayerForCountEstimation(acc.size()));
+}
+
+void InMemoryLabelPropertyCompositeIndex::RunGC() {
+  for (auto &index_entry : index_) {
+    index_entry.second.run_gc();
+  }
+}
+
+InMemoryLabelPropertyCompositeIndex::Iterable InMemoryLabelPropertyCompositeIndex::Vertices(
+    LabelId label, const std::vector<PropertyId> &properties, std::vector<PropertyValue> prefix,
+    const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
+    Transaction *transaction) {
+  DMG_ASSERT(storage->storage_mode_ == StorageMode::IN_MEMORY_TRANSACTIONAL ||
+                 storage->storage_mode_ == StorageMode::IN_MEMORY_ANALYTICAL,
+             "PropertiesLabel index trying to access InMemory vertices from OnDisk!");
+  MG_ASSERT(prefix.size() + ((lower_bound || upper_bound) ? 1 : 0) <= properties.size(),
+            "Index scan has more values than the index has properties!");
+  auto vertices_acc = static_cast<InMemoryStorage const *>(storage)->vertices_.access();
+  auto it = index_.find({label, properties});
+  MG_ASSERT(it != index_.end(), "Index for label {} and {} properties doesn't exist", label.AsUint(),
+            properties.size());
+  return {it->second.access(), std::move(vertices_acc), label, properties, std::move(prefix), lower_bound,
+          upper_bound, view, storage, transaction};
+}
+
+}  // namespace memgraph::storage
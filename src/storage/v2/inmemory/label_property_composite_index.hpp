@@ -0,0 +1,143 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <map>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "storage/v2/durability/recovery_type.hpp"
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/indices/label_property_composite_index.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/vertex_accessor.hpp"
+#include "utils/bound.hpp"
+#include "utils/skip_list.hpp"
+
+namespace memgraph::storage {
+
+class InMemoryLabelPropertyCompositeIndex : public storage::LabelPropertyCompositeIndex {
+ private:
+  /// Values of the index properties in their order, missing values are
+  /// `Null`. Entries are ordered by the values first, so the entries with the
+  /// same prefix of values are next to each other.
+  struct Entry {
+    std::vector<PropertyValue> values;
+    Vertex *vertex;
+    uint64_t timestamp;
+
+    bool operator<(const Entry &rhs) const;
+    bool operator==(const Entry &rhs) const;
+
+    /// Compare only the first `rhs.size()` values.
+    bool operator<(const std::vector<PropertyValue> &rhs) const;
+    bool operator==(const std::vector<PropertyValue> &rhs) const;
+  };
+
+ public:
+  using Key = std::pair<LabelId, std::vector<PropertyId>>;
+
+  InMemoryLabelPropertyCompositeIndex() = default;
+
+  /// @throw std::bad_alloc
+  bool CreateIndex(LabelId label, const std::vector<PropertyId> &properties, utils::SkipList<Vertex>::Accessor vertices,
+                   const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info);
+
+  /// @throw std::bad_alloc
+  void UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx) override;
+
+  /// @throw std::bad_alloc
+  void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
+                           const Transaction &tx) override;
+
+  bool DropIndex(LabelId label, const std::vector<PropertyId> &properties) override;
+
+  bool IndexExists(LabelId label, const std::vector<PropertyId> &properties) const override;
+
+  std::vector<std::pair<LabelId, std::vector<PropertyId>>> ListIndices() const override;
+
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token);
+
+  /// `vertices` hold the values of the index properties the aborted
+  /// transaction indexed the vertices with.
+  void AbortEntries(const Key &key, std::span<std::pair<std::vector<PropertyValue>, Vertex *> const> vertices,
+                    uint64_t exact_start_timestamp);
+
+  class Iterable {
+   public:
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
+             LabelId label, const std::vector<PropertyId> &properties, std::vector<PropertyValue> prefix,
+             const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+             const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
+             Transaction *transaction);
+
+    class Iterator {
+     public:
+      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
+
+      VertexAccessor const &operator*() const { return current_vertex_accessor_; }
+
+      bool operator==(const Iterator &other) const { return index_iterator_ == other.index_iterator_; }
+      bool operator!=(const Iterator &other) const { return index_iterator_ != other.index_iterator_; }
+
+      Iterator &operator++();
+
+     private:
+      void AdvanceUntilValid();
+
+      Iterable *self_;
+      utils::SkipList<Entry>::Iterator index_iterator_;
+      VertexAccessor current_vertex_accessor_;
+      Vertex *current_vertex_;
+    };
+
+    Iterator begin();
+    Iterator end();
+
+   private:
+    utils::SkipList<Vertex>::ConstAccessor pin_accessor_;
+    utils::SkipList<Entry>::Accessor index_accessor_;
+    LabelId label_;
+    std::vector<PropertyId> properties_;
+    // Values of the first properties which the entries have to be equal to.
+    std::vector<PropertyValue> prefix_;
+    // Bounds of the property which follows the prefix.
+    std::optional<utils::Bound<PropertyValue>> lower_bound_;
+    std::optional<utils::Bound<PropertyValue>> upper_bound_;
+    bool bounds_valid_{true};
+    View view_;
+    Storage *storage_;
+    Transaction *transaction_;
+  };
+
+  uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties) const override;
+
+  uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                  const std::vector<PropertyValue> &prefix) const override;
+
+  void RunGC();
+
+  /// `prefix` holds the values of the first properties, and the bounds apply
+  /// to the property after them.
+  Iterable Vertices(LabelId label, const std::vector<PropertyId> &properties, std::vector<PropertyValue> prefix,
+                    const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
+                    Transaction *transaction);
+
+ private:
+  std::map<Key, utils::SkipList<Entry>> index_;
+  // Indices which contain the property, for the `UpdateOnSetProperty` hook.
+  std::unordered_map<PropertyId, std::vector<std::pair<const Key *, utils::SkipList<Entry> *>>> indices_by_property_;
+};
+
+}  // namespace memgraph::storage
@@ -0,0 +1,389 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/inmemory/label_property_hash_index.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <shared_mutex>
+
+#include "storage/v2/indices/indices_utils.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "utils/counter.hpp"
+#include "utils/fnv.hpp"
+#include "utils/logging.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+
+size_t HashDouble(double value) {
+  // -0.0 == 0.0, so both have to hash equally.
+  if (value == 0.0) value = 0.0;
+  return std::hash<double>{}(value);
+}
+
+/// NaN isn't equal to anything, itself included, so an entry with it could
+/// never be looked up nor removed.
+bool ContainsNaN(const PropertyValue &value) {
+  switch (value.type()) {
+    case PropertyValue::Type::Double:
+      return std::isnan(value.ValueDouble());
+    case PropertyValue::Type::List:
+      return std::ranges::any_of(value.ValueList(), ContainsNaN);
+    case PropertyValue::Type::Map:
+      return std::ranges::any_of(value.ValueMap(), [](const auto &item) { return ContainsNaN(item.second); });
+    default:
+      return false;
+  }
+}
+
+bool IsIndexable(const PropertyValue &value) { return !value.IsNull() && !ContainsNaN(value); }
+
+}  // namespace
+
+size_t PropertyValueHash::operator()(const PropertyValue &value) const {
+  switch (value.type()) {
+    case PropertyValue::Type::Null:
+      return 0;
+    case PropertyValue::Type::Bool:
+      return std::hash<bool>{}(value.ValueBool());
+    case PropertyValue::Type::Int:
+      // Integers are equal to doubles with the same value.
+      return HashDouble(static_cast<double>(value.ValueInt()));
+    case PropertyValue::Type::Double:
+      return HashDouble(value.ValueDouble());
+    case PropertyValue::Type::String:
+      return std::hash<std::string>{}(value.ValueString());
+    case PropertyValue::Type::List:
+      return utils::FnvCollection<std::vector<PropertyValue>, PropertyValue, PropertyValueHash>{}(value.ValueList());
+    case PropertyValue::Type::Map: {
+      size_t hash = 0;
+      for (const auto &[key, item] : value.ValueMap()) {
+        hash ^= utils::HashCombine<std::string, PropertyValue, std::hash<std::string>, PropertyValueHash>{}(key, item);
+      }
+      return hash;
+    }
+    case PropertyValue::Type::TemporalData: {
+      const auto temporal = value.ValueTemporalData();
+      return utils::HashCombine<uint8_t, int64_t>{}(static_cast<uint8_t>(temporal.type), temporal.microseconds);
+    }
+  }
+}
+
+void InMemoryLabelPropertyHashIndex::Index::Insert(const PropertyValue &value, Vertex *vertex, uint64_t timestamp) {
+  auto &shard = ShardFor(value);
+  auto guard = std::unique_lock{shard.lock};
+  auto [first, last] = shard.entries.equal_range(value);
+  const bool exists = std::any_of(first, last, [&](const auto &item) {
+    return item.second.vertex == vertex && item.second.timestamp == timestamp;
+  });
+  if (!exists) {
+    shard.entries.emplace(value, Entry{vertex, timestamp});
+  }
+}
+
+bool InMemoryLabelPropertyHashIndex::CreateIndex(LabelId label, PropertyId property,
+                                                 utils::SkipList<Vertex>::Accessor vertices) {
+  auto [it, emplaced] =
+      index_.emplace(std::piecewise_construct, std::forward_as_tuple(label, property), std::forward_as_tuple());
+  if (!emplaced) {
+    return false;
+  }
+  indices_by_property_[property].emplace_back(label, &it->second);
+
+  for (auto &vertex : vertices) {
+    if (vertex.deleted || !utils::Contains(vertex.labels, label)) continue;
+    auto value = vertex.properties.GetProperty(property);
+    if (!IsIndexable(value)) continue;
+    it->second.Insert(value, &vertex, 0);
+  }
+  return true;
+}
+
+void InMemoryLabelPropertyHashIndex::Clear() {
+  for (auto &[label_property, index] : index_) {
+    for (auto &shard : index.shards) {
+      auto guard = std::unique_lock{shard.lock};
+      shard.entries.clear();
+    }
+  }
+}
+
+void InMemoryLabelPropertyHashIndex::Rebuild(utils::SkipList<Vertex>::Accessor vertices) {
+  Clear();
+  for (auto &vertex : vertices) {
+    if (vertex.deleted) continue;
+    for (auto &[label_property, index] : index_) {
+      const auto &[label, property] = label_property;
+      if (!utils::Contains(vertex.labels, label)) continue;
+      auto value = vertex.properties.GetProperty(property);
+      if (!IsIndexable(value)) continue;
+      index.Insert(value, &vertex, 0);
+    }
+  }
+}
+
+std::vector<std::pair<LabelId, PropertyId>> InMemoryLabelPropertyHashIndex::ListIndices() const {
+  std::vector<std::pair<LabelId, PropertyId>> ret;
+  ret.reserve(index_.size());
+  for (const auto &[label_property, _] : index_) {
+    ret.push_back(label_property);
+  }
+  return ret;
+}
+
+void InMemoryLabelPropertyHashIndex::UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update,
+                                                      const Transaction &tx) {
+  for (auto &[label_property, index] : index_) {
+    if (label_property.first != added_label) {
+      continue;
+    }
+    auto value = vertex_after_update->properties.GetProperty(label_property.second);
+    if (IsIndexable(value)) {
+      index.Insert(value, vertex_after_update, tx.start_timestamp);
+    }
+  }
+}
+
+void InMemoryLabelPropertyHashIndex::UpdateOnSetProperty(PropertyId property, const PropertyValue &value,
+                                                         Vertex *vertex, const Transaction &tx) {
+  if (!IsIndexable(value)) {
+    return;
+  }
+
+  auto indices = indices_by_property_.find(property);
+  if (indices == indices_by_property_.end()) {
+    return;
+  }
+
+  for (const auto &[label, index] : indices->second) {
+    // The caller holds the vertex lock. Versions which had the label before
+    // it was removed in this transaction don't have this value, and the entry
+    // is added if the label is added back.
+    if (!utils::Contains(vertex->labels, label)) continue;
+    index->Insert(value, vertex, tx.start_timestamp);
+  }
+}
+
+void InMemoryLabelPropertyHashIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp,
+                                                           std::stop_token token) {
+  auto maybe_stop = utils::ResettableCounter<2048>();
+
+  for (auto &[label_property, index] : index_) {
+    const auto &[label, property] = label_property;
+    for (auto &shard : index.shards) {
+      if (token.stop_requested()) return;
+
+      // Entries are copied out of the shard because checking them takes the
+      // vertex locks, which writers hold while they lock the shard.
+      std::vector<std::pair<PropertyValue, Entry>> obsolete;
+      std::vector<std::pair<PropertyValue, Entry>> to_check;
+      {
+        auto guard = std::shared_lock{shard.lock};
+        for (auto it = shard.entries.begin(); it != shard.entries.end();) {
+          // Entries with equal values are adjacent.
+          auto [first, last] = shard.entries.equal_range(it->first);
+          it = last;
+          // If a vertex has several entries for the value, only the newest
+          // one which no active transaction added has to be kept.
+          std::unordered_map<Vertex *, uint64_t> newest;
+          if (std::next(first) != last) {
+            for (auto item = first; item != last; ++item) {
+              if (item->second.timestamp >= oldest_active_start_timestamp) continue;
+              auto &timestamp = newest[item->second.vertex];
+              timestamp = std::max(timestamp, item->second.timestamp);
+            }
+          }
+          for (auto item = first; item != last; ++item) {
+            if (item->second.timestamp >= oldest_active_start_timestamp) continue;
+            auto found = newest.find(item->second.vertex);
+            if (found != newest.end() && found->second > item->second.timestamp) {
+              obsolete.emplace_back(item->first, item->second);
+            } else {
+              to_check.emplace_back(item->first, item->second);
+            }
+          }
+        }
+      }
+
+      for (auto &candidate : to_check) {
+        // Hot loop, don't check stop_requested every time
+        if (maybe_stop() && token.stop_requested()) return;
+        const auto &[value, entry] = candidate;
+        if (!AnyVersionHasLabelProperty(*entry.vertex, label, property, value, oldest_active_start_timestamp)) {
+          obsolete.push_back(std::move(candidate));
+        }
+      }
+
+      if (obsolete.empty()) continue;
+      auto guard = std::unique_lock{shard.lock};
+      for (const auto &[value, entry] : obsolete) {
+        auto [first, last] = shard.entries.equal_range(value);
+        auto found = std::find_if(first, last, [&](const auto &item) {
+          return item.second.vertex == entry.vertex && item.second.timestamp == entry.timestamp;
+        });
+        if (found != last) {
+          shard.entries.erase(found);
+        }
+      }
+    }
+  }
+}
+
+void InMemoryLabelPropertyHashIndex::AbortEntries(PropertyId property,
+                                                  std::span<std::pair<PropertyValue, Vertex *> const> vertices,
+                                                  uint64_t exact_start_timestamp) {
+  auto const indices = indices_by_property_.find(property);
+  if (indices == indices_by_property_.end()) return;
+
+  for (const auto &[_, index] : indices->second) {
+    for (const auto &[value, vertex] : vertices) {
+      if (!IsIndexable(value)) continue;
+      auto &shard = index->ShardFor(value);
+      auto guard = std::unique_lock{shard.lock};
+      auto [first, last] = shard.entries.equal_range(value);
+      auto found = std::find_if(first, last, [&](const auto &item) {
+        return item.second.vertex == vertex && item.second.timestamp == exact_start_timestamp;
+      });
+      if (found != last) {
+        shard.entries.erase(found);
+      }
+    }
+  }
+}
+
+void InMemoryLabelPropertyHashIndex::AbortEntries(LabelId label,
+                                                  std::span<std::pair<PropertyValue, Vertex *> const> vertices,
+                                                  uint64_t exact_start_timestamp) {
+  for (auto &[label_property, index] : index_) {
+    if (label_property.first != label) {
+      continue;
+    }
+    for (const auto &[value, vertex] : vertices) {
+      if (!IsIndexable(value)) continue;
+      auto &shard = index.ShardFor(value);
+      auto guard = std::unique_lock{shard.lock};
+      auto [first, last] = shard.entries.equal_range(value);
+      auto found = std::find_if(first, last, [&](const auto &item) {
+        return item.second.vertex == vertex && item.second.timestamp == exact_start_timestamp;
+      });
+      if (found != last) {
+        shard.entries.erase(found);
+      }
+    }
+  }
+}
+
+uint64_t InMemoryLabelPropertyHashIndex::ApproximateVertexCount(LabelId label, PropertyId property) const {
+  auto it = index_.find({label, property});
+  MG_ASSERT(it != index_.end(), "Hash index for label {} and property {} doesn't exist", label.AsUint(),
+            property.AsUint());
+  uint64_t count = 0;
+  for (const auto &shard : it->second.shards) {
+    auto guard = std::shared_lock{shard.lock};
+    count += shard.entries.size();
+  }
+  return count;
+}
+
+uint64_t InMemoryLabelPropertyHashIndex::ApproximateVertexCount(LabelId label, PropertyId property,
+                                                                const PropertyValue &value) const {
+  auto it = index_.find({label, property});
+  MG_ASSERT(it != index_.end(), "Hash index for label {} and property {} doesn't exist", label.AsUint(),
+            property.AsUint());
+  if (!value.IsNull()) {
+    if (ContainsNaN(value)) return 0;
+    const auto &shard = it->second.ShardFor(value);
+    auto guard = std::shared_lock{shard.lock};
+    return shard.entries.count(value);
+  }
+  // As in the skip list index, `Null` asks for the average number of entries
+  // with equal values. That takes a pass over the entries.
+  uint64_t entries = 0;
+  uint64_t values = 0;
+  for (const auto &shard : it->second.shards) {
+    auto guard = std::shared_lock{shard.lock};
+    entries += shard.entries.size();
+    // Entries with equal values are adjacent.
+    for (auto item = shard.entries.begin(); item != shard.entries.end();
+         item = shard.entries.equal_range(item->first).second) {
+      ++values;
+    }
+  }
+  return values == 0 ? 0 : entries / values;
+}
+
+InMemoryLabelPropertyHashIndex::Iterable::Iterable(utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
+                                                   std::vector<Vertex *> vertices, LabelId label, PropertyId property,
+                                                   PropertyValue value, View view, Storage *storage,
+                                                   Transaction *transaction)
+    : pin_accessor_(std::move(vertices_accessor)),
+      vertices_(std::move(vertices)),
+      label_(label),
+      property_(property),
+      value_(std::move(value)),
+      view_(view),
+      storage_(storage),
+      transaction_(transaction) {}
+
+InMemoryLabelPropertyHashIndex::Iterable::Iterator::Iterator(Iterable *self, std::vector<Vertex *>::const_iterator it)
+    : self_(self), it_(it), current_vertex_accessor_(nullptr, self_->storage_, nullptr) {
+  AdvanceUntilValid();
+}
+
+InMemoryLabelPropertyHashIndex::Iterable::Iterator &InMemoryLabelPropertyHashIndex::Iterable::Iterator::operator++() {
+  ++it_;
+  AdvanceUntilValid();
+  return *this;
+}
+
+void InMemoryLabelPropertyHashIndex::Iterable::Iterator::AdvanceUntilValid() {
+  for (; it_ != self_->vertices_.cend(); ++it_) {
+    if (CurrentVersionHasLabelProperty(**it_, self_->label_, self_->property_, self_->value_, self_->transaction_,
+                                       self_->view_)) {
+      current_vertex_accessor_ = VertexAccessor(*it_, self_->storage_, self_->transaction_);
+      break;
+    }
+  }
+}
+
+InMemoryLabelPropertyHashIndex::Iterable InMemoryLabelPropertyHashIndex::Vertices(LabelId label, PropertyId property,
+                                                                                  const PropertyValue &value,
+                                                                                  View view, Storage *storage,
+                                                                                  Transaction *transaction) const {
+  DMG_ASSERT(storage->storage_mode_ == StorageMode::IN_MEMORY_TRANSACTIONAL ||
+                 storage->storage_mode_ == StorageMode::IN_MEMORY_ANALYTICAL,
+             "Hash index trying to access InMemory vertices from OnDisk!");
+  // The vertices are pinned before the entries are read, so GC can't free a
+  // vertex whose entry is read.
+  auto vertices_acc = static_cast<InMemoryStorage const *>(storage)->vertices_.access();
+  auto it = index_.find({label, property});
+  MG_ASSERT(it != index_.end(), "Hash index for label {} and property {} doesn't exist", label.AsUint(),
+            property.AsUint());
+
+  std::vector<Vertex *> vertices;
+  if (IsIndexable(value)) {
+    const auto &shard = it->second.ShardFor(value);
+    auto guard = std::shared_lock{shard.lock};
+    auto [first, last] = shard.entries.equal_range(value);
+    for (; first != last; ++first) {
+      vertices.push_back(first->second.vertex);
+    }
+  }
+  // A vertex can have several entries for the value, but is returned once.
+  std::ranges::sort(vertices);
+  vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+  return {std::move(vertices_acc), std::move(vertices), label, property, value, view, storage, transaction};
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,182 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <array>
+#include <map>
+#include <span>
+#include <stop_token>
+#include <unordered_map>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/transaction.hpp"
+#include "storage/v2/vertex.hpp"
+#include "storage/v2/vertex_accessor.hpp"
+#include "storage/v2/view.hpp"
+#include "utils/rw_spin_lock.hpp"
+#include "utils/skip_list.hpp"
+
+namespace memgraph::storage {
+
+class Storage;
+
+/// Hashes property values consistently with `operator==` on `PropertyValue`:
+/// integers and doubles which compare equal hash equally.
+struct PropertyValueHash {
+  size_t operator()(const PropertyValue &value) const;
+};
+
+/// Label+property index which only answers equality lookups. Unlike
+/// `InMemoryLabelPropertyIndex`, the entries are kept in hash tables, so a
+/// lookup hashes the value once instead of comparing it against the values
+/// along a skip list search. That's meant for properties which identify a
+/// vertex, such as external ids used by MERGE.
+///
+/// Entries follow the same rules as the skip list indices: an entry is added
+/// whenever a vertex may have the label and the value, it's checked against
+/// the vertex when it's read, and it's removed by GC once no transaction can
+/// see the vertex with the label and the value, or when the transaction which
+/// added it aborts.
+///
+/// Indices are declared in the storage config and are only added or rebuilt
+/// with unique access to the storage.
+class InMemoryLabelPropertyHashIndex {
+ private:
+  struct Entry {
+    Vertex *vertex;
+    uint64_t timestamp;
+  };
+
+  static constexpr size_t kShardCount = 64;
+
+  /// A part of the index with its own lock. Writers lock a shard while they
+  /// hold the lock of the vertex they modify, so a shard lock must never be
+  /// held while taking a vertex lock.
+  struct Shard {
+    mutable utils::RWSpinLock lock;
+    std::unordered_multimap<PropertyValue, Entry, PropertyValueHash> entries;
+  };
+
+  struct Index {
+    Shard &ShardFor(const PropertyValue &value) { return shards[PropertyValueHash{}(value) % kShardCount]; }
+    const Shard &ShardFor(const PropertyValue &value) const {
+      return shards[PropertyValueHash{}(value) % kShardCount];
+    }
+
+    /// Adds an entry unless the same one exists.
+    /// @throw std::bad_alloc
+    void Insert(const PropertyValue &value, Vertex *vertex, uint64_t timestamp);
+
+    std::array<Shard, kShardCount> shards;
+  };
+
+ public:
+  InMemoryLabelPropertyHashIndex() = default;
+
+  InMemoryLabelPropertyHashIndex(const InMemoryLabelPropertyHashIndex &) = delete;
+  InMemoryLabelPropertyHashIndex(InMemoryLabelPropertyHashIndex &&) = delete;
+  InMemoryLabelPropertyHashIndex &operator=(const InMemoryLabelPropertyHashIndex &) = delete;
+  InMemoryLabelPropertyHashIndex &operator=(InMemoryLabelPropertyHashIndex &&) = delete;
+  ~InMemoryLabelPropertyHashIndex() = default;
+
+  /// Adds an index and fills it from `vertices`. Returns false if the index
+  /// already exists.
+  /// @throw std::bad_alloc
+  bool CreateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices);
+
+  /// Refills all indices from `vertices`, e.g. after a replica loaded a
+  /// snapshot.
+  /// @throw std::bad_alloc
+  void Rebuild(utils::SkipList<Vertex>::Accessor vertices);
+
+  /// Removes all entries but keeps the indices. Has to be called before the
+  /// vertices are cleared.
+  void Clear();
+
+  bool IndexExists(LabelId label, PropertyId property) const { return index_.contains({label, property}); }
+
+  bool Empty() const { return index_.empty(); }
+
+  std::vector<std::pair<LabelId, PropertyId>> ListIndices() const;
+
+  /// @throw std::bad_alloc
+  void UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx);
+
+  /// @throw std::bad_alloc
+  void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex, const Transaction &tx);
+
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token);
+
+  void AbortEntries(PropertyId property, std::span<std::pair<PropertyValue, Vertex *> const> vertices,
+                    uint64_t exact_start_timestamp);
+  void AbortEntries(LabelId label, std::span<std::pair<PropertyValue, Vertex *> const> vertices,
+                    uint64_t exact_start_timestamp);
+
+  /// Returns the number of entries for the label and property, which is an
+  /// over-estimate of the number of vertices.
+  uint64_t ApproximateVertexCount(LabelId label, PropertyId property) const;
+
+  /// Returns the number of entries with `value`. If `value` is `Null`, the
+  /// average number of entries per distinct value is returned.
+  uint64_t ApproximateVertexCount(LabelId label, PropertyId property, const PropertyValue &value) const;
+
+  class Iterable {
+   public:
+    Iterable(utils::SkipList<Vertex>::ConstAccessor vertices_accessor, std::vector<Vertex *> vertices, LabelId label,
+             PropertyId property, PropertyValue value, View view, Storage *storage, Transaction *transaction);
+
+    class Iterator {
+     public:
+      Iterator(Iterable *self, std::vector<Vertex *>::const_iterator it);
+
+      VertexAccessor const &operator*() const { return current_vertex_accessor_; }
+
+      bool operator==(const Iterator &other) const { return it_ == other.it_; }
+      bool operator!=(const Iterator &other) const { return it_ != other.it_; }
+
+      Iterator &operator++();
+
+     private:
+      void AdvanceUntilValid();
+
+      Iterable *self_;
+      std::vector<Vertex *>::const_iterator it_;
+      VertexAccessor current_vertex_accessor_;
+    };
+
+    Iterator begin() { return {this, vertices_.cbegin()}; }
+    Iterator end() { return {this, vertices_.cend()}; }
+
+   private:
+    utils::SkipList<Vertex>::ConstAccessor pin_accessor_;
+    // Candidates copied out of the index, so no shard lock is held while the
+    // result is consumed.
+    std::vector<Vertex *> vertices_;
+    LabelId label_;
+    PropertyId property_;
+    PropertyValue value_;
+    View view_;
+    Storage *storage_;
+    Transaction *transaction_;
+  };
+
+  Iterable Vertices(LabelId label, PropertyId property, const PropertyValue &value, View view, Storage *storage,
+                    Transaction *transaction) const;
+
+ private:
+  std::map<std::pair<LabelId, PropertyId>, Index> index_;
+  std::unordered_map<PropertyId, std::vector<std::pair<LabelId, Index *>>> indices_by_property_;
+};
+
+}  // namespace memgraph::storage
@@ -56,11 +56,10 @@ bool InMemoryLabelPropertyIndex::CreateIndex(
       [this](LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor &vertices,
              std::map<std::pair<LabelId, PropertyId>, utils::SkipList<Entry>>::iterator label_property_it,
              const durability::ParallelizedSchemaCreationInfo &parallel_exec_info) {
-        using IndexAccessor = decltype(label_property_it->second.access());
-
+        // The entries are inserted either into the index or into a sorted run.
         CreateIndexOnMultipleThreads(
             vertices, label_property_it, index_, std::make_pair(label, property), parallel_exec_info,
-            [](Vertex &vertex, std::pair<LabelId, PropertyId> key, IndexAccessor &index_accessor) {
+            [](Vertex &vertex, std::pair<LabelId, PropertyId> key, auto &index_accessor) {
               TryInsertLabelPropertyIndex(vertex, key, index_accessor);
             });
 
@@ -73,8 +72,18 @@ bool InMemoryLabelPropertyIndex::CreateIndex(
   indices_by_property_[property].insert({label, &it->second});
 
   if (!emplaced) {
-    // Index already exists.
-    return false;
+    auto registered = registered_.find({label, property});
+    if (registered == registered_.end()) {
+      // Index already exists.
+      return false;
+    }
+    // The index was registered and only has to be populated if that didn't
+    // finish.
+    const bool populated = registered->second.load(std::memory_order_acquire);
+    registered_.erase(registered);
+    if (populated) {
+      return true;
+    }
   }
 
   if (parallel_exec_info) {
@@ -84,6 +93,33 @@ bool InMemoryLabelPropertyIndex::CreateIndex(
   return create_index_seq(label, property, vertices, it);
 }
 
+bool InMemoryLabelPropertyIndex::RegisterIndex(LabelId label, PropertyId property) {
+  auto [it, emplaced] =
+      index_.emplace(std::piecewise_construct, std::forward_as_tuple(label, property), std::forward_as_tuple());
+  if (!emplaced) {
+    return false;
+  }
+  indices_by_property_[property].insert({label, &it->second});
+  registered_.emplace(std::piecewise_construct, std::forward_as_tuple(label, property), std::forward_as_tuple(false));
+  return true;
+}
+
+void InMemoryLabelPropertyIndex::PopulateIndex(LabelId label, PropertyId property,
+                                               utils::SkipList<Vertex>::Accessor vertices, uint64_t timestamp) {
+  auto registered = registered_.find({label, property});
+  if (registered == registered_.end()) {
+    return;
+  }
+  // Unlike `CreateIndexOnSingleThread`, the index isn't dropped on failure
+  // because that requires unique access.
+  utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+  auto acc = index_.at({label, property}).access();
+  for (Vertex &vertex : vertices) {
+    TryInsertLabelPropertyIndexOnline(vertex, {label, property}, timestamp, acc);
+  }
+  registered->second.store(true, std::memory_order_release);
+}
+
 void InMemoryLabelPropertyIndex::UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update,
                                                   const Transaction &tx) {
   for (auto &[label_prop, storage] : index_) {
@@ -124,17 +160,27 @@ bool InMemoryLabelPropertyIndex::DropIndex(LabelId label, PropertyId property) {
     }
   }
 
+  // A registered index doesn't exist yet, but it's dropped all the same.
+  registered_.erase({label, property});
   return index_.erase({label, property}) > 0;
 }
 
+bool InMemoryLabelPropertyIndex::DropRegisteredIndex(LabelId label, PropertyId property) {
+  if (registered_.erase({label, property}) == 0) {
+    return false;
+  }
+  return DropIndex(label, property);
+}
+
 bool InMemoryLabelPropertyIndex::IndexExists(LabelId label, PropertyId property) const {
-  return index_.find({label, property}) != index_.end();
+  return index_.find({label, property}) != index_.end() && !registered_.contains({label, property});
 }
 
 std::vector<std::pair<LabelId, PropertyId>> InMemoryLabelPropertyIndex::ListIndices() const {
   std::vector<std::pair<LabelId, PropertyId>> ret;
   ret.reserve(index_.size());
   for (const auto &item : index_) {
+    if (registered_.contains(item.first)) continue;
     ret.push_back(item.first);
   }
   return ret;
@@ -235,21 +281,8 @@ const PropertyValue kSmallestMap = PropertyValue(std::map<std::string, PropertyV
 const PropertyValue kSmallestTemporalData =
     PropertyValue(TemporalData{static_cast<TemporalType>(0), std::numeric_limits<int64_t>::min()});
 
-InMemoryLabelPropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor,
-                                               utils::SkipList<Vertex>::ConstAccessor vertices_accessor, LabelId label,
-                                               PropertyId property,
-                                               const std::optional<utils::Bound<PropertyValue>> &lower_bound,
-                                               const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view,
-                                               Storage *storage, Transaction *transaction)
-    : pin_accessor_(std::move(vertices_accessor)),
-      index_accessor_(std::move(index_accessor)),
-      label_(label),
-      property_(property),
-      lower_bound_(lower_bound),
-      upper_bound_(upper_bound),
-      view_(view),
-      storage_(storage),
-      transaction_(transaction) {
+bool CompleteIndexScanBounds(std::optional<utils::Bound<PropertyValue>> &lower,
+                             std::optional<utils::Bound<PropertyValue>> &upper) {
   // We have to fix the bounds that the user provided to us. If the user
   // provided only one bound we should make sure that only values of that type
   // are returned by the iterator. We ensure this by supplying either an
@@ -265,83 +298,100 @@ InMemoryLabelPropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor
   static_assert(PropertyValue::Type::List < PropertyValue::Type::Map);
 
   // Remove any bounds that are set to `Null` because that isn't a valid value.
-  if (lower_bound_ && lower_bound_->value().IsNull()) {
-    lower_bound_ = std::nullopt;
+  if (lower && lower->value().IsNull()) {
+    lower = std::nullopt;
   }
-  if (upper_bound_ && upper_bound_->value().IsNull()) {
-    upper_bound_ = std::nullopt;
+  if (upper && upper->value().IsNull()) {
+    upper = std::nullopt;
   }
 
   // Check whether the bounds are of comparable types if both are supplied.
-  if (lower_bound_ && upper_bound_ &&
-      !PropertyValue::AreComparableTypes(lower_bound_->value().type(), upper_bound_->value().type())) {
-    bounds_valid_ = false;
-    return;
+  if (lower && upper && !PropertyValue::AreComparableTypes(lower->value().type(), upper->value().type())) {
+    return false;
   }
 
   // Set missing bounds.
-  if (lower_bound_ && !upper_bound_) {
+  if (lower && !upper) {
     // Here we need to supply an upper bound. The upper bound is set to an
     // exclusive lower bound of the following type.
-    switch (lower_bound_->value().type()) {
+    switch (lower->value().type()) {
       case PropertyValue::Type::Null:
         // This shouldn't happen because of the nullopt-ing above.
         LOG_FATAL("Invalid database state!");
         break;
       case PropertyValue::Type::Bool:
-        upper_bound_ = utils::MakeBoundExclusive(kSmallestNumber);
+        upper = utils::MakeBoundExclusive(kSmallestNumber);
         break;
       case PropertyValue::Type::Int:
       case PropertyValue::Type::Double:
         // Both integers and doubles are treated as the same type in
         // `PropertyValue` and they are interleaved when sorted.
-        upper_bound_ = utils::MakeBoundExclusive(kSmallestString);
+        upper = utils::MakeBoundExclusive(kSmallestString);
         break;
       case PropertyValue::Type::String:
-        upper_bound_ = utils::MakeBoundExclusive(kSmallestList);
+        upper = utils::MakeBoundExclusive(kSmallestList);
         break;
       case PropertyValue::Type::List:
-        upper_bound_ = utils::MakeBoundExclusive(kSmallestMap);
+        upper = utils::MakeBoundExclusive(kSmallestMap);
         break;
       case PropertyValue::Type::Map:
-        upper_bound_ = utils::MakeBoundExclusive(kSmallestTemporalData);
+        upper = utils::MakeBoundExclusive(kSmallestTemporalData);
         break;
       case PropertyValue::Type::TemporalData:
         // This is the last type in the order so we leave the upper bound empty.
         break;
     }
   }
-  if (upper_bound_ && !lower_bound_) {
+  if (upper && !lower) {
     // Here we need to supply a lower bound. The lower bound is set to an
     // inclusive lower bound of the current type.
-    switch (upper_bound_->value().type()) {
+    switch (upper->value().type()) {
       case PropertyValue::Type::Null:
         // This shouldn't happen because of the nullopt-ing above.
         LOG_FATAL("Invalid database state!");
         break;
       case PropertyValue::Type::Bool:
-        lower_bound_ = utils::MakeBoundInclusive(kSmallestBool);
+        lower = utils::MakeBoundInclusive(kSmallestBool);
         break;
       case PropertyValue::Type::Int:
       case PropertyValue::Type::Double:
         // Both integers and doubles are treated as the same type in
         // `PropertyValue` and they are interleaved when sorted.
-        lower_bound_ = utils::MakeBoundInclusive(kSmallestNumber);
+        lower = utils::MakeBoundInclusive(kSmallestNumber);
         break;
       case PropertyValue::Type::String:
-        lower_bound_ = utils::MakeBoundInclusive(kSmallestString);
+        lower = utils::MakeBoundInclusive(kSmallestString);
         break;
       case PropertyValue::Type::List:
-        lower_bound_ = utils::MakeBoundInclusive(kSmallestList);
+        lower = utils::MakeBoundInclusive(kSmallestList);
         break;
       case PropertyValue::Type::Map:
-        lower_bound_ = utils::MakeBoundInclusive(kSmallestMap);
+        lower = utils::MakeBoundInclusive(kSmallestMap);
         break;
       case PropertyValue::Type::TemporalData:
-        lower_bound_ = utils::MakeBoundInclusive(kSmallestTemporalData);
+        lower = utils::MakeBoundInclusive(kSmallestTemporalData);
         break;
     }
   }
+  return true;
+}
+
+InMemoryLabelPropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor,
+                                               utils::SkipList<Vertex>::ConstAccessor vertices_accessor, LabelId label,
+                                               PropertyId property,
+                                               const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                               const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view,
+                                               Storage *storage, Transaction *transaction)
+    : pin_accessor_(std::move(vertices_accessor)),
+      index_accessor_(std::move(index_accessor)),
+      label_(label),
+      property_(property),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound),
+      view_(view),
+      storage_(storage),
+      transaction_(transaction) {
+  bounds_valid_ = CompleteIndexScanBounds(lower_bound_, upper_bound_);
 }
 
 InMemoryLabelPropertyIndex::Iterable::Iterator InMemoryLabelPropertyIndex::Iterable::begin() {
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <span>
 
 #include "storage/v2/constraints/constraints.hpp"
@@ -24,6 +25,12 @@
 
 namespace memgraph::storage {
 
+/// Sets a missing bound of an index scan so that only values of the type of
+/// the other bound are scanned. Returns false if the bounds have incomparable
+/// types and the scan is empty.
+bool CompleteIndexScanBounds(std::optional<utils::Bound<PropertyValue>> &lower,
+                             std::optional<utils::Bound<PropertyValue>> &upper);
+
 class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
  private:
   struct Entry {
@@ -54,8 +61,26 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
   void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
                            const Transaction &tx) override;
 
+  /// Adds an empty index which writers keep up to date, but which isn't visible
+  /// until it's created with `CreateIndex`. Requires unique access to the
+  /// storage. Returns false if the index already exists.
+  /// @throw std::bad_alloc
+  bool RegisterIndex(LabelId label, PropertyId property);
+
+  /// Fills a registered index while other transactions modify the vertices.
+  /// `timestamp` is the start timestamp of the transaction which reads the
+  /// vertices. Does nothing if the index isn't registered.
+  /// @throw std::bad_alloc
+  void PopulateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
+                     uint64_t timestamp);
+
   bool DropIndex(LabelId label, PropertyId property) override;
 
+  /// Drops the index only if it's registered and not created yet, so that an
+  /// interrupted online build doesn't leave it behind. Requires unique access
+  /// to the storage. Returns false if there was no such index.
+  bool DropRegisteredIndex(LabelId label, PropertyId property);
+
   bool IndexExists(LabelId label, PropertyId property) const override;
 
   std::vector<std::pair<LabelId, PropertyId>> ListIndices() const override;
@@ -157,6 +182,9 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
  private:
   std::map<std::pair<LabelId, PropertyId>, utils::SkipList<Entry>> index_;
   std::unordered_map<PropertyId, std::unordered_map<LabelId, utils::SkipList<Entry> *>> indices_by_property_;
+  // Registered indices which aren't created yet, with whether they are
+  // populated. The map is only changed with unique access to the storage.
+  std::map<std::pair<LabelId, PropertyId>, std::atomic<bool>> registered_;
   utils::Synchronized<std::map<std::pair<LabelId, PropertyId>, storage::LabelPropertyIndexStats>,
                       utils::ReadPrioritizedRWLock>
       stats_;
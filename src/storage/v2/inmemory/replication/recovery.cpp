@@ -28,7 +28,7 @@ namespace memgraph::storage {
 class InMemoryCurrentWalHandler {
  public:
   explicit InMemoryCurrentWalHandler(const utils::UUID &main_uuid, InMemoryStorage const *storage,
-                                     rpc::Client &rpc_client);
+                                     rpc::Client &rpc_client, bool compress);
   void AppendFilename(const std::string &filename);
 
   void AppendSize(size_t size);
@@ -46,8 +46,10 @@ class InMemoryCurrentWalHandler {
 
 ////// CurrentWalHandler //////
 InMemoryCurrentWalHandler::InMemoryCurrentWalHandler(const utils::UUID &main_uuid, InMemoryStorage const *storage,
-                                                     rpc::Client &rpc_client)
-    : stream_(rpc_client.Stream<replication::CurrentWalRpc>(main_uuid, storage->uuid())) {}
+                                                     rpc::Client &rpc_client, bool compress)
+    : stream_(rpc_client.Stream<replication::CurrentWalRpc>(main_uuid, storage->uuid())) {
+  if (compress) stream_.GetBuilder()->EnableCompression();
+}
 
 void InMemoryCurrentWalHandler::AppendFilename(const std::string &filename) {
   replication::Encoder encoder(stream_.GetBuilder());
@@ -73,9 +75,10 @@ replication::CurrentWalRes InMemoryCurrentWalHandler::Finalize() { return stream
 
 ////// ReplicationClient Helpers //////
 replication::WalFilesRes TransferWalFiles(const utils::UUID &main_uuid, const utils::UUID &uuid, rpc::Client &client,
-                                          const std::vector<std::filesystem::path> &wal_files) {
+                                          const std::vector<std::filesystem::path> &wal_files, bool compress) {
   MG_ASSERT(!wal_files.empty(), "Wal files list is empty!");
   auto stream = client.Stream<replication::WalFilesRpc>(main_uuid, uuid, wal_files.size());
+  if (compress) stream.GetBuilder()->EnableCompression();
   replication::Encoder encoder(stream.GetBuilder());
   for (const auto &wal : wal_files) {
     spdlog::debug("Sending wal file: {}", wal);
@@ -85,16 +88,17 @@ replication::WalFilesRes TransferWalFiles(const utils::UUID &main_uuid, const ut
 }
 
 replication::SnapshotRes TransferSnapshot(const utils::UUID &main_uuid, const utils::UUID &uuid, rpc::Client &client,
-                                          const std::filesystem::path &path) {
+                                          const std::filesystem::path &path, bool compress) {
   auto stream = client.Stream<replication::SnapshotRpc>(main_uuid, uuid);
+  if (compress) stream.GetBuilder()->EnableCompression();
   replication::Encoder encoder(stream.GetBuilder());
   encoder.WriteFile(path);
   return stream.AwaitResponse();
 }
 
 uint64_t ReplicateCurrentWal(const utils::UUID &main_uuid, const InMemoryStorage *storage, rpc::Client &client,
-                             durability::WalFile const &wal_file) {
-  InMemoryCurrentWalHandler stream{main_uuid, storage, client};
+                             durability::WalFile const &wal_file, bool compress) {
+  InMemoryCurrentWalHandler stream{main_uuid, storage, client, compress};
   stream.AppendFilename(wal_file.Path().filename());
   utils::InputFile file;
   MG_ASSERT(file.Open(wal_file.Path()), "Failed to open current WAL file at {}!", wal_file.Path());
@@ -138,7 +142,7 @@ std::vector<RecoveryStep> GetRecoverySteps(uint64_t replica_commit, utils::FileR
   std::optional<uint64_t> current_wal_from_timestamp;
 
   std::unique_lock transaction_guard(
-      storage->engine_lock_);  // Hold the storage lock so the current wal file cannot be changed
+      storage->commit_sequencer_);  // Hold the commit sequencer so the current wal file cannot be changed
   (void)locker_acc.AddPath(storage->recovery_.wal_directory_);  // Protect all WALs from being deleted
 
   if (storage->wal_file_) {
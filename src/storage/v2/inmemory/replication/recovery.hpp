@@ -20,13 +20,13 @@ class InMemoryStorage;
 ////// ReplicationClient Helpers //////
 
 replication::WalFilesRes TransferWalFiles(const utils::UUID &main_uuid, const utils::UUID &uuid, rpc::Client &client,
-                                          const std::vector<std::filesystem::path> &wal_files);
+                                          const std::vector<std::filesystem::path> &wal_files, bool compress);
 
 replication::SnapshotRes TransferSnapshot(const utils::UUID &main_uuid, const utils::UUID &uuid, rpc::Client &client,
-                                          const std::filesystem::path &path);
+                                          const std::filesystem::path &path, bool compress);
 
 uint64_t ReplicateCurrentWal(const utils::UUID &main_uuid, const InMemoryStorage *storage, rpc::Client &client,
-                             durability::WalFile const &wal_file);
+                             durability::WalFile const &wal_file, bool compress);
 
 auto GetRecoverySteps(uint64_t replica_commit, utils::FileRetainer::FileLocker *file_locker,
                       const InMemoryStorage *storage) -> std::vector<RecoveryStep>;
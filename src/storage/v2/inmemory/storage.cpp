@@ -14,6 +14,7 @@
 #include <filesystem>
 #include <functional>
 #include <optional>
+#include <type_traits>
 #include "dbms/constants.hpp"
 #include "flags/experimental.hpp"
 #include "flags/run_time_configurable.hpp"
@@ -23,6 +24,7 @@
 #include "storage/v2/edge_direction.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/inmemory/edge_type_index.hpp"
+#include "storage/v2/inmemory/edge_type_property_index.hpp"
 #include "storage/v2/metadata_delta.hpp"
 
 /// REPLICATION ///
@@ -34,10 +36,56 @@
 #include "utils/resource_lock.hpp"
 #include "utils/stat.hpp"
 
+namespace memgraph::metrics {
+extern const Event GCLatency_us;
+extern const Event GCDeltaUnlinkLatency_us;
+extern const Event GCIndexCleanupLatency_us;
+extern const Event GCObjectCleanupLatency_us;
+extern const Event GCSkipListCleanupLatency_us;
+}  // namespace memgraph::metrics
+
 namespace memgraph::storage {
 
 namespace {
 
+/// Runs the tasks of a GC phase on the GC thread pool, or right away on the
+/// calling thread if the GC has no pool.
+class GcTasks final {
+ public:
+  explicit GcTasks(std::optional<utils::ThreadPool> &pool) {
+    if (pool) group_.emplace(*pool);
+  }
+
+  void Run(std::function<void()> task) {
+    if (group_) {
+      group_->Run(std::move(task));
+    } else {
+      task();
+    }
+  }
+
+  utils::TaskGroup *Group() { return group_ ? &*group_ : nullptr; }
+
+  /// Helps with the tasks and waits until all of them are done.
+  void Wait() {
+    if (group_) group_->Wait();
+  }
+
+ private:
+  std::optional<utils::TaskGroup> group_;
+};
+
+void MeasureGcPhase(const metrics::Event event, const utils::Timer &timer) {
+  metrics::Measure(event, std::chrono::duration_cast<std::chrono::microseconds>(timer.Elapsed()).count());
+}
+
+// Indices created by queries are built from chunks of the vertex skip list.
+std::optional<durability::ParallelizedSchemaCreationInfo> GetIndexCreationParallelExecInfo(const Config &config) {
+  if (config.index_creation.thread_count <= 1) return std::nullopt;
+  return durability::ParallelizedSchemaCreationInfo{.vertex_recovery_info = {},
+                                                    .thread_count = config.index_creation.thread_count};
+}
+
 auto FindEdges(const View view, EdgeTypeId edge_type, const VertexAccessor *from_vertex, VertexAccessor *to_vertex)
     -> Result<EdgesVertexAccessorResult> {
   auto use_out_edges = [](Vertex const *from_vertex, Vertex const *to_vertex) {
@@ -145,6 +193,37 @@ InMemoryStorage::InMemoryStorage(Config config)
     }
   }
 
+  for (const auto &[label, property] : config_.property_column_cache.columns) {
+    property_column_cache_.AddColumn(NameToLabel(label), NameToProperty(property));
+  }
+  property_column_cache_.Rebuild(vertices_.access());
+
+  for (const auto &[label, property] : config_.hash_indices.label_properties) {
+    indices_.label_property_hash_index_.CreateIndex(NameToLabel(label), NameToProperty(property), vertices_.access());
+  }
+
+  if (config_.vertex_directory.enabled) {
+    vertex_directory_.Enable();
+    vertex_directory_.Rebuild(vertices_.access());
+  }
+
+  if (config_.durability.wal_group_commit &&
+      config_.durability.snapshot_wal_mode == Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL) {
+    wal_group_commit_.emplace([this] {
+      // Holding the commit sequencer guarantees that the WAL records of all
+      // transactions up to the last ticket are written to the WAL file. If
+      // there is no WAL file, the last one was synced when it was finalized.
+      std::unique_lock publication_guard(commit_sequencer_);
+      return durability::WalGroupCommit::SyncRequest{
+          .ticket = wal_group_commit_->LastTicket(),
+          .fd = wal_file_ ? wal_file_->FlushAndDuplicateDescriptor() : -1};
+    });
+  }
+
+  if (config_.gc.threads > 1) {
+    // The thread running the GC works on the tasks too.
+    gc_pool_.emplace(config_.gc.threads - 1);
+  }
   if (config_.gc.type == Config::Gc::Type::PERIODIC) {
     // TODO: move out of storage have one global gc_runner_
     gc_runner_.Run("Storage GC", config_.gc.interval, [this] { this->FreeMemory({}, true); });
@@ -166,6 +245,7 @@ InMemoryStorage::~InMemoryStorage() {
     // Stop replication (Stop all clients or stop the REPLICA server)
     repl_storage_state_.Reset();
   }
+  wal_group_commit_.reset();
   if (wal_file_) {
     wal_file_->FinalizeWal();
     wal_file_ = std::nullopt;
@@ -206,6 +286,7 @@ VertexAccessor InMemoryStorage::InMemoryAccessor::CreateVertex() {
   auto [it, inserted] = acc.insert(Vertex{storage::Gid::FromUint(gid), delta});
   MG_ASSERT(inserted, "The vertex must be inserted here!");
   MG_ASSERT(it != acc.end(), "Invalid Vertex accessor!");
+  mem_storage->vertex_directory_.Insert(&*it);
 
   if (delta) {
     delta->prev.Set(&*it);
@@ -229,6 +310,7 @@ VertexAccessor InMemoryStorage::InMemoryAccessor::CreateVertexEx(storage::Gid gi
   auto [it, inserted] = acc.insert(Vertex{gid, delta});
   MG_ASSERT(inserted, "The vertex must be inserted here!");
   MG_ASSERT(it != acc.end(), "Invalid Vertex accessor!");
+  mem_storage->vertex_directory_.Insert(&*it);
   if (delta) {
     delta->prev.Set(&*it);
   }
@@ -238,6 +320,11 @@ VertexAccessor InMemoryStorage::InMemoryAccessor::CreateVertexEx(storage::Gid gi
 std::optional<VertexAccessor> InMemoryStorage::InMemoryAccessor::FindVertex(Gid gid, View view) {
   auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
   auto acc = mem_storage->vertices_.access();
+  // The accessor keeps the vertex from being freed, see VertexDirectory.
+  if (auto vertex = mem_storage->vertex_directory_.Find(gid)) {
+    if (!*vertex) return std::nullopt;
+    return VertexAccessor::Create(*vertex, storage_, &transaction_, view);
+  }
   auto it = acc.find(gid);
   if (it == acc.end()) return std::nullopt;
   return VertexAccessor::Create(&*it, storage_, &transaction_, view);
@@ -345,10 +432,10 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdge(VertexAccesso
   utils::AtomicMemoryBlock atomic_memory_block{
       [this, edge, from_vertex = from_vertex, edge_type = edge_type, to_vertex = to_vertex]() {
         CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge);
-        from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
+        from_vertex->out_edges.emplace(edge_type, to_vertex, edge);
 
         CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge);
-        to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+        to_vertex->in_edges.emplace(edge_type, from_vertex, edge);
 
         transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
         transaction_.manyDeltasCache.Invalidate(to_vertex, edge_type, EdgeDirection::IN);
@@ -447,10 +534,10 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdgeEx(VertexAcces
   utils::AtomicMemoryBlock atomic_memory_block{
       [this, edge, from_vertex = from_vertex, edge_type = edge_type, to_vertex = to_vertex]() {
         CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge);
-        from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
+        from_vertex->out_edges.emplace(edge_type, to_vertex, edge);
 
         CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge);
-        to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+        to_vertex->in_edges.emplace(edge_type, from_vertex, edge);
 
         transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
         transaction_.manyDeltasCache.Invalidate(to_vertex, edge_type, EdgeDirection::IN);
@@ -526,14 +613,13 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetFrom(EdgeAccessor
 
   auto delete_edge_from_storage = [&edge_type, &edge_ref, this](auto *vertex, auto *edges) {
     std::tuple<EdgeTypeId, Vertex *, EdgeRef> link(edge_type, vertex, edge_ref);
-    auto it = std::find(edges->begin(), edges->end(), link);
+    auto it = edges->find(link);
     if (config_.properties_on_edges) {
       MG_ASSERT(it != edges->end(), "Invalid database state!");
     } else if (it == edges->end()) {
       return false;
     }
-    std::swap(*it, *edges->rbegin());
-    edges->pop_back();
+    edges->erase(it);
     return true;
   };
 
@@ -555,14 +641,12 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetFrom(EdgeAccessor
         CreateAndLinkDelta(&transaction_, to_vertex, Delta::AddInEdgeTag(), edge_type, old_from_vertex, edge_ref);
 
         CreateAndLinkDelta(&transaction_, new_from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge_ref);
-        new_from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge_ref);
+        new_from_vertex->out_edges.emplace(edge_type, to_vertex, edge_ref);
         CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, new_from_vertex, edge_ref);
-        to_vertex->in_edges.emplace_back(edge_type, new_from_vertex, edge_ref);
+        to_vertex->in_edges.emplace(edge_type, new_from_vertex, edge_ref);
 
-        auto *in_memory = static_cast<InMemoryStorage *>(storage_);
-        auto *mem_edge_type_index = static_cast<InMemoryEdgeTypeIndex *>(in_memory->indices_.edge_type_index_.get());
-        mem_edge_type_index->UpdateOnEdgeModification(old_from_vertex, to_vertex, new_from_vertex, to_vertex, edge_ref,
-                                                      edge_type, transaction_);
+        storage_->indices_.UpdateOnEdgeModification(old_from_vertex, to_vertex, new_from_vertex, to_vertex, edge_ref,
+                                                    edge_type, transaction_);
 
         transaction_.manyDeltasCache.Invalidate(new_from_vertex, edge_type, EdgeDirection::OUT);
         transaction_.manyDeltasCache.Invalidate(old_from_vertex, edge_type, EdgeDirection::OUT);
@@ -636,14 +720,13 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetTo(EdgeAccessor *
 
   auto delete_edge_from_storage = [&edge_type, &edge_ref, this](auto *vertex, auto *edges) {
     std::tuple<EdgeTypeId, Vertex *, EdgeRef> link(edge_type, vertex, edge_ref);
-    auto it = std::find(edges->begin(), edges->end(), link);
+    auto it = edges->find(link);
     if (config_.properties_on_edges) {
       MG_ASSERT(it != edges->end(), "Invalid database state!");
     } else if (it == edges->end()) {
       return false;
     }
-    std::swap(*it, *edges->rbegin());
-    edges->pop_back();
+    edges->erase(it);
     return true;
   };
 
@@ -666,14 +749,12 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetTo(EdgeAccessor *
         CreateAndLinkDelta(&transaction_, old_to_vertex, Delta::AddInEdgeTag(), edge_type, from_vertex, edge_ref);
 
         CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, new_to_vertex, edge_ref);
-        from_vertex->out_edges.emplace_back(edge_type, new_to_vertex, edge_ref);
+        from_vertex->out_edges.emplace(edge_type, new_to_vertex, edge_ref);
         CreateAndLinkDelta(&transaction_, new_to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge_ref);
-        new_to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge_ref);
+        new_to_vertex->in_edges.emplace(edge_type, from_vertex, edge_ref);
 
-        auto *in_memory = static_cast<InMemoryStorage *>(storage_);
-        auto *mem_edge_type_index = static_cast<InMemoryEdgeTypeIndex *>(in_memory->indices_.edge_type_index_.get());
-        mem_edge_type_index->UpdateOnEdgeModification(from_vertex, old_to_vertex, from_vertex, new_to_vertex, edge_ref,
-                                                      edge_type, transaction_);
+        storage_->indices_.UpdateOnEdgeModification(from_vertex, old_to_vertex, from_vertex, new_to_vertex, edge_ref,
+                                                    edge_type, transaction_);
 
         transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
         transaction_.manyDeltasCache.Invalidate(old_to_vertex, edge_type, EdgeDirection::IN);
@@ -726,22 +807,23 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeChangeType(EdgeAcces
   if (!PrepareForWrite(&transaction_, to_vertex)) return Error::SERIALIZATION_ERROR;
   MG_ASSERT(!to_vertex->deleted, "Invalid database state!");
 
-  auto change_edge_type_in_storage = [&edge_type, &edge_ref, &new_edge_type, this](auto *vertex, auto *edges) {
-    std::tuple<EdgeTypeId, Vertex *, EdgeRef> link(edge_type, vertex, edge_ref);
-    auto it = std::find(edges->begin(), edges->end(), link);
-    if (config_.properties_on_edges) {
-      MG_ASSERT(it != edges->end(), "Invalid database state!");
-    } else if (it == edges->end()) {
-      return false;
-    }
-    *it = std::tuple<EdgeTypeId, Vertex *, EdgeRef>{new_edge_type, vertex, edge_ref};
-    return true;
-  };
-
-  auto op1 = change_edge_type_in_storage(to_vertex, &from_vertex->out_edges);
-  auto op2 = change_edge_type_in_storage(from_vertex, &to_vertex->in_edges);
+  // The edge has to move to the slice of its new type. Only the insertions can
+  // throw and they leave the list unchanged when they do, so both are done
+  // before the old entries are erased.
+  const std::tuple<EdgeTypeId, Vertex *, EdgeRef> old_out_link{edge_type, to_vertex, edge_ref};
+  const std::tuple<EdgeTypeId, Vertex *, EdgeRef> old_in_link{edge_type, from_vertex, edge_ref};
+  MG_ASSERT(from_vertex->out_edges.find(old_out_link) != from_vertex->out_edges.end(), "Invalid database state!");
+  MG_ASSERT(to_vertex->in_edges.find(old_in_link) != to_vertex->in_edges.end(), "Invalid database state!");
 
-  MG_ASSERT((op1 && op2), "Invalid database state!");
+  from_vertex->out_edges.emplace(new_edge_type, to_vertex, edge_ref);
+  try {
+    to_vertex->in_edges.emplace(new_edge_type, from_vertex, edge_ref);
+  } catch (...) {
+    from_vertex->out_edges.erase(from_vertex->out_edges.find({new_edge_type, to_vertex, edge_ref}));
+    throw;
+  }
+  from_vertex->out_edges.erase(from_vertex->out_edges.find(old_out_link));
+  to_vertex->in_edges.erase(to_vertex->in_edges.find(old_in_link));
 
   utils::AtomicMemoryBlock atomic_memory_block{[this, to_vertex, new_edge_type, edge_ref, from_vertex, edge_type]() {
     // "deleting" old edge
@@ -797,33 +879,97 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
       }
     }
 
+    // Store the final values of the modified vertices in the property columns.
+    // Readers only use the columns for vertices without deltas, so the cells
+    // aren't visible before this transaction is committed and its deltas are
+    // unlinked. If the commit fails, `Abort` refreshes them again.
+    if (!storage_->property_column_cache_.Empty()) {
+      std::vector<Vertex *> modified_vertices;
+      for (const auto &delta : transaction_.deltas) {
+        auto prev = delta.prev.Get();
+        if (prev.type == PreviousPtr::Type::VERTEX) modified_vertices.push_back(prev.vertex);
+      }
+      std::ranges::sort(modified_vertices);
+      const auto [first, last] = std::ranges::unique(modified_vertices);
+      modified_vertices.erase(first, last);
+      for (auto *vertex : modified_vertices) {
+        auto guard = std::unique_lock{vertex->lock};
+        storage_->property_column_cache_.Refresh(*vertex);
+      }
+    }
+
     // Result of validating the vertex against unqiue constraints. It has to be
-    // declared outside of the critical section scope because its value is
-    // tested for Abort call which has to be done out of the scope.
+    // declared outside of the publication turn because its value is tested for
+    // Abort call which has to be done after the turn.
     std::optional<ConstraintViolation> unique_constraint_violation;
 
+    // Ticket to wait for after the transaction is published when the WAL is
+    // synced by the group commit flusher.
+    std::optional<uint64_t> wal_sync_ticket;
+
     // Save these so we can mark them used in the commit log.
     uint64_t start_timestamp = transaction_.start_timestamp;
 
     {
-      std::unique_lock<utils::SpinLock> engine_guard(storage_->engine_lock_);
+      // Only the commit timestamp and the ticket that orders the publication of
+      // this transaction are taken while holding the engine lock. Tickets are
+      // ordered like commit timestamps.
+      uint64_t publication_ticket = 0;
+      {
+        std::unique_lock<utils::SpinLock> engine_guard(storage_->engine_lock_);
+        commit_timestamp_.emplace(mem_storage->CommitTimestamp(reparg.desired_commit_timestamp));
+        publication_ticket = mem_storage->commit_sequencer_.NextTicket();
+      }
+      // The ticket has to be published even if the commit fails midway, or the
+      // following transactions would wait for it forever.
+      auto const publish = utils::OnScopeExit{[mem_storage, publication_ticket] {
+        mem_storage->commit_sequencer_.WaitPublished(publication_ticket);
+        mem_storage->commit_sequencer_.Publish();
+      }};
+
+      // Until its turn comes, the transaction prepares its commit concurrently
+      // with other committing transactions. No one else can modify the vertices
+      // and edges it modified until it is published.
       auto *mem_unique_constraints =
           static_cast<InMemoryUniqueConstraints *>(storage_->constraints_.unique_constraints_.get());
-      commit_timestamp_.emplace(mem_storage->CommitTimestamp(reparg.desired_commit_timestamp));
-
-      if (transaction_.constraint_verification_info &&
-          transaction_.constraint_verification_info->NeedsUniqueConstraintVerification()) {
+      const bool needs_unique_constraint_verification =
+          transaction_.constraint_verification_info &&
+          transaction_.constraint_verification_info->NeedsUniqueConstraintVerification();
+      if (needs_unique_constraint_verification) {
         // Before committing and validating vertices against unique constraints,
         // we have to update unique constraints with the vertices that are going
         // to be validated/committed.
-        const auto vertices_to_update =
-            transaction_.constraint_verification_info->GetVerticesForUniqueConstraintChecking();
-
-        for (auto const *vertex : vertices_to_update) {
+        for (auto const *vertex : transaction_.constraint_verification_info->GetVerticesForUniqueConstraintChecking()) {
           mem_unique_constraints->UpdateBeforeCommit(vertex, transaction_);
         }
+      }
+
+      [[maybe_unused]] bool const is_main_or_replica_write =
+          reparg.IsMain() || reparg.desired_commit_timestamp.has_value();
+
+      // TODO Figure out if we can assert this
+      // DMG_ASSERT(is_main_or_replica_write, "Should only get here on writes");
+      // Currently there are queries that write to some subsystem that are allowed on a replica
+      // ex. analyze graph stats
+      // There are probably others. We not to check all of them and figure out if they are allowed and what are
+      // they even doing here...
+
+      // The WAL records are encoded with the final commit timestamp, only
+      // appending them to the WAL has to wait for the turn.
+      std::optional<durability::EncodedDeltas> encoded_deltas;
+      if (is_main_or_replica_write) {
+        encoded_deltas = mem_storage->EncodeWalDeltas(transaction_, *commit_timestamp_);
+      }
+
+      // Wait until all transactions with lower commit timestamps are
+      // published. Until this transaction is published, the following ones
+      // wait for it.
+      mem_storage->commit_sequencer_.WaitPublished(publication_ticket);
 
-        for (auto const *vertex : vertices_to_update) {
+      if (needs_unique_constraint_verification) {
+        // Validation has to see all transactions committed before this one, so
+        // it is done in turn.
+        for (auto const *vertex : transaction_.constraint_verification_info->GetVerticesForUniqueConstraintChecking()) {
           // No need to take any locks here because we modified this vertex and no
           // one else can touch it until we commit.
           unique_constraint_violation = mem_unique_constraints->Validate(*vertex, transaction_, *commit_timestamp_);
@@ -834,28 +980,19 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
       }
 
       if (!unique_constraint_violation) {
-        [[maybe_unused]] bool const is_main_or_replica_write =
-            reparg.IsMain() || reparg.desired_commit_timestamp.has_value();
-
-        // TODO Figure out if we can assert this
-        // DMG_ASSERT(is_main_or_replica_write, "Should only get here on writes");
-        // Currently there are queries that write to some subsystem that are allowed on a replica
-        // ex. analyze graph stats
-        // There are probably others. We not to check all of them and figure out if they are allowed and what are
-        // they even doing here...
-
-        // Write transaction to WAL while holding the engine lock to make sure
-        // that committed transactions are sorted by the commit timestamp in the
-        // WAL files. We supply the new commit timestamp to the function so that
-        // it knows what will be the final commit timestamp. The WAL must be
-        // written before actually committing the transaction (before setting
-        // the commit timestamp) so that no other transaction can see the
-        // modifications before they are written to disk.
+        // Write transaction to WAL in turn to make sure that committed
+        // transactions are sorted by the commit timestamp in the WAL files.
+        // The WAL must be written before actually committing the transaction
+        // (before setting the commit timestamp) so that no other transaction
+        // can see the modifications before they are written to disk.
         // Replica can log only the write transaction received from Main
         // so the Wal files are consistent
         if (is_main_or_replica_write) {
           could_replicate_all_sync_replicas =
-              mem_storage->AppendToWal(transaction_, *commit_timestamp_, std::move(db_acc));
+              mem_storage->AppendToWal(transaction_, *commit_timestamp_, encoded_deltas, std::move(db_acc));
+          if (mem_storage->wal_group_commit_) {
+            wal_sync_ticket = mem_storage->wal_group_commit_->LastTicket();
+          }
 
           // TODO: release lock, and update all deltas to have a local copy of the commit timestamp
           MG_ASSERT(transaction_.commit_timestamp != nullptr, "Invalid database state!");
@@ -869,22 +1006,25 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
         // TODO: can and should this be moved earlier?
         mem_storage->commit_log_->MarkFinished(start_timestamp);
 
-        // while still holding engine lock
-        // and after durability + replication
+        // after durability + replication
         // check if we can fast discard deltas (ie. do not hand over to GC)
-        bool no_older_transactions = mem_storage->commit_log_->OldestActive() == *commit_timestamp_;
-        bool no_newer_transactions = mem_storage->transaction_id_ == transaction_.transaction_id + 1;
-        if (no_older_transactions && no_newer_transactions) [[unlikely]] {
-          // STEP 0) Can only do fast discard if GC is not running
-          //         We can't unlink our transcations deltas until all of the older deltas in GC have been unlinked
-          //         must do a try here, to avoid deadlock between transactions `engine_lock_` and the GC `gc_lock_`
-          auto gc_guard = std::unique_lock{mem_storage->gc_lock_, std::defer_lock};
-          if (gc_guard.try_lock()) {
-            FastDiscardOfDeltas(*commit_timestamp_, std::move(gc_guard));
+        if (mem_storage->commit_log_->OldestActive() == *commit_timestamp_) [[unlikely]] {
+          // the engine lock keeps new transactions from starting meanwhile
+          std::unique_lock<utils::SpinLock> engine_guard(storage_->engine_lock_);
+          bool no_older_transactions = mem_storage->commit_log_->OldestActive() == *commit_timestamp_;
+          bool no_newer_transactions = mem_storage->transaction_id_ == transaction_.transaction_id + 1;
+          if (no_older_transactions && no_newer_transactions) {
+            // STEP 0) Can only do fast discard if GC is not running
+            //         We can't unlink our transcations deltas until all of the older deltas in GC have been unlinked
+            //         must do a try here, to avoid deadlock between transactions `engine_lock_` and the GC `gc_lock_`
+            auto gc_guard = std::unique_lock{mem_storage->gc_lock_, std::defer_lock};
+            if (gc_guard.try_lock()) {
+              FastDiscardOfDeltas(*commit_timestamp_, std::move(gc_guard));
+            }
           }
         }
       }
-    }  // Release engine lock because we don't have to hold it anymore
+    }  // Publish because the following transactions don't have to wait anymore
 
     if (unique_constraint_violation) {
       Abort();
@@ -893,6 +1033,12 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
       return StorageManipulationError{*unique_constraint_violation};
     }
 
+    if (wal_sync_ticket) {
+      // The transaction is already visible to others, but the client is
+      // only acknowledged once it is durable.
+      mem_storage->wal_group_commit_->WaitDurable(*wal_sync_ticket);
+    }
+
     if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
       mem_storage->indices_.text_index_.Commit();
     }
@@ -913,7 +1059,7 @@ void InMemoryStorage::InMemoryAccessor::FastDiscardOfDeltas(uint64_t oldest_acti
   std::list<Gid> current_deleted_edges;
   std::list<Gid> current_deleted_vertices;
 
-  auto const unlink_remove_clear = [&](std::deque<Delta> &deltas) {
+  auto const unlink_remove_clear = [&](DeltaContainer &deltas) {
     for (auto &delta : deltas) {
       auto prev = delta.prev.Get();
       switch (prev.type) {
@@ -951,6 +1097,7 @@ void InMemoryStorage::InMemoryAccessor::FastDiscardOfDeltas(uint64_t oldest_acti
   // 1.a) old garbage_undo_buffers are safe to remove
   //      we are the only transaction, no one is reading those unlinked deltas
   mem_storage->garbage_undo_buffers_.WithLock([&](auto &garbage_undo_buffers) { garbage_undo_buffers.clear(); });
+  mem_storage->gc_unlinked_undo_buffers_.clear();
 
   // 1.b.0) old committed_transactions_ need mininal unlinking + remove + clear
   //      must be done before this transactions delta unlinking
@@ -980,6 +1127,7 @@ void InMemoryStorage::InMemoryAccessor::FastDiscardOfDeltas(uint64_t oldest_acti
     // 3.b) remove from veretex skip_list
     auto vertex_acc = mem_storage->vertices_.access();
     for (auto gid : current_deleted_vertices) {
+      mem_storage->vertex_directory_.Remove(gid);
       vertex_acc.remove(gid);
     }
   }
@@ -1022,6 +1170,25 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
     std::map<LabelId, std::vector<Vertex *>> label_cleanup;
     std::map<LabelId, std::vector<std::pair<PropertyValue, Vertex *>>> label_property_cleanup;
     std::map<PropertyId, std::vector<std::pair<PropertyValue, Vertex *>>> property_cleanup;
+    std::map<PropertyId, std::vector<std::pair<PropertyValue, Edge *>>> edge_property_cleanup;
+    std::map<std::pair<LabelId, std::vector<PropertyId>>, std::vector<std::pair<std::vector<PropertyValue>, Vertex *>>>
+        label_properties_cleanup;
+
+    // Composite index entries are keyed by the values of all the index
+    // properties, and vertices without the first property aren't indexed.
+    auto const collect_label_properties = [&](const std::pair<LabelId, std::vector<PropertyId>> &label_properties,
+                                              Vertex *vertex) {
+      const auto &properties = label_properties.second;
+      auto first_value = vertex->properties.GetProperty(properties.front());
+      if (first_value.IsNull()) return;
+      std::vector<PropertyValue> values;
+      values.reserve(properties.size());
+      values.push_back(std::move(first_value));
+      for (auto it = std::next(properties.begin()); it != properties.end(); ++it) {
+        values.push_back(vertex->properties.GetProperty(*it));
+      }
+      label_properties_cleanup[label_properties].emplace_back(std::move(values), vertex);
+    };
 
     for (const auto &delta : transaction_.deltas) {
       auto prev = delta.prev.Get();
@@ -1056,6 +1223,11 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
                     }
                   }
                 }
+                for (const auto &label_properties : index_stats.label_properties) {
+                  if (label_properties.first == current->label.value) {
+                    collect_label_properties(label_properties, vertex);
+                  }
+                }
                 break;
               }
               case Delta::Action::ADD_LABEL: {
@@ -1076,6 +1248,15 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
                     property_cleanup[current->property.key].emplace_back(std::move(current_value), vertex);
                   }
                 }
+                // The values are collected before the property is reverted,
+                // the same as when the entry was added.
+                for (const auto &label_properties : index_stats.label_properties) {
+                  if (std::ranges::find(label_properties.second, current->property.key) !=
+                          label_properties.second.end() &&
+                      std::ranges::find(vertex->labels, label_properties.first) != vertex->labels.end()) {
+                    collect_label_properties(label_properties, vertex);
+                  }
+                }
                 // Setting the correct value
                 vertex->properties.SetProperty(current->property.key, *current->property.value);
                 break;
@@ -1083,17 +1264,17 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
               case Delta::Action::ADD_IN_EDGE: {
                 std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                                current->vertex_edge.vertex, current->vertex_edge.edge};
-                auto it = std::find(vertex->in_edges.begin(), vertex->in_edges.end(), link);
+                auto it = vertex->in_edges.find(link);
                 MG_ASSERT(it == vertex->in_edges.end(), "Invalid database state!");
-                vertex->in_edges.push_back(link);
+                vertex->in_edges.insert(link);
                 break;
               }
               case Delta::Action::ADD_OUT_EDGE: {
                 std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                                current->vertex_edge.vertex, current->vertex_edge.edge};
-                auto it = std::find(vertex->out_edges.begin(), vertex->out_edges.end(), link);
+                auto it = vertex->out_edges.find(link);
                 MG_ASSERT(it == vertex->out_edges.end(), "Invalid database state!");
-                vertex->out_edges.push_back(link);
+                vertex->out_edges.insert(link);
                 // Increment edge count. We only increment the count here because
                 // the information in `ADD_IN_EDGE` and `Edge/RECREATE_OBJECT` is
                 // redundant. Also, `Edge/RECREATE_OBJECT` isn't available when
@@ -1104,19 +1285,17 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
               case Delta::Action::REMOVE_IN_EDGE: {
                 std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                                current->vertex_edge.vertex, current->vertex_edge.edge};
-                auto it = std::find(vertex->in_edges.begin(), vertex->in_edges.end(), link);
+                auto it = vertex->in_edges.find(link);
                 MG_ASSERT(it != vertex->in_edges.end(), "Invalid database state!");
-                std::swap(*it, *vertex->in_edges.rbegin());
-                vertex->in_edges.pop_back();
+                vertex->in_edges.erase(it);
                 break;
               }
               case Delta::Action::REMOVE_OUT_EDGE: {
                 std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                                current->vertex_edge.vertex, current->vertex_edge.edge};
-                auto it = std::find(vertex->out_edges.begin(), vertex->out_edges.end(), link);
+                auto it = vertex->out_edges.find(link);
                 MG_ASSERT(it != vertex->out_edges.end(), "Invalid database state!");
-                std::swap(*it, *vertex->out_edges.rbegin());
-                vertex->out_edges.pop_back();
+                vertex->out_edges.erase(it);
                 // Decrement edge count. We only decrement the count here because
                 // the information in `REMOVE_IN_EDGE` and `Edge/DELETE_OBJECT` is
                 // redundant. Also, `Edge/DELETE_OBJECT` isn't available when edge
@@ -1141,6 +1320,11 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
           if (current != nullptr) {
             current->prev.Set(vertex);
           }
+          // Revert the cells while still holding the lock; the vertex may have
+          // no deltas left and readers would take the values from the columns.
+          if (!storage_->property_column_cache_.Empty()) {
+            storage_->property_column_cache_.Refresh(*vertex);
+          }
 
           break;
         }
@@ -1152,6 +1336,15 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
                  current->timestamp->load(std::memory_order_acquire) == transaction_.transaction_id) {
             switch (current->action) {
               case Delta::Action::SET_PROPERTY: {
+                // For edge-type+property index
+                //  check if we care about the property and get the value this transaction wrote
+                if (std::binary_search(index_stats.edge_property.begin(), index_stats.edge_property.end(),
+                                       current->property.key)) {
+                  auto current_value = edge->properties.GetProperty(current->property.key);
+                  if (!current_value.IsNull()) {
+                    edge_property_cleanup[current->property.key].emplace_back(std::move(current_value), edge);
+                  }
+                }
                 edge->properties.SetProperty(current->property.key, *current->property.value);
                 break;
               }
@@ -1219,6 +1412,12 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
       for (auto const &[property, prop_vertices] : property_cleanup) {
         storage_->indices_.AbortEntries(property, prop_vertices, transaction_.start_timestamp);
       }
+      for (auto const &[property, prop_edges] : edge_property_cleanup) {
+        storage_->indices_.AbortEntries(property, prop_edges, transaction_.start_timestamp);
+      }
+      for (auto const &[label_properties, values_vertices] : label_properties_cleanup) {
+        storage_->indices_.AbortEntries(label_properties, values_vertices, transaction_.start_timestamp);
+      }
       if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
         storage_->indices_.text_index_.Rollback();
       }
@@ -1227,6 +1426,7 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
       {
         auto vertices_acc = mem_storage->vertices_.access();
         for (auto gid : my_deleted_vertices) {
+          mem_storage->vertex_directory_.Remove(gid);
           vertices_acc.remove(gid);
         }
       }
@@ -1266,7 +1466,8 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryA
   MG_ASSERT(unique_guard_.owns_lock(), "Creating label index requires a unique access to the storage!");
   auto *in_memory = static_cast<InMemoryStorage *>(storage_);
   auto *mem_label_index = static_cast<InMemoryLabelIndex *>(in_memory->indices_.label_index_.get());
-  if (!mem_label_index->CreateIndex(label, in_memory->vertices_.access(), std::nullopt)) {
+  if (!mem_label_index->CreateIndex(label, in_memory->vertices_.access(),
+                                    GetIndexCreationParallelExecInfo(in_memory->config_))) {
     return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
   transaction_.md_deltas.emplace_back(MetadataDelta::label_index_create, label);
@@ -1281,7 +1482,8 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryA
   auto *in_memory = static_cast<InMemoryStorage *>(storage_);
   auto *mem_label_property_index =
       static_cast<InMemoryLabelPropertyIndex *>(in_memory->indices_.label_property_index_.get());
-  if (!mem_label_property_index->CreateIndex(label, property, in_memory->vertices_.access(), std::nullopt)) {
+  if (!mem_label_property_index->CreateIndex(label, property, in_memory->vertices_.access(),
+                                             GetIndexCreationParallelExecInfo(in_memory->config_))) {
     return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
   transaction_.md_deltas.emplace_back(MetadataDelta::label_property_index_create, label, property);
@@ -1302,11 +1504,45 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryA
   return {};
 }
 
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::CreateIndex(
+    EdgeTypeId edge_type, PropertyId property) {
+  MG_ASSERT(unique_guard_.owns_lock(), "Create index requires a unique access to the storage!");
+  auto *in_memory = static_cast<InMemoryStorage *>(storage_);
+  // Without properties on edges there is nothing to index.
+  if (!in_memory->config_.salient.items.properties_on_edges) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  auto *mem_edge_type_property_index =
+      static_cast<InMemoryEdgeTypePropertyIndex *>(in_memory->indices_.edge_type_property_index_.get());
+  if (!mem_edge_type_property_index->CreateIndex(edge_type, property, in_memory->vertices_.access())) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  transaction_.md_deltas.emplace_back(MetadataDelta::edge_property_index_create, edge_type, property);
+  return {};
+}
+
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::CreateIndex(
+    LabelId label, std::vector<PropertyId> properties) {
+  MG_ASSERT(unique_guard_.owns_lock(), "Creating label-properties index requires a unique access to the storage!");
+  auto *in_memory = static_cast<InMemoryStorage *>(storage_);
+  auto *mem_label_property_composite_index =
+      static_cast<InMemoryLabelPropertyCompositeIndex *>(in_memory->indices_.label_property_composite_index_.get());
+  if (!mem_label_property_composite_index->CreateIndex(label, properties, in_memory->vertices_.access(),
+                                                       GetIndexCreationParallelExecInfo(in_memory->config_))) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  transaction_.md_deltas.emplace_back(MetadataDelta::label_property_composite_index_create, label,
+                                      std::move(properties));
+  return {};
+}
+
 utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::DropIndex(LabelId label) {
   MG_ASSERT(unique_guard_.owns_lock(), "Dropping label index requires a unique access to the storage!");
   auto *in_memory = static_cast<InMemoryStorage *>(storage_);
   auto *mem_label_index = static_cast<InMemoryLabelIndex *>(in_memory->indices_.label_index_.get());
-  if (!mem_label_index->DropIndex(label)) {
+  // An index still being built online doesn't exist yet and is left to the
+  // query creating it.
+  if (!mem_label_index->IndexExists(label) || !mem_label_index->DropIndex(label)) {
     return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
   transaction_.md_deltas.emplace_back(MetadataDelta::label_index_drop, label);
@@ -1321,7 +1557,8 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryA
   auto *in_memory = static_cast<InMemoryStorage *>(storage_);
   auto *mem_label_property_index =
       static_cast<InMemoryLabelPropertyIndex *>(in_memory->indices_.label_property_index_.get());
-  if (!mem_label_property_index->DropIndex(label, property)) {
+  if (!mem_label_property_index->IndexExists(label, property) ||
+      !mem_label_property_index->DropIndex(label, property)) {
     return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
   transaction_.md_deltas.emplace_back(MetadataDelta::label_property_index_drop, label, property);
@@ -1342,6 +1579,33 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryA
   return {};
 }
 
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::DropIndex(
+    EdgeTypeId edge_type, PropertyId property) {
+  MG_ASSERT(unique_guard_.owns_lock(), "Drop index requires a unique access to the storage!");
+  auto *in_memory = static_cast<InMemoryStorage *>(storage_);
+  auto *mem_edge_type_property_index =
+      static_cast<InMemoryEdgeTypePropertyIndex *>(in_memory->indices_.edge_type_property_index_.get());
+  if (!mem_edge_type_property_index->DropIndex(edge_type, property)) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  transaction_.md_deltas.emplace_back(MetadataDelta::edge_property_index_drop, edge_type, property);
+  return {};
+}
+
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::DropIndex(
+    LabelId label, std::vector<PropertyId> properties) {
+  MG_ASSERT(unique_guard_.owns_lock(), "Dropping label-properties index requires a unique access to the storage!");
+  auto *in_memory = static_cast<InMemoryStorage *>(storage_);
+  auto *mem_label_property_composite_index =
+      static_cast<InMemoryLabelPropertyCompositeIndex *>(in_memory->indices_.label_property_composite_index_.get());
+  if (!mem_label_property_composite_index->DropIndex(label, properties)) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  transaction_.md_deltas.emplace_back(MetadataDelta::label_property_composite_index_drop, label,
+                                      std::move(properties));
+  return {};
+}
+
 utils::BasicResult<StorageExistenceConstraintDefinitionError, void>
 InMemoryStorage::InMemoryAccessor::CreateExistenceConstraint(LabelId label, PropertyId property) {
   MG_ASSERT(unique_guard_.owns_lock(), "Creating existence requires a unique access to the storage!");
@@ -1403,6 +1667,37 @@ UniqueConstraints::DeletionStatus InMemoryStorage::InMemoryAccessor::DropUniqueC
   return UniqueConstraints::DeletionStatus::SUCCESS;
 }
 
+std::vector<VerticesIterable> InMemoryStorage::InMemoryAccessor::ChunkedVertices(View view, uint64_t num_chunks) {
+  auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
+  // Chunks are delimited by gids instead of skip list nodes because a boundary
+  // node can be removed, and later freed, while the chunks are being iterated.
+  std::vector<Gid> chunk_begins;
+  {
+    auto vertices_acc = mem_storage->vertices_.access();
+    for (auto it : vertices_acc.chunk_boundaries(num_chunks)) chunk_begins.push_back(it->gid);
+  }
+  std::vector<VerticesIterable> chunks;
+  chunks.reserve(chunk_begins.size());
+  for (size_t i = 0; i < chunk_begins.size(); ++i) {
+    auto vertices_acc = mem_storage->vertices_.access();
+    auto chunk_begin = i == 0 ? vertices_acc.begin() : vertices_acc.find_equal_or_greater(chunk_begins[i]);
+    auto chunk_end = i + 1 < chunk_begins.size() ? std::optional<Gid>{chunk_begins[i + 1]} : std::nullopt;
+    chunks.emplace_back(
+        AllVerticesIterable(std::move(vertices_acc), chunk_begin, chunk_end, storage_, &transaction_, view));
+  }
+  return chunks;
+}
+
+std::vector<VerticesIterable> InMemoryStorage::InMemoryAccessor::ChunkedVertices(LabelId label, View view,
+                                                                                 uint64_t num_chunks) {
+  auto *mem_label_index = static_cast<InMemoryLabelIndex *>(storage_->indices_.label_index_.get());
+  auto label_chunks = mem_label_index->ChunkedVertices(label, view, num_chunks, storage_, &transaction_);
+  std::vector<VerticesIterable> chunks;
+  chunks.reserve(label_chunks.size());
+  for (auto &chunk : label_chunks) chunks.emplace_back(std::move(chunk));
+  return chunks;
+}
+
 VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(LabelId label, View view) {
   auto *mem_label_index = static_cast<InMemoryLabelIndex *>(storage_->indices_.label_index_.get());
   return VerticesIterable(mem_label_index->Vertices(label, view, storage_, &transaction_));
@@ -1417,6 +1712,10 @@ VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(LabelId label, Prop
 
 VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(LabelId label, PropertyId property,
                                                              const PropertyValue &value, View view) {
+  const auto &hash_index = storage_->indices_.label_property_hash_index_;
+  if (hash_index.IndexExists(label, property)) {
+    return VerticesIterable(hash_index.Vertices(label, property, value, view, storage_, &transaction_));
+  }
   auto *mem_label_property_index =
       static_cast<InMemoryLabelPropertyIndex *>(storage_->indices_.label_property_index_.get());
   return VerticesIterable(mem_label_property_index->Vertices(label, property, utils::MakeBoundInclusive(value),
@@ -1433,11 +1732,47 @@ VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(
       mem_label_property_index->Vertices(label, property, lower_bound, upper_bound, view, storage_, &transaction_));
 }
 
+VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(
+    LabelId label, const std::vector<PropertyId> &properties, const std::vector<PropertyValue> &prefix,
+    const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) {
+  auto *mem_label_property_composite_index =
+      static_cast<InMemoryLabelPropertyCompositeIndex *>(storage_->indices_.label_property_composite_index_.get());
+  return VerticesIterable(mem_label_property_composite_index->Vertices(label, properties, prefix, lower_bound,
+                                                                       upper_bound, view, storage_, &transaction_));
+}
+
 EdgesIterable InMemoryStorage::InMemoryAccessor::Edges(EdgeTypeId edge_type, View view) {
   auto *mem_edge_type_index = static_cast<InMemoryEdgeTypeIndex *>(storage_->indices_.edge_type_index_.get());
   return EdgesIterable(mem_edge_type_index->Edges(edge_type, view, storage_, &transaction_));
 }
 
+EdgesIterable InMemoryStorage::InMemoryAccessor::Edges(EdgeTypeId edge_type, PropertyId property, View view) {
+  auto *mem_edge_type_property_index =
+      static_cast<InMemoryEdgeTypePropertyIndex *>(storage_->indices_.edge_type_property_index_.get());
+  return EdgesIterable(mem_edge_type_property_index->Edges(edge_type, property, std::nullopt, std::nullopt, view,
+                                                           storage_, &transaction_));
+}
+
+EdgesIterable InMemoryStorage::InMemoryAccessor::Edges(EdgeTypeId edge_type, PropertyId property,
+                                                       const PropertyValue &value, View view) {
+  auto *mem_edge_type_property_index =
+      static_cast<InMemoryEdgeTypePropertyIndex *>(storage_->indices_.edge_type_property_index_.get());
+  return EdgesIterable(mem_edge_type_property_index->Edges(edge_type, property, utils::MakeBoundInclusive(value),
+                                                           utils::MakeBoundInclusive(value), view, storage_,
+                                                           &transaction_));
+}
+
+EdgesIterable InMemoryStorage::InMemoryAccessor::Edges(EdgeTypeId edge_type, PropertyId property,
+                                                       const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                                       const std::optional<utils::Bound<PropertyValue>> &upper_bound,
+                                                       View view) {
+  auto *mem_edge_type_property_index =
+      static_cast<InMemoryEdgeTypePropertyIndex *>(storage_->indices_.edge_type_property_index_.get());
+  return EdgesIterable(mem_edge_type_property_index->Edges(edge_type, property, lower_bound, upper_bound, view,
+                                                           storage_, &transaction_));
+}
+
 Transaction InMemoryStorage::CreateTransaction(
     IsolationLevel isolation_level, StorageMode storage_mode,
     memgraph::replication_coordination_glue::ReplicationRole replication_role) {
@@ -1446,6 +1781,7 @@ Transaction InMemoryStorage::CreateTransaction(
   // `timestamp`) below.
   uint64_t transaction_id = 0;
   uint64_t start_timestamp = 0;
+  uint64_t issued_tickets = 0;
   {
     std::lock_guard<utils::SpinLock> guard(engine_lock_);
     transaction_id = transaction_id_++;
@@ -1460,7 +1796,11 @@ Transaction InMemoryStorage::CreateTransaction(
     } else {
       start_timestamp = timestamp_;
     }
+    issued_tickets = commit_sequencer_.IssuedTickets();
   }
+  // Transactions which got a lower commit timestamp may still be publishing
+  // their changes, which have to be visible to this transaction from its start.
+  commit_sequencer_.WaitPublished(issued_tickets);
   return {transaction_id, start_timestamp, isolation_level, storage_mode, false, !constraints_.empty()};
 }
 
@@ -1479,6 +1819,10 @@ void InMemoryStorage::SetStorageMode(StorageMode new_storage_mode) {
     }
 
     storage_mode_ = new_storage_mode;
+    if (new_storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL) {
+      // Analytical transactions don't create deltas and don't maintain the columns.
+      property_column_cache_.Rebuild(vertices_.access());
+    }
     FreeMemory(std::move(main_guard), false);
   }
 }
@@ -1528,6 +1872,8 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   spdlog::trace("Storage GC on '{}' started [{}]", name(), periodic ? "periodic" : "forced");
   auto trace_on_exit = utils::OnScopeExit{
       [&] { spdlog::trace("Storage GC on '{}' finished [{}]", name(), periodic ? "periodic" : "forced"); }};
+  utils::Timer gc_timer;
+  auto measure_on_exit = utils::OnScopeExit{[&] { MeasureGcPhase(metrics::GCLatency_us, gc_timer); }};
 
   // Garbage collection must be performed in two phases. In the first phase,
   // deltas that won't be applied by any transaction anymore are unlinked from
@@ -1586,16 +1932,21 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   bool run_index_cleanup = !linked_undo_buffers.empty() || !garbage_undo_buffers_->empty() || need_full_scan_vertices ||
                            need_full_scan_edges;
 
-  auto const end_linked_undo_buffers = linked_undo_buffers.end();
-  for (auto linked_entry = linked_undo_buffers.begin(); linked_entry != end_linked_undo_buffers;) {
-    auto const *const commit_timestamp_ptr = linked_entry->commit_timestamp_.get();
-    auto const commit_timestamp = commit_timestamp_ptr->load(std::memory_order_acquire);
+  utils::Timer unlink_timer;
 
-    // only process those that are no longer active
-    if (commit_timestamp >= oldest_active_start_timestamp) {
-      ++linked_entry;  // can not process, skip
-      continue;        // must continue to next transaction, because committed_transactions_ was not ordered
+  // Only the transactions which are no longer visible to any active one can be
+  // unlinked. All of them have to be checked because committed_transactions_
+  // isn't ordered.
+  std::vector<std::list<GCDeltas>::iterator> unlinkable_entries;
+  for (auto linked_entry = linked_undo_buffers.begin(); linked_entry != linked_undo_buffers.end(); ++linked_entry) {
+    if (linked_entry->commit_timestamp_->load(std::memory_order_acquire) < oldest_active_start_timestamp) {
+      unlinkable_entries.push_back(linked_entry);
     }
+  }
+
+  auto const unlink_entry = [oldest_active_start_timestamp](GCDeltas &linked_entry, std::list<Gid> &deleted_vertices,
+                                                            std::list<Gid> &deleted_edges) {
+    auto const *const commit_timestamp_ptr = linked_entry.commit_timestamp_.get();
 
     // When unlinking a delta which is the first delta in its version chain,
     // special care has to be taken to avoid the following race condition:
@@ -1628,7 +1979,7 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
     // chain in a broken state.
     // The chain can be only read without taking any locks.
 
-    for (Delta &delta : linked_entry->deltas_) {
+    for (Delta &delta : linked_entry.deltas_) {
       while (true) {
         auto prev = delta.prev.Get();
         switch (prev.type) {
@@ -1643,7 +1994,7 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
             vertex->delta = nullptr;
             if (vertex->deleted) {
               DMG_ASSERT(delta.action == memgraph::storage::Delta::Action::RECREATE_OBJECT);
-              current_deleted_vertices.push_back(vertex->gid);
+              deleted_vertices.push_back(vertex->gid);
             }
             break;
           }
@@ -1658,7 +2009,7 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
             edge->delta = nullptr;
             if (edge->deleted) {
               DMG_ASSERT(delta.action == memgraph::storage::Delta::Action::RECREATE_OBJECT);
-              current_deleted_edges.push_back(edge->gid);
+              deleted_edges.push_back(edge->gid);
             }
             break;
           }
@@ -1723,12 +2074,57 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
         break;
       }
     }
+  };
+
+  // The transactions are unlinked independently of each other, so they are
+  // handed out to the GC threads one by one. With a step budget the GC stops
+  // taking new transactions once the budget is spent and leaves the rest for
+  // the following runs. The first shard still takes at least one transaction,
+  // so each run makes progress even when the budget is spent before it starts.
+  auto const deadline = config_.gc.step_budget.count() > 0
+                            ? std::optional{std::chrono::steady_clock::now() + config_.gc.step_budget}
+                            : std::nullopt;
+  auto const num_shards = std::min<size_t>(config_.gc.threads, unlinkable_entries.size());
+  std::vector<uint8_t> unlinked(unlinkable_entries.size(), 0);
+  std::vector<std::list<Gid>> deleted_vertices_per_shard(num_shards);
+  std::vector<std::list<Gid>> deleted_edges_per_shard(num_shards);
+  std::atomic<size_t> next_entry{0};
+  auto const unlink_shard = [&](size_t shard) {
+    for (bool first = shard == 0; first || !deadline || std::chrono::steady_clock::now() < *deadline; first = false) {
+      auto const entry = next_entry.fetch_add(1, std::memory_order_relaxed);
+      if (entry >= unlinkable_entries.size()) return;
+      unlink_entry(*unlinkable_entries[entry], deleted_vertices_per_shard[shard], deleted_edges_per_shard[shard]);
+      unlinked[entry] = 1;
+    }
+  };
+  {
+    GcTasks tasks(gc_pool_);
+    for (size_t shard = 1; shard < num_shards; ++shard) {
+      tasks.Run([&unlink_shard, shard] { unlink_shard(shard); });
+    }
+    if (num_shards > 0) unlink_shard(0);
+    tasks.Wait();
+  }
 
-    // Now unlinked, move to unlinked_undo_buffers
-    auto const to_move = linked_entry;
-    ++linked_entry;  // advanced to next before we move the list node
-    unlinked_undo_buffers.splice(unlinked_undo_buffers.end(), linked_undo_buffers, to_move);
+  // Now unlinked, move to unlinked_undo_buffers
+  for (size_t entry = 0; entry < unlinkable_entries.size(); ++entry) {
+    if (!unlinked[entry]) continue;
+    unlinked_undo_buffers.splice(unlinked_undo_buffers.end(), linked_undo_buffers, unlinkable_entries[entry]);
   }
+  // An unlinkable transaction doesn't detach itself from a newer inactive one
+  // in its version chain, because the newer one is unlinked as well. When the
+  // budget leaves the older one for a later run, it still points to the
+  // deltas of the newer one, so those are kept until every unlinkable
+  // transaction has been unlinked.
+  gc_unlinked_undo_buffers_.splice(gc_unlinked_undo_buffers_.end(), std::move(unlinked_undo_buffers));
+  if (std::all_of(unlinked.begin(), unlinked.end(), [](auto entry_unlinked) { return entry_unlinked != 0; })) {
+    unlinked_undo_buffers.swap(gc_unlinked_undo_buffers_);
+  }
+  for (size_t shard = 0; shard < num_shards; ++shard) {
+    current_deleted_vertices.splice(current_deleted_vertices.end(), deleted_vertices_per_shard[shard]);
+    current_deleted_edges.splice(current_deleted_edges.end(), deleted_edges_per_shard[shard]);
+  }
+  MeasureGcPhase(metrics::GCDeltaUnlinkLatency_us, unlink_timer);
 
   if (!linked_undo_buffers.empty()) {
     // some were not able to be collected, add them back to committed_transactions_ for the next GC run
@@ -1744,11 +2140,16 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   if (run_index_cleanup) {
     // This operation is very expensive as it traverses through all of the items
     // in every index every time.
+    // The indices are cleaned up concurrently on the GC threads.
     auto token = stop_source.get_token();
     if (!token.stop_requested()) {
-      indices_.RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+      utils::Timer index_cleanup_timer;
+      GcTasks tasks(gc_pool_);
+      indices_.RemoveObsoleteEntries(oldest_active_start_timestamp, token, tasks.Group());
       auto *mem_unique_constraints = static_cast<InMemoryUniqueConstraints *>(constraints_.unique_constraints_.get());
       mem_unique_constraints->RemoveObsoleteEntries(oldest_active_start_timestamp, std::move(token));
+      tasks.Wait();
+      MeasureGcPhase(metrics::GCIndexCleanupLatency_us, index_cleanup_timer);
     }
   }
 
@@ -1778,12 +2179,35 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
     }
   }
 
-  {
-    auto vertex_acc = vertices_.access();
-    for (auto vertex : current_deleted_vertices) {
-      MG_ASSERT(vertex_acc.remove(vertex), "Invalid database state!");
+  // Vertices and edges are removed from their own skip lists, so they are
+  // removed concurrently.
+  utils::Timer object_cleanup_timer;
+  GcTasks tasks(gc_pool_);
+  tasks.Run([&] {
+    {
+      auto vertex_acc = vertices_.access();
+      for (auto vertex : current_deleted_vertices) {
+        vertex_directory_.Remove(vertex);
+        MG_ASSERT(vertex_acc.remove(vertex), "Invalid database state!");
+      }
     }
-  }
+
+    // EXPENSIVE full scan, is only run if an IN_MEMORY_ANALYTICAL transaction involved any deletions
+    // TODO: implement a fast internal iteration inside the skip_list (to avoid unnecessary find_node calls),
+    //  accessor.remove_if([](auto const & item){ return item.delta == nullptr && item.deleted;});
+    //  alternatively, an auxiliary data structure within skip_list to track these, hence a full scan wouldn't be
+    //  needed we will wait for evidence that this is needed before doing so.
+    if (need_full_scan_vertices) {
+      auto vertex_acc = vertices_.access();
+      for (auto &vertex : vertex_acc) {
+        // a deleted vertex which as no deltas must have come from IN_MEMORY_ANALYTICAL deletion
+        if (vertex.delta == nullptr && vertex.deleted) {
+          vertex_directory_.Remove(vertex.gid);
+          vertex_acc.remove(vertex);
+        }
+      }
+    }
+  });
   {
     auto edge_acc = edges_.access();
     for (auto edge : current_deleted_edges) {
@@ -1791,21 +2215,6 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
     }
   }
 
-  // EXPENSIVE full scan, is only run if an IN_MEMORY_ANALYTICAL transaction involved any deletions
-  // TODO: implement a fast internal iteration inside the skip_list (to avoid unnecessary find_node calls),
-  //  accessor.remove_if([](auto const & item){ return item.delta == nullptr && item.deleted;});
-  //  alternatively, an auxiliary data structure within skip_list to track these, hence a full scan wouldn't be needed
-  //  we will wait for evidence that this is needed before doing so.
-  if (need_full_scan_vertices) {
-    auto vertex_acc = vertices_.access();
-    for (auto &vertex : vertex_acc) {
-      // a deleted vertex which as no deltas must have come from IN_MEMORY_ANALYTICAL deletion
-      if (vertex.delta == nullptr && vertex.deleted) {
-        vertex_acc.remove(vertex);
-      }
-    }
-  }
-
   // EXPENSIVE full scan, is only run if an IN_MEMORY_ANALYTICAL transaction involved any deletions
   if (need_full_scan_edges) {
     auto edge_acc = edges_.access();
@@ -1816,6 +2225,8 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
       }
     }
   }
+  tasks.Wait();
+  MeasureGcPhase(metrics::GCObjectCleanupLatency_us, object_cleanup_timer);
 }
 
 // tell the linker he can find the CollectGarbage definitions here
@@ -1875,14 +2286,19 @@ bool InMemoryStorage::InitializeWalFile(memgraph::replication::ReplicationEpoch
     return false;
   if (!wal_file_) {
     wal_file_.emplace(recovery_.wal_directory_, uuid_, epoch.id(), config_.salient.items, name_id_mapper_.get(),
-                      wal_seq_num_++, &file_retainer_);
+                      wal_seq_num_++, &file_retainer_,
+                      config_.durability.compression ? durability::FileCompression::ZLIB
+                                                     : durability::FileCompression::NONE);
   }
   return true;
 }
 
 void InMemoryStorage::FinalizeWalFile() {
-  ++wal_unsynced_transactions_;
-  if (wal_unsynced_transactions_ >= config_.durability.wal_file_flush_every_n_tx) {
+  if (wal_group_commit_) {
+    // The committing transaction waits for the flusher to sync the WAL
+    // after it releases the engine lock.
+    wal_group_commit_->Enqueue();
+  } else if (++wal_unsynced_transactions_ >= config_.durability.wal_file_flush_every_n_tx) {
     wal_file_->Sync();
     wal_unsynced_transactions_ = 0;
   }
@@ -1899,170 +2315,198 @@ void InMemoryStorage::FinalizeWalFile() {
   }
 }
 
+namespace {
+/// Calls `callback` with each of the transaction's deltas and the vertex or
+/// edge it belongs to, in the order in which they are written to the WAL.
+template <typename TCallback>
+void ForEachDeltaInWalOrder(const Transaction &transaction, TCallback &&callback) {
+  // The transaction isn't published yet, so its deltas are still marked with
+  // its transaction id.
+  auto current_commit_timestamp = transaction.commit_timestamp->load(std::memory_order_acquire);
+
+  // Helper lambda that traverses the delta chain on order to find the first
+  // delta that should be processed and then appends all discovered deltas.
+  auto find_and_apply_deltas = [&](const auto *delta, const auto &parent, auto filter) {
+    while (true) {
+      auto *older = delta->next.load(std::memory_order_acquire);
+      if (older == nullptr || older->timestamp->load(std::memory_order_acquire) != current_commit_timestamp) break;
+      delta = older;
+    }
+    while (true) {
+      if (filter(delta->action)) {
+        callback(*delta, parent);
+      }
+      auto prev = delta->prev.Get();
+      MG_ASSERT(prev.type != PreviousPtr::Type::NULLPTR, "Invalid pointer!");
+      if (prev.type != PreviousPtr::Type::DELTA) break;
+      delta = prev.delta;
+    }
+  };
+
+  // The deltas are ordered correctly in the `transaction.deltas` buffer, but we
+  // don't traverse them in that order. That is because for each delta we need
+  // information about the vertex or edge they belong to and that information
+  // isn't stored in the deltas themselves. In order to find out information
+  // about the corresponding vertex or edge it is necessary to traverse the
+  // delta chain for each delta until a vertex or edge is encountered. This
+  // operation is very expensive as the chain grows.
+  // Instead, we traverse the edges until we find a vertex or edge and traverse
+  // their delta chains. This approach has a drawback because we lose the
+  // correct order of the operations. Because of that, we need to traverse the
+  // deltas several times and we have to manually ensure that the stored deltas
+  // will be ordered correctly.
+
+  // 1. Process all Vertex deltas and store all operations that create vertices
+  // and modify vertex data.
+  for (const auto &delta : transaction.deltas) {
+    auto prev = delta.prev.Get();
+    MG_ASSERT(prev.type != PreviousPtr::Type::NULLPTR, "Invalid pointer!");
+    if (prev.type != PreviousPtr::Type::VERTEX) continue;
+    find_and_apply_deltas(&delta, *prev.vertex, [](auto action) {
+      switch (action) {
+        case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+        case Delta::Action::DELETE_OBJECT:
+        case Delta::Action::SET_PROPERTY:
+        case Delta::Action::ADD_LABEL:
+        case Delta::Action::REMOVE_LABEL:
+          return true;
+
+        case Delta::Action::RECREATE_OBJECT:
+        case Delta::Action::ADD_IN_EDGE:
+        case Delta::Action::ADD_OUT_EDGE:
+        case Delta::Action::REMOVE_IN_EDGE:
+        case Delta::Action::REMOVE_OUT_EDGE:
+          return false;
+      }
+    });
+  }
+  // 2. Process all Vertex deltas and store all operations that create edges.
+  for (const auto &delta : transaction.deltas) {
+    auto prev = delta.prev.Get();
+    MG_ASSERT(prev.type != PreviousPtr::Type::NULLPTR, "Invalid pointer!");
+    if (prev.type != PreviousPtr::Type::VERTEX) continue;
+    find_and_apply_deltas(&delta, *prev.vertex, [](auto action) {
+      switch (action) {
+        case Delta::Action::REMOVE_OUT_EDGE:
+          return true;
+        case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+        case Delta::Action::DELETE_OBJECT:
+        case Delta::Action::RECREATE_OBJECT:
+        case Delta::Action::SET_PROPERTY:
+        case Delta::Action::ADD_LABEL:
+        case Delta::Action::REMOVE_LABEL:
+        case Delta::Action::ADD_IN_EDGE:
+        case Delta::Action::ADD_OUT_EDGE:
+        case Delta::Action::REMOVE_IN_EDGE:
+          return false;
+      }
+    });
+  }
+  // 3. Process all Edge deltas and store all operations that modify edge data.
+  for (const auto &delta : transaction.deltas) {
+    auto prev = delta.prev.Get();
+    MG_ASSERT(prev.type != PreviousPtr::Type::NULLPTR, "Invalid pointer!");
+    if (prev.type != PreviousPtr::Type::EDGE) continue;
+    find_and_apply_deltas(&delta, *prev.edge, [](auto action) {
+      switch (action) {
+        case Delta::Action::SET_PROPERTY:
+          return true;
+        case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+        case Delta::Action::DELETE_OBJECT:
+        case Delta::Action::RECREATE_OBJECT:
+        case Delta::Action::ADD_LABEL:
+        case Delta::Action::REMOVE_LABEL:
+        case Delta::Action::ADD_IN_EDGE:
+        case Delta::Action::ADD_OUT_EDGE:
+        case Delta::Action::REMOVE_IN_EDGE:
+        case Delta::Action::REMOVE_OUT_EDGE:
+          return false;
+      }
+    });
+  }
+  // 4. Process all Vertex deltas and store all operations that delete edges.
+  for (const auto &delta : transaction.deltas) {
+    auto prev = delta.prev.Get();
+    MG_ASSERT(prev.type != PreviousPtr::Type::NULLPTR, "Invalid pointer!");
+    if (prev.type != PreviousPtr::Type::VERTEX) continue;
+    find_and_apply_deltas(&delta, *prev.vertex, [](auto action) {
+      switch (action) {
+        case Delta::Action::ADD_OUT_EDGE:
+          return true;
+        case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+        case Delta::Action::DELETE_OBJECT:
+        case Delta::Action::RECREATE_OBJECT:
+        case Delta::Action::SET_PROPERTY:
+        case Delta::Action::ADD_LABEL:
+        case Delta::Action::REMOVE_LABEL:
+        case Delta::Action::ADD_IN_EDGE:
+        case Delta::Action::REMOVE_IN_EDGE:
+        case Delta::Action::REMOVE_OUT_EDGE:
+          return false;
+      }
+    });
+  }
+  // 5. Process all Vertex deltas and store all operations that delete vertices.
+  for (const auto &delta : transaction.deltas) {
+    auto prev = delta.prev.Get();
+    MG_ASSERT(prev.type != PreviousPtr::Type::NULLPTR, "Invalid pointer!");
+    if (prev.type != PreviousPtr::Type::VERTEX) continue;
+    find_and_apply_deltas(&delta, *prev.vertex, [](auto action) {
+      switch (action) {
+        case Delta::Action::RECREATE_OBJECT:
+          return true;
+        case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+        case Delta::Action::DELETE_OBJECT:
+        case Delta::Action::SET_PROPERTY:
+        case Delta::Action::ADD_LABEL:
+        case Delta::Action::REMOVE_LABEL:
+        case Delta::Action::ADD_IN_EDGE:
+        case Delta::Action::ADD_OUT_EDGE:
+        case Delta::Action::REMOVE_IN_EDGE:
+        case Delta::Action::REMOVE_OUT_EDGE:
+          return false;
+      }
+    });
+  }
+}
+}  // namespace
+
+std::optional<durability::EncodedDeltas> InMemoryStorage::EncodeWalDeltas(const Transaction &transaction,
+                                                                          uint64_t final_commit_timestamp) {
+  if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL ||
+      transaction.deltas.empty()) {
+    return std::nullopt;
+  }
+  durability::EncodedDeltas encoded_deltas;
+  ForEachDeltaInWalOrder(transaction, [&](const Delta &delta, const auto &parent) {
+    if constexpr (std::is_same_v<std::remove_cvref_t<decltype(parent)>, Vertex>) {
+      durability::EncodeDelta(&encoded_deltas.encoder, name_id_mapper_.get(), config_.salient.items, delta, parent,
+                              final_commit_timestamp);
+    } else {
+      durability::EncodeDelta(&encoded_deltas.encoder, name_id_mapper_.get(), delta, parent, final_commit_timestamp);
+    }
+    ++encoded_deltas.count;
+  });
+  return encoded_deltas;
+}
+
 bool InMemoryStorage::AppendToWal(const Transaction &transaction, uint64_t final_commit_timestamp,
+                                  const std::optional<durability::EncodedDeltas> &encoded_deltas,
                                   DatabaseAccessProtector db_acc) {
   if (!InitializeWalFile(repl_storage_state_.epoch_)) {
     return true;
   }
-  // Traverse deltas and append them to the WAL file.
-  // A single transaction will always be contained in a single WAL file.
-  auto current_commit_timestamp = transaction.commit_timestamp->load(std::memory_order_acquire);
 
   //////// AF only this calls initialize transaction
   repl_storage_state_.InitializeTransaction(wal_file_->SequenceNumber(), this, db_acc);
 
-  auto append_deltas = [&](auto callback) {
-    // Helper lambda that traverses the delta chain on order to find the first
-    // delta that should be processed and then appends all discovered deltas.
-    auto find_and_apply_deltas = [&](const auto *delta, const auto &parent, auto filter) {
-      while (true) {
-        auto *older = delta->next.load(std::memory_order_acquire);
-        if (older == nullptr || older->timestamp->load(std::memory_order_acquire) != current_commit_timestamp) break;
-        delta = older;
-      }
-      while (true) {
-        if (filter(delta->action)) {
-          callback(*delta, parent, final_commit_timestamp);
-        }
-        auto prev = delta->prev.Get();
-        MG_ASSERT(prev.type != PreviousPtr::Type::NULLPTR, "Invalid pointer!");
-        if (prev.type != PreviousPtr::Type::DELTA) break;
-        delta = prev.delta;
-      }
-    };
-
-    // The deltas are ordered correctly in the `transaction.deltas` buffer, but we
-    // don't traverse them in that order. That is because for each delta we need
-    // information about the vertex or edge they belong to and that information
-    // isn't stored in the deltas themselves. In order to find out information
-    // about the corresponding vertex or edge it is necessary to traverse the
-    // delta chain for each delta until a vertex or edge is encountered. This
-    // operation is very expensive as the chain grows.
-    // Instead, we traverse the edges until we find a vertex or edge and traverse
-    // their delta chains. This approach has a drawback because we lose the
-    // correct order of the operations. Because of that, we need to traverse the
-    // deltas several times and we have to manually ensure that the stored deltas
-    // will be ordered correctly.
-
-    // 1. Process all Vertex deltas and store all operations that create vertices
-    // and modify vertex data.
-    for (const auto &delta : transaction.deltas) {
-      auto prev = delta.prev.Get();
-      MG_ASSERT(prev.type != PreviousPtr::Type::NULLPTR, "Invalid pointer!");
-      if (prev.type != PreviousPtr::Type::VERTEX) continue;
-      find_and_apply_deltas(&delta, *prev.vertex, [](auto action) {
-        switch (action) {
-          case Delta::Action::DELETE_DESERIALIZED_OBJECT:
-          case Delta::Action::DELETE_OBJECT:
-          case Delta::Action::SET_PROPERTY:
-          case Delta::Action::ADD_LABEL:
-          case Delta::Action::REMOVE_LABEL:
-            return true;
-
-          case Delta::Action::RECREATE_OBJECT:
-          case Delta::Action::ADD_IN_EDGE:
-          case Delta::Action::ADD_OUT_EDGE:
-          case Delta::Action::REMOVE_IN_EDGE:
-          case Delta::Action::REMOVE_OUT_EDGE:
-            return false;
-        }
-      });
-    }
-    // 2. Process all Vertex deltas and store all operations that create edges.
-    for (const auto &delta : transaction.deltas) {
-      auto prev = delta.prev.Get();
-      MG_ASSERT(prev.type != PreviousPtr::Type::NULLPTR, "Invalid pointer!");
-      if (prev.type != PreviousPtr::Type::VERTEX) continue;
-      find_and_apply_deltas(&delta, *prev.vertex, [](auto action) {
-        switch (action) {
-          case Delta::Action::REMOVE_OUT_EDGE:
-            return true;
-          case Delta::Action::DELETE_DESERIALIZED_OBJECT:
-          case Delta::Action::DELETE_OBJECT:
-          case Delta::Action::RECREATE_OBJECT:
-          case Delta::Action::SET_PROPERTY:
-          case Delta::Action::ADD_LABEL:
-          case Delta::Action::REMOVE_LABEL:
-          case Delta::Action::ADD_IN_EDGE:
-          case Delta::Action::ADD_OUT_EDGE:
-          case Delta::Action::REMOVE_IN_EDGE:
-            return false;
-        }
-      });
-    }
-    // 3. Process all Edge deltas and store all operations that modify edge data.
-    for (const auto &delta : transaction.deltas) {
-      auto prev = delta.prev.Get();
-      MG_ASSERT(prev.type != PreviousPtr::Type::NULLPTR, "Invalid pointer!");
-      if (prev.type != PreviousPtr::Type::EDGE) continue;
-      find_and_apply_deltas(&delta, *prev.edge, [](auto action) {
-        switch (action) {
-          case Delta::Action::SET_PROPERTY:
-            return true;
-          case Delta::Action::DELETE_DESERIALIZED_OBJECT:
-          case Delta::Action::DELETE_OBJECT:
-          case Delta::Action::RECREATE_OBJECT:
-          case Delta::Action::ADD_LABEL:
-          case Delta::Action::REMOVE_LABEL:
-          case Delta::Action::ADD_IN_EDGE:
-          case Delta::Action::ADD_OUT_EDGE:
-          case Delta::Action::REMOVE_IN_EDGE:
-          case Delta::Action::REMOVE_OUT_EDGE:
-            return false;
-        }
-      });
-    }
-    // 4. Process all Vertex deltas and store all operations that delete edges.
-    for (const auto &delta : transaction.deltas) {
-      auto prev = delta.prev.Get();
-      MG_ASSERT(prev.type != PreviousPtr::Type::NULLPTR, "Invalid pointer!");
-      if (prev.type != PreviousPtr::Type::VERTEX) continue;
-      find_and_apply_deltas(&delta, *prev.vertex, [](auto action) {
-        switch (action) {
-          case Delta::Action::ADD_OUT_EDGE:
-            return true;
-          case Delta::Action::DELETE_DESERIALIZED_OBJECT:
-          case Delta::Action::DELETE_OBJECT:
-          case Delta::Action::RECREATE_OBJECT:
-          case Delta::Action::SET_PROPERTY:
-          case Delta::Action::ADD_LABEL:
-          case Delta::Action::REMOVE_LABEL:
-          case Delta::Action::ADD_IN_EDGE:
-          case Delta::Action::REMOVE_IN_EDGE:
-          case Delta::Action::REMOVE_OUT_EDGE:
-            return false;
-        }
-      });
-    }
-    // 5. Process all Vertex deltas and store all operations that delete vertices.
-    for (const auto &delta : transaction.deltas) {
-      auto prev = delta.prev.Get();
-      MG_ASSERT(prev.type != PreviousPtr::Type::NULLPTR, "Invalid pointer!");
-      if (prev.type != PreviousPtr::Type::VERTEX) continue;
-      find_and_apply_deltas(&delta, *prev.vertex, [](auto action) {
-        switch (action) {
-          case Delta::Action::RECREATE_OBJECT:
-            return true;
-          case Delta::Action::DELETE_DESERIALIZED_OBJECT:
-          case Delta::Action::DELETE_OBJECT:
-          case Delta::Action::SET_PROPERTY:
-          case Delta::Action::ADD_LABEL:
-          case Delta::Action::REMOVE_LABEL:
-          case Delta::Action::ADD_IN_EDGE:
-          case Delta::Action::ADD_OUT_EDGE:
-          case Delta::Action::REMOVE_IN_EDGE:
-          case Delta::Action::REMOVE_OUT_EDGE:
-            return false;
-        }
-      });
-    }
-  };
-
   // Handle MVCC deltas
-  if (!transaction.deltas.empty()) {
-    append_deltas([&](const Delta &delta, const auto &parent, uint64_t timestamp) {
-      wal_file_->AppendDelta(delta, parent, timestamp);
-      repl_storage_state_.AppendDelta(delta, parent, timestamp);
+  if (encoded_deltas) {
+    wal_file_->AppendDeltas(*encoded_deltas, final_commit_timestamp);
+  }
+  if (!transaction.deltas.empty() && repl_storage_state_.HasReplicas()) {
+    ForEachDeltaInWalOrder(transaction, [&](const Delta &delta, const auto &parent) {
+      repl_storage_state_.AppendDelta(delta, parent, final_commit_timestamp);
     });
   }
 
@@ -2080,7 +2524,7 @@ bool InMemoryStorage::AppendToWal(const Transaction &transaction, uint64_t final
       case MetadataDelta::Action::LABEL_PROPERTY_INDEX_CREATE: {
         const auto &info = md_delta.label_property;
         AppendToWalDataDefinition(durability::StorageMetadataOperation::LABEL_PROPERTY_INDEX_CREATE, info.label,
-                                  {info.property}, final_commit_timestamp);
+                                  std::set{info.property}, final_commit_timestamp);
       } break;
       case MetadataDelta::Action::LABEL_INDEX_DROP: {
         AppendToWalDataDefinition(durability::StorageMetadataOperation::LABEL_INDEX_DROP, md_delta.label,
@@ -2093,7 +2537,27 @@ bool InMemoryStorage::AppendToWal(const Transaction &transaction, uint64_t final
       case MetadataDelta::Action::LABEL_PROPERTY_INDEX_DROP: {
         const auto &info = md_delta.label_property;
         AppendToWalDataDefinition(durability::StorageMetadataOperation::LABEL_PROPERTY_INDEX_DROP, info.label,
-                                  {info.property}, final_commit_timestamp);
+                                  std::set{info.property}, final_commit_timestamp);
+      } break;
+      case MetadataDelta::Action::EDGE_PROPERTY_INDEX_CREATE: {
+        const auto &info = md_delta.edge_type_property;
+        AppendToWalDataDefinition(durability::StorageMetadataOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE,
+                                  info.edge_type, info.property, final_commit_timestamp);
+      } break;
+      case MetadataDelta::Action::EDGE_PROPERTY_INDEX_DROP: {
+        const auto &info = md_delta.edge_type_property;
+        AppendToWalDataDefinition(durability::StorageMetadataOperation::EDGE_TYPE_PROPERTY_INDEX_DROP,
+                                  info.edge_type, info.property, final_commit_timestamp);
+      } break;
+      case MetadataDelta::Action::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE: {
+        const auto &info = md_delta.label_ordered_properties;
+        AppendToWalDataDefinition(durability::StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE,
+                                  info.label, info.properties, final_commit_timestamp);
+      } break;
+      case MetadataDelta::Action::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+        const auto &info = md_delta.label_ordered_properties;
+        AppendToWalDataDefinition(durability::StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP,
+                                  info.label, info.properties, final_commit_timestamp);
       } break;
       case MetadataDelta::Action::LABEL_INDEX_STATS_SET: {
         const auto &info = md_delta.label_stats;
@@ -2130,12 +2594,12 @@ bool InMemoryStorage::AppendToWal(const Transaction &transaction, uint64_t final
       case MetadataDelta::Action::EXISTENCE_CONSTRAINT_CREATE: {
         const auto &info = md_delta.label_property;
         AppendToWalDataDefinition(durability::StorageMetadataOperation::EXISTENCE_CONSTRAINT_CREATE, info.label,
-                                  {info.property}, final_commit_timestamp);
+                                  std::set{info.property}, final_commit_timestamp);
       } break;
       case MetadataDelta::Action::EXISTENCE_CONSTRAINT_DROP: {
         const auto &info = md_delta.label_property;
         AppendToWalDataDefinition(durability::StorageMetadataOperation::EXISTENCE_CONSTRAINT_DROP, info.label,
-                                  {info.property}, final_commit_timestamp);
+                                  std::set{info.property}, final_commit_timestamp);
       } break;
       case MetadataDelta::Action::UNIQUE_CONSTRAINT_CREATE: {
         const auto &info = md_delta.label_properties;
@@ -2173,6 +2637,12 @@ void InMemoryStorage::AppendToWalDataDefinition(durability::StorageMetadataOpera
   repl_storage_state_.AppendOperation(operation, edge_type, final_commit_timestamp);
 }
 
+void InMemoryStorage::AppendToWalDataDefinition(durability::StorageMetadataOperation operation, EdgeTypeId edge_type,
+                                                PropertyId property, uint64_t final_commit_timestamp) {
+  wal_file_->AppendOperation(operation, edge_type, property, final_commit_timestamp);
+  repl_storage_state_.AppendOperation(operation, edge_type, property, final_commit_timestamp);
+}
+
 void InMemoryStorage::AppendToWalDataDefinition(durability::StorageMetadataOperation operation, LabelId label,
                                                 const std::set<PropertyId> &properties,
                                                 LabelPropertyIndexStats property_stats,
@@ -2197,6 +2667,13 @@ void InMemoryStorage::AppendToWalDataDefinition(durability::StorageMetadataOpera
   return AppendToWalDataDefinition(operation, label, {}, {}, final_commit_timestamp);
 }
 
+void InMemoryStorage::AppendToWalDataDefinition(durability::StorageMetadataOperation operation, LabelId label,
+                                                const std::vector<PropertyId> &properties,
+                                                uint64_t final_commit_timestamp) {
+  wal_file_->AppendOperation(operation, label, properties, final_commit_timestamp);
+  repl_storage_state_.AppendOperation(operation, label, properties, final_commit_timestamp);
+}
+
 void InMemoryStorage::AppendToWalDataDefinition(durability::StorageMetadataOperation operation,
                                                 const std::optional<std::string> text_index_name, LabelId label,
                                                 uint64_t final_commit_timestamp) {
@@ -2232,15 +2709,72 @@ utils::BasicResult<InMemoryStorage::CreateSnapshotError> InMemoryStorage::Create
   return {};
 }
 
+void InMemoryStorage::BuildIndexOnline(memgraph::replication_coordination_glue::ReplicationRole replication_role,
+                                       LabelId label, std::optional<PropertyId> property) {
+  if (!BuildsIndexOnline()) {
+    return;
+  }
+  auto *mem_label_index = static_cast<InMemoryLabelIndex *>(indices_.label_index_.get());
+  auto *mem_label_property_index = static_cast<InMemoryLabelPropertyIndex *>(indices_.label_property_index_.get());
+
+  {
+    // Writers look the indices up without locking, so only registering the
+    // index excludes them. From then on they insert the vertices they change.
+    auto main_guard = std::unique_lock{main_lock_};
+    const bool registered =
+        property ? mem_label_property_index->RegisterIndex(label, *property) : mem_label_index->RegisterIndex(label);
+    if (!registered) {
+      return;
+    }
+  }
+
+  try {
+    // The transaction keeps the versions older than the registration from
+    // being collected while they are read.
+    auto accessor = Access(replication_role);
+    const auto timestamp = accessor->GetTransaction()->start_timestamp;
+    if (property) {
+      mem_label_property_index->PopulateIndex(label, *property, vertices_.access(), timestamp);
+    } else {
+      mem_label_index->PopulateIndex(label, vertices_.access(), timestamp);
+    }
+  } catch (...) {
+    AbortIndexOnline(label, property);
+    throw;
+  }
+}
+
+void InMemoryStorage::AbortIndexOnline(LabelId label, std::optional<PropertyId> property) {
+  utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+  auto main_guard = std::unique_lock{main_lock_};
+  if (property) {
+    static_cast<InMemoryLabelPropertyIndex *>(indices_.label_property_index_.get())
+        ->DropRegisteredIndex(label, *property);
+  } else {
+    static_cast<InMemoryLabelIndex *>(indices_.label_index_.get())->DropRegisteredIndex(label);
+  }
+}
+
 void InMemoryStorage::FreeMemory(std::unique_lock<utils::ResourceLock> main_guard, bool periodic) {
   CollectGarbage(std::move(main_guard), periodic);
 
-  static_cast<InMemoryLabelIndex *>(indices_.label_index_.get())->RunGC();
-  static_cast<InMemoryLabelPropertyIndex *>(indices_.label_property_index_.get())->RunGC();
+  // Every skip list frees its removed nodes independently.
+  utils::Timer skip_list_cleanup_timer;
+  GcTasks tasks(gc_pool_);
+  tasks.Run([this] { static_cast<InMemoryLabelIndex *>(indices_.label_index_.get())->RunGC(); });
+  tasks.Run([this] { static_cast<InMemoryLabelPropertyIndex *>(indices_.label_property_index_.get())->RunGC(); });
+  tasks.Run([this] {
+    static_cast<InMemoryLabelPropertyCompositeIndex *>(indices_.label_property_composite_index_.get())->RunGC();
+  });
+  tasks.Run([this] {
+    static_cast<InMemoryEdgeTypePropertyIndex *>(indices_.edge_type_property_index_.get())->RunGC();
+  });
 
   // SkipList is already threadsafe
-  vertices_.run_gc();
+  tasks.Run([this] { vertices_.run_gc(); });
   edges_.run_gc();
+  tasks.Wait();
+  MeasureGcPhase(metrics::GCSkipListCleanupLatency_us, skip_list_cleanup_timer);
 }
 
 uint64_t InMemoryStorage::CommitTimestamp(const std::optional<uint64_t> desired_commit_timestamp) {
@@ -2252,7 +2786,7 @@ uint64_t InMemoryStorage::CommitTimestamp(const std::optional<uint64_t> desired_
 }
 
 void InMemoryStorage::PrepareForNewEpoch() {
-  std::unique_lock engine_guard{engine_lock_};
+  std::unique_lock publication_guard{commit_sequencer_};
   if (wal_file_) {
     wal_file_->FinalizeWal();
     wal_file_.reset();
@@ -2330,9 +2864,18 @@ IndicesInfo InMemoryStorage::InMemoryAccessor::ListAllIndices() const {
   auto *mem_label_property_index =
       static_cast<InMemoryLabelPropertyIndex *>(in_memory->indices_.label_property_index_.get());
   auto *mem_edge_type_index = static_cast<InMemoryEdgeTypeIndex *>(in_memory->indices_.edge_type_index_.get());
+  auto *mem_edge_type_property_index =
+      static_cast<InMemoryEdgeTypePropertyIndex *>(in_memory->indices_.edge_type_property_index_.get());
+  auto *mem_label_property_composite_index =
+      static_cast<InMemoryLabelPropertyCompositeIndex *>(in_memory->indices_.label_property_composite_index_.get());
   auto &text_index = storage_->indices_.text_index_;
-  return {mem_label_index->ListIndices(), mem_label_property_index->ListIndices(), mem_edge_type_index->ListIndices(),
-          text_index.ListIndices()};
+  return {mem_label_index->ListIndices(),
+          mem_label_property_index->ListIndices(),
+          mem_edge_type_index->ListIndices(),
+          mem_edge_type_property_index->ListIndices(),
+          text_index.ListIndices(),
+          mem_label_property_composite_index->ListIndices(),
+          in_memory->indices_.label_property_hash_index_.ListIndices()};
 }
 ConstraintsInfo InMemoryStorage::InMemoryAccessor::ListAllConstraints() const {
   const auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
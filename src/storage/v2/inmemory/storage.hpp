@@ -15,11 +15,16 @@
 #include <cstdint>
 #include <memory>
 #include <utility>
+#include "storage/v2/commit_sequencer.hpp"
 #include "storage/v2/indices/label_index_stats.hpp"
+#include "storage/v2/durability/wal_group_commit.hpp"
 #include "storage/v2/inmemory/edge_type_index.hpp"
+#include "storage/v2/inmemory/edge_type_property_index.hpp"
 #include "storage/v2/inmemory/label_index.hpp"
+#include "storage/v2/inmemory/label_property_composite_index.hpp"
 #include "storage/v2/inmemory/label_property_index.hpp"
 #include "storage/v2/inmemory/replication/recovery.hpp"
+#include "storage/v2/inmemory/vertex_directory.hpp"
 #include "storage/v2/replication/replication_client.hpp"
 #include "storage/v2/storage.hpp"
 
@@ -34,6 +39,7 @@
 #include "utils/memory.hpp"
 #include "utils/resource_lock.hpp"
 #include "utils/synchronized.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace memgraph::dbms {
 class InMemoryReplicationHandlers;
@@ -54,7 +60,10 @@ class InMemoryStorage final : public Storage {
                                                     const InMemoryStorage *storage);
   friend class InMemoryLabelIndex;
   friend class InMemoryLabelPropertyIndex;
+  friend class InMemoryLabelPropertyCompositeIndex;
+  friend class InMemoryLabelPropertyHashIndex;
   friend class InMemoryEdgeTypeIndex;
+  friend class InMemoryEdgeTypePropertyIndex;
 
  public:
   enum class CreateSnapshotError : uint8_t { DisabledForReplica, ReachedMaxNumTries };
@@ -109,8 +118,25 @@ class InMemoryStorage final : public Storage {
                               const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                               const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
 
+    VerticesIterable Vertices(LabelId label, const std::vector<PropertyId> &properties,
+                              const std::vector<PropertyValue> &prefix,
+                              const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                              const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
+
     EdgesIterable Edges(EdgeTypeId edge_type, View view) override;
 
+    EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property, View view) override;
+
+    EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value, View view) override;
+
+    EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property,
+                        const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                        const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
+
+    std::vector<VerticesIterable> ChunkedVertices(View view, uint64_t num_chunks) override;
+
+    std::vector<VerticesIterable> ChunkedVertices(LabelId label, View view, uint64_t num_chunks) override;
+
     /// Return approximate number of all vertices in the database.
     /// Note that this is always an over-estimate and never an under-estimate.
     uint64_t ApproximateVertexCount() const override {
@@ -127,16 +153,24 @@ class InMemoryStorage final : public Storage {
     /// Return approximate number of vertices with the given label and property.
     /// Note that this is always an over-estimate and never an under-estimate.
     uint64_t ApproximateVertexCount(LabelId label, PropertyId property) const override {
-      return static_cast<InMemoryStorage *>(storage_)->indices_.label_property_index_->ApproximateVertexCount(label,
-                                                                                                              property);
+      const auto &indices = static_cast<InMemoryStorage *>(storage_)->indices_;
+      if (!indices.label_property_index_->IndexExists(label, property) &&
+          indices.label_property_hash_index_.IndexExists(label, property)) {
+        return indices.label_property_hash_index_.ApproximateVertexCount(label, property);
+      }
+      return indices.label_property_index_->ApproximateVertexCount(label, property);
     }
 
     /// Return approximate number of vertices with the given label and the given
     /// value for the given property. Note that this is always an over-estimate
     /// and never an under-estimate.
     uint64_t ApproximateVertexCount(LabelId label, PropertyId property, const PropertyValue &value) const override {
-      return static_cast<InMemoryStorage *>(storage_)->indices_.label_property_index_->ApproximateVertexCount(
-          label, property, value);
+      const auto &indices = static_cast<InMemoryStorage *>(storage_)->indices_;
+      // Lookups by value use the hash index if there is one.
+      if (indices.label_property_hash_index_.IndexExists(label, property)) {
+        return indices.label_property_hash_index_.ApproximateVertexCount(label, property, value);
+      }
+      return indices.label_property_index_->ApproximateVertexCount(label, property, value);
     }
 
     /// Return approximate number of vertices with the given label and value for
@@ -149,10 +183,35 @@ class InMemoryStorage final : public Storage {
           label, property, lower, upper);
     }
 
+    /// Return approximate number of vertices in the composite index on
+    /// `properties` whose values of the first properties are equal to `prefix`.
+    uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                    const std::vector<PropertyValue> &prefix) const override {
+      return static_cast<InMemoryStorage *>(storage_)->indices_.label_property_composite_index_->ApproximateVertexCount(
+          label, properties, prefix);
+    }
+
     uint64_t ApproximateEdgeCount(EdgeTypeId id) const override {
       return static_cast<InMemoryStorage *>(storage_)->indices_.edge_type_index_->ApproximateEdgeCount(id);
     }
 
+    uint64_t ApproximateEdgeCount(EdgeTypeId id, PropertyId property) const override {
+      return static_cast<InMemoryStorage *>(storage_)->indices_.edge_type_property_index_->ApproximateEdgeCount(
+          id, property);
+    }
+
+    uint64_t ApproximateEdgeCount(EdgeTypeId id, PropertyId property, const PropertyValue &value) const override {
+      return static_cast<InMemoryStorage *>(storage_)->indices_.edge_type_property_index_->ApproximateEdgeCount(
+          id, property, value);
+    }
+
+    uint64_t ApproximateEdgeCount(EdgeTypeId id, PropertyId property,
+                                  const std::optional<utils::Bound<PropertyValue>> &lower,
+                                  const std::optional<utils::Bound<PropertyValue>> &upper) const override {
+      return static_cast<InMemoryStorage *>(storage_)->indices_.edge_type_property_index_->ApproximateEdgeCount(
+          id, property, lower, upper);
+    }
+
     template <typename TResult, typename TIndex, typename TIndexKey>
     std::optional<TResult> GetIndexStatsForIndex(TIndex *index, TIndexKey &&key) const {
       return index->GetIndexStats(key);
@@ -212,10 +271,20 @@ class InMemoryStorage final : public Storage {
       return static_cast<InMemoryStorage *>(storage_)->indices_.label_property_index_->IndexExists(label, property);
     }
 
+    bool LabelPropertyCompositeIndexExists(LabelId label, const std::vector<PropertyId> &properties) const override {
+      return static_cast<InMemoryStorage *>(storage_)->indices_.label_property_composite_index_->IndexExists(
+          label, properties);
+    }
+
     bool EdgeTypeIndexExists(EdgeTypeId edge_type) const override {
       return static_cast<InMemoryStorage *>(storage_)->indices_.edge_type_index_->IndexExists(edge_type);
     }
 
+    bool EdgeTypePropertyIndexExists(EdgeTypeId edge_type, PropertyId property) const override {
+      return static_cast<InMemoryStorage *>(storage_)->indices_.edge_type_property_index_->IndexExists(edge_type,
+                                                                                                       property);
+    }
+
     IndicesInfo ListAllIndices() const override;
 
     ConstraintsInfo ListAllConstraints() const override;
@@ -259,6 +328,24 @@ class InMemoryStorage final : public Storage {
     /// @throw std::bad_alloc
     utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(EdgeTypeId edge_type) override;
 
+    /// Create an index on the edge-type and a property of its edges.
+    /// Returns void if the index has been created.
+    /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+    /// * `ReplicationError`:  there is at least one SYNC replica that has not confirmed receiving the transaction.
+    /// * `IndexDefinitionError`: the index already exists or properties on edges are disabled.
+    /// @throw std::bad_alloc
+    utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(EdgeTypeId edge_type,
+                                                                      PropertyId property) override;
+
+    /// Create a composite index on the ordered list of properties.
+    /// Returns void if the index has been created.
+    /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+    /// * `ReplicationError`:  there is at least one SYNC replica that has not confirmed receiving the transaction.
+    /// * `IndexDefinitionError`: the index already exists.
+    /// @throw std::bad_alloc
+    utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(LabelId label,
+                                                                      std::vector<PropertyId> properties) override;
+
     /// Drop an existing index.
     /// Returns void if the index has been dropped.
     /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
@@ -280,6 +367,22 @@ class InMemoryStorage final : public Storage {
     /// * `IndexDefinitionError`: the index does not exist.
     utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(EdgeTypeId edge_type) override;
 
+    /// Drop an existing edge-type+property index.
+    /// Returns void if the index has been dropped.
+    /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+    /// * `ReplicationError`:  there is at least one SYNC replica that has not confirmed receiving the transaction.
+    /// * `IndexDefinitionError`: the index does not exist.
+    utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(EdgeTypeId edge_type,
+                                                                    PropertyId property) override;
+
+    /// Drop an existing composite index.
+    /// Returns void if the index has been dropped.
+    /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+    /// * `ReplicationError`:  there is at least one SYNC replica that has not confirmed receiving the transaction.
+    /// * `IndexDefinitionError`: the index does not exist.
+    utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(LabelId label,
+                                                                    std::vector<PropertyId> properties) override;
+
     /// Returns void if the existence constraint has been created.
     /// Returns `StorageExistenceConstraintDefinitionError` if an error occures. Error can be:
     /// * `ReplicationError`: there is at least one SYNC replica that has not confirmed receiving the transaction.
@@ -359,6 +462,21 @@ class InMemoryStorage final : public Storage {
   std::unique_ptr<Accessor> UniqueAccess(memgraph::replication_coordination_glue::ReplicationRole replication_role,
                                          std::optional<IsolationLevel> override_isolation_level) override;
 
+  /// Registers the index with unique access, populates it with shared access
+  /// and leaves it to `CreateIndex` to make it visible, see
+  /// `Config::IndexCreation::online`.
+  /// @throw std::bad_alloc
+  void BuildIndexOnline(memgraph::replication_coordination_glue::ReplicationRole replication_role, LabelId label,
+                        std::optional<PropertyId> property) override;
+
+  bool BuildsIndexOnline() const override {
+    return config_.index_creation.online && storage_mode_ == StorageMode::IN_MEMORY_TRANSACTIONAL;
+  }
+
+  /// Drops an index registered by `BuildIndexOnline` if it wasn't created yet.
+  /// Takes unique access to the storage.
+  void AbortIndexOnline(LabelId label, std::optional<PropertyId> property) override;
+
   void FreeMemory(std::unique_lock<utils::ResourceLock> main_guard, bool periodic) override;
 
   utils::FileRetainer::FileLockerAccessor::ret_type IsPathLocked();
@@ -398,15 +516,25 @@ class InMemoryStorage final : public Storage {
   StorageInfo GetBaseInfo() override;
   StorageInfo GetInfo(memgraph::replication_coordination_glue::ReplicationRole replication_role) override;
 
+  /// Encodes the WAL records of the transaction's deltas. It is done before
+  /// the transaction's turn to be published, while other transactions commit.
+  std::optional<durability::EncodedDeltas> EncodeWalDeltas(const Transaction &transaction,
+                                                           uint64_t final_commit_timestamp);
+
   /// Return true in all cases except if any sync replicas have not sent confirmation.
   [[nodiscard]] bool AppendToWal(const Transaction &transaction, uint64_t final_commit_timestamp,
+                                 const std::optional<durability::EncodedDeltas> &encoded_deltas,
                                  DatabaseAccessProtector db_acc);
   void AppendToWalDataDefinition(durability::StorageMetadataOperation operation, LabelId label,
                                  uint64_t final_commit_timestamp);
   void AppendToWalDataDefinition(durability::StorageMetadataOperation operation, EdgeTypeId edge_type,
                                  uint64_t final_commit_timestamp);
+  void AppendToWalDataDefinition(durability::StorageMetadataOperation operation, EdgeTypeId edge_type,
+                                 PropertyId property, uint64_t final_commit_timestamp);
   void AppendToWalDataDefinition(durability::StorageMetadataOperation operation, LabelId label,
                                  const std::set<PropertyId> &properties, uint64_t final_commit_timestamp);
+  void AppendToWalDataDefinition(durability::StorageMetadataOperation operation, LabelId label,
+                                 const std::vector<PropertyId> &properties, uint64_t final_commit_timestamp);
   void AppendToWalDataDefinition(durability::StorageMetadataOperation operation, LabelId label, LabelIndexStats stats,
                                  uint64_t final_commit_timestamp);
   void AppendToWalDataDefinition(durability::StorageMetadataOperation operation, LabelId label,
@@ -427,6 +555,8 @@ class InMemoryStorage final : public Storage {
   // Main object storage
   utils::SkipList<storage::Vertex> vertices_;
   utils::SkipList<storage::Edge> edges_;
+  // Optional gid -> vertex table next to `vertices_`, kept in sync with it.
+  VertexDirectory vertex_directory_;
 
   // Durability
   durability::Recovery recovery_;
@@ -444,6 +574,12 @@ class InMemoryStorage final : public Storage {
 
   std::optional<durability::WalFile> wal_file_;
   uint64_t wal_unsynced_transactions_{0};
+  // Syncs the WAL for committing transactions in group commit mode.
+  std::optional<durability::WalGroupCommit> wal_group_commit_;
+
+  // Orders the publication of committed transactions, including their writes
+  // to the WAL. Locking it keeps the WAL from being written to.
+  mutable CommitSequencer commit_sequencer_;
 
   utils::FileRetainer file_retainer_;
 
@@ -458,16 +594,19 @@ class InMemoryStorage final : public Storage {
 
   utils::Scheduler gc_runner_;
   std::mutex gc_lock_;
+  // Additional threads the GC phases are split between, empty if the GC runs
+  // on a single thread.
+  std::optional<utils::ThreadPool> gc_pool_;
 
   struct GCDeltas {
-    GCDeltas(uint64_t mark_timestamp, std::deque<Delta> deltas, std::unique_ptr<std::atomic<uint64_t>> commit_timestamp)
+    GCDeltas(uint64_t mark_timestamp, DeltaContainer deltas, std::unique_ptr<std::atomic<uint64_t>> commit_timestamp)
         : mark_timestamp_{mark_timestamp}, deltas_{std::move(deltas)}, commit_timestamp_{std::move(commit_timestamp)} {}
 
     GCDeltas(GCDeltas &&) = default;
     GCDeltas &operator=(GCDeltas &&) = default;
 
     uint64_t mark_timestamp_{};                                  //!< a timestamp no active transaction currently has
-    std::deque<Delta> deltas_;                                   //!< the deltas that need cleaning
+    DeltaContainer deltas_;                                      //!< the deltas that need cleaning
     std::unique_ptr<std::atomic<uint64_t>> commit_timestamp_{};  //!< the timestamp the deltas are pointing at
   };
 
@@ -477,6 +616,11 @@ class InMemoryStorage final : public Storage {
   // Ownership of unlinked deltas is transferred to garabage_undo_buffers once transaction is commited/aborted
   utils::Synchronized<std::list<GCDeltas>, utils::SpinLock> garbage_undo_buffers_{};
 
+  // Deltas unlinked by GC runs which left some unlinkable transactions for a
+  // later run. They are moved to garbage_undo_buffers_ once no unlinkable
+  // transaction is left. Protected by gc_lock_.
+  std::list<GCDeltas> gc_unlinked_undo_buffers_{};
+
   // Vertices that are logically deleted but still have to be removed from
   // indices before removing them from the main storage.
   utils::Synchronized<std::list<Gid>, utils::SpinLock> deleted_vertices_;
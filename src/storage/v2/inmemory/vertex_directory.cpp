@@ -0,0 +1,75 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/inmemory/vertex_directory.hpp"
+
+#include <mutex>
+
+namespace memgraph::storage {
+
+void VertexDirectory::Enable() {
+  if (chunks_) return;
+  chunks_ = std::make_unique<std::atomic<Chunk *>[]>(kMaxChunks);
+}
+
+VertexDirectory::Chunk *VertexDirectory::FindChunk(uint64_t gid) const {
+  return chunks_[gid >> kChunkBits].load(std::memory_order_acquire);
+}
+
+VertexDirectory::Chunk *VertexDirectory::GetOrCreateChunk(uint64_t gid) {
+  if (auto *chunk = FindChunk(gid)) return chunk;
+
+  auto guard = std::lock_guard{chunks_lock_};
+  if (auto *chunk = FindChunk(gid)) return chunk;
+  auto *chunk = owned_chunks_.emplace_back(std::make_unique<Chunk>()).get();
+  chunks_[gid >> kChunkBits].store(chunk, std::memory_order_release);
+  return chunk;
+}
+
+std::optional<Vertex *> VertexDirectory::Find(Gid gid) const {
+  const auto id = gid.AsUint();
+  if (!chunks_ || (id >> kChunkBits) >= kMaxChunks) return std::nullopt;
+  const auto *chunk = FindChunk(id);
+  if (!chunk) return nullptr;
+  return chunk->vertices[id & (kChunkSize - 1)].load(std::memory_order_acquire);
+}
+
+void VertexDirectory::Insert(Vertex *vertex) {
+  const auto id = vertex->gid.AsUint();
+  if (!chunks_ || (id >> kChunkBits) >= kMaxChunks) return;
+  GetOrCreateChunk(id)->vertices[id & (kChunkSize - 1)].store(vertex, std::memory_order_release);
+}
+
+void VertexDirectory::Remove(Gid gid) {
+  const auto id = gid.AsUint();
+  if (!chunks_ || (id >> kChunkBits) >= kMaxChunks) return;
+  // Don't allocate a chunk just to clear an entry.
+  if (auto *chunk = FindChunk(id)) chunk->vertices[id & (kChunkSize - 1)].store(nullptr, std::memory_order_release);
+}
+
+void VertexDirectory::Clear() {
+  if (!chunks_) return;
+  auto guard = std::lock_guard{chunks_lock_};
+  for (uint64_t i = 0; i < kMaxChunks; ++i) {
+    chunks_[i].store(nullptr, std::memory_order_release);
+  }
+  owned_chunks_.clear();
+}
+
+void VertexDirectory::Rebuild(utils::SkipList<Vertex>::Accessor vertices) {
+  if (!chunks_) return;
+  Clear();
+  for (auto &vertex : vertices) {
+    Insert(&vertex);
+  }
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,88 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/vertex.hpp"
+#include "utils/skip_list.hpp"
+#include "utils/spin_lock.hpp"
+
+namespace memgraph::storage {
+
+/// Opt-in dense table from vertex gids to the vertices in the vertex skip
+/// list.
+///
+/// Gids are handed out by a counter, so the table is addressed directly by the
+/// gid and finding a vertex takes two loads instead of a skip list search.
+/// Chunks of the table are allocated as the gids grow and are kept until the
+/// table is cleared.
+///
+/// The table mirrors the skip list: a vertex is added after it's inserted into
+/// the skip list and removed before it's removed from the skip list. A reader
+/// which holds a skip list accessor while looking up a vertex therefore never
+/// gets a vertex the skip list has already freed.
+class VertexDirectory {
+ public:
+  // 64Ki vertices per chunk and 64Ki chunks cover 2^32 gids. Vertices with
+  // larger gids aren't in the table and have to be looked up in the skip list.
+  static constexpr uint64_t kChunkBits = 16;
+  static constexpr uint64_t kChunkSize = 1UL << kChunkBits;
+  static constexpr uint64_t kMaxChunks = 1UL << 16;
+
+  VertexDirectory() = default;
+  VertexDirectory(const VertexDirectory &) = delete;
+  VertexDirectory(VertexDirectory &&) = delete;
+  VertexDirectory &operator=(const VertexDirectory &) = delete;
+  VertexDirectory &operator=(VertexDirectory &&) = delete;
+  ~VertexDirectory() = default;
+
+  /// Allocates the table. Must be called before the storage is accessed.
+  void Enable();
+
+  bool Enabled() const { return chunks_ != nullptr; }
+
+  /// Returns the vertex with `gid` or nullptr if there is no such vertex.
+  /// Returns nullopt if the table is disabled or `gid` is outside of it.
+  std::optional<Vertex *> Find(Gid gid) const;
+
+  void Insert(Vertex *vertex);
+
+  void Remove(Gid gid);
+
+  /// Drops all vertices. Must be called without concurrent accessors.
+  void Clear();
+
+  /// Drops all vertices and adds the ones in the skip list. Must be called
+  /// without concurrent accessors (after recovery).
+  void Rebuild(utils::SkipList<Vertex>::Accessor vertices);
+
+ private:
+  struct Chunk {
+    std::array<std::atomic<Vertex *>, kChunkSize> vertices{};
+  };
+
+  Chunk *FindChunk(uint64_t gid) const;
+  Chunk *GetOrCreateChunk(uint64_t gid);
+
+  std::unique_ptr<std::atomic<Chunk *>[]> chunks_;
+  std::vector<std::unique_ptr<Chunk>> owned_chunks_;
+  utils::SpinLock chunks_lock_;
+};
+
+}  // namespace memgraph::storage
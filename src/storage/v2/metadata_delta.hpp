@@ -14,6 +14,7 @@
 #include <atomic>
 #include <cstdint>
 #include <set>
+#include <vector>
 
 #include "storage/v2/edge_ref.hpp"
 #include "storage/v2/id_types.hpp"
@@ -35,8 +36,12 @@ struct MetadataDelta {
     LABEL_PROPERTY_INDEX_DROP,
     LABEL_PROPERTY_INDEX_STATS_SET,
     LABEL_PROPERTY_INDEX_STATS_CLEAR,
+    LABEL_PROPERTY_COMPOSITE_INDEX_CREATE,
+    LABEL_PROPERTY_COMPOSITE_INDEX_DROP,
     EDGE_INDEX_CREATE,
     EDGE_INDEX_DROP,
+    EDGE_PROPERTY_INDEX_CREATE,
+    EDGE_PROPERTY_INDEX_DROP,
     TEXT_INDEX_CREATE,
     TEXT_INDEX_DROP,
     EXISTENCE_CONSTRAINT_CREATE,
@@ -61,10 +66,18 @@ struct MetadataDelta {
   } label_property_index_stats_set;
   static constexpr struct LabelPropertyIndexStatsClear {
   } label_property_index_stats_clear;
+  static constexpr struct LabelPropertyCompositeIndexCreate {
+  } label_property_composite_index_create;
+  static constexpr struct LabelPropertyCompositeIndexDrop {
+  } label_property_composite_index_drop;
   static constexpr struct EdgeIndexCreate {
   } edge_index_create;
   static constexpr struct EdgeIndexDrop {
   } edge_index_drop;
+  static constexpr struct EdgePropertyIndexCreate {
+  } edge_property_index_create;
+  static constexpr struct EdgePropertyIndexDrop {
+  } edge_property_index_drop;
   static constexpr struct TextIndexCreate {
   } text_index_create;
   static constexpr struct TextIndexDrop {
@@ -94,16 +107,28 @@ struct MetadataDelta {
       : action(Action::LABEL_PROPERTY_INDEX_DROP), label_property{label, property} {}
 
   MetadataDelta(LabelPropertyIndexStatsSet /*tag*/, LabelId label, PropertyId property, LabelPropertyIndexStats stats)
-      : action(Action::LABEL_PROPERTY_INDEX_STATS_SET), label_property_stats{label, property, stats} {}
+      : action(Action::LABEL_PROPERTY_INDEX_STATS_SET), label_property_stats{label, property, std::move(stats)} {}
 
   MetadataDelta(LabelPropertyIndexStatsClear /*tag*/, LabelId label)
       : action(Action::LABEL_PROPERTY_INDEX_STATS_CLEAR), label{label} {}
 
+  MetadataDelta(LabelPropertyCompositeIndexCreate /*tag*/, LabelId label, std::vector<PropertyId> properties)
+      : action(Action::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE), label_ordered_properties{label, std::move(properties)} {}
+
+  MetadataDelta(LabelPropertyCompositeIndexDrop /*tag*/, LabelId label, std::vector<PropertyId> properties)
+      : action(Action::LABEL_PROPERTY_COMPOSITE_INDEX_DROP), label_ordered_properties{label, std::move(properties)} {}
+
   MetadataDelta(EdgeIndexCreate /*tag*/, EdgeTypeId edge_type)
       : action(Action::EDGE_INDEX_CREATE), edge_type(edge_type) {}
 
   MetadataDelta(EdgeIndexDrop /*tag*/, EdgeTypeId edge_type) : action(Action::EDGE_INDEX_DROP), edge_type(edge_type) {}
 
+  MetadataDelta(EdgePropertyIndexCreate /*tag*/, EdgeTypeId edge_type, PropertyId property)
+      : action(Action::EDGE_PROPERTY_INDEX_CREATE), edge_type_property{edge_type, property} {}
+
+  MetadataDelta(EdgePropertyIndexDrop /*tag*/, EdgeTypeId edge_type, PropertyId property)
+      : action(Action::EDGE_PROPERTY_INDEX_DROP), edge_type_property{edge_type, property} {}
+
   MetadataDelta(TextIndexCreate /*tag*/, std::string index_name, LabelId label)
       : action(Action::TEXT_INDEX_CREATE), text_index{index_name, label} {}
 
@@ -135,10 +160,11 @@ struct MetadataDelta {
       case Action::LABEL_INDEX_STATS_CLEAR:
       case Action::LABEL_PROPERTY_INDEX_CREATE:
       case Action::LABEL_PROPERTY_INDEX_DROP:
-      case Action::LABEL_PROPERTY_INDEX_STATS_SET:
       case Action::LABEL_PROPERTY_INDEX_STATS_CLEAR:
       case Action::EDGE_INDEX_CREATE:
       case Action::EDGE_INDEX_DROP:
+      case Action::EDGE_PROPERTY_INDEX_CREATE:
+      case Action::EDGE_PROPERTY_INDEX_DROP:
       case Action::TEXT_INDEX_CREATE:
       case Action::TEXT_INDEX_DROP:
       case Action::EXISTENCE_CONSTRAINT_CREATE:
@@ -148,6 +174,13 @@ struct MetadataDelta {
       case Action::UNIQUE_CONSTRAINT_DROP:
         label_properties.properties.~set<PropertyId>();
         break;
+      case Action::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+      case Action::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+        label_ordered_properties.properties.~vector<PropertyId>();
+        break;
+      case Action::LABEL_PROPERTY_INDEX_STATS_SET:
+        label_property_stats.stats.~LabelPropertyIndexStats();
+        break;
     }
   }
 
@@ -158,6 +191,11 @@ struct MetadataDelta {
 
     EdgeTypeId edge_type;
 
+    struct {
+      EdgeTypeId edge_type;
+      PropertyId property;
+    } edge_type_property;
+
     struct {
       LabelId label;
       PropertyId property;
@@ -168,6 +206,11 @@ struct MetadataDelta {
       std::set<PropertyId> properties;
     } label_properties;
 
+    struct {
+      LabelId label;
+      std::vector<PropertyId> properties;
+    } label_ordered_properties;
+
     struct {
       LabelId label;
       LabelIndexStats stats;
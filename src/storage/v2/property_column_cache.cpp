@@ -0,0 +1,145 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/property_column_cache.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <mutex>
+
+namespace memgraph::storage {
+
+namespace {
+bool HasLabel(const Vertex &vertex, LabelId label) {
+  return std::find(vertex.labels.begin(), vertex.labels.end(), label) != vertex.labels.end();
+}
+}  // namespace
+
+PropertyColumnCache::Column::Column(LabelId label, PropertyId property)
+    : label(label), property(property), chunks(std::make_unique<std::atomic<Chunk *>[]>(kMaxChunks)) {}
+
+PropertyColumnCache::Chunk *PropertyColumnCache::Column::FindChunk(uint64_t gid) const {
+  const auto chunk_id = gid >> kChunkBits;
+  if (chunk_id >= kMaxChunks) return nullptr;
+  return chunks[chunk_id].load(std::memory_order_acquire);
+}
+
+PropertyColumnCache::Chunk *PropertyColumnCache::Column::GetOrCreateChunk(uint64_t gid) {
+  const auto chunk_id = gid >> kChunkBits;
+  if (chunk_id >= kMaxChunks) return nullptr;
+  if (auto *chunk = chunks[chunk_id].load(std::memory_order_acquire)) return chunk;
+
+  auto guard = std::lock_guard{chunks_lock};
+  if (auto *chunk = chunks[chunk_id].load(std::memory_order_acquire)) return chunk;
+  auto *chunk = owned_chunks.emplace_back(std::make_unique<Chunk>()).get();
+  chunks[chunk_id].store(chunk, std::memory_order_release);
+  return chunk;
+}
+
+void PropertyColumnCache::Column::Clear() {
+  auto guard = std::lock_guard{chunks_lock};
+  for (uint64_t i = 0; i < kMaxChunks; ++i) {
+    chunks[i].store(nullptr, std::memory_order_release);
+  }
+  owned_chunks.clear();
+}
+
+void PropertyColumnCache::AddColumn(LabelId label, PropertyId property) {
+  const auto exists = std::any_of(columns_.begin(), columns_.end(), [&](const auto &column) {
+    return column->label == label && column->property == property;
+  });
+  if (exists) return;
+  columns_.emplace_back(std::make_unique<Column>(label, property));
+}
+
+bool PropertyColumnCache::Get(const Vertex &vertex, PropertyId property, PropertyValue *value) const {
+  const auto gid = vertex.gid.AsUint();
+  const auto offset = gid & (kChunkSize - 1);
+  for (const auto &column : columns_) {
+    if (column->property != property || !HasLabel(vertex, column->label)) continue;
+    const auto *chunk = column->FindChunk(gid);
+    if (!chunk) continue;
+    const auto payload = chunk->payloads[offset];
+    switch (chunk->kinds[offset]) {
+      case CellKind::UNKNOWN:
+        continue;
+      case CellKind::NULL_VALUE:
+        *value = PropertyValue();
+        return true;
+      case CellKind::BOOL:
+        *value = PropertyValue(payload != 0);
+        return true;
+      case CellKind::INT:
+        *value = PropertyValue(payload);
+        return true;
+      case CellKind::DOUBLE:
+        *value = PropertyValue(std::bit_cast<double>(payload));
+        return true;
+    }
+  }
+  return false;
+}
+
+void PropertyColumnCache::Refresh(const Vertex &vertex) {
+  const auto gid = vertex.gid.AsUint();
+  const auto offset = gid & (kChunkSize - 1);
+  for (auto &column : columns_) {
+    if (vertex.deleted || !HasLabel(vertex, column->label)) {
+      // Don't allocate a chunk just to mark a cell as unknown.
+      if (auto *chunk = column->FindChunk(gid)) chunk->kinds[offset] = CellKind::UNKNOWN;
+      continue;
+    }
+    auto *chunk = column->GetOrCreateChunk(gid);
+    if (!chunk) continue;
+
+    const auto value = vertex.properties.GetProperty(column->property);
+    auto kind = CellKind::UNKNOWN;
+    int64_t payload = 0;
+    switch (value.type()) {
+      case PropertyValue::Type::Null:
+        kind = CellKind::NULL_VALUE;
+        break;
+      case PropertyValue::Type::Bool:
+        kind = CellKind::BOOL;
+        payload = value.ValueBool() ? 1 : 0;
+        break;
+      case PropertyValue::Type::Int:
+        kind = CellKind::INT;
+        payload = value.ValueInt();
+        break;
+      case PropertyValue::Type::Double:
+        kind = CellKind::DOUBLE;
+        payload = std::bit_cast<int64_t>(value.ValueDouble());
+        break;
+      default:
+        // Strings, collections and temporal values are read from the property store.
+        break;
+    }
+    chunk->payloads[offset] = payload;
+    chunk->kinds[offset] = kind;
+  }
+}
+
+void PropertyColumnCache::Rebuild(utils::SkipList<Vertex>::Accessor vertices) {
+  if (columns_.empty()) return;
+  for (auto &column : columns_) {
+    column->Clear();
+  }
+  for (auto &vertex : vertices) {
+    auto guard = std::unique_lock{vertex.lock};
+    // The newest delta may still be uncommitted, so the current values can't
+    // be trusted. Such cells stay unknown until the vertex is modified again.
+    if (vertex.delta != nullptr) continue;
+    Refresh(vertex);
+  }
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,104 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/vertex.hpp"
+#include "utils/skip_list.hpp"
+#include "utils/spin_lock.hpp"
+
+namespace memgraph::storage {
+
+/// Opt-in columnar copy of hot (label, property) combinations.
+///
+/// Every column keeps one cell per vertex, addressed directly by the vertex
+/// gid, with the last committed value of the property for vertices that have
+/// the label. Only scalar values are cached (null, bool, int and double) and
+/// stored as a kind byte plus an 8-byte payload in two parallel arrays, so a
+/// property lookup doesn't have to decode the vertex's `PropertyStore`.
+///
+/// A cell is only meaningful for a vertex without deltas: then every
+/// transaction sees the committed state of the vertex. Cells are refreshed by
+/// the committing (or aborting) transaction while it holds the vertex lock, so
+/// by the time GC unlinks the last delta of a vertex its cells are current.
+/// Readers must hold the vertex lock as well and check that the vertex has no
+/// deltas.
+///
+/// The set of columns is fixed when the storage is constructed, which lets the
+/// readers iterate it without synchronization.
+class PropertyColumnCache {
+ public:
+  enum class CellKind : uint8_t { UNKNOWN = 0, NULL_VALUE, BOOL, INT, DOUBLE };
+
+  // 64Ki cells per chunk and 64Ki chunks per column cover 2^32 gids. Vertices
+  // with larger gids aren't cached and always fall back to the property store.
+  static constexpr uint64_t kChunkBits = 16;
+  static constexpr uint64_t kChunkSize = 1UL << kChunkBits;
+  static constexpr uint64_t kMaxChunks = 1UL << 16;
+
+  PropertyColumnCache() = default;
+  PropertyColumnCache(const PropertyColumnCache &) = delete;
+  PropertyColumnCache(PropertyColumnCache &&) = delete;
+  PropertyColumnCache &operator=(const PropertyColumnCache &) = delete;
+  PropertyColumnCache &operator=(PropertyColumnCache &&) = delete;
+  ~PropertyColumnCache() = default;
+
+  /// Adds a column. Must be called before the storage is accessed.
+  void AddColumn(LabelId label, PropertyId property);
+
+  bool Empty() const { return columns_.empty(); }
+
+  /// Reads the cached value of `property` for `vertex` into `value`. Returns
+  /// false if no column holds a value for it. The caller must hold the vertex
+  /// lock and have checked that the vertex has no deltas.
+  bool Get(const Vertex &vertex, PropertyId property, PropertyValue *value) const;
+
+  /// Stores the current values of `vertex` in all columns. The caller must hold
+  /// the vertex lock exclusively.
+  void Refresh(const Vertex &vertex);
+
+  /// Drops all cells and refills them from the vertices without deltas. Must
+  /// be called without concurrent accessors (after recovery).
+  void Rebuild(utils::SkipList<Vertex>::Accessor vertices);
+
+ private:
+  struct Chunk {
+    std::array<CellKind, kChunkSize> kinds{};
+    std::array<int64_t, kChunkSize> payloads{};
+  };
+
+  struct Column {
+    Column(LabelId label, PropertyId property);
+
+    Chunk *FindChunk(uint64_t gid) const;
+    Chunk *GetOrCreateChunk(uint64_t gid);
+    void Clear();
+
+    LabelId label;
+    PropertyId property;
+    std::unique_ptr<std::atomic<Chunk *>[]> chunks;
+    std::vector<std::unique_ptr<Chunk>> owned_chunks;
+    utils::SpinLock chunks_lock;
+  };
+
+  std::vector<std::unique_ptr<Column>> columns_;
+};
+
+}  // namespace memgraph::storage
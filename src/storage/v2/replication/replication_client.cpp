@@ -41,6 +41,7 @@ void ReplicationStorageClient::UpdateReplicaState(Storage *storage, DatabaseAcce
   auto hb_stream{client_.rpc_client_.Stream<replication::HeartbeatRpc>(
       main_uuid_, storage->uuid(), replStorageState.last_commit_timestamp_, std::string{replStorageState.epoch_.id()})};
   const auto replica = hb_stream.AwaitResponse();
+  replica_compression_ = replica.compression;
 
 #ifdef MG_ENTERPRISE       // Multi-tenancy is only supported in enterprise
   if (!replica.success) {  // Replica is missing the current database
@@ -160,6 +161,10 @@ void ReplicationStorageClient::LogRpcFailure() {
       utils::MessageWithLink("Couldn't replicate data to {}.", client_.name_, "https://memgr.ph/replication"));
 }
 
+bool ReplicationStorageClient::CompressStreams(Storage const *storage) const {
+  return storage->config_.durability.replication_compression && replica_compression_;
+}
+
 void ReplicationStorageClient::TryCheckReplicaStateAsync(Storage *storage, DatabaseAccessProtector db_acc) {
   client_.thread_pool_.AddTask([storage, db_acc = std::move(db_acc), this]() mutable {
     this->TryCheckReplicaStateSync(storage, std::move(db_acc));
@@ -216,7 +221,8 @@ void ReplicationStorageClient::StartTransactionReplication(const uint64_t curren
     case READY:
       MG_ASSERT(!replica_stream_);
       try {
-        replica_stream_.emplace(storage, client_.rpc_client_, current_wal_seq_num, main_uuid_);
+        replica_stream_.emplace(storage, client_.rpc_client_, current_wal_seq_num, main_uuid_,
+                                CompressStreams(storage));
         *locked_state = REPLICATING;
       } catch (const rpc::RpcFailedException &) {
         *locked_state = MAYBE_BEHIND;
@@ -291,6 +297,7 @@ void ReplicationStorageClient::RecoverReplica(uint64_t replica_commit, memgraph:
   }
   spdlog::debug("Starting replica recovery");
   auto *mem_storage = static_cast<InMemoryStorage *>(storage);
+  const bool compress = CompressStreams(storage);
 
   while (true) {
     auto file_locker = mem_storage->file_retainer_.AddLocker();
@@ -303,27 +310,30 @@ void ReplicationStorageClient::RecoverReplica(uint64_t replica_commit, memgraph:
         rpc::Client &rpcClient = client_.rpc_client_;
         std::visit(
             utils::Overloaded{
-                [&replica_commit, mem_storage, &rpcClient, main_uuid = main_uuid_](RecoverySnapshot const &snapshot) {
+                [&replica_commit, mem_storage, &rpcClient, main_uuid = main_uuid_,
+                 compress](RecoverySnapshot const &snapshot) {
                   spdlog::debug("Sending the latest snapshot file: {}", snapshot);
-                  auto response = TransferSnapshot(main_uuid, mem_storage->uuid(), rpcClient, snapshot);
+                  auto response = TransferSnapshot(main_uuid, mem_storage->uuid(), rpcClient, snapshot, compress);
                   replica_commit = response.current_commit_timestamp;
                 },
-                [&replica_commit, mem_storage, &rpcClient, main_uuid = main_uuid_](RecoveryWals const &wals) {
+                [&replica_commit, mem_storage, &rpcClient, main_uuid = main_uuid_,
+                 compress](RecoveryWals const &wals) {
                   spdlog::debug("Sending the latest wal files");
-                  auto response = TransferWalFiles(main_uuid, mem_storage->uuid(), rpcClient, wals);
+                  auto response = TransferWalFiles(main_uuid, mem_storage->uuid(), rpcClient, wals, compress);
                   replica_commit = response.current_commit_timestamp;
                   spdlog::debug("Wal files successfully transferred.");
                 },
-                [&replica_commit, mem_storage, &rpcClient,
-                 main_uuid = main_uuid_](RecoveryCurrentWal const &current_wal) {
-                  std::unique_lock transaction_guard(mem_storage->engine_lock_);
+                [&replica_commit, mem_storage, &rpcClient, main_uuid = main_uuid_,
+                 compress](RecoveryCurrentWal const &current_wal) {
+                  std::unique_lock transaction_guard(mem_storage->commit_sequencer_);
                   if (mem_storage->wal_file_ &&
                       mem_storage->wal_file_->SequenceNumber() == current_wal.current_wal_seq_num) {
                     utils::OnScopeExit on_exit([mem_storage]() { mem_storage->wal_file_->EnableFlushing(); });
                     mem_storage->wal_file_->DisableFlushing();
                     transaction_guard.unlock();
                     spdlog::debug("Sending current wal file");
-                    replica_commit = ReplicateCurrentWal(main_uuid, mem_storage, rpcClient, *mem_storage->wal_file_);
+                    replica_commit =
+                        ReplicateCurrentWal(main_uuid, mem_storage, rpcClient, *mem_storage->wal_file_, compress);
                   } else {
                     spdlog::debug("Cannot recover using current wal file");
                   }
@@ -377,11 +387,12 @@ std::pair<bool, uint64_t> ReplicationStorageClient::ForceResetStorage(memgraph::
 
 ////// ReplicaStream //////
 ReplicaStream::ReplicaStream(Storage *storage, rpc::Client &rpc_client, const uint64_t current_seq_num,
-                             utils::UUID main_uuid)
+                             utils::UUID main_uuid, bool compress)
     : storage_{storage},
       stream_(rpc_client.Stream<replication::AppendDeltasRpc>(
           main_uuid, storage->uuid(), storage->repl_storage_state_.last_commit_timestamp_.load(), current_seq_num)),
       main_uuid_(main_uuid) {
+  if (compress) stream_.GetBuilder()->EnableCompression();
   replication::Encoder encoder{stream_.GetBuilder()};
   encoder.WriteString(storage->repl_storage_state_.epoch_.id());
 }
@@ -417,6 +428,18 @@ void ReplicaStream::AppendOperation(durability::StorageMetadataOperation operati
   EncodeOperation(&encoder, storage_->name_id_mapper_.get(), operation, edge_type, timestamp);
 }
 
+void ReplicaStream::AppendOperation(durability::StorageMetadataOperation operation, EdgeTypeId edge_type,
+                                    PropertyId property, uint64_t timestamp) {
+  replication::Encoder encoder(stream_.GetBuilder());
+  EncodeOperation(&encoder, storage_->name_id_mapper_.get(), operation, edge_type, property, timestamp);
+}
+
+void ReplicaStream::AppendOperation(durability::StorageMetadataOperation operation, LabelId label,
+                                    const std::vector<PropertyId> &properties, uint64_t timestamp) {
+  replication::Encoder encoder(stream_.GetBuilder());
+  EncodeOperation(&encoder, storage_->name_id_mapper_.get(), operation, label, properties, timestamp);
+}
+
 replication::AppendDeltasRes ReplicaStream::Finalize() { return stream_.AwaitResponse(); }
 
 }  // namespace memgraph::storage
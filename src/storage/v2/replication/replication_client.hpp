@@ -37,6 +37,7 @@
 #include <set>
 #include <string>
 #include <variant>
+#include <vector>
 
 namespace memgraph::storage {
 
@@ -49,7 +50,8 @@ class ReplicationStorageClient;
 // Handler used for transferring the current transaction.
 class ReplicaStream {
  public:
-  explicit ReplicaStream(Storage *storage, rpc::Client &rpc_client, uint64_t current_seq_num, utils::UUID main_uuid);
+  explicit ReplicaStream(Storage *storage, rpc::Client &rpc_client, uint64_t current_seq_num, utils::UUID main_uuid,
+                         bool compress);
 
   /// @throw rpc::RpcFailedException
   void AppendDelta(const Delta &delta, const Vertex &vertex, uint64_t final_commit_timestamp);
@@ -68,6 +70,14 @@ class ReplicaStream {
   /// @throw rpc::RpcFailedException
   void AppendOperation(durability::StorageMetadataOperation operation, EdgeTypeId edge_type, uint64_t timestamp);
 
+  /// @throw rpc::RpcFailedException
+  void AppendOperation(durability::StorageMetadataOperation operation, EdgeTypeId edge_type, PropertyId property,
+                       uint64_t timestamp);
+
+  /// @throw rpc::RpcFailedException
+  void AppendOperation(durability::StorageMetadataOperation operation, LabelId label,
+                       const std::vector<PropertyId> &properties, uint64_t timestamp);
+
   /// @throw rpc::RpcFailedException
   replication::AppendDeltasRes Finalize();
 
@@ -200,6 +210,10 @@ class ReplicationStorageClient {
 
   void LogRpcFailure();
 
+  // Whether the data sent to the replica is compressed, which needs both the
+  // flag on MAIN and a replica which can read it.
+  bool CompressStreams(Storage const *storage) const;
+
   /**
    * @brief Synchronously try to check the replica state and start a recovery thread if necessary
    *
@@ -214,6 +228,9 @@ class ReplicationStorageClient {
       replica_stream_;  // Currently active stream (nullopt if not in use), note: a single stream per rpc client
   mutable utils::Synchronized<replication::ReplicaState, utils::SpinLock> replica_state_{
       replication::ReplicaState::MAYBE_BEHIND};
+  // Whether the replica can read compressed SLK segments, as told by its last
+  // heartbeat.
+  std::atomic<bool> replica_compression_{false};
 
   const utils::UUID main_uuid_;
 };
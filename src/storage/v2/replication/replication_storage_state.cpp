@@ -63,6 +63,27 @@ void ReplicationStorageState::AppendOperation(durability::StorageMetadataOperati
   });
 }
 
+void ReplicationStorageState::AppendOperation(durability::StorageMetadataOperation operation, EdgeTypeId edge_type,
+                                              PropertyId property, uint64_t final_commit_timestamp) {
+  replication_clients_.WithLock([&](auto &clients) {
+    for (auto &client : clients) {
+      client->IfStreamingTransaction(
+          [&](auto &stream) { stream.AppendOperation(operation, edge_type, property, final_commit_timestamp); });
+    }
+  });
+}
+
+void ReplicationStorageState::AppendOperation(durability::StorageMetadataOperation operation, LabelId label,
+                                              const std::vector<PropertyId> &properties,
+                                              uint64_t final_commit_timestamp) {
+  replication_clients_.WithLock([&](auto &clients) {
+    for (auto &client : clients) {
+      client->IfStreamingTransaction(
+          [&](auto &stream) { stream.AppendOperation(operation, label, properties, final_commit_timestamp); });
+    }
+  });
+}
+
 bool ReplicationStorageState::FinalizeTransaction(uint64_t timestamp, Storage *storage,
                                                   DatabaseAccessProtector db_acc) {
   return replication_clients_.WithLock([=, db_acc = std::move(db_acc)](auto &clients) mutable {
@@ -48,8 +48,16 @@ struct ReplicationStorageState {
                        const LabelPropertyIndexStats &property_stats, uint64_t final_commit_timestamp);
   void AppendOperation(durability::StorageMetadataOperation operation, EdgeTypeId edge_type,
                        uint64_t final_commit_timestamp);
+  void AppendOperation(durability::StorageMetadataOperation operation, EdgeTypeId edge_type, PropertyId property,
+                       uint64_t final_commit_timestamp);
+  void AppendOperation(durability::StorageMetadataOperation operation, LabelId label,
+                       const std::vector<PropertyId> &properties, uint64_t final_commit_timestamp);
   bool FinalizeTransaction(uint64_t timestamp, Storage *storage, DatabaseAccessProtector db_acc);
 
+  bool HasReplicas() const {
+    return replication_clients_.WithReadLock([](auto const &clients) { return !clients.empty(); });
+  }
+
   // Getters
   auto GetReplicaState(std::string_view name) const -> std::optional<replication::ReplicaState>;
   auto ReplicasInfo(const Storage *storage) const -> std::vector<ReplicaInfo>;
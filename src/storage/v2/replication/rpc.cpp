@@ -222,12 +222,16 @@ void Save(const memgraph::storage::replication::HeartbeatRes &self, memgraph::sl
   memgraph::slk::Save(self.success, builder);
   memgraph::slk::Save(self.current_commit_timestamp, builder);
   memgraph::slk::Save(self.epoch_id, builder);
+  memgraph::slk::Save(self.compression, builder);
 }
 
 void Load(memgraph::storage::replication::HeartbeatRes *self, memgraph::slk::Reader *reader) {
   memgraph::slk::Load(&self->success, reader);
   memgraph::slk::Load(&self->current_commit_timestamp, reader);
   memgraph::slk::Load(&self->epoch_id, reader);
+  // Older replicas end the response before the field.
+  self->compression = false;
+  if (reader->HasMoreData()) memgraph::slk::Load(&self->compression, reader);
 }
 
 // Serialize code for HeartbeatReq
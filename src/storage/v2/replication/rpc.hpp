@@ -88,6 +88,9 @@ struct HeartbeatRes {
   bool success;
   uint64_t current_commit_timestamp;
   std::string epoch_id;
+  // Whether the replica can read compressed SLK segments. Replicas which
+  // can't don't send it at all, so MAIN must not compress what it sends them.
+  bool compression{true};
 };
 
 using HeartbeatRpc = rpc::RequestResponse<HeartbeatReq, HeartbeatRes>;
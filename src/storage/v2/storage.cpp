@@ -125,6 +125,18 @@ void Storage::Accessor::AdvanceCommand() {
   ++transaction_.command_id;
 }
 
+std::vector<VerticesIterable> Storage::Accessor::ChunkedVertices(View view, uint64_t /*num_chunks*/) {
+  std::vector<VerticesIterable> chunks;
+  chunks.push_back(Vertices(view));
+  return chunks;
+}
+
+std::vector<VerticesIterable> Storage::Accessor::ChunkedVertices(LabelId label, View view, uint64_t /*num_chunks*/) {
+  std::vector<VerticesIterable> chunks;
+  chunks.push_back(Vertices(label, view));
+  return chunks;
+}
+
 Result<std::optional<VertexAccessor>> Storage::Accessor::DeleteVertex(VertexAccessor *vertex) {
   /// NOTE: Checking whether the vertex can be deleted must be done by loading edges from disk.
   /// Loading edges is done through VertexAccessor so we do it here.
@@ -336,8 +348,8 @@ EdgeInfoForDeletion Storage::Accessor::PrepareDeletableEdges(const std::unordere
   // add nodes which need to be detached on the other end of the edge
   if (detach) {
     for (auto *vertex_ptr : vertices) {
-      std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> in_edges;
-      std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> out_edges;
+      AdjacencyList in_edges;
+      AdjacencyList out_edges;
 
       {
         auto vertex_lock = std::shared_lock{vertex_ptr->lock};
@@ -386,7 +398,7 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::ClearEdgesOn
     auto vertex_lock = std::unique_lock{vertex_ptr->lock};
     while (!attached_edges_to_vertex->empty()) {
       // get the information about the last edge in the vertex collection
-      auto const &[edge_type, opposing_vertex, edge_ref] = *attached_edges_to_vertex->rbegin();
+      auto const [edge_type, opposing_vertex, edge_ref] = attached_edges_to_vertex->back();
 
       /// TODO: (andi) Again here, no need to lock the edge if using on disk storage.
       std::unique_lock<utils::RWSpinLock> guard;
@@ -459,20 +471,20 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::DetachRemain
     if (!PrepareForWrite(&transaction_, vertex_ptr)) return Error::SERIALIZATION_ERROR;
     MG_ASSERT(!vertex_ptr->deleted, "Invalid database state!");
 
-    auto mid = std::partition(
-        edges_attached_to_vertex->begin(), edges_attached_to_vertex->end(), [this, &set_for_erasure](auto &edge) {
-          auto const &[edge_type, opposing_vertex, edge_ref] = edge;
-          auto const edge_gid = storage_->config_.salient.items.properties_on_edges ? edge_ref.ptr->gid : edge_ref.gid;
-          return !set_for_erasure.contains(edge_gid);
-        });
+    auto const should_erase = [this, &set_for_erasure](auto const &edge) {
+      auto const &[edge_type, opposing_vertex, edge_ref] = edge;
+      auto const edge_gid = storage_->config_.salient.items.properties_on_edges ? edge_ref.ptr->gid : edge_ref.gid;
+      return set_for_erasure.contains(edge_gid);
+    };
 
     // Creating deltas and erasing edge only at the end -> we might have incomplete state as
     // delta might cause OOM, so we don't remove edges from edges_attached_to_vertex
-    utils::AtomicMemoryBlock atomic_memory_block{[&mid, &edges_attached_to_vertex, &deleted_edges,
+    utils::AtomicMemoryBlock atomic_memory_block{[&should_erase, &edges_attached_to_vertex, &deleted_edges,
                                                   &partially_detached_edge_ids, this, vertex_ptr, deletion_delta,
                                                   reverse_vertex_order]() {
-      for (auto it = mid; it != edges_attached_to_vertex->end(); it++) {
-        auto const &[edge_type, opposing_vertex, edge_ref] = *it;
+      for (auto const &edge : *edges_attached_to_vertex) {
+        if (!should_erase(edge)) continue;
+        auto const &[edge_type, opposing_vertex, edge_ref] = edge;
         std::unique_lock<utils::RWSpinLock> guard;
         if (storage_->config_.salient.items.properties_on_edges) {
           auto edge_ptr = edge_ref.ptr;
@@ -493,7 +505,7 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::DetachRemain
           deleted_edges.emplace_back(edge_ref, edge_type, from_vertex, to_vertex, storage_, &transaction_, true);
         }
       }
-      edges_attached_to_vertex->erase(mid, edges_attached_to_vertex->end());
+      edges_attached_to_vertex->erase_if(should_erase);
     }};
 
     std::invoke(atomic_memory_block);
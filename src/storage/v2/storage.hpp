@@ -34,6 +34,7 @@
 #include "storage/v2/edges_iterable.hpp"
 #include "storage/v2/indices/indices.hpp"
 #include "storage/v2/mvcc.hpp"
+#include "storage/v2/property_column_cache.hpp"
 #include "storage/v2/replication/enums.hpp"
 #include "storage/v2/replication/replication_client.hpp"
 #include "storage/v2/replication/replication_storage_state.hpp"
@@ -65,7 +66,11 @@ struct IndicesInfo {
   std::vector<LabelId> label;
   std::vector<std::pair<LabelId, PropertyId>> label_property;
   std::vector<EdgeTypeId> edge_type;
+  std::vector<std::pair<EdgeTypeId, PropertyId>> edge_type_property;
   std::vector<std::pair<std::string, LabelId>> text_indices;
+  std::vector<std::pair<LabelId, std::vector<PropertyId>>> label_properties;
+  // Declared in the storage config, so they aren't part of the schema.
+  std::vector<std::pair<LabelId, PropertyId>> label_property_hash;
 };
 
 struct ConstraintsInfo {
@@ -179,8 +184,37 @@ class Storage {
                                       const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                                       const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) = 0;
 
+    /// Vertices from the composite index on `properties` whose values of the
+    /// first properties are equal to `prefix` and whose value of the next
+    /// property is within the bounds.
+    virtual VerticesIterable Vertices(LabelId label, const std::vector<PropertyId> &properties,
+                                      const std::vector<PropertyValue> &prefix,
+                                      const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                      const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) = 0;
+
     virtual EdgesIterable Edges(EdgeTypeId edge_type, View view) = 0;
 
+    virtual EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property, View view) = 0;
+
+    virtual EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value, View view) = 0;
+
+    virtual EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property,
+                                const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) = 0;
+
+    /// Splits all vertices into at most `num_chunks` disjoint iterables which
+    /// can be consumed concurrently. Storages that can't split their vertices
+    /// return a single iterable over all of them.
+    /// @see SetConcurrentReads
+    virtual std::vector<VerticesIterable> ChunkedVertices(View view, uint64_t num_chunks);
+
+    /// Splits the vertices with the label like `ChunkedVertices(View, uint64_t)`.
+    virtual std::vector<VerticesIterable> ChunkedVertices(LabelId label, View view, uint64_t num_chunks);
+
+    /// While enabled, reads of this transaction may be done from multiple
+    /// threads at once. The transaction must not be modified in the meantime.
+    void SetConcurrentReads(bool enabled) { transaction_.manyDeltasCache.SetReadOnly(enabled); }
+
     virtual Result<std::optional<VertexAccessor>> DeleteVertex(VertexAccessor *vertex);
 
     virtual Result<std::optional<std::pair<VertexAccessor, std::vector<EdgeAccessor>>>> DetachDeleteVertex(
@@ -201,8 +235,19 @@ class Storage {
                                             const std::optional<utils::Bound<PropertyValue>> &lower,
                                             const std::optional<utils::Bound<PropertyValue>> &upper) const = 0;
 
+    virtual uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                            const std::vector<PropertyValue> &prefix) const = 0;
+
     virtual uint64_t ApproximateEdgeCount(EdgeTypeId id) const = 0;
 
+    virtual uint64_t ApproximateEdgeCount(EdgeTypeId id, PropertyId property) const = 0;
+
+    virtual uint64_t ApproximateEdgeCount(EdgeTypeId id, PropertyId property, const PropertyValue &value) const = 0;
+
+    virtual uint64_t ApproximateEdgeCount(EdgeTypeId id, PropertyId property,
+                                          const std::optional<utils::Bound<PropertyValue>> &lower,
+                                          const std::optional<utils::Bound<PropertyValue>> &upper) const = 0;
+
     virtual std::optional<storage::LabelIndexStats> GetIndexStats(const storage::LabelId &label) const = 0;
 
     virtual std::optional<storage::LabelPropertyIndexStats> GetIndexStats(
@@ -235,8 +280,18 @@ class Storage {
 
     virtual bool LabelPropertyIndexExists(LabelId label, PropertyId property) const = 0;
 
+    virtual bool LabelPropertyCompositeIndexExists(LabelId label, const std::vector<PropertyId> &properties) const = 0;
+
     virtual bool EdgeTypeIndexExists(EdgeTypeId edge_type) const = 0;
 
+    virtual bool EdgeTypePropertyIndexExists(EdgeTypeId edge_type, PropertyId property) const = 0;
+
+    /// Hash indices are declared in the storage config and only answer
+    /// `Vertices(label, property, value, view)`.
+    bool LabelPropertyHashIndexExists(LabelId label, PropertyId property) const {
+      return storage_->indices_.label_property_hash_index_.IndexExists(label, property);
+    }
+
     bool TextIndexExists(const std::string &index_name) const {
       return storage_->indices_.text_index_.IndexExists(index_name);
     }
@@ -305,12 +360,24 @@ class Storage {
 
     virtual utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(EdgeTypeId edge_type) = 0;
 
+    virtual utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(EdgeTypeId edge_type,
+                                                                              PropertyId property) = 0;
+
+    virtual utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(LabelId label,
+                                                                              std::vector<PropertyId> properties) = 0;
+
     virtual utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(LabelId label) = 0;
 
     virtual utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(LabelId label, PropertyId property) = 0;
 
     virtual utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(EdgeTypeId edge_type) = 0;
 
+    virtual utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(EdgeTypeId edge_type,
+                                                                            PropertyId property) = 0;
+
+    virtual utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(LabelId label,
+                                                                            std::vector<PropertyId> properties) = 0;
+
     void CreateTextIndex(const std::string &index_name, LabelId label, query::DbAccessor *db);
 
     void DropTextIndex(const std::string &index_name);
@@ -405,6 +472,21 @@ class Storage {
     return UniqueAccess(replication_role, {});
   }
 
+  /// Builds a label or label+property index while other transactions keep
+  /// running, so that creating it with unique access afterwards doesn't have to
+  /// populate it. Does nothing if the storage doesn't build indices online.
+  virtual void BuildIndexOnline(memgraph::replication_coordination_glue::ReplicationRole replication_role,
+                                LabelId label, std::optional<PropertyId> property) {}
+
+  /// Drops an index built by `BuildIndexOnline` that wasn't created afterwards,
+  /// for example because the query creating it failed. Must not be called
+  /// while holding an accessor.
+  virtual void AbortIndexOnline(LabelId label, std::optional<PropertyId> property) {}
+
+  /// Whether `BuildIndexOnline` builds the index instead of leaving it to
+  /// `CreateIndex`.
+  virtual bool BuildsIndexOnline() const { return false; }
+
   enum class SetIsolationLevelError : uint8_t { DisabledForAnalyticalMode };
 
   utils::BasicResult<SetIsolationLevelError> SetIsolationLevel(IsolationLevel isolation_level);
@@ -453,6 +535,7 @@ class Storage {
 
   Indices indices_;
   Constraints constraints_;
+  PropertyColumnCache property_column_cache_;
 
   // Datastructures to provide fast retrieval of node-label and
   // edge-type related metadata.
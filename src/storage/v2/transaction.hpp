@@ -20,6 +20,7 @@
 
 #include "storage/v2/constraint_verification_info.hpp"
 #include "storage/v2/delta.hpp"
+#include "storage/v2/delta_container.hpp"
 #include "storage/v2/edge.hpp"
 #include "storage/v2/isolation_level.hpp"
 #include "storage/v2/metadata_delta.hpp"
@@ -90,7 +91,8 @@ struct Transaction {
   std::unique_ptr<std::atomic<uint64_t>> commit_timestamp{};
   uint64_t command_id{};
 
-  std::deque<Delta> deltas;
+  // Deltas are recycled through a slab pool once the GC destroys them.
+  DeltaContainer deltas;
   utils::pmr::list<MetadataDelta> md_deltas;
   bool must_abort{};
   IsolationLevel isolation_level{};
@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2024 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -15,6 +15,7 @@
 #include <tuple>
 #include <vector>
 
+#include "storage/v2/adjacency_list.hpp"
 #include "storage/v2/delta.hpp"
 #include "storage/v2/edge_ref.hpp"
 #include "storage/v2/id_types.hpp"
@@ -35,8 +36,8 @@ struct Vertex {
   std::vector<LabelId> labels;
   PropertyStore properties;
 
-  std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> in_edges;
-  std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> out_edges;
+  AdjacencyList in_edges;
+  AdjacencyList out_edges;
 
   mutable utils::RWSpinLock lock;
   bool deleted;
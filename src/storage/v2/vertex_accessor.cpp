@@ -78,6 +78,30 @@ std::pair<bool, bool> IsVisible(Vertex const *vertex, Transaction const *transac
 }
 }  // namespace detail
 
+namespace {
+/// Copies the edges matching the filters; with edge types given only the slices of those types are visited.
+void CopyEdges(AdjacencyList const &edges, std::vector<EdgeTypeId> const &edge_types, Vertex const *destination,
+               edge_store *result) {
+  auto const copy_range = [destination, result](auto &&range) {
+    for (const auto &[edge_type, vertex, edge] : range) {
+      if (destination && vertex != destination) continue;
+      result->emplace_back(edge_type, vertex, edge);
+    }
+  };
+
+  if (edge_types.empty()) {
+    result->reserve(edges.size());
+    copy_range(edges);
+    return;
+  }
+  for (auto it = edge_types.begin(); it != edge_types.end(); ++it) {
+    // Duplicated edge types in the filter must not duplicate the edges.
+    if (std::find(edge_types.begin(), it, *it) != it) continue;
+    copy_range(edges.equal_range(*it));
+  }
+}
+}  // namespace
+
 std::optional<VertexAccessor> VertexAccessor::Create(Vertex *vertex, Storage *storage, Transaction *transaction,
                                                      View view) {
   if (const auto [exists, deleted] = detail::IsVisible(vertex, transaction, view); !exists || deleted) {
@@ -419,8 +443,11 @@ Result<PropertyValue> VertexAccessor::GetProperty(PropertyId property, View view
   {
     auto guard = std::shared_lock{vertex_->lock};
     deleted = vertex_->deleted;
-    value = vertex_->properties.GetProperty(property);
     delta = vertex_->delta;
+    // Without deltas every transaction sees the committed value, which is what the property columns hold.
+    auto const from_columns = !delta && transaction_->storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL &&
+                              storage_->property_column_cache_.Get(*vertex_, property, &value);
+    if (!from_columns) value = vertex_->properties.GetProperty(property);
   }
 
   // Checking cache has a cost, only do it if we have any deltas
@@ -608,17 +635,7 @@ Result<EdgesVertexAccessorResult> VertexAccessor::InEdges(View view, const std::
     auto guard = std::shared_lock{vertex_->lock};
     deleted = vertex_->deleted;
     expanded_count = static_cast<int64_t>(vertex_->in_edges.size());
-    // TODO: a better filter copy
-    if (edge_types.empty() && !destination) {
-      in_edges = vertex_->in_edges;
-    } else {
-      for (const auto &[edge_type, from_vertex, edge] : vertex_->in_edges) {
-        if (destination && from_vertex != destination_vertex) continue;
-        if (!edge_types.empty() && std::find(edge_types.begin(), edge_types.end(), edge_type) == edge_types.end())
-          continue;
-        in_edges.emplace_back(edge_type, from_vertex, edge);
-      }
-    }
+    CopyEdges(vertex_->in_edges, edge_types, destination_vertex, &in_edges);
     delta = vertex_->delta;
   }
 
@@ -698,16 +715,7 @@ Result<EdgesVertexAccessorResult> VertexAccessor::OutEdges(View view, const std:
     auto guard = std::shared_lock{vertex_->lock};
     deleted = vertex_->deleted;
     expanded_count = static_cast<int64_t>(vertex_->out_edges.size());
-    if (edge_types.empty() && !destination) {
-      out_edges = vertex_->out_edges;
-    } else {
-      for (const auto &[edge_type, to_vertex, edge] : vertex_->out_edges) {
-        if (destination && to_vertex != dst_vertex) continue;
-        if (!edge_types.empty() && std::find(edge_types.begin(), edge_types.end(), edge_type) == edge_types.end())
-          continue;
-        out_edges.emplace_back(edge_type, to_vertex, edge);
-      }
-    }
+    CopyEdges(vertex_->out_edges, edge_types, dst_vertex, &out_edges);
     delta = vertex_->delta;
   }
 
@@ -112,6 +112,10 @@ struct VertexInfoCache final {
 
   void Clear();
 
+  /// While read-only, storing into the cache is a no-op so that the cache can
+  /// be read from multiple threads at once.
+  void SetReadOnly(bool read_only) { read_only_ = read_only; }
+
  private:
   /// Note: not a tuple because need a canonical form for the edge types
   struct EdgeKey {
@@ -157,6 +161,7 @@ struct VertexInfoCache final {
   };
   Caches old_;
   Caches new_;
+  bool read_only_{false};
 
   // Helpers
   template <typename Ret, typename Func, typename... Keys>
@@ -16,6 +16,7 @@
 #include "utils/variant_helpers.hpp"
 
 #include <algorithm>
+#include <span>
 #include <tuple>
 #include <vector>
 namespace memgraph::storage {
@@ -125,6 +126,16 @@ inline auto PropertyValueMatch_ActionMethod(bool &match, PropertyId property, Pr
   });
 }
 
+inline auto PropertyValuesMatch_ActionMethod(std::vector<bool> &matches, std::span<PropertyId const> properties,
+                                             std::span<PropertyValue const> values) {
+  using enum Delta::Action;
+  return ActionMethod<SET_PROPERTY>([&, properties, values](Delta const &delta) {
+    for (size_t i = 0; i < properties.size(); ++i) {
+      if (delta.property.key == properties[i]) matches[i] = (values[i] == *delta.property.value);
+    }
+  });
+}
+
 inline auto Properties_ActionMethod(std::map<PropertyId, PropertyValue> &properties) {
   using enum Delta::Action;
   return ActionMethod<SET_PROPERTY>([&](Delta const &delta) {
@@ -25,6 +25,16 @@ VerticesIterable::VerticesIterable(InMemoryLabelPropertyIndex::Iterable vertices
   new (&in_memory_vertices_by_label_property_) InMemoryLabelPropertyIndex::Iterable(std::move(vertices));
 }
 
+VerticesIterable::VerticesIterable(InMemoryLabelPropertyCompositeIndex::Iterable vertices)
+    : type_(Type::BY_LABEL_PROPERTIES_IN_MEMORY) {
+  new (&in_memory_vertices_by_label_properties_) InMemoryLabelPropertyCompositeIndex::Iterable(std::move(vertices));
+}
+
+VerticesIterable::VerticesIterable(InMemoryLabelPropertyHashIndex::Iterable vertices)
+    : type_(Type::BY_LABEL_PROPERTY_HASH_IN_MEMORY) {
+  new (&in_memory_vertices_by_label_property_hash_) InMemoryLabelPropertyHashIndex::Iterable(std::move(vertices));
+}
+
 VerticesIterable::VerticesIterable(VerticesIterable &&other) noexcept : type_(other.type_) {
   switch (other.type_) {
     case Type::ALL:
@@ -37,6 +47,14 @@ VerticesIterable::VerticesIterable(VerticesIterable &&other) noexcept : type_(ot
       new (&in_memory_vertices_by_label_property_)
           InMemoryLabelPropertyIndex::Iterable(std::move(other.in_memory_vertices_by_label_property_));
       break;
+    case Type::BY_LABEL_PROPERTIES_IN_MEMORY:
+      new (&in_memory_vertices_by_label_properties_)
+          InMemoryLabelPropertyCompositeIndex::Iterable(std::move(other.in_memory_vertices_by_label_properties_));
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH_IN_MEMORY:
+      new (&in_memory_vertices_by_label_property_hash_)
+          InMemoryLabelPropertyHashIndex::Iterable(std::move(other.in_memory_vertices_by_label_property_hash_));
+      break;
   }
 }
 
@@ -51,6 +69,12 @@ VerticesIterable &VerticesIterable::operator=(VerticesIterable &&other) noexcept
     case Type::BY_LABEL_PROPERTY_IN_MEMORY:
       in_memory_vertices_by_label_property_.InMemoryLabelPropertyIndex::Iterable::~Iterable();
       break;
+    case Type::BY_LABEL_PROPERTIES_IN_MEMORY:
+      in_memory_vertices_by_label_properties_.InMemoryLabelPropertyCompositeIndex::Iterable::~Iterable();
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH_IN_MEMORY:
+      in_memory_vertices_by_label_property_hash_.InMemoryLabelPropertyHashIndex::Iterable::~Iterable();
+      break;
   }
   type_ = other.type_;
   switch (other.type_) {
@@ -64,6 +88,14 @@ VerticesIterable &VerticesIterable::operator=(VerticesIterable &&other) noexcept
       new (&in_memory_vertices_by_label_property_)
           InMemoryLabelPropertyIndex::Iterable(std::move(other.in_memory_vertices_by_label_property_));
       break;
+    case Type::BY_LABEL_PROPERTIES_IN_MEMORY:
+      new (&in_memory_vertices_by_label_properties_)
+          InMemoryLabelPropertyCompositeIndex::Iterable(std::move(other.in_memory_vertices_by_label_properties_));
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH_IN_MEMORY:
+      new (&in_memory_vertices_by_label_property_hash_)
+          InMemoryLabelPropertyHashIndex::Iterable(std::move(other.in_memory_vertices_by_label_property_hash_));
+      break;
   }
   return *this;
 }
@@ -79,6 +111,12 @@ VerticesIterable::~VerticesIterable() {
     case Type::BY_LABEL_PROPERTY_IN_MEMORY:
       in_memory_vertices_by_label_property_.InMemoryLabelPropertyIndex::Iterable::~Iterable();
       break;
+    case Type::BY_LABEL_PROPERTIES_IN_MEMORY:
+      in_memory_vertices_by_label_properties_.InMemoryLabelPropertyCompositeIndex::Iterable::~Iterable();
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH_IN_MEMORY:
+      in_memory_vertices_by_label_property_hash_.InMemoryLabelPropertyHashIndex::Iterable::~Iterable();
+      break;
   }
 }
 
@@ -90,6 +128,10 @@ VerticesIterable::Iterator VerticesIterable::begin() {
       return Iterator(in_memory_vertices_by_label_.begin());
     case Type::BY_LABEL_PROPERTY_IN_MEMORY:
       return Iterator(in_memory_vertices_by_label_property_.begin());
+    case Type::BY_LABEL_PROPERTIES_IN_MEMORY:
+      return Iterator(in_memory_vertices_by_label_properties_.begin());
+    case Type::BY_LABEL_PROPERTY_HASH_IN_MEMORY:
+      return Iterator(in_memory_vertices_by_label_property_hash_.begin());
   }
 }
 
@@ -101,6 +143,10 @@ VerticesIterable::Iterator VerticesIterable::end() {
       return Iterator(in_memory_vertices_by_label_.end());
     case Type::BY_LABEL_PROPERTY_IN_MEMORY:
       return Iterator(in_memory_vertices_by_label_property_.end());
+    case Type::BY_LABEL_PROPERTIES_IN_MEMORY:
+      return Iterator(in_memory_vertices_by_label_properties_.end());
+    case Type::BY_LABEL_PROPERTY_HASH_IN_MEMORY:
+      return Iterator(in_memory_vertices_by_label_property_hash_.end());
   }
 }
 
@@ -120,6 +166,18 @@ VerticesIterable::Iterator::Iterator(InMemoryLabelPropertyIndex::Iterable::Itera
   new (&in_memory_by_label_property_it_) InMemoryLabelPropertyIndex::Iterable::Iterator(std::move(it));
 }
 
+VerticesIterable::Iterator::Iterator(InMemoryLabelPropertyCompositeIndex::Iterable::Iterator it)
+    : type_(Type::BY_LABEL_PROPERTIES_IN_MEMORY) {
+  // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+  new (&in_memory_by_label_properties_it_) InMemoryLabelPropertyCompositeIndex::Iterable::Iterator(std::move(it));
+}
+
+VerticesIterable::Iterator::Iterator(InMemoryLabelPropertyHashIndex::Iterable::Iterator it)
+    : type_(Type::BY_LABEL_PROPERTY_HASH_IN_MEMORY) {
+  // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+  new (&in_memory_by_label_property_hash_it_) InMemoryLabelPropertyHashIndex::Iterable::Iterator(std::move(it));
+}
+
 VerticesIterable::Iterator::Iterator(const VerticesIterable::Iterator &other) : type_(other.type_) {
   switch (other.type_) {
     case Type::ALL:
@@ -132,6 +190,14 @@ VerticesIterable::Iterator::Iterator(const VerticesIterable::Iterator &other) :
       new (&in_memory_by_label_property_it_)
           InMemoryLabelPropertyIndex::Iterable::Iterator(other.in_memory_by_label_property_it_);
       break;
+    case Type::BY_LABEL_PROPERTIES_IN_MEMORY:
+      new (&in_memory_by_label_properties_it_)
+          InMemoryLabelPropertyCompositeIndex::Iterable::Iterator(other.in_memory_by_label_properties_it_);
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH_IN_MEMORY:
+      new (&in_memory_by_label_property_hash_it_)
+          InMemoryLabelPropertyHashIndex::Iterable::Iterator(other.in_memory_by_label_property_hash_it_);
+      break;
   }
 }
 
@@ -150,6 +216,14 @@ VerticesIterable::Iterator &VerticesIterable::Iterator::operator=(const Vertices
       new (&in_memory_by_label_property_it_)
           InMemoryLabelPropertyIndex::Iterable::Iterator(other.in_memory_by_label_property_it_);
       break;
+    case Type::BY_LABEL_PROPERTIES_IN_MEMORY:
+      new (&in_memory_by_label_properties_it_)
+          InMemoryLabelPropertyCompositeIndex::Iterable::Iterator(other.in_memory_by_label_properties_it_);
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH_IN_MEMORY:
+      new (&in_memory_by_label_property_hash_it_)
+          InMemoryLabelPropertyHashIndex::Iterable::Iterator(other.in_memory_by_label_property_hash_it_);
+      break;
   }
   return *this;
 }
@@ -169,6 +243,16 @@ VerticesIterable::Iterator::Iterator(VerticesIterable::Iterator &&other) noexcep
           // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
           InMemoryLabelPropertyIndex::Iterable::Iterator(std::move(other.in_memory_by_label_property_it_));
       break;
+    case Type::BY_LABEL_PROPERTIES_IN_MEMORY:
+      new (&in_memory_by_label_properties_it_)
+          // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+          InMemoryLabelPropertyCompositeIndex::Iterable::Iterator(std::move(other.in_memory_by_label_properties_it_));
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH_IN_MEMORY:
+      new (&in_memory_by_label_property_hash_it_)
+          // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+          InMemoryLabelPropertyHashIndex::Iterable::Iterator(std::move(other.in_memory_by_label_property_hash_it_));
+      break;
   }
 }
 
@@ -189,6 +273,16 @@ VerticesIterable::Iterator &VerticesIterable::Iterator::operator=(VerticesIterab
           // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
           InMemoryLabelPropertyIndex::Iterable::Iterator(std::move(other.in_memory_by_label_property_it_));
       break;
+    case Type::BY_LABEL_PROPERTIES_IN_MEMORY:
+      new (&in_memory_by_label_properties_it_)
+          // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+          InMemoryLabelPropertyCompositeIndex::Iterable::Iterator(std::move(other.in_memory_by_label_properties_it_));
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH_IN_MEMORY:
+      new (&in_memory_by_label_property_hash_it_)
+          // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+          InMemoryLabelPropertyHashIndex::Iterable::Iterator(std::move(other.in_memory_by_label_property_hash_it_));
+      break;
   }
   return *this;
 }
@@ -206,6 +300,12 @@ void VerticesIterable::Iterator::Destroy() noexcept {
     case Type::BY_LABEL_PROPERTY_IN_MEMORY:
       in_memory_by_label_property_it_.InMemoryLabelPropertyIndex::Iterable::Iterator::~Iterator();
       break;
+    case Type::BY_LABEL_PROPERTIES_IN_MEMORY:
+      in_memory_by_label_properties_it_.InMemoryLabelPropertyCompositeIndex::Iterable::Iterator::~Iterator();
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH_IN_MEMORY:
+      in_memory_by_label_property_hash_it_.InMemoryLabelPropertyHashIndex::Iterable::Iterator::~Iterator();
+      break;
   }
 }
 
@@ -217,6 +317,10 @@ VertexAccessor const &VerticesIterable::Iterator::operator*() const {
       return *in_memory_by_label_it_;
     case Type::BY_LABEL_PROPERTY_IN_MEMORY:
       return *in_memory_by_label_property_it_;
+    case Type::BY_LABEL_PROPERTIES_IN_MEMORY:
+      return *in_memory_by_label_properties_it_;
+    case Type::BY_LABEL_PROPERTY_HASH_IN_MEMORY:
+      return *in_memory_by_label_property_hash_it_;
   }
 }
 
@@ -231,6 +335,12 @@ VerticesIterable::Iterator &VerticesIterable::Iterator::operator++() {
     case Type::BY_LABEL_PROPERTY_IN_MEMORY:
       ++in_memory_by_label_property_it_;
       break;
+    case Type::BY_LABEL_PROPERTIES_IN_MEMORY:
+      ++in_memory_by_label_properties_it_;
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH_IN_MEMORY:
+      ++in_memory_by_label_property_hash_it_;
+      break;
   }
   return *this;
 }
@@ -243,6 +353,10 @@ bool VerticesIterable::Iterator::operator==(const Iterator &other) const {
       return in_memory_by_label_it_ == other.in_memory_by_label_it_;
     case Type::BY_LABEL_PROPERTY_IN_MEMORY:
       return in_memory_by_label_property_it_ == other.in_memory_by_label_property_it_;
+    case Type::BY_LABEL_PROPERTIES_IN_MEMORY:
+      return in_memory_by_label_properties_it_ == other.in_memory_by_label_properties_it_;
+    case Type::BY_LABEL_PROPERTY_HASH_IN_MEMORY:
+      return in_memory_by_label_property_hash_it_ == other.in_memory_by_label_property_hash_it_;
   }
 }
 
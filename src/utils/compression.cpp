@@ -0,0 +1,90 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "utils/compression.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <new>
+
+#include "utils/logging.hpp"
+
+namespace memgraph::utils {
+
+void ZlibCompress(std::span<const uint8_t> data, std::vector<uint8_t> &output, int level) {
+  const auto old_size = output.size();
+  auto compressed_size = compressBound(data.size());
+  output.resize(old_size + compressed_size);
+  const auto res = compress2(output.data() + old_size, &compressed_size, data.data(), data.size(), level);
+  if (res == Z_MEM_ERROR) throw std::bad_alloc();
+  MG_ASSERT(res == Z_OK, "zlib compression failed with error {}!", res);
+  output.resize(old_size + compressed_size);
+}
+
+bool ZlibDecompress(std::span<const uint8_t> data, std::span<uint8_t> output) {
+  z_stream stream{};
+  const auto init_res = inflateInit(&stream);
+  if (init_res == Z_MEM_ERROR) throw std::bad_alloc();
+  MG_ASSERT(init_res == Z_OK, "zlib decompression failed to start with error {}!", init_res);
+  stream.next_in = const_cast<Bytef *>(data.data());
+  stream.avail_in = static_cast<uInt>(data.size());
+  stream.next_out = output.data();
+  stream.avail_out = static_cast<uInt>(output.size());
+  // A flushed stream which isn't finished doesn't end with Z_STREAM_END, so
+  // the decompression succeeds once `output` is filled.
+  const auto res = inflate(&stream, Z_SYNC_FLUSH);
+  const bool decompressed = (res == Z_STREAM_END || res == Z_OK || res == Z_BUF_ERROR) && stream.avail_out == 0;
+  inflateEnd(&stream);
+  return decompressed;
+}
+
+struct ZlibStream::State {
+  z_stream stream{};
+};
+
+ZlibStream::ZlibStream(int level) : state_(std::make_unique<State>()) {
+  const auto res = deflateInit(&state_->stream, level);
+  if (res == Z_MEM_ERROR) throw std::bad_alloc();
+  MG_ASSERT(res == Z_OK, "zlib compression failed to start with error {}!", res);
+}
+
+ZlibStream::~ZlibStream() {
+  if (state_) deflateEnd(&state_->stream);
+}
+
+void ZlibStream::Flush(std::span<const uint8_t> data, std::vector<uint8_t> &output) {
+  auto &stream = state_->stream;
+  stream.next_in = const_cast<Bytef *>(data.data());
+  stream.avail_in = static_cast<uInt>(data.size());
+  // The output is grown until the flush doesn't fill it, because only then
+  // everything was flushed.
+  while (true) {
+    const auto old_size = output.size();
+    const auto chunk_size = std::max<uLong>(deflateBound(&stream, stream.avail_in), 64);
+    output.resize(old_size + chunk_size);
+    stream.next_out = output.data() + old_size;
+    stream.avail_out = static_cast<uInt>(chunk_size);
+    const auto res = deflate(&stream, Z_PARTIAL_FLUSH);
+    MG_ASSERT(res == Z_OK || res == Z_BUF_ERROR, "zlib compression failed with error {}!", res);
+    output.resize(old_size + chunk_size - stream.avail_out);
+    if (stream.avail_out != 0) break;
+  }
+}
+
+void ZlibStream::Reset() {
+  const auto res = deflateReset(&state_->stream);
+  MG_ASSERT(res == Z_OK, "zlib compression failed to restart with error {}!", res);
+}
+
+uint32_t Crc32(std::span<const uint8_t> data, uint32_t crc) { return crc32_z(crc, data.data(), data.size()); }
+
+}  // namespace memgraph::utils
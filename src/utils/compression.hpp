@@ -0,0 +1,64 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace memgraph::utils {
+
+/// Compresses `data` with zlib and appends the result to `output`. The default
+/// level favours speed over ratio, because the callers compress data on the
+/// write path.
+/// @throw std::bad_alloc
+void ZlibCompress(std::span<const uint8_t> data, std::vector<uint8_t> &output, int level = 1);
+
+/// Decompresses zlib compressed `data` into `output`, which has to be exactly
+/// as big as the uncompressed data. `data` may also be the flushed output of
+/// an unfinished `ZlibStream`. Returns false if `data` isn't valid or if it
+/// doesn't decompress to the size of `output`.
+bool ZlibDecompress(std::span<const uint8_t> data, std::span<uint8_t> output);
+
+/// Compresses data which arrives in parts. After each `Flush` the output so
+/// far can be decompressed with `ZlibDecompress`, so data which grows can be
+/// kept compressed without compressing it again from the start.
+class ZlibStream {
+ public:
+  /// @throw std::bad_alloc
+  explicit ZlibStream(int level = 1);
+  ~ZlibStream();
+
+  ZlibStream(const ZlibStream &) = delete;
+  ZlibStream &operator=(const ZlibStream &) = delete;
+  ZlibStream(ZlibStream &&) noexcept = default;
+  ZlibStream &operator=(ZlibStream &&) noexcept = default;
+
+  /// Compresses `data` and appends it to `output`, including everything the
+  /// stream still held back.
+  /// @throw std::bad_alloc
+  void Flush(std::span<const uint8_t> data, std::vector<uint8_t> &output);
+
+  /// Starts a new stream.
+  void Reset();
+
+ private:
+  struct State;
+  std::unique_ptr<State> state_;
+};
+
+/// Returns the CRC-32 checksum of `data`. The checksum of data which follows
+/// other data is computed by passing the checksum of the other data as `crc`.
+uint32_t Crc32(std::span<const uint8_t> data, uint32_t crc = 0);
+
+}  // namespace memgraph::utils
@@ -25,8 +25,13 @@
   M(ScanAllByLabelPropertyRangeOperator, Operator, "Number of times ScanAllByLabelPropertyRange operator was used.") \
   M(ScanAllByLabelPropertyValueOperator, Operator, "Number of times ScanAllByLabelPropertyValue operator was used.") \
   M(ScanAllByLabelPropertyOperator, Operator, "Number of times ScanAllByLabelProperty operator was used.")           \
+  M(ScanAllByLabelPropertiesOperator, Operator, "Number of times ScanAllByLabelProperties operator was used.")       \
   M(ScanAllByIdOperator, Operator, "Number of times ScanAllById operator was used.")                                 \
   M(ScanAllByEdgeTypeOperator, Operator, "Number of times ScanAllByEdgeTypeOperator operator was used.")             \
+  M(ScanAllByEdgeTypePropertyValueOperator, Operator,                                                                \
+    "Number of times ScanAllByEdgeTypePropertyValue operator was used.")                                             \
+  M(ScanAllByEdgeTypePropertyRangeOperator, Operator,                                                                \
+    "Number of times ScanAllByEdgeTypePropertyRange operator was used.")                                             \
   M(ExpandOperator, Operator, "Number of times Expand operator was used.")                                           \
   M(ExpandVariableOperator, Operator, "Number of times ExpandVariable operator was used.")                           \
   M(ConstructNamedPathOperator, Operator, "Number of times ConstructNamedPath operator was used.")                   \
@@ -45,6 +50,7 @@
   M(SkipOperator, Operator, "Number of times Skip operator was used.")                                               \
   M(LimitOperator, Operator, "Number of times Limit operator was used.")                                             \
   M(OrderByOperator, Operator, "Number of times OrderBy operator was used.")                                         \
+  M(TopKOperator, Operator, "Number of times TopK operator was used.")                                               \
   M(MergeOperator, Operator, "Number of times Merge operator was used.")                                             \
   M(OptionalOperator, Operator, "Number of times Optional operator was used.")                                       \
   M(UnwindOperator, Operator, "Number of times Unwind operator was used.")                                           \
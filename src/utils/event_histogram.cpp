@@ -12,10 +12,17 @@
 #include "utils/event_histogram.hpp"
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
-#define APPLY_FOR_HISTOGRAMS(M)                                                                    \
-  M(QueryExecutionLatency_us, Query, "Query execution latency in microseconds", 50, 90, 99)        \
-  M(SnapshotCreationLatency_us, Snapshot, "Snapshot creation latency in microseconds", 50, 90, 99) \
-  M(SnapshotRecoveryLatency_us, Snapshot, "Snapshot recovery latency in microseconds", 50, 90, 99)
+#define APPLY_FOR_HISTOGRAMS(M)                                                                                 \
+  M(QueryExecutionLatency_us, Query, "Query execution latency in microseconds", 50, 90, 99)                     \
+  M(SnapshotCreationLatency_us, Snapshot, "Snapshot creation latency in microseconds", 50, 90, 99)              \
+  M(SnapshotRecoveryLatency_us, Snapshot, "Snapshot recovery latency in microseconds", 50, 90, 99)              \
+  M(WalSyncLatency_us, Durability, "WAL sync latency in microseconds in group commit mode", 50, 90, 99)         \
+  M(WalGroupCommitSize, Durability, "Number of transactions made durable by a single WAL sync", 50, 90, 99)     \
+  M(GCLatency_us, GC, "Storage GC latency in microseconds", 50, 90, 99)                                         \
+  M(GCDeltaUnlinkLatency_us, GC, "Latency of unlinking deltas during GC in microseconds", 50, 90, 99)           \
+  M(GCIndexCleanupLatency_us, GC, "Latency of cleaning up indices during GC in microseconds", 50, 90, 99)       \
+  M(GCObjectCleanupLatency_us, GC, "Latency of removing deleted objects during GC in microseconds", 50, 90, 99) \
+  M(GCSkipListCleanupLatency_us, GC, "Latency of freeing skip list nodes in microseconds", 50, 90, 99)
 
 namespace memgraph::metrics {
 
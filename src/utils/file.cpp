@@ -374,6 +374,21 @@ void OutputFile::Write(const uint8_t *data, size_t size) {
 void OutputFile::Write(const char *data, size_t size) { Write(reinterpret_cast<const uint8_t *>(data), size); }
 void OutputFile::Write(const std::string_view data) { Write(data.data(), data.size()); }
 
+void OutputFile::WriteAt(const uint8_t *data, size_t size, size_t offset) {
+  while (size > 0) {
+    auto written = pwrite(fd_, data, size, static_cast<off_t>(offset));
+    if (written == -1 && errno == EINTR) {
+      continue;
+    }
+
+    MG_ASSERT(written > 0, "While trying to write to {} an error occurred: {} ({}).", path_, strerror(errno), errno);
+
+    size -= written;
+    data += written;
+    offset += written;
+  }
+}
+
 size_t OutputFile::SeekFile(const Position position, const ssize_t offset) {
   int whence;
   switch (position) {
@@ -475,6 +490,47 @@ void OutputFile::Sync() {
   written_since_last_sync_ = 0;
 }
 
+int OutputFile::FlushAndDuplicateDescriptor() {
+  FlushBuffer(true);
+
+  int fd = -1;
+  while (true) {
+    fd = fcntl(fd_, F_DUPFD_CLOEXEC, 0);
+    if (fd == -1 && errno == EINTR) {
+      // The call was interrupted, try again...
+      continue;
+    }
+    break;
+  }
+
+  MG_ASSERT(fd != -1, "While trying to duplicate the descriptor of {}, an error occurred: {} ({}).", path_,
+            strerror(errno), errno);
+  return fd;
+}
+
+void DataSyncAndClose(int fd) {
+  int ret = 0;
+  while (true) {
+    ret = fdatasync(fd);
+    if (ret == -1 && errno == EINTR) {
+      // The call was interrupted, try again...
+      continue;
+    }
+    break;
+  }
+  // Failing to sync is fatal for the same reasons as in `OutputFile::Sync`.
+  MG_ASSERT(ret == 0, "While trying to sync a file, an error occurred: {} ({}).", strerror(errno), errno);
+
+  while (true) {
+    ret = close(fd);
+    if (ret == -1 && errno == EINTR) {
+      continue;
+    }
+    break;
+  }
+  MG_ASSERT(ret == 0, "While trying to close a file, an error occurred: {} ({}).", strerror(errno), errno);
+}
+
 void OutputFile::Close() noexcept {
   FlushBuffer(true);
 
@@ -557,9 +613,24 @@ size_t OutputFile::GetSize() {
   return SeekFile(Position::RELATIVE_TO_END, 0) + buffer_position_.load();
 }
 
-void OutputFile::TryFlushing() {
+bool OutputFile::TryFlushing() {
   if (std::unique_lock guard(flush_lock_, std::try_to_lock); guard.owns_lock()) {
     FlushBufferInternal();
+    return true;
+  }
+  return false;
+}
+
+void OutputFile::Truncate() {
+  FlushBuffer(true);
+  const auto position = SeekFile(Position::RELATIVE_TO_CURRENT, 0);
+  while (true) {
+    auto ret = ftruncate(fd_, static_cast<off_t>(position));
+    if (ret == -1 && errno == EINTR) {
+      continue;
+    }
+    MG_ASSERT(ret == 0, "While trying to truncate {} an error occurred: {} ({})", path_, strerror(errno), errno);
+    break;
   }
 }
 
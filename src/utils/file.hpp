@@ -214,6 +214,12 @@ class OutputFile {
   void Write(const char *data, size_t size);
   void Write(std::string_view data);
 
+  /// Writes data at `offset` of the currently opened file, bypassing the
+  /// internal buffer and without changing the current position. It can be
+  /// called from multiple threads at once, as long as no other method is
+  /// called meanwhile. On failure and misuse it crashes the program.
+  void WriteAt(const uint8_t *data, size_t size, size_t offset);
+
   /// This method gets the current absolute position in the file. On failure and
   /// misuse it crashes the program.
   size_t GetPosition();
@@ -235,6 +241,13 @@ class OutputFile {
   /// and misuse it crashes the program.
   void Sync();
 
+  /// Writes the internal buffer to the currently opened file and returns a
+  /// duplicate of its file descriptor. The duplicate stays valid after the
+  /// file is closed, so the written data can be synced from another thread
+  /// using `DataSyncAndClose` without synchronizing with the writer. On
+  /// failure and misuse it crashes the program.
+  int FlushAndDuplicateDescriptor();
+
   /// Closes the currently opened file. It doesn't perform a `Sync` on the
   /// file. On failure and misuse it crashes the program.
   void Close() noexcept;
@@ -247,8 +260,13 @@ class OutputFile {
   /// is flushed.
   void EnableFlushing();
 
-  /// Try flushing the internal buffer.
-  void TryFlushing();
+  /// Try flushing the internal buffer. Returns false if the flushing is
+  /// disabled.
+  bool TryFlushing();
+
+  /// Truncates the file at the current position, dropping the data after it.
+  /// On failure and misuse it crashes the program.
+  void Truncate();
 
   /// Get the internal buffer with its current size.
   std::pair<const uint8_t *, size_t> CurrentBuffer() const;
@@ -272,4 +290,9 @@ class OutputFile {
   utils::RWLock flush_lock_{RWLock::Priority::WRITE};
 };
 
+/// Syncs the data written to the file referred to by `fd` using `fdatasync`
+/// and closes the descriptor. On failure it crashes the program, the same as
+/// `OutputFile::Sync`.
+void DataSyncAndClose(int fd);
+
 }  // namespace memgraph::utils
@@ -54,6 +54,13 @@ void QueryMemoryTracker::SetQueryLimit(size_t size) {
   query_tracker_->SetHardLimit(static_cast<int64_t>(size));
 }
 
+std::optional<std::pair<int64_t, int64_t>> QueryMemoryTracker::QueryUsage() const {
+  if (!query_tracker_.has_value()) {
+    return std::nullopt;
+  }
+  return std::make_pair(query_tracker_->Amount(), query_tracker_->HardLimit());
+}
+
 memgraph::utils::MemoryTracker *QueryMemoryTracker::GetActiveProc() {
   if (active_proc_id == NO_PROCEDURE) [[likely]] {
     return nullptr;
@@ -52,6 +52,9 @@ class QueryMemoryTracker {
   // Set query limit
   void SetQueryLimit(size_t);
 
+  // Memory tracked for the query and the query limit, if the query is limited
+  std::optional<std::pair<int64_t, int64_t>> QueryUsage() const;
+
   // Create proc tracker if doesn't exist
   void TryCreateProcTracker(int64_t, size_t);
 
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <cmath>
 #include <cstdint>
@@ -20,6 +21,7 @@
 #include <optional>
 #include <random>
 #include <utility>
+#include <vector>
 
 #include "spdlog/spdlog.h"
 #include "utils/bound.hpp"
@@ -812,6 +814,21 @@ class SkipList final : detail::SkipListNode_base {
       return skiplist_->estimate_average_number_of_equals(equal_cmp, max_layer_for_estimation);
     }
 
+    /// Splits the list into at most `num_chunks` contiguous chunks of roughly
+    /// the same size so that they can be iterated concurrently. The nodes of
+    /// the highest layer that has enough of them are used as chunk boundaries,
+    /// so the split costs much less than a full traversal of the list.
+    ///
+    /// Chunk `i` starts at the i-th returned iterator and contains all items
+    /// that are less than the item at the start of chunk `i + 1`. The last
+    /// chunk extends to the end of the list. Items should be compared instead
+    /// of iterators to detect the end of a chunk, because the boundary item
+    /// may get removed from the list concurrently.
+    ///
+    /// @return std::vector<Iterator> iterators to the start of each chunk,
+    ///                               empty if the list is empty
+    std::vector<Iterator> chunk_boundaries(uint64_t num_chunks) { return skiplist_->chunk_boundaries(num_chunks); }
+
     /// Removes the key from the list.
     ///
     /// @return bool indicating whether the removal was successful
@@ -1296,6 +1313,47 @@ class SkipList final : detail::SkipListNode_base {
     return nodes_traversed / unique_count;
   }
 
+  std::vector<Iterator> chunk_boundaries(uint64_t num_chunks) {
+    std::vector<Iterator> boundaries;
+    TNode *first = head_->nexts[0].load(std::memory_order_acquire);
+    if (first == nullptr) return boundaries;
+    if (num_chunks <= 1) {
+      boundaries.push_back(Iterator{first});
+      return boundaries;
+    }
+
+    // Find the highest layer that has at least `num_chunks` nodes. Each layer
+    // has about two times less nodes than the one below it, so the chosen
+    // layer has less than `2 * num_chunks` nodes on average.
+    int layer = kSkipListMaxHeight - 1;
+    for (; layer > 0; --layer) {
+      uint64_t count = 0;
+      TNode *curr = head_->nexts[layer].load(std::memory_order_acquire);
+      while (curr != nullptr && count < num_chunks) {
+        ++count;
+        curr = curr->nexts[layer].load(std::memory_order_acquire);
+      }
+      if (count == num_chunks) break;
+    }
+
+    std::vector<TNode *> nodes;
+    for (TNode *curr = head_->nexts[layer].load(std::memory_order_acquire); curr != nullptr;
+         curr = curr->nexts[layer].load(std::memory_order_acquire)) {
+      nodes.push_back(curr);
+    }
+
+    // The first chunk always starts at the beginning of the list, the other
+    // boundaries are spread evenly across the nodes of the chosen layer.
+    boundaries.push_back(Iterator{first});
+    const uint64_t num_boundaries = std::min<uint64_t>(num_chunks, nodes.size());
+    for (uint64_t i = 1; i < num_boundaries; ++i) {
+      TNode *node = nodes[i * nodes.size() / num_boundaries];
+      if (node == first) continue;
+      boundaries.push_back(Iterator{node});
+    }
+    return boundaries;
+  }
+
   bool ok_to_delete(TNode *candidate, int layer_found) {
     // The paper has an incorrect check here. It expects the `layer_found`
     // variable to be 1-indexed, but in fact it is 0-indexed.
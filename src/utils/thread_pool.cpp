@@ -10,19 +10,116 @@
 // licenses/APL.txt.
 
 #include "utils/thread_pool.hpp"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+
+#include "utils/logging.hpp"
+#include "utils/string.hpp"
+
 namespace memgraph::utils {
 
-ThreadPool::ThreadPool(const size_t pool_size) {
+namespace {
+
+std::optional<int> ParseCpu(std::string_view text) {
+  int cpu = 0;
+  const auto *end = text.data() + text.size();
+  auto [ptr, ec] = std::from_chars(text.data(), end, cpu);
+  if (ec != std::errc{} || ptr != end) return std::nullopt;
+  return cpu;
+}
+
+// CPUs the process may run on, grouped by NUMA node.
+std::vector<int> CpusByNumaNode() {
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) return {};
+
+  std::vector<std::pair<int, std::filesystem::path>> nodes;
+  std::error_code error;
+  for (const auto &entry : std::filesystem::directory_iterator("/sys/devices/system/node", error)) {
+    const auto name = entry.path().filename().string();
+    if (!name.starts_with("node")) continue;
+    if (auto node = ParseCpu(std::string_view(name).substr(4))) nodes.emplace_back(*node, entry.path());
+  }
+  std::sort(nodes.begin(), nodes.end());
+
+  std::vector<int> cpus;
+  const auto add = [&](int cpu) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE || !CPU_ISSET(cpu, &allowed)) return;
+    if (std::find(cpus.begin(), cpus.end(), cpu) == cpus.end()) cpus.push_back(cpu);
+  };
+  for (const auto &[node, path] : nodes) {
+    std::ifstream cpulist(path / "cpulist");
+    std::string ranges;
+    std::getline(cpulist, ranges);
+    // The list looks like "0-3,8-11".
+    for (const auto &range : Split(Trim(ranges), ",")) {
+      const auto bounds = Split(range, "-");
+      const auto first = bounds.empty() ? std::nullopt : ParseCpu(bounds.front());
+      const auto last = bounds.empty() ? std::nullopt : ParseCpu(bounds.back());
+      if (!first || !last) continue;
+      for (int cpu = *first; cpu <= *last; ++cpu) add(cpu);
+    }
+  }
+  // Without NUMA information the CPUs are used in their natural order.
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) add(cpu);
+  return cpus;
+}
+
+void PinThread(std::thread &thread, int cpu) {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  if (pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set) != 0) {
+    spdlog::warn("Couldn't pin a thread pool worker to CPU {}!", cpu);
+  }
+}
+
+}  // namespace
+
+thread_local ThreadPool::Worker *ThreadPool::current_worker_{nullptr};
+
+ThreadPool::ThreadPool(const size_t pool_size, const bool pin_workers) {
+  workers_.reserve(pool_size);
   for (size_t i = 0; i < pool_size; ++i) {
-    thread_pool_.emplace_back(([this] { this->ThreadLoop(); }));
+    workers_.emplace_back(std::make_unique<Worker>(this));
+  }
+  const auto cpus = pin_workers ? CpusByNumaNode() : std::vector<int>{};
+  for (size_t i = 0; i < pool_size; ++i) {
+    thread_pool_.emplace_back(([this, worker = workers_[i].get()] { this->ThreadLoop(worker); }));
+    if (!cpus.empty()) PinThread(thread_pool_.back(), cpus[i % cpus.size()]);
   }
 }
 
-void ThreadPool::AddTask(std::function<void()> new_task) {
-  task_queue_.WithLock([&](auto &queue) {
-    queue.emplace(std::make_unique<TaskSignature>(std::move(new_task)));
-    unfinished_tasks_num_.fetch_add(1);
-  });
+void ThreadPool::AddTask(std::function<void()> new_task, const TaskPriority priority) {
+  // Nothing would ever run the task.
+  if (workers_.empty()) return;
+  unfinished_tasks_num_.fetch_add(1);
+  // Counted before the task is queued, so that it is never negative.
+  queued_tasks_num_.fetch_add(1);
+  auto *self = current_worker_ && current_worker_->pool == this ? current_worker_ : nullptr;
+  if (self && priority == TaskPriority::HIGH) {
+    auto guard = std::lock_guard{self->lock};
+    self->local.push_back(std::move(new_task));
+    self->size.fetch_add(1);
+  } else {
+    // Normal priority tasks of a worker are queued behind the ones it already
+    // has, so they keep their submission order.
+    auto &worker = self ? *self : *workers_[next_worker_.fetch_add(1, std::memory_order_relaxed) % workers_.size()];
+    auto guard = std::lock_guard{worker.lock};
+    worker.inbox[static_cast<size_t>(priority)].push_back(std::move(new_task));
+    worker.size.fetch_add(1);
+  }
+  // The pool lock is taken only to wake up a sleeping worker, see ThreadLoop.
+  if (sleeping_workers_num_.load() == 0) return;
   std::unique_lock pool_guard(pool_lock_);
   queue_cv_.notify_one();
 }
@@ -50,34 +147,83 @@ ThreadPool::~ThreadPool() {
   }
 }
 
-std::unique_ptr<ThreadPool::TaskSignature> ThreadPool::PopTask() {
-  return task_queue_.WithLock([](auto &queue) -> std::unique_ptr<TaskSignature> {
-    if (queue.empty()) {
-      return nullptr;
+bool ThreadPool::PopTask(Worker *self, TaskSignature *task) {
+  if (queued_tasks_num_.load() == 0) return false;
+
+  const auto take = [&](Worker &worker, auto &&pop) {
+    if (worker.size.load() == 0) return false;
+    auto guard = std::lock_guard{worker.lock};
+    if (!pop(worker)) return false;
+    worker.size.fetch_sub(1);
+    queued_tasks_num_.fetch_sub(1);
+    return true;
+  };
+  const auto pop_front = [task](std::deque<TaskSignature> &queue) {
+    if (queue.empty()) return false;
+    *task = std::move(queue.front());
+    queue.pop_front();
+    return true;
+  };
+
+  // Victims are visited starting after the worker itself, so that the
+  // workers don't all steal from the first one.
+  const auto self_index =
+      self ? static_cast<size_t>(std::find_if(workers_.begin(), workers_.end(),
+                                              [self](const auto &worker) { return worker.get() == self; }) -
+                                 workers_.begin())
+           : next_worker_.load(std::memory_order_relaxed);
+  const auto steal = [&](auto &&pop) {
+    for (size_t i = 1; i <= workers_.size(); ++i) {
+      auto &victim = *workers_[(self_index + i) % workers_.size()];
+      if (&victim != self && take(victim, pop)) return true;
     }
-    auto front = std::move(queue.front());
-    queue.pop();
-    return front;
-  });
+    return false;
+  };
+
+  const auto high = static_cast<size_t>(TaskPriority::HIGH);
+  const auto normal = static_cast<size_t>(TaskPriority::NORMAL);
+  if (self) {
+    const auto own_high = [&](Worker &worker) {
+      if (!worker.local.empty()) {
+        *task = std::move(worker.local.back());
+        worker.local.pop_back();
+        return true;
+      }
+      return pop_front(worker.inbox[high]);
+    };
+    if (take(*self, own_high)) return true;
+  }
+  const auto stolen_high = [&](Worker &worker) { return pop_front(worker.local) || pop_front(worker.inbox[high]); };
+  if (steal(stolen_high)) return true;
+  const auto any_normal = [&](Worker &worker) { return pop_front(worker.inbox[normal]); };
+  if (self && take(*self, any_normal)) return true;
+  return steal(any_normal);
 }
 
-void ThreadPool::ThreadLoop() {
-  std::unique_ptr<TaskSignature> task = PopTask();
+void ThreadPool::ThreadLoop(Worker *self) {
+  current_worker_ = self;
+  TaskSignature task;
+  bool has_task = PopTask(self, &task);
   while (true) {
-    while (task) {
+    while (has_task) {
       if (terminate_pool_.load()) {
         return;
       }
-      (*task)();
+      task();
       unfinished_tasks_num_.fetch_sub(1);
-      task = PopTask();
+      has_task = PopTask(self, &task);
     }
 
+    // A worker announces that it is going to sleep before looking for a task
+    // one last time, so AddTask either sees it sleeping and wakes it up or
+    // the task is found here.
     std::unique_lock guard(pool_lock_);
+    sleeping_workers_num_.fetch_add(1);
     queue_cv_.wait(guard, [&] {
-      task = PopTask();
-      return task || terminate_pool_.load();
+      has_task = PopTask(self, &task);
+      return has_task || terminate_pool_.load();
     });
+    sleeping_workers_num_.fetch_sub(1);
     if (terminate_pool_.load()) {
       return;
     }
@@ -86,4 +232,51 @@ void ThreadPool::ThreadLoop() {
 
 size_t ThreadPool::UnfinishedTasksNum() const { return unfinished_tasks_num_.load(); }
 
+TaskGroup::TaskGroup(ThreadPool &pool) : pool_(&pool), state_(std::make_shared<State>()) {}
+
+TaskGroup::~TaskGroup() {
+  try {
+    Wait();
+  } catch (...) {
+    // The caller didn't wait for the tasks, so it isn't interested in errors.
+  }
+}
+
+void TaskGroup::Run(std::function<void()> task) {
+  {
+    auto guard = std::lock_guard{state_->lock};
+    state_->tasks.push_back(std::move(task));
+    ++state_->unfinished;
+  }
+  pool_->AddTask([state = state_] { state->RunOne(); }, TaskPriority::HIGH);
+}
+
+void TaskGroup::Wait() {
+  while (state_->RunOne()) {
+  }
+  std::unique_lock guard(state_->lock);
+  state_->done_cv.wait(guard, [this] { return state_->unfinished == 0; });
+  if (auto error = std::exchange(state_->error, nullptr)) std::rethrow_exception(error);
+}
+
+bool TaskGroup::State::RunOne() {
+  std::function<void()> task;
+  {
+    auto guard = std::lock_guard{lock};
+    if (tasks.empty()) return false;
+    task = std::move(tasks.front());
+    tasks.pop_front();
+  }
+  std::exception_ptr task_error;
+  try {
+    task();
+  } catch (...) {
+    task_error = std::current_exception();
+  }
+  auto guard = std::lock_guard{lock};
+  if (task_error && !error) error = task_error;
+  if (--unfinished == 0) done_cv.notify_all();
+  return true;
+}
+
 }  // namespace memgraph::utils
@@ -10,12 +10,16 @@
 // licenses/APL.txt.
 
 #pragma once
+#include <array>
 #include <atomic>
 #include <condition_variable>
+#include <deque>
+#include <exception>
 #include <functional>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
+#include <vector>
 
 #include "utils/spin_lock.hpp"
 #include "utils/synchronized.hpp"
@@ -33,13 +37,34 @@ struct CopyMovableFunctionWrapper {
   std::shared_ptr<Func> func_;
 };
 
+enum class TaskPriority : uint8_t { HIGH, NORMAL };
+
+/// Work-stealing thread pool.
+///
+/// Every worker has its own queues, so submitting and taking tasks doesn't go
+/// through a single lock:
+///  - tasks submitted from outside the pool are spread over the workers and
+///    kept in submission order, one queue per priority,
+///  - normal priority tasks submitted by a worker are queued behind the ones
+///    the worker already has, in the same queue,
+///  - high priority tasks submitted by a worker go to its local deque, from
+///    which the worker takes the newest task and idle workers steal the oldest
+///    one.
+///
+/// A worker first runs its local tasks and high priority tasks, its own and
+/// then stolen, and only then the normal priority ones. A pool with a single
+/// worker therefore runs the normal priority tasks in submission order, also
+/// when they are submitted by other tasks.
+///
+/// Workers can be pinned to CPUs. Consecutive workers are placed on the CPUs
+/// of the same NUMA node before moving on to the next node.
 class ThreadPool {
   using TaskSignature = std::function<void()>;
 
  public:
-  explicit ThreadPool(size_t pool_size);
+  explicit ThreadPool(size_t pool_size, bool pin_workers = false);
 
-  void AddTask(std::function<void()> new_task);
+  void AddTask(std::function<void()> new_task, TaskPriority priority = TaskPriority::NORMAL);
 
   void Shutdown();
 
@@ -53,18 +78,79 @@ class ThreadPool {
   size_t UnfinishedTasksNum() const;
 
  private:
-  std::unique_ptr<TaskSignature> PopTask();
+  static constexpr size_t kNumPriorities = 2;
 
-  void ThreadLoop();
+  struct Worker {
+    explicit Worker(ThreadPool *pool) : pool(pool) {}
 
+    ThreadPool *pool;
+    utils::SpinLock lock;
+    // Number of queued tasks, read without the lock to skip empty workers.
+    std::atomic<size_t> size{0};
+    // High priority tasks submitted by the worker itself.
+    std::deque<TaskSignature> local;
+    // Tasks submitted from outside the pool and normal priority tasks submitted
+    // by the worker itself, indexed by priority.
+    std::array<std::deque<TaskSignature>, kNumPriorities> inbox;
+  };
+
+  bool PopTask(Worker *self, TaskSignature *task);
+
+  void ThreadLoop(Worker *self);
+
+  // Worker of the calling thread, if it is a pool thread.
+  static thread_local Worker *current_worker_;
+
+  std::vector<std::unique_ptr<Worker>> workers_;
   std::vector<std::thread> thread_pool_;
 
   std::atomic<size_t> unfinished_tasks_num_{0};
+  std::atomic<size_t> queued_tasks_num_{0};
+  std::atomic<size_t> sleeping_workers_num_{0};
+  std::atomic<size_t> next_worker_{0};
   std::atomic<bool> terminate_pool_{false};
   std::atomic<bool> stopped_{false};
-  utils::Synchronized<std::queue<std::unique_ptr<TaskSignature>>, utils::SpinLock> task_queue_;
   std::mutex pool_lock_;
   std::condition_variable queue_cv_;
 };
 
+/// Fork/join on top of a `ThreadPool`.
+///
+/// Tasks spawned with `Run` are scheduled on the pool. `Wait` blocks until all
+/// of them are done and runs the ones no worker has picked up yet on the
+/// calling thread, so it makes progress even when the pool is busy or when it
+/// is called from a pool thread. Only tasks of this group are run by `Wait`.
+/// The first exception thrown by a task is rethrown by `Wait`.
+class TaskGroup {
+ public:
+  explicit TaskGroup(ThreadPool &pool);
+
+  TaskGroup(const TaskGroup &) = delete;
+  TaskGroup(TaskGroup &&) = delete;
+  TaskGroup &operator=(const TaskGroup &) = delete;
+  TaskGroup &operator=(TaskGroup &&) = delete;
+  ~TaskGroup();
+
+  void Run(std::function<void()> task);
+
+  void Wait();
+
+ private:
+  struct State {
+    /// Runs the oldest task which hasn't been started yet, returns false if
+    /// there is none.
+    bool RunOne();
+
+    std::mutex lock;
+    std::condition_variable done_cv;
+    std::deque<std::function<void()>> tasks;
+    size_t unfinished{0};
+    std::exception_ptr error;
+  };
+
+  ThreadPool *pool_;
+  // Shared with the tasks scheduled on the pool, which can outlive the group.
+  std::shared_ptr<State> state_;
+};
+
 }  // namespace memgraph::utils
@@ -31,8 +31,11 @@ enum class TypeId : uint64_t {
   SCAN_ALL_BY_LABEL_PROPERTY_RANGE,
   SCAN_ALL_BY_LABEL_PROPERTY_VALUE,
   SCAN_ALL_BY_LABEL_PROPERTY,
+  SCAN_ALL_BY_LABEL_PROPERTIES,
   SCAN_ALL_BY_ID,
   SCAN_ALL_BY_EDGE_TYPE,
+  SCAN_ALL_BY_EDGE_TYPE_PROPERTY_VALUE,
+  SCAN_ALL_BY_EDGE_TYPE_PROPERTY_RANGE,
   EXPAND_COMMON,
   EXPAND,
   EXPANSION_LAMBDA,
@@ -70,6 +73,7 @@ enum class TypeId : uint64_t {
   INDEXED_JOIN,
   HASH_JOIN,
   ROLLUP_APPLY,
+  TOP_K,
 
   // Replication
   // NOTE: these NEED to be stable in the 2000+ range (see rpc version)
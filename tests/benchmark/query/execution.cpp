@@ -9,6 +9,7 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <limits>
 #include <random>
 #include <string>
 
@@ -480,6 +481,70 @@ BENCHMARK_TEMPLATE(OrderBy, MonotonicBufferResource)
 
 BENCHMARK_TEMPLATE(OrderBy, PoolResource)->Ranges({{4, 1U << 7U}, {512, 1U << 13U}})->Unit(benchmark::kMicrosecond);
 
+static void AddVerticesWithRandomProperty(memgraph::storage::Storage *db, int vertex_count) {
+  auto dba = db->Access(ReplicationRole::MAIN);
+  auto prop = dba->NameToProperty("prop");
+  // NOLINTNEXTLINE(cert-msc32-c,cert-msc51-cpp)
+  std::mt19937_64 rg(42);
+  for (int i = 0; i < vertex_count; i++) {
+    auto vertex = dba->CreateVertex();
+    MG_ASSERT(vertex.SetProperty(prop, memgraph::storage::PropertyValue(memgraph::utils::MemcpyCast<int64_t>(rg())))
+                  .HasValue());
+  }
+  MG_ASSERT(!dba->Commit().HasError());
+}
+
+// Runs ORDER BY v.prop LIMIT k, either planned as OrderBy followed by Limit or
+// as TopK. Besides the time, reports the memory kept by the plan once the
+// first row is returned, which for OrderBy holds all of the input rows.
+template <bool TTopK>
+// NOLINTNEXTLINE(google-runtime-references)
+static void OrderByLimit(benchmark::State &state) {
+  memgraph::query::AstStorage ast;
+  std::unique_ptr<memgraph::storage::Storage> db(new memgraph::storage::InMemoryStorage());
+  AddVerticesWithRandomProperty(db.get(), state.range(0));
+  memgraph::query::SymbolTable symbol_table;
+  auto vertex_sym = symbol_table.CreateSymbol("v", false);
+  auto scan_all = std::make_shared<memgraph::query::plan::ScanAll>(nullptr, vertex_sym);
+  auto *prop_lookup = ast.Create<memgraph::query::PropertyLookup>(
+      ast.Create<memgraph::query::Identifier>("v")->MapTo(vertex_sym), ast.GetPropertyIx("prop"));
+  std::vector<memgraph::query::SortItem> sort_items{{memgraph::query::Ordering::ASC, prop_lookup}};
+  auto *limit = ast.Create<memgraph::query::PrimitiveLiteral>(state.range(1));
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> plan;
+  if constexpr (TTopK) {
+    plan = std::make_shared<memgraph::query::plan::TopK>(scan_all, sort_items, std::vector{vertex_sym}, nullptr, limit);
+  } else {
+    plan = std::make_shared<memgraph::query::plan::Limit>(
+        std::make_shared<memgraph::query::plan::OrderBy>(scan_all, sort_items, std::vector{vertex_sym}), limit);
+  }
+  auto storage_dba = db->Access(ReplicationRole::MAIN);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  // We need to only set the memory for temporary (per pull) evaluations
+  MonotonicBufferResource per_pull_memory;
+  memgraph::query::EvaluationContext evaluation_context{per_pull_memory.get()};
+  evaluation_context.properties = memgraph::query::NamesToProperties(ast.properties_, &dba);
+  size_t kept_bytes = 0;
+  while (state.KeepRunning()) {
+    memgraph::query::ExecutionContext execution_context{
+        .db_accessor = &dba, .symbol_table = symbol_table, .evaluation_context = evaluation_context};
+    memgraph::utils::MemoryTrackingResource memory(memgraph::utils::NewDeleteResource(),
+                                                   std::numeric_limits<size_t>::max());
+    memgraph::query::Frame frame(symbol_table.max_position(), &memory);
+    auto cursor = plan->MakeCursor(&memory);
+    if (cursor->Pull(frame, execution_context)) kept_bytes = memory.GetAllocatedBytes();
+    per_pull_memory.Reset();
+    while (cursor->Pull(frame, execution_context)) per_pull_memory.Reset();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["kept_bytes"] = static_cast<double>(kept_bytes);
+}
+
+BENCHMARK_TEMPLATE(OrderByLimit, false)
+    ->Ranges({{1U << 10U, 1U << 18U}, {10, 1000}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(OrderByLimit, true)->Ranges({{1U << 10U, 1U << 18U}, {10, 1000}})->Unit(benchmark::kMicrosecond);
+
 template <class TMemory>
 // NOLINTNEXTLINE(google-runtime-references)
 static void Unwind(benchmark::State &state) {
@@ -147,7 +147,43 @@ startup_config_dict = {
         "Controls whether updating a property with the same value should create a delta object.",
     ),
     "storage_gc_cycle_sec": ("30", "30", "Storage garbage collector interval (in seconds)."),
+    "storage_gc_threads": ("1", "1", "Number of threads the storage garbage collector splits its work between."),
+    "storage_gc_step_budget_ms": (
+        "0",
+        "0",
+        "Time (in milliseconds) a single storage garbage collector run may spend unlinking old versions of objects. The rest is left to the following runs. Set to 0 to unlink everything in each run.",
+    ),
+    "storage_property_column_cache": (
+        "",
+        "",
+        "Comma-separated list of Label.property pairs whose integer, floating point and boolean values are additionally kept in dense per-vertex columns, so property lookups on vertices with that label don't have to decode the vertex's property store. Only used by the in-memory transactional storage mode.",
+    ),
+    "storage_hash_indices": (
+        "",
+        "",
+        "Comma-separated list of Label.property pairs which get a hash index. A hash index only answers equality lookups, such as MATCH or MERGE on an external id, and does so without comparing values along a skip list. Only used by the in-memory storage modes.",
+    ),
+    "storage_vertex_directory": (
+        "false",
+        "false",
+        "Controls whether a dense table from vertex ids to vertices is kept next to the vertex skip list, so vertices are found by id in constant time. Uses 8 bytes per vertex id handed out. Only used by the in-memory storage modes.",
+    ),
+    "storage_index_creation_thread_count": (
+        "1",
+        "1",
+        "The number of threads which build a label or label+property index created by a query. With more than one thread, every thread indexes chunks of the vertices.",
+    ),
+    "storage_index_creation_online": (
+        "false",
+        "false",
+        "Controls whether a label or label+property index created by a query is populated while other transactions keep running. Unique access to the storage is only taken to register the index and to make it visible. Only used by the in-memory transactional storage mode.",
+    ),
     "storage_python_gc_cycle_sec": ("180", "180", "Storage python full garbage collection interval (in seconds)."),
+    "storage_durability_compression": (
+        "false",
+        "false",
+        "Compress new snapshot and WAL files with zlib. The data is compressed in blocks, so the transactions committed since the last WAL sync may not be in the WAL file yet.",
+    ),
     "storage_items_per_batch": (
         "1000000",
         "1000000",
@@ -155,6 +191,11 @@ startup_config_dict = {
     ),
     "storage_properties_on_edges": ("false", "true", "Controls whether edges have properties."),
     "storage_recovery_thread_count": ("12", "12", "The number of threads used to recover persisted data from disk."),
+    "storage_snapshot_thread_count": (
+        "1",
+        "1",
+        "The number of threads used to create a snapshot. With more than one thread, vertices and edges are encoded, compressed and written to the snapshot file in parallel.",
+    ),
     "storage_snapshot_interval_sec": (
         "0",
         "300",
@@ -172,6 +213,11 @@ startup_config_dict = {
         "100000",
         "Issue a 'fsync' call after this amount of transactions are written to the WAL file. Set to 1 for fully synchronous operation.",
     ),
+    "storage_wal_group_commit": (
+        "false",
+        "false",
+        "Every committed transaction is durable before the commit returns, but the WAL is synced by a dedicated thread once for all transactions committed in the meantime. Replaces --storage-wal-file-flush-every-n-tx when enabled.",
+    ),
     "storage_mode": (
         "IN_MEMORY_TRANSACTIONAL",
         "IN_MEMORY_TRANSACTIONAL",
@@ -201,6 +247,26 @@ startup_config_dict = {
         "Maximum count of indexed vertices which provoke indexed lookup and then expand to existing, instead of a regular expand. Default is 10, to turn off use -1.",
     ),
     "query_max_plans": ("1000", "1000", "Maximum number of generated plans for a query."),
+    "query_parallel_execution_threads": (
+        "1",
+        "1",
+        "Maximum number of threads a single query can use to scan and aggregate vertices in parallel. Values less than 2 disable parallel execution.",
+    ),
+    "query_parallel_execution_pin_threads": (
+        "false",
+        "false",
+        "Pin the threads used for parallel query execution to CPUs, filling the CPUs of one NUMA node before moving on to the next one.",
+    ),
+    "query_compile_expressions": (
+        "true",
+        "true",
+        "Compile the filter expressions of frequently executed cached plans instead of interpreting them for every row.",
+    ),
+    "query_spill_threshold_mb": (
+        "0",
+        "0",
+        "Memory in MiB a single aggregation can use before its groups are spilled to disk. Value of 0 means the groups are spilled only when the query gets close to its memory limit.",
+    ),
     "flag_file": ("", "", "load flags from file"),
     "init_file": (
         "",
@@ -213,6 +279,11 @@ startup_config_dict = {
         "false",
         "Restore replication state on startup, e.g. recover replica",
     ),
+    "replication_compression": (
+        "false",
+        "false",
+        "Compress the deltas, snapshots and WAL files that MAIN sends to its replicas with zlib. Replicas which can't read compressed data are sent uncompressed data. Helps when the replicas are behind a slow link, at the cost of CPU time on both ends.",
+    ),
     "query_callable_mappings_path": (
         "",
         "",
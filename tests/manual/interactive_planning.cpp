@@ -200,6 +200,12 @@ class InteractiveDbAccessor {
     return ReadVertexCount("label '" + label + "' and property '" + property + "' in range " + range_string.str());
   }
 
+  int64_t VerticesCount(memgraph::storage::LabelId label_id,
+                        const std::vector<memgraph::storage::PropertyId> &properties,
+                        const std::vector<memgraph::storage::PropertyValue> &prefix) {
+    return dba_->VerticesCount(label_id, properties, prefix);
+  }
+
   bool LabelIndexExists(memgraph::storage::LabelId label) { return true; }
 
   bool LabelPropertyIndexExists(memgraph::storage::LabelId label_id, memgraph::storage::PropertyId property_id) {
@@ -214,8 +220,21 @@ class InteractiveDbAccessor {
     return label_property_index_.at(key);
   }
 
+  bool LabelPropertyHashIndexExists(memgraph::storage::LabelId label_id, memgraph::storage::PropertyId property_id) {
+    return dba_->LabelPropertyHashIndexExists(label_id, property_id);
+  }
+
+  std::vector<std::vector<memgraph::storage::PropertyId>> LabelPropertyCompositeIndices(
+      memgraph::storage::LabelId label_id) {
+    return dba_->LabelPropertyCompositeIndices(label_id);
+  }
+
   bool EdgeTypeIndexExists(memgraph::storage::EdgeTypeId edge_type) { return true; }
 
+  bool EdgeTypePropertyIndexExists(memgraph::storage::EdgeTypeId edge_type, memgraph::storage::PropertyId property) {
+    return dba_->EdgeTypePropertyIndexExists(edge_type, property);
+  }
+
   std::optional<memgraph::storage::LabelIndexStats> GetIndexStats(const memgraph::storage::LabelId label) const {
     return dba_->GetIndexStats(label);
   }
@@ -12,8 +12,10 @@
 #include "bfs_common.hpp"
 
 #include "disk_test_utils.hpp"
+#include "flags/query.hpp"
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/inmemory/storage.hpp"
+#include "utils/on_scope_exit.hpp"
 
 using namespace memgraph::query;
 using namespace memgraph::query::plan;
@@ -177,3 +179,60 @@ INSTANTIATE_TEST_CASE_P(FilterLambda, SingleNodeBfsTestOnDisk,
                                          testing::Values(FilterLambdaType::NONE, FilterLambdaType::USE_FRAME,
                                                          FilterLambdaType::USE_FRAME_NULL, FilterLambdaType::USE_CTX,
                                                          FilterLambdaType::ERROR)));
+
+class SingleNodeBfsParallelTest : public ::testing::TestWithParam<EdgeAtom::Direction> {
+ protected:
+  memgraph::query::AstStorage storage;
+  SingleNodeDb<memgraph::storage::InMemoryStorage> db_;
+};
+
+TEST_P(SingleNodeBfsParallelTest, LargeLevels) {
+  // Levels with thousands of vertices are expanded by multiple threads, which
+  // must reach the same vertices by the same edges and yield them in the same
+  // order as a single thread does.
+  auto storage_dba = db_.Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  const int first_level = 2000;
+  const int second_level = 3000;
+  std::vector<std::tuple<int, int, std::string>> edges;
+  for (int i = 1; i <= first_level; ++i) {
+    edges.emplace_back(0, i, "a");
+    edges.emplace_back(i, first_level + 1 + (i * 7) % second_level, "a");
+    edges.emplace_back(i, first_level + 1 + (i * 13) % second_level, "b");
+    edges.emplace_back(first_level + 1 + (i * 11) % second_level, i, "a");
+  }
+  const auto vertices = db_.BuildGraph(&dba, std::vector<int>(1 + first_level + second_level), edges).first;
+  dba.AdvanceCommand();
+
+  memgraph::query::ExecutionContext context{.db_accessor = &dba};
+  auto source_sym = context.symbol_table.CreateSymbol("source", true);
+  auto sink_sym = context.symbol_table.CreateSymbol("sink", true);
+  auto edges_sym = context.symbol_table.CreateSymbol("edges", true);
+  auto inner_node_sym = context.symbol_table.CreateSymbol("inner_node", true);
+  auto inner_edge_sym = context.symbol_table.CreateSymbol("inner_edge", true);
+  auto *inner_node = IDENT("inner_node")->MapTo(inner_node_sym);
+  auto *filter_expr = NEQ(PROPERTY_LOOKUP(dba, inner_node, PROPERTY_PAIR(dba, "id")), LITERAL(first_level + 1));
+  context.evaluation_context.properties = memgraph::query::NamesToProperties(storage.properties_, &dba);
+
+  auto pull_paths = [&] {
+    auto bfs = db_.MakeBfsOperator(source_sym, sink_sym, edges_sym, GetParam(), {},
+                                   YieldVertices(&dba, {vertices[0]}, source_sym, nullptr), false, nullptr, nullptr,
+                                   ExpansionLambda{inner_edge_sym, inner_node_sym, filter_expr});
+    std::vector<std::vector<memgraph::storage::Gid>> paths;
+    for (const auto &row : PullResults(bfs.get(), &context, {sink_sym, edges_sym})) {
+      auto &path = paths.emplace_back();
+      path.push_back(row[0].ValueVertex().Gid());
+      for (const auto &edge : row[1].ValueList()) path.push_back(edge.ValueEdge().Gid());
+    }
+    return paths;
+  };
+
+  const auto sequential_paths = pull_paths();
+  ASSERT_GT(sequential_paths.size(), first_level);
+  FLAGS_query_parallel_execution_threads = 4;
+  memgraph::utils::OnScopeExit reset_threads([] { FLAGS_query_parallel_execution_threads = 1; });
+  EXPECT_EQ(pull_paths(), sequential_paths);
+}
+
+INSTANTIATE_TEST_CASE_P(Direction, SingleNodeBfsParallelTest,
+                        testing::Values(EdgeAtom::Direction::OUT, EdgeAtom::Direction::BOTH));
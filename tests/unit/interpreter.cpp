@@ -157,6 +157,32 @@ TYPED_TEST(InterpreterTest, MultiplePulls) {
   }
 }
 
+// Scan, filter and produce are pulled in batches, across multiple pulls which
+// end in the middle of a batch.
+TYPED_TEST(InterpreterTest, MultiplePullsInBatches) {
+  this->Interpret("UNWIND range(0, 2999) AS i CREATE ({prop: i})");
+  auto [stream, qid] = this->Prepare("MATCH (n) WHERE n.prop % 3 = 0 RETURN n.prop AS p");
+  this->Pull(&stream, 10);
+  ASSERT_TRUE(stream.GetSummary().at("has_more").ValueBool());
+  ASSERT_EQ(stream.GetResults().size(), 10U);
+  this->Pull(&stream, 500);
+  ASSERT_TRUE(stream.GetSummary().at("has_more").ValueBool());
+  ASSERT_EQ(stream.GetResults().size(), 510U);
+  this->Pull(&stream, 490);
+  ASSERT_FALSE(stream.GetSummary().at("has_more").ValueBool());
+  ASSERT_EQ(stream.GetResults().size(), 1000U);
+
+  std::set<int64_t> values;
+  for (const auto &row : stream.GetResults()) {
+    ASSERT_EQ(row.size(), 1U);
+    values.insert(row[0].ValueInt());
+  }
+  ASSERT_EQ(values.size(), 1000U);
+  EXPECT_EQ(*values.begin(), 0);
+  EXPECT_EQ(*values.rbegin(), 2997);
+  for (auto value : values) EXPECT_EQ(value % 3, 0);
+}
+
 // Run query with different ast twice to see if query executes correctly when
 // ast is read from cache.
 TYPED_TEST(InterpreterTest, AstCache) {
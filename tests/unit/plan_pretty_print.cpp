@@ -814,6 +814,34 @@ TYPED_TEST(PrintToJsonTest, OrderBy) {
           })sep");
 }
 
+TYPED_TEST(PrintToJsonTest, TopK) {
+  Symbol node_sym = this->GetSymbol("node");
+  memgraph::storage::PropertyId value = this->dba.NameToProperty("value");
+  std::shared_ptr<LogicalOperator> last_op = std::make_shared<ScanAll>(nullptr, node_sym);
+  last_op = std::make_shared<TopK>(last_op,
+                                   std::vector<SortItem>{{Ordering::DESC, PROPERTY_LOOKUP(this->dba, "node", value)}},
+                                   std::vector<Symbol>{node_sym}, nullptr, LITERAL(42));
+
+  this->Check(last_op.get(), R"sep(
+          {
+            "name" : "TopK",
+            "order_by" : [
+              {
+                "ordering" : "desc",
+                "expression" : "(PropertyLookup (Identifier \"node\") \"value\")"
+              }
+            ],
+            "output_symbols" : ["node"],
+            "skip" : null,
+            "limit" : "42",
+            "input" : {
+              "name" : "ScanAll",
+              "output_symbol" : "node",
+              "input" : { "name" : "Once" }
+            }
+          })sep");
+}
+
 TYPED_TEST(PrintToJsonTest, Merge) {
   Symbol node_sym = this->GetSymbol("node");
   memgraph::storage::LabelId label = this->dba.NameToLabel("label");
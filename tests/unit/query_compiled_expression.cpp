@@ -0,0 +1,213 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "query/context.hpp"
+#include "query/db_accessor.hpp"
+#include "query/exceptions.hpp"
+#include "query/frontend/ast/ast.hpp"
+#include "query/interpret/compiled_expression.hpp"
+#include "query/interpret/eval.hpp"
+#include "query/interpret/frame.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+
+using namespace memgraph::query;
+using memgraph::storage::PropertyValue;
+
+namespace {
+
+using MakeOperator = std::function<Expression *(AstStorage &, Expression *, Expression *)>;
+
+template <class TOperator>
+MakeOperator Make() {
+  return [](AstStorage &storage, Expression *lhs, Expression *rhs) { return storage.Create<TOperator>(lhs, rhs); };
+}
+
+class CompiledExpressionTest : public ::testing::Test {
+ protected:
+  CompiledExpressionTest()
+      : db_(std::make_unique<memgraph::storage::InMemoryStorage>()),
+        storage_dba_(db_->Access(memgraph::replication_coordination_glue::ReplicationRole::MAIN)),
+        dba_(storage_dba_.get()) {
+    auto vertex = dba_.InsertVertex();
+    MG_ASSERT(vertex.SetProperty(dba_.NameToProperty("age"), PropertyValue(10)).HasValue());
+    MG_ASSERT(vertex.SetProperty(dba_.NameToProperty("score"), PropertyValue(2.5)).HasValue());
+    MG_ASSERT(vertex.SetProperty(dba_.NameToProperty("name"), PropertyValue("bob")).HasValue());
+    MG_ASSERT(vertex.SetProperty(dba_.NameToProperty("nan"), PropertyValue(std::numeric_limits<double>::quiet_NaN()))
+                  .HasValue());
+    dba_.AdvanceCommand();
+
+    identifier_ = storage_.Create<Identifier>("n");
+    auto symbol = symbol_table_.CreateSymbol("n", true);
+    identifier_->MapTo(symbol);
+    frame_[symbol] = TypedValue(vertex);
+  }
+
+  PropertyLookup *Property(const std::string &name) {
+    return storage_.Create<PropertyLookup>(identifier_, storage_.GetPropertyIx(name));
+  }
+
+  // Checks that the compiled expression gives the same result or raises the
+  // same error as the evaluator.
+  void ExpectSameAsEvaluator(Expression *expression) {
+    ctx_.properties = NamesToProperties(storage_.properties_, &dba_);
+    ctx_.labels = NamesToLabels(storage_.labels_, &dba_);
+    auto compiled = CompiledExpression::Compile(expression, symbol_table_);
+    ASSERT_TRUE(compiled);
+    const auto parameters = compiled->BindParameters(ctx_);
+
+    std::optional<TypedValue> expected;
+    std::string expected_error;
+    try {
+      expected = expression->Accept(evaluator_);
+    } catch (const QueryRuntimeException &e) {
+      expected_error = e.what();
+    }
+
+    if (expected) {
+      const auto actual = compiled->Evaluate(evaluator_, parameters);
+      EXPECT_EQ(actual.type(), expected->type());
+      EXPECT_TRUE(TypedValue::BoolEqual{}(actual, *expected));
+      EXPECT_EQ(actual.GetMemoryResource(), &mem_);
+    } else {
+      try {
+        compiled->Evaluate(evaluator_, parameters);
+        ADD_FAILURE() << "Expected error: " << expected_error;
+      } catch (const QueryRuntimeException &e) {
+        EXPECT_EQ(std::string(e.what()), expected_error);
+      }
+    }
+  }
+
+  std::unique_ptr<memgraph::storage::Storage> db_;
+  std::unique_ptr<memgraph::storage::Storage::Accessor> storage_dba_;
+  DbAccessor dba_;
+
+  AstStorage storage_;
+  memgraph::utils::MonotonicBufferResource mem_{1024};
+  EvaluationContext ctx_{.memory = &mem_, .timestamp = QueryTimestamp()};
+  SymbolTable symbol_table_;
+  Frame frame_{128};
+  ExpressionEvaluator evaluator_{&frame_, symbol_table_, ctx_, &dba_, memgraph::storage::View::OLD};
+  Identifier *identifier_;
+};
+
+}  // namespace
+
+TEST_F(CompiledExpressionTest, PropertyComparisons) {
+  const std::vector<MakeOperator> operators{Make<EqualOperator>(),     Make<NotEqualOperator>(),
+                                            Make<LessOperator>(),      Make<GreaterOperator>(),
+                                            Make<LessEqualOperator>(), Make<GreaterEqualOperator>()};
+  const std::vector<PropertyValue> constants{
+      PropertyValue(10), PropertyValue(5),     PropertyValue(10.0),  PropertyValue(2.5), PropertyValue("bob"),
+      PropertyValue("al"), PropertyValue(true), PropertyValue(), PropertyValue(std::numeric_limits<double>::quiet_NaN())};
+  const std::vector<std::string> properties{"age", "score", "name", "nan", "missing"};
+
+  for (const auto &make : operators) {
+    for (const auto &constant : constants) {
+      for (const auto &property : properties) {
+        auto *literal = storage_.Create<PrimitiveLiteral>(constant);
+        ExpectSameAsEvaluator(make(storage_, Property(property), literal));
+        ExpectSameAsEvaluator(make(storage_, literal, Property(property)));
+      }
+    }
+  }
+}
+
+TEST_F(CompiledExpressionTest, Parameters) {
+  ctx_.parameters.Add(0, PropertyValue(7));
+  ctx_.parameters.Add(3, PropertyValue("bob"));
+  auto *age_filter = storage_.Create<GreaterOperator>(Property("age"), storage_.Create<ParameterLookup>(0));
+  auto *name_filter = storage_.Create<EqualOperator>(storage_.Create<ParameterLookup>(3), Property("name"));
+  auto *filter = storage_.Create<AndOperator>(age_filter, name_filter);
+  ExpectSameAsEvaluator(filter);
+
+  ctx_.properties = NamesToProperties(storage_.properties_, &dba_);
+  auto compiled = CompiledExpression::Compile(filter, symbol_table_);
+  ASSERT_TRUE(compiled);
+  const auto parameters = compiled->BindParameters(ctx_);
+  ASSERT_EQ(parameters.size(), 2);
+  EXPECT_EQ(parameters[0].ValueInt(), 7);
+  EXPECT_EQ(parameters[1].ValueString(), "bob");
+  EXPECT_TRUE(compiled->Evaluate(evaluator_, parameters).ValueBool());
+}
+
+TEST_F(CompiledExpressionTest, LogicalAndArithmeticOperators) {
+  auto *age = Property("age");
+  auto *one = storage_.Create<PrimitiveLiteral>(1);
+  auto *two = storage_.Create<PrimitiveLiteral>(2.0);
+  auto *null = storage_.Create<PrimitiveLiteral>(PropertyValue());
+  auto *text = storage_.Create<PrimitiveLiteral>("text");
+
+  ExpectSameAsEvaluator(storage_.Create<AdditionOperator>(age, one));
+  ExpectSameAsEvaluator(storage_.Create<DivisionOperator>(age, storage_.Create<PrimitiveLiteral>(0)));
+  ExpectSameAsEvaluator(storage_.Create<ModOperator>(storage_.Create<MultiplicationOperator>(age, two), one));
+  ExpectSameAsEvaluator(storage_.Create<SubtractionOperator>(text, age));
+  ExpectSameAsEvaluator(storage_.Create<UnaryMinusOperator>(age));
+  ExpectSameAsEvaluator(storage_.Create<UnaryPlusOperator>(Property("name")));
+  ExpectSameAsEvaluator(storage_.Create<NotOperator>(storage_.Create<IsNullOperator>(Property("missing"))));
+  ExpectSameAsEvaluator(storage_.Create<NotOperator>(age));
+  ExpectSameAsEvaluator(storage_.Create<AndOperator>(null, storage_.Create<EqualOperator>(age, one)));
+  ExpectSameAsEvaluator(storage_.Create<OrOperator>(storage_.Create<LessOperator>(age, one), null));
+  ExpectSameAsEvaluator(storage_.Create<OrOperator>(age, one));
+  ExpectSameAsEvaluator(storage_.Create<XorOperator>(storage_.Create<PrimitiveLiteral>(true), null));
+  ExpectSameAsEvaluator(storage_.Create<LessOperator>(storage_.Create<AdditionOperator>(one, two), age));
+  // Short-circuiting skips the second operand, even if it would fail.
+  ExpectSameAsEvaluator(storage_.Create<AndOperator>(storage_.Create<PrimitiveLiteral>(false),
+                                                     storage_.Create<UnaryMinusOperator>(text)));
+  ExpectSameAsEvaluator(storage_.Create<OrOperator>(storage_.Create<GreaterOperator>(age, one),
+                                                    storage_.Create<UnaryMinusOperator>(text)));
+  // Constant operands which fail are reported when evaluated.
+  ExpectSameAsEvaluator(storage_.Create<AndOperator>(storage_.Create<EqualOperator>(age, one),
+                                                     storage_.Create<UnaryMinusOperator>(text)));
+}
+
+TEST_F(CompiledExpressionTest, InterpretedParts) {
+  auto *list = storage_.Create<ListLiteral>(
+      std::vector<Expression *>{storage_.Create<PrimitiveLiteral>(10), storage_.Create<PrimitiveLiteral>(11)});
+  auto *in_list = storage_.Create<InListOperator>(Property("age"), list);
+  ASSERT_FALSE(CompiledExpression::Compile(in_list, symbol_table_));
+
+  ExpectSameAsEvaluator(storage_.Create<AndOperator>(
+      in_list, storage_.Create<EqualOperator>(Property("name"), storage_.Create<PrimitiveLiteral>("bob"))));
+  ExpectSameAsEvaluator(storage_.Create<NotOperator>(in_list));
+
+  auto *map = storage_.Create<MapLiteral>(std::unordered_map<PropertyIx, Expression *>{
+      {storage_.GetPropertyIx("age"), storage_.Create<PrimitiveLiteral>(3)}});
+  auto map_symbol = symbol_table_.CreateSymbol("m", true);
+  auto *map_identifier = storage_.Create<Identifier>("m")->MapTo(map_symbol);
+  frame_[map_symbol] = map->Accept(evaluator_);
+  auto *map_age = storage_.Create<PropertyLookup>(map_identifier, storage_.GetPropertyIx("age"));
+  ExpectSameAsEvaluator(storage_.Create<EqualOperator>(map_age, storage_.Create<PrimitiveLiteral>(3)));
+  ExpectSameAsEvaluator(storage_.Create<LessOperator>(map_age, storage_.Create<PrimitiveLiteral>("3")));
+}
+
+TEST_F(CompiledExpressionTest, CacheCompilesHotExpressions) {
+  auto *filter = storage_.Create<EqualOperator>(Property("age"), storage_.Create<PrimitiveLiteral>(10));
+  CompiledExpressionCache cache;
+  for (uint64_t i = 1; i < CompiledExpressionCache::kExecutionsBeforeCompile; ++i) {
+    ASSERT_FALSE(cache.Get(filter, symbol_table_));
+  }
+  auto compiled = cache.Get(filter, symbol_table_);
+  ASSERT_TRUE(compiled);
+  ASSERT_EQ(cache.Get(filter, symbol_table_), compiled);
+
+  auto copy = cache;
+  ASSERT_FALSE(copy.Get(filter, symbol_table_));
+}
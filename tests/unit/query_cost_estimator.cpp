@@ -10,6 +10,7 @@
 // licenses/APL.txt.
 
 #include <gtest/gtest.h>
+#include <map>
 #include <memory>
 
 #include "query/db_accessor.hpp"
@@ -18,6 +19,7 @@
 #include "query/plan/cost_estimator.hpp"
 #include "query/plan/operator.hpp"
 #include "query/plan/rewrite/index_lookup.hpp"
+#include "storage/v2/indices/label_property_index_stats.hpp"
 #include "storage/v2/inmemory/storage.hpp"
 #include "storage/v2/storage.hpp"
 
@@ -179,6 +181,73 @@ TEST_F(QueryCostEstimator, ScanAllByLabelPropertyRangeConstExpr) {
   }
 }
 
+TEST_F(QueryCostEstimator, ScanAllByLabelPropertyValueMostCommonValues) {
+  AddVertices(100, 30, 20);
+  // value 0 is on 900 vertices, values 1 to 100 on one vertex each
+  std::map<memgraph::storage::PropertyValue, int64_t> values{{memgraph::storage::PropertyValue(0), 900}};
+  for (int i = 1; i <= 100; ++i) values.emplace(memgraph::storage::PropertyValue(i), 1);
+  memgraph::storage::LabelPropertyIndexStats stats{
+      .count = 1000, .distinct_values_count = 101, .statistic = 0, .avg_group_size = 1000. / 101, .avg_degree = 0};
+  memgraph::storage::SetValueDistribution(stats, values);
+  dba->SetIndexStats(label, property, stats);
+
+  MakeOp<ScanAllByLabelPropertyValue>(nullptr, NextSymbol(), label, property, "property", Literal(0));
+  EXPECT_COST(900 * CostParam::MakeScanAllByLabelPropertyValue);
+  // equal doubles are the same value
+  MakeOp<ScanAllByLabelPropertyValue>(nullptr, NextSymbol(), label, property, "property", Parameter(0.0));
+  EXPECT_COST(900 * CostParam::MakeScanAllByLabelPropertyValue);
+  MakeOp<ScanAllByLabelPropertyValue>(nullptr, NextSymbol(), label, property, "property", Literal(42));
+  EXPECT_COST(1 * CostParam::MakeScanAllByLabelPropertyValue);
+  MakeOp<ScanAllByLabelPropertyValue>(nullptr, NextSymbol(), label, property, "property",
+                                      storage_.Create<UnaryPlusOperator>(Literal(0)));
+  EXPECT_COST(1000. / 101 * CostParam::MakeScanAllByLabelPropertyValue);
+}
+
+TEST_F(QueryCostEstimator, ScanAllByLabelPropertyRangeHistogram) {
+  AddVertices(100, 30, 20);
+  // values 0 to 999 are on one vertex each, strings aren't in the histogram
+  std::map<memgraph::storage::PropertyValue, int64_t> values{{memgraph::storage::PropertyValue("string"), 1}};
+  for (int i = 0; i < 1000; ++i) values.emplace(memgraph::storage::PropertyValue(i), 1);
+  memgraph::storage::LabelPropertyIndexStats stats{
+      .count = 1001, .distinct_values_count = 1001, .statistic = 0, .avg_group_size = 1, .avg_degree = 0};
+  memgraph::storage::SetValueDistribution(stats, values);
+  ASSERT_EQ(stats.histogram_count, 1000U);
+  ASSERT_EQ(stats.histogram_bounds.size(), memgraph::storage::kLabelPropertyIndexStatsHistogramBuckets + 1);
+  ASSERT_TRUE(stats.most_common_values.empty());
+  dba->SetIndexStats(label, property, stats);
+
+  MakeOp<ScanAllByLabelPropertyRange>(nullptr, NextSymbol(), label, property, "property", nullopt,
+                                      InclusiveBound(Literal(249)));
+  EXPECT_COST(250 * CostParam::MakeScanAllByLabelPropertyRange);
+  MakeOp<ScanAllByLabelPropertyRange>(nullptr, NextSymbol(), label, property, "property",
+                                      InclusiveBound(Parameter(499)), InclusiveBound(Literal(599.0)));
+  EXPECT_COST(100 * CostParam::MakeScanAllByLabelPropertyRange);
+}
+
+TEST_F(QueryCostEstimator, IndexStatsDistributionJson) {
+  std::map<memgraph::storage::PropertyValue, int64_t> values{{memgraph::storage::PropertyValue("common"), 10},
+                                                             {memgraph::storage::PropertyValue(-1.5), 1},
+                                                             {memgraph::storage::PropertyValue(3), 2}};
+  memgraph::storage::LabelPropertyIndexStats stats{
+      .count = 13, .distinct_values_count = 3, .statistic = 1, .avg_group_size = 13. / 3, .avg_degree = 2};
+  memgraph::storage::SetValueDistribution(stats, values);
+  ASSERT_EQ(stats.most_common_values.size(), 1U);
+
+  memgraph::storage::LabelPropertyIndexStats read{};
+  ASSERT_TRUE(FromJson(ToJson(stats), read));
+  EXPECT_EQ(read.count, stats.count);
+  EXPECT_EQ(read.histogram_count, 3U);
+  EXPECT_EQ(read.histogram_bounds, stats.histogram_bounds);
+  EXPECT_EQ(read.most_common_values, stats.most_common_values);
+
+  // statistics written before the value distribution was collected
+  ASSERT_TRUE(FromJson(R"({"count":1, "distinct_values_count":1, "statistic":0, "avg_group_size":1 "avg_degree":0})",
+                       read));
+  EXPECT_EQ(read.histogram_count, 0U);
+  EXPECT_TRUE(read.histogram_bounds.empty());
+  EXPECT_TRUE(read.most_common_values.empty());
+}
+
 TEST_F(QueryCostEstimator, Expand) {
   MakeOp<Expand>(last_op_, NextSymbol(), NextSymbol(), NextSymbol(), EdgeAtom::Direction::IN,
                  std::vector<memgraph::storage::EdgeTypeId>{}, false, memgraph::storage::View::OLD);
@@ -215,6 +284,22 @@ TEST_F(QueryCostEstimator, SubqueryCartesian) {
   EXPECT_COST(CostParam::kSubquery * no_vertices * no_vertices + no_vertices);
 }
 
+TEST_F(QueryCostEstimator, HashJoinAndIndexedJoin) {
+  AddVertices(100, 30, 20);
+  auto left_symbol = NextSymbol();
+  auto right_symbol = NextSymbol();
+  std::shared_ptr<LogicalOperator> left = std::make_shared<ScanAllByLabel>(std::make_shared<Once>(), left_symbol, label);
+  std::shared_ptr<LogicalOperator> right =
+      std::make_shared<ScanAllByLabel>(std::make_shared<Once>(), right_symbol, label);
+  // The right branch of a HashJoin is pulled and hashed once and every row of
+  // the left one probes the hash table.
+  MakeOp<HashJoin>(left, std::vector<Symbol>{left_symbol}, right, std::vector<Symbol>{right_symbol}, nullptr);
+  EXPECT_COST(2 * 30 * CostParam::kScanAllByLabel + 2 * 30 * CostParam::kHashJoin);
+  // The sub branch of an IndexedJoin is pulled for every row of the main one.
+  MakeOp<IndexedJoin>(left, right);
+  EXPECT_COST(30 * CostParam::kScanAllByLabel + 30 * 30 * CostParam::kScanAllByLabel);
+}
+
 TEST_F(QueryCostEstimator, UnitSubquery) {
   auto no_vertices = 4;
   AddVertices(no_vertices, 0, 0);
@@ -238,6 +238,22 @@ TYPED_TEST(ExpressionEvaluatorTest, DivisionOperator) {
   ASSERT_EQ(value.ValueInt(), 5);
 }
 
+TYPED_TEST(ExpressionEvaluatorTest, EvaluateBatchConstantOperandError) {
+  auto *x = this->CreateIdentifierWithValue("x", TypedValue(1));
+  auto *division_by_zero = this->storage.template Create<DivisionOperator>(
+      this->storage.template Create<PrimitiveLiteral>(1), this->storage.template Create<PrimitiveLiteral>(0));
+  auto *op = this->storage.template Create<LessOperator>(x, division_by_zero);
+  FrameBatch batch(this->frame.elems().size(), 4, memgraph::utils::NewDeleteResource());
+  memgraph::utils::pmr::vector<TypedValue> results(memgraph::utils::NewDeleteResource());
+  // The constant operand is evaluated only on the first row, so there is no
+  // error without rows.
+  EXPECT_NO_THROW(this->eval.EvaluateBatch(op, batch, &results));
+  EXPECT_TRUE(results.empty());
+  batch.PushBack(this->frame);
+  EXPECT_THROW(this->eval.EvaluateBatch(op, batch, &results), QueryRuntimeException);
+  EXPECT_EQ(this->eval.GetFrame(), &this->frame);
+}
+
 TYPED_TEST(ExpressionEvaluatorTest, ModOperator) {
   auto *op = this->storage.template Create<ModOperator>(this->storage.template Create<PrimitiveLiteral>(65),
                                                         this->storage.template Create<PrimitiveLiteral>(10));
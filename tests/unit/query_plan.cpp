@@ -749,8 +749,7 @@ TYPED_TEST(TestPlanner, ReturnDistinctOrderBySkipLimit) {
   // Test RETURN DISTINCT 1 ORDER BY 1 SKIP 1 LIMIT 1
   auto *query = QUERY(
       SINGLE_QUERY(RETURN_DISTINCT(LITERAL(1), AS("1"), ORDER_BY(LITERAL(1)), SKIP(LITERAL(1)), LIMIT(LITERAL(1)))));
-  CheckPlan<TypeParam>(query, this->storage, ExpectProduce(), ExpectDistinct(), ExpectOrderBy(), ExpectSkip(),
-                       ExpectLimit());
+  CheckPlan<TypeParam>(query, this->storage, ExpectProduce(), ExpectDistinct(), ExpectTopK());
 }
 
 TYPED_TEST(TestPlanner, CreateWithDistinctSumWhereReturn) {
@@ -864,6 +863,53 @@ TYPED_TEST(TestPlanner, MatchEdgeTypeIndex) {
   }
 }
 
+TYPED_TEST(TestPlanner, MatchEdgeTypePropertyIndex) {
+  FakeDbAccessor dba;
+  auto edge_type = dba.EdgeType("edgetype");
+  auto prop = dba.Property("prop");
+  auto other_prop = dba.Property("other_prop");
+  dba.SetIndexCount(edge_type, prop, 1);
+  {
+    // Test MATCH ()-[r:edgetype]->() WHERE r.prop = 42 RETURN r;
+    auto *lit_42 = LITERAL(42);
+    auto *query = QUERY(SINGLE_QUERY(
+        MATCH(PATTERN(NODE("anon1"), EDGE("r", memgraph::query::EdgeAtom::Direction::OUT, {"edgetype"}),
+                      NODE("anon2"))),
+        WHERE(EQ(PROPERTY_LOOKUP(dba, "r", prop), lit_42)), RETURN("r")));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    CheckPlan(planner.plan(), symbol_table, ExpectScanAllByEdgeTypePropertyValue(edge_type, prop, lit_42),
+              ExpectProduce());
+  }
+  {
+    // Test MATCH ()-[r:edgetype]->() WHERE r.prop > 42 AND r.other_prop = 1 RETURN r;
+    auto *query = QUERY(SINGLE_QUERY(
+        MATCH(PATTERN(NODE("anon1"), EDGE("r", memgraph::query::EdgeAtom::Direction::OUT, {"edgetype"}),
+                      NODE("anon2"))),
+        WHERE(AND(GREATER(PROPERTY_LOOKUP(dba, "r", prop), LITERAL(42)),
+                  EQ(PROPERTY_LOOKUP(dba, "r", other_prop), LITERAL(1)))),
+        RETURN("r")));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    CheckPlan(planner.plan(), symbol_table,
+              ExpectScanAllByEdgeTypePropertyRange(edge_type, prop, Bound(LITERAL(42), Bound::Type::EXCLUSIVE),
+                                                   std::nullopt),
+              ExpectFilter(), ExpectProduce());
+  }
+  {
+    // The source vertex is filtered on, so it can't be dropped from the plan.
+    // Test MATCH (:label)-[r:edgetype]->() WHERE r.prop = 42 RETURN r;
+    auto *query = QUERY(SINGLE_QUERY(
+        MATCH(PATTERN(NODE("anon1", "label"), EDGE("r", memgraph::query::EdgeAtom::Direction::OUT, {"edgetype"}),
+                      NODE("anon2"))),
+        WHERE(EQ(PROPERTY_LOOKUP(dba, "r", prop), LITERAL(42))), RETURN("r")));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectFilter(), ExpectExpand(), ExpectFilter(),
+              ExpectProduce());
+  }
+}
+
 TYPED_TEST(TestPlanner, MatchFilterPropIsNotNull) {
   FakeDbAccessor dba;
   auto label = dba.Label("label");
@@ -1240,6 +1286,48 @@ TYPED_TEST(TestPlanner, BestPropertyIndexed) {
             ExpectProduce());
 }
 
+TYPED_TEST(TestPlanner, CompositeIndexPrefix) {
+  // Test MATCH (n :label) WHERE n.a = 1 AND n.b = 2 RETURN n
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto a = PROPERTY_PAIR(dba, "a");
+  auto b = PROPERTY_PAIR(dba, "b");
+  auto c = PROPERTY_PAIR(dba, "c");
+  // The label+property index matches a single property, so the composite one
+  // with the longer matched prefix is better even with more vertices.
+  dba.SetIndexCount(label, a.second, 1);
+  dba.SetIndexCount(label, {a.second, b.second, c.second}, 10);
+  auto *query = QUERY(SINGLE_QUERY(
+      MATCH(PATTERN(NODE("n", "label"))),
+      WHERE(AND(EQ(PROPERTY_LOOKUP(dba, "n", a), LITERAL(1)), EQ(PROPERTY_LOOKUP(dba, "n", b), LITERAL(2)))),
+      RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  CheckPlan(planner.plan(), symbol_table,
+            ExpectScanAllByLabelProperties(label, {a.second, b.second, c.second}, 2, false), ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, CompositeIndexPrefixRange) {
+  // Test MATCH (n :label) WHERE n.a = 1 AND n.b > 2 AND n.c = 3 RETURN n
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto a = PROPERTY_PAIR(dba, "a");
+  auto b = PROPERTY_PAIR(dba, "b");
+  auto c = PROPERTY_PAIR(dba, "c");
+  dba.SetIndexCount(label, {a.second, b.second, c.second}, 10);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                   WHERE(AND(AND(EQ(PROPERTY_LOOKUP(dba, "n", a), LITERAL(1)),
+                                                 GREATER(PROPERTY_LOOKUP(dba, "n", b), LITERAL(2))),
+                                             EQ(PROPERTY_LOOKUP(dba, "n", c), LITERAL(3)))),
+                                   RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  // The filter on the property after the range isn't a part of the scan.
+  CheckPlan(planner.plan(), symbol_table,
+            ExpectScanAllByLabelProperties(label, {a.second, b.second, c.second}, 1, true), ExpectFilter(),
+            ExpectProduce());
+}
+
 TYPED_TEST(TestPlanner, MultiPropertyIndexScan) {
   // Test MATCH (n :label1), (m :label2) WHERE n.prop1 = 1 AND m.prop2 = 2
   //      RETURN n, m
@@ -1328,6 +1416,33 @@ TYPED_TEST(TestPlanner, WherePreferEqualityIndexOverRange) {
             ExpectProduce());
 }
 
+TYPED_TEST(TestPlanner, WhereEqualityUsesHashIndex) {
+  // Test MATCH (n :label) WHERE n.property = 42 RETURN n
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto property = PROPERTY_PAIR(dba, "property");
+  dba.SetHashIndexCount(label, property.second, 1);
+  auto lit_42 = LITERAL(42);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                   WHERE(EQ(PROPERTY_LOOKUP(dba, "n", property), lit_42)), RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabelPropertyValue(label, property, lit_42), ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, WhereRangeDoesntUseHashIndex) {
+  // Test MATCH (n :label) WHERE n.property > 42 RETURN n
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto property = PROPERTY_PAIR(dba, "property");
+  dba.SetHashIndexCount(label, property.second, 1);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                   WHERE(GREATER(PROPERTY_LOOKUP(dba, "n", property), LITERAL(42))), RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectFilter(), ExpectProduce());
+}
+
 TYPED_TEST(TestPlanner, UnableToUsePropertyIndex) {
   // Test MATCH (n: label) WHERE n.property = n.property RETURN n
   FakeDbAccessor dba;
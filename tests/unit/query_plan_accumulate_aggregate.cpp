@@ -10,20 +10,25 @@
 // licenses/APL.txt.
 
 #include <algorithm>
+#include <filesystem>
 #include <iterator>
 #include <memory>
 #include <vector>
 
 #include "disk_test_utils.hpp"
+#include "flags/general.hpp"
+#include "flags/query.hpp"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
 #include "query/context.hpp"
 #include "query/exceptions.hpp"
+#include "query/interpret/frame.hpp"
 #include "query/plan/operator.hpp"
 #include "query_plan_common.hpp"
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/inmemory/storage.hpp"
+#include "utils/on_scope_exit.hpp"
 
 using memgraph::replication_coordination_glue::ReplicationRole;
 
@@ -402,6 +407,274 @@ TYPED_TEST(QueryPlanTest, AggregateMultipleGroupBy) {
   EXPECT_EQ(results.size(), 2 * 3 * 5);
 }
 
+TYPED_TEST(QueryPlanTest, AggregateBatchedScanFilter) {
+  // MATCH (n) WHERE n.prop >= 1000 RETURN count(n.prop), sum(n.prop)
+  // The input spans multiple batches, so the last batch is partially filled.
+  auto storage_dba = this->db->Access(ReplicationRole::MAIN);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  auto prop = dba.NameToProperty("prop");
+  const int64_t vertex_count = 2 * FrameBatch::kDefaultCapacity + 100;
+  int64_t expected_sum = 0;
+  for (int64_t i = 0; i < vertex_count; ++i) {
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(prop, memgraph::storage::PropertyValue(i)).HasValue());
+    if (i >= 1000) expected_sum += i;
+  }
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto n_p = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), prop);
+  auto filter = std::make_shared<Filter>(n.op_, std::vector<std::shared_ptr<LogicalOperator>>{},
+                                         GREATER_EQ(n_p, LITERAL(1000)));
+
+  auto produce = this->MakeAggregationProduce(filter, symbol_table, {n_p, n_p},
+                                              {Aggregation::Op::COUNT, Aggregation::Op::SUM}, {}, {}, false);
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  auto results = CollectProduce(*produce, &context);
+  ASSERT_EQ(results.size(), 1);
+  ASSERT_EQ(results[0].size(), 2);
+  EXPECT_EQ(results[0][0].ValueInt(), vertex_count - 1000);
+  EXPECT_EQ(results[0][1].ValueInt(), expected_sum);
+
+  // The same pipeline pulled directly in batches.
+  FrameBatch batch(symbol_table.max_position(), FrameBatch::kDefaultCapacity, memgraph::utils::NewDeleteResource());
+  Frame frame(symbol_table.max_position());
+  batch.Reset(frame);
+  auto cursor = filter->MakeCursor(memgraph::utils::NewDeleteResource());
+  int64_t pulled = 0;
+  while (cursor->PullBatch(batch, context)) {
+    ASSERT_LE(batch.Size(), FrameBatch::kDefaultCapacity);
+    for (size_t row = 0; row < batch.Size(); ++row) {
+      EXPECT_GE(batch[row][n.sym_].ValueVertex().GetProperty(memgraph::storage::View::OLD, prop)->ValueInt(), 1000);
+    }
+    pulled += static_cast<int64_t>(batch.Size());
+  }
+  EXPECT_EQ(pulled, vertex_count - 1000);
+  EXPECT_FALSE(cursor->PullBatch(batch, context));
+}
+
+TYPED_TEST(QueryPlanTest, AggregateParallelScanFilter) {
+  // MATCH (n) WHERE n.prop >= 100
+  // RETURN count(*), sum(n.prop), min(n.prop), max(n.prop), avg(n.prop), n.group
+  // Chunks of vertices are aggregated by multiple threads and then merged.
+  FLAGS_query_parallel_execution_threads = 4;
+  memgraph::utils::OnScopeExit reset_threads([] { FLAGS_query_parallel_execution_threads = 1; });
+
+  auto storage_dba = this->db->Access(ReplicationRole::MAIN);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  auto prop = dba.NameToProperty("prop");
+  auto group = dba.NameToProperty("group");
+  const int64_t vertex_count = 10000;
+  const int64_t group_count = 3;
+  for (int64_t i = 0; i < vertex_count; ++i) {
+    auto vertex = dba.InsertVertex();
+    ASSERT_TRUE(vertex.SetProperty(prop, memgraph::storage::PropertyValue(i)).HasValue());
+    ASSERT_TRUE(vertex.SetProperty(group, memgraph::storage::PropertyValue(i % group_count)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto n_p = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), prop);
+  auto n_g = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), group);
+  auto filter = std::make_shared<Filter>(n.op_, std::vector<std::shared_ptr<LogicalOperator>>{},
+                                         GREATER_EQ(n_p, LITERAL(100)));
+  auto produce = this->MakeAggregationProduce(
+      filter, symbol_table, {nullptr, n_p, n_p, n_p, n_p},
+      {Aggregation::Op::COUNT, Aggregation::Op::SUM, Aggregation::Op::MIN, Aggregation::Op::MAX, Aggregation::Op::AVG},
+      {n_g}, {}, false);
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  auto results = CollectProduce(*produce, &context);
+  ASSERT_EQ(results.size(), group_count);
+
+  for (const auto &row : results) {
+    ASSERT_EQ(row.size(), 6);
+    const auto g = row[5].ValueInt();
+    int64_t count = 0;
+    int64_t sum = 0;
+    int64_t min = vertex_count;
+    int64_t max = 0;
+    for (int64_t i = 100; i < vertex_count; ++i) {
+      if (i % group_count != g) continue;
+      ++count;
+      sum += i;
+      min = std::min(min, i);
+      max = std::max(max, i);
+    }
+    EXPECT_EQ(row[0].ValueInt(), count);
+    EXPECT_EQ(row[1].ValueInt(), sum);
+    EXPECT_EQ(row[2].ValueInt(), min);
+    EXPECT_EQ(row[3].ValueInt(), max);
+    EXPECT_DOUBLE_EQ(row[4].ValueDouble(), static_cast<double>(sum) / static_cast<double>(count));
+  }
+}
+
+TYPED_TEST(QueryPlanTest, AggregateParallelScanByLabel) {
+  // MATCH (n:Label) RETURN count(*), sum(n.prop)
+  // Chunks of the label index are aggregated by multiple threads. Every vertex
+  // has two index entries, which must not end up in different chunks.
+  FLAGS_query_parallel_execution_threads = 4;
+  memgraph::utils::OnScopeExit reset_threads([] { FLAGS_query_parallel_execution_threads = 1; });
+
+  auto label = this->db->NameToLabel("Label");
+  {
+    auto unique_acc = this->db->UniqueAccess(ReplicationRole::MAIN);
+    ASSERT_FALSE(unique_acc->CreateIndex(label).HasError());
+    ASSERT_FALSE(unique_acc->Commit().HasError());
+  }
+  auto prop = this->db->NameToProperty("prop");
+  const int64_t vertex_count = 10000;
+  {
+    auto storage_dba = this->db->Access(ReplicationRole::MAIN);
+    memgraph::query::DbAccessor dba(storage_dba.get());
+    for (int64_t i = 0; i < vertex_count; ++i) {
+      auto vertex = dba.InsertVertex();
+      ASSERT_TRUE(vertex.SetProperty(prop, memgraph::storage::PropertyValue(i)).HasValue());
+      if (i % 2 == 0) ASSERT_TRUE(vertex.AddLabel(label).HasValue());
+    }
+    ASSERT_FALSE(dba.Commit().HasError());
+  }
+
+  auto storage_dba = this->db->Access(ReplicationRole::MAIN);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  // Labeling again in a later transaction adds another index entry.
+  for (auto vertex : dba.Vertices(memgraph::storage::View::OLD)) {
+    if (!*vertex.HasLabel(memgraph::storage::View::OLD, label)) continue;
+    ASSERT_TRUE(vertex.RemoveLabel(label).HasValue());
+    ASSERT_TRUE(vertex.AddLabel(label).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+  auto n = MakeScanAllByLabel(this->storage, symbol_table, "n", label);
+  auto n_p = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), prop);
+  auto produce = this->MakeAggregationProduce(n.op_, symbol_table, {nullptr, n_p},
+                                              {Aggregation::Op::COUNT, Aggregation::Op::SUM}, {}, {}, false);
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  auto results = CollectProduce(*produce, &context);
+  ASSERT_EQ(results.size(), 1);
+  ASSERT_EQ(results[0].size(), 2);
+  EXPECT_EQ(results[0][0].ValueInt(), vertex_count / 2);
+  EXPECT_EQ(results[0][1].ValueInt(), (vertex_count / 2) * (vertex_count / 2 - 1));
+}
+
+TYPED_TEST(QueryPlanTest, AggregateSpillToDisk) {
+  // MATCH (n) RETURN count(*), sum(n.prop), min(n.prop), avg(n.prop), collect(n.prop), n.group
+  // The groups don't fit under the spill threshold, so they are spilled to
+  // disk and merged once all the input is aggregated.
+  if (std::is_same<TypeParam, memgraph::storage::DiskStorage>::value) GTEST_SKIP();
+  const auto data_directory = std::filesystem::temp_directory_path() / "MG_test_unit_query_plan_spill";
+  const auto old_data_directory = FLAGS_data_directory;
+  FLAGS_data_directory = data_directory;
+  FLAGS_query_spill_threshold_mb = 1;
+  memgraph::utils::OnScopeExit reset_flags([&] {
+    FLAGS_data_directory = old_data_directory;
+    FLAGS_query_spill_threshold_mb = 0;
+    std::filesystem::remove_all(data_directory);
+  });
+
+  auto storage_dba = this->db->Access(ReplicationRole::MAIN);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  auto prop = dba.NameToProperty("prop");
+  auto group = dba.NameToProperty("group");
+  // Every group gets a row in each half of the input, so groups which were
+  // spilled get more rows afterwards.
+  const int64_t group_count = 20000;
+  for (int64_t i = 0; i < 2 * group_count; ++i) {
+    auto vertex = dba.InsertVertex();
+    ASSERT_TRUE(vertex.SetProperty(prop, memgraph::storage::PropertyValue(i)).HasValue());
+    ASSERT_TRUE(vertex.SetProperty(group, memgraph::storage::PropertyValue(i % group_count)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto n_p = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), prop);
+  auto n_g = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), group);
+  auto produce = this->MakeAggregationProduce(n.op_, symbol_table, {nullptr, n_p, n_p, n_p, n_p},
+                                              {Aggregation::Op::COUNT, Aggregation::Op::SUM, Aggregation::Op::MIN,
+                                               Aggregation::Op::AVG, Aggregation::Op::COLLECT_LIST},
+                                              {n_g}, {n.sym_}, false);
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  auto results = CollectProduce(*produce, &context);
+  EXPECT_TRUE(std::filesystem::exists(data_directory / "query_spill"));
+  ASSERT_EQ(results.size(), group_count);
+
+  std::vector<bool> seen(group_count, false);
+  for (const auto &row : results) {
+    ASSERT_EQ(row.size(), 6);
+    const auto g = row[5].ValueInt();
+    ASSERT_FALSE(seen[g]);
+    seen[g] = true;
+    EXPECT_EQ(row[0].ValueInt(), 2);
+    EXPECT_EQ(row[1].ValueInt(), 2 * g + group_count);
+    EXPECT_EQ(row[2].ValueInt(), g);
+    EXPECT_DOUBLE_EQ(row[3].ValueDouble(), static_cast<double>(g) + group_count / 2.0);
+    EXPECT_THAT(ToIntList(row[4]), testing::ElementsAre(g, g + group_count));
+  }
+  // Nothing is left behind in the spill directory.
+  EXPECT_TRUE(std::filesystem::is_empty(data_directory / "query_spill"));
+}
+
+TYPED_TEST(QueryPlanTest, AggregateParallelSpillToDisk) {
+  // MATCH (n) RETURN count(*), sum(n.prop), min(n.prop), max(n.prop), n.group
+  // The partial aggregations of the threads count towards the spill threshold,
+  // so they are merged and spilled before all the chunks are aggregated.
+  if (std::is_same<TypeParam, memgraph::storage::DiskStorage>::value) GTEST_SKIP();
+  const auto data_directory = std::filesystem::temp_directory_path() / "MG_test_unit_query_plan_parallel_spill";
+  const auto old_data_directory = FLAGS_data_directory;
+  FLAGS_data_directory = data_directory;
+  FLAGS_query_spill_threshold_mb = 1;
+  FLAGS_query_parallel_execution_threads = 4;
+  memgraph::utils::OnScopeExit reset_flags([&] {
+    FLAGS_data_directory = old_data_directory;
+    FLAGS_query_spill_threshold_mb = 0;
+    FLAGS_query_parallel_execution_threads = 1;
+    std::filesystem::remove_all(data_directory);
+  });
+
+  auto storage_dba = this->db->Access(ReplicationRole::MAIN);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  auto prop = dba.NameToProperty("prop");
+  auto group = dba.NameToProperty("group");
+  const int64_t group_count = 20000;
+  for (int64_t i = 0; i < 2 * group_count; ++i) {
+    auto vertex = dba.InsertVertex();
+    ASSERT_TRUE(vertex.SetProperty(prop, memgraph::storage::PropertyValue(i)).HasValue());
+    ASSERT_TRUE(vertex.SetProperty(group, memgraph::storage::PropertyValue(i % group_count)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto n_p = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), prop);
+  auto n_g = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), group);
+  auto produce = this->MakeAggregationProduce(
+      n.op_, symbol_table, {nullptr, n_p, n_p, n_p},
+      {Aggregation::Op::COUNT, Aggregation::Op::SUM, Aggregation::Op::MIN, Aggregation::Op::MAX}, {n_g}, {}, false);
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  auto results = CollectProduce(*produce, &context);
+  EXPECT_TRUE(std::filesystem::exists(data_directory / "query_spill"));
+  ASSERT_EQ(results.size(), group_count);
+
+  std::vector<bool> seen(group_count, false);
+  for (const auto &row : results) {
+    ASSERT_EQ(row.size(), 5);
+    const auto g = row[4].ValueInt();
+    ASSERT_FALSE(seen[g]);
+    seen[g] = true;
+    EXPECT_EQ(row[0].ValueInt(), 2);
+    EXPECT_EQ(row[1].ValueInt(), 2 * g + group_count);
+    EXPECT_EQ(row[2].ValueInt(), g);
+    EXPECT_EQ(row[3].ValueInt(), g + group_count);
+  }
+  EXPECT_TRUE(std::filesystem::is_empty(data_directory / "query_spill"));
+}
+
 TYPED_TEST(QueryPlanTest, AggregateNoInput) {
   auto storage_dba = this->db->Access(ReplicationRole::MAIN);
   memgraph::query::DbAccessor dba(storage_dba.get());
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <numeric>
 #include <vector>
 
 #include "disk_test_utils.hpp"
@@ -308,3 +309,53 @@ TYPED_TEST(QueryPlanTest, OrderByExceptions) {
     EXPECT_THROW(PullAll(*order_by, &context), QueryRuntimeException);
   }
 }
+
+TYPED_TEST(QueryPlanTest, TopK) {
+  auto storage_dba = this->db->Access(ReplicationRole::MAIN);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  SymbolTable symbol_table;
+  auto prop = dba.NameToProperty("prop");
+  auto id = dba.NameToProperty("id");
+
+  // values repeat, so ties have to be ordered like they arrive
+  const int N = 100;
+  for (int i = 0; i < N; ++i) {
+    auto v = dba.InsertVertex();
+    ASSERT_TRUE(v.SetProperty(prop, memgraph::storage::PropertyValue((i * 37) % 10)).HasValue());
+    ASSERT_TRUE(v.SetProperty(id, memgraph::storage::PropertyValue(i)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  auto collect = [&](Expression *skip, Expression *limit) {
+    auto n = MakeScanAll(this->storage, symbol_table, "n");
+    auto n_p = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), prop);
+    auto top_k = std::make_shared<plan::TopK>(n.op_, std::vector<SortItem>{{Ordering::DESC, n_p}},
+                                              std::vector<Symbol>{n.sym_}, skip, limit);
+    auto n_id = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), id);
+    auto produce = MakeProduce(top_k, NEXPR("n.id", n_id)->MapTo(symbol_table.CreateSymbol("n.id", true)));
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    std::vector<int64_t> ids;
+    for (const auto &row : CollectProduce(*produce, &context)) ids.push_back(row[0].ValueInt());
+    return ids;
+  };
+
+  // ids sorted by descending values, equal values keep the ascending ids
+  std::vector<int64_t> sorted(N);
+  std::iota(sorted.begin(), sorted.end(), 0);
+  std::stable_sort(sorted.begin(), sorted.end(), [](auto lhs, auto rhs) { return (lhs * 37) % 10 > (rhs * 37) % 10; });
+
+  for (int skip : {0, 3, 50, 99, 100, 150}) {
+    for (int limit : {0, 1, 7, 10, 100, 200}) {
+      auto begin = std::min<size_t>(skip, N);
+      auto end = std::min<size_t>(skip + limit, N);
+      std::vector<int64_t> expected(sorted.begin() + begin, sorted.begin() + end);
+      EXPECT_EQ(collect(LITERAL(skip), LITERAL(limit)), expected) << "skip " << skip << " limit " << limit;
+    }
+  }
+  EXPECT_EQ(collect(nullptr, LITERAL(3)), std::vector<int64_t>(sorted.begin(), sorted.begin() + 3));
+
+  EXPECT_THROW(collect(nullptr, LITERAL(-1)), QueryRuntimeException);
+  EXPECT_THROW(collect(nullptr, LITERAL("bla")), QueryRuntimeException);
+  EXPECT_THROW(collect(LITERAL(-1), LITERAL(1)), QueryRuntimeException);
+  EXPECT_THROW(collect(LITERAL(1.5), LITERAL(1)), QueryRuntimeException);
+}
@@ -65,7 +65,10 @@ class PlanChecker : public virtual HierarchicalLogicalOperatorVisitor {
   PRE_VISIT(ScanAllByLabelPropertyValue);
   PRE_VISIT(ScanAllByLabelPropertyRange);
   PRE_VISIT(ScanAllByLabelProperty);
+  PRE_VISIT(ScanAllByLabelProperties);
   PRE_VISIT(ScanAllByEdgeType);
+  PRE_VISIT(ScanAllByEdgeTypePropertyValue);
+  PRE_VISIT(ScanAllByEdgeTypePropertyRange);
   PRE_VISIT(ScanAllById);
   PRE_VISIT(Expand);
   PRE_VISIT(ExpandVariable);
@@ -83,6 +86,7 @@ class PlanChecker : public virtual HierarchicalLogicalOperatorVisitor {
   PRE_VISIT(Skip);
   PRE_VISIT(Limit);
   PRE_VISIT(OrderBy);
+  PRE_VISIT(TopK);
   PRE_VISIT(EvaluatePatternFilter);
   bool PreVisit(Merge &op) override {
     CheckOp(op);
@@ -186,6 +190,7 @@ using ExpectEdgeUniquenessFilter = OpChecker<EdgeUniquenessFilter>;
 using ExpectSkip = OpChecker<Skip>;
 using ExpectLimit = OpChecker<Limit>;
 using ExpectOrderBy = OpChecker<OrderBy>;
+using ExpectTopK = OpChecker<TopK>;
 using ExpectUnwind = OpChecker<Unwind>;
 using ExpectDistinct = OpChecker<Distinct>;
 using ExpectEvaluatePatternFilter = OpChecker<EvaluatePatternFilter>;
@@ -425,6 +430,52 @@ class ExpectScanAllByLabelPropertyRange : public OpChecker<ScanAllByLabelPropert
   std::optional<ScanAllByLabelPropertyRange::Bound> upper_bound_;
 };
 
+class ExpectScanAllByEdgeTypePropertyValue : public OpChecker<ScanAllByEdgeTypePropertyValue> {
+ public:
+  ExpectScanAllByEdgeTypePropertyValue(memgraph::storage::EdgeTypeId edge_type, memgraph::storage::PropertyId property,
+                                       memgraph::query::Expression *expression)
+      : edge_type_(edge_type), property_(property), expression_(expression) {}
+
+  void ExpectOp(ScanAllByEdgeTypePropertyValue &scan_all, const SymbolTable &) override {
+    EXPECT_EQ(scan_all.edge_type_, edge_type_);
+    EXPECT_EQ(scan_all.property_, property_);
+    // TODO: Proper expression equality
+    EXPECT_EQ(typeid(scan_all.expression_).hash_code(), typeid(expression_).hash_code());
+  }
+
+ private:
+  memgraph::storage::EdgeTypeId edge_type_;
+  memgraph::storage::PropertyId property_;
+  memgraph::query::Expression *expression_;
+};
+
+class ExpectScanAllByEdgeTypePropertyRange : public OpChecker<ScanAllByEdgeTypePropertyRange> {
+ public:
+  ExpectScanAllByEdgeTypePropertyRange(memgraph::storage::EdgeTypeId edge_type, memgraph::storage::PropertyId property,
+                                       std::optional<ScanAllByEdgeTypePropertyRange::Bound> lower_bound,
+                                       std::optional<ScanAllByEdgeTypePropertyRange::Bound> upper_bound)
+      : edge_type_(edge_type), property_(property), lower_bound_(lower_bound), upper_bound_(upper_bound) {}
+
+  void ExpectOp(ScanAllByEdgeTypePropertyRange &scan_all, const SymbolTable &) override {
+    EXPECT_EQ(scan_all.edge_type_, edge_type_);
+    EXPECT_EQ(scan_all.property_, property_);
+    if (lower_bound_) {
+      ASSERT_TRUE(scan_all.lower_bound_);
+      EXPECT_EQ(scan_all.lower_bound_->type(), lower_bound_->type());
+    }
+    if (upper_bound_) {
+      ASSERT_TRUE(scan_all.upper_bound_);
+      EXPECT_EQ(scan_all.upper_bound_->type(), upper_bound_->type());
+    }
+  }
+
+ private:
+  memgraph::storage::EdgeTypeId edge_type_;
+  memgraph::storage::PropertyId property_;
+  std::optional<ScanAllByEdgeTypePropertyRange::Bound> lower_bound_;
+  std::optional<ScanAllByEdgeTypePropertyRange::Bound> upper_bound_;
+};
+
 class ExpectScanAllByLabelProperty : public OpChecker<ScanAllByLabelProperty> {
  public:
   ExpectScanAllByLabelProperty(memgraph::storage::LabelId label,
@@ -441,6 +492,27 @@ class ExpectScanAllByLabelProperty : public OpChecker<ScanAllByLabelProperty> {
   memgraph::storage::PropertyId property_;
 };
 
+class ExpectScanAllByLabelProperties : public OpChecker<ScanAllByLabelProperties> {
+ public:
+  ExpectScanAllByLabelProperties(memgraph::storage::LabelId label,
+                                 std::vector<memgraph::storage::PropertyId> properties, size_t prefix_size,
+                                 bool has_range)
+      : label_(label), properties_(std::move(properties)), prefix_size_(prefix_size), has_range_(has_range) {}
+
+  void ExpectOp(ScanAllByLabelProperties &scan_all, const SymbolTable &) override {
+    EXPECT_EQ(scan_all.label_, label_);
+    EXPECT_EQ(scan_all.properties_, properties_);
+    EXPECT_EQ(scan_all.prefix_expressions_.size(), prefix_size_);
+    EXPECT_EQ(scan_all.lower_bound_ || scan_all.upper_bound_, has_range_);
+  }
+
+ private:
+  memgraph::storage::LabelId label_;
+  std::vector<memgraph::storage::PropertyId> properties_;
+  size_t prefix_size_;
+  bool has_range_;
+};
+
 class ExpectCartesian : public OpChecker<Cartesian> {
  public:
   ExpectCartesian(const std::list<BaseOpChecker *> &left, const std::list<BaseOpChecker *> &right)
@@ -559,6 +631,18 @@ class FakeDbAccessor {
         return std::get<2>(index);
       }
     }
+    auto found = label_property_hash_index_.find({label, property});
+    if (found != label_property_hash_index_.end()) return found->second;
+    return 0;
+  }
+
+  int64_t VerticesCount(memgraph::storage::LabelId label, const std::vector<memgraph::storage::PropertyId> &properties,
+                        const std::vector<memgraph::storage::PropertyValue> & /*prefix*/) const {
+    for (const auto &index : label_properties_index_) {
+      if (std::get<0>(index) == label && std::get<1>(index) == properties) {
+        return std::get<2>(index);
+      }
+    }
     return 0;
   }
 
@@ -581,10 +665,28 @@ class FakeDbAccessor {
     return false;
   }
 
+  bool LabelPropertyHashIndexExists(memgraph::storage::LabelId label, memgraph::storage::PropertyId property) const {
+    return label_property_hash_index_.contains({label, property});
+  }
+
+  std::vector<std::vector<memgraph::storage::PropertyId>> LabelPropertyCompositeIndices(
+      memgraph::storage::LabelId label) const {
+    std::vector<std::vector<memgraph::storage::PropertyId>> indices;
+    for (const auto &index : label_properties_index_) {
+      if (std::get<0>(index) == label) indices.push_back(std::get<1>(index));
+    }
+    return indices;
+  }
+
   bool EdgeTypeIndexExists(memgraph::storage::EdgeTypeId edge_type) const {
     return edge_type_index_.find(edge_type) != edge_type_index_.end();
   }
 
+  bool EdgeTypePropertyIndexExists(memgraph::storage::EdgeTypeId edge_type,
+                                   memgraph::storage::PropertyId property) const {
+    return edge_type_property_index_.contains({edge_type, property});
+  }
+
   std::optional<memgraph::storage::LabelPropertyIndexStats> GetIndexStats(
       const memgraph::storage::LabelId label, const memgraph::storage::PropertyId property) const {
     return memgraph::storage::LabelPropertyIndexStats{.statistic = 0, .avg_group_size = 1};  // unique id
@@ -606,8 +708,27 @@ class FakeDbAccessor {
     label_property_index_.emplace_back(label, property, count);
   }
 
+  void SetIndexCount(memgraph::storage::LabelId label, std::vector<memgraph::storage::PropertyId> properties,
+                     int64_t count) {
+    for (auto &index : label_properties_index_) {
+      if (std::get<0>(index) == label && std::get<1>(index) == properties) {
+        std::get<2>(index) = count;
+        return;
+      }
+    }
+    label_properties_index_.emplace_back(label, std::move(properties), count);
+  }
+
   void SetIndexCount(memgraph::storage::EdgeTypeId edge_type, int64_t count) { edge_type_index_[edge_type] = count; }
 
+  void SetIndexCount(memgraph::storage::EdgeTypeId edge_type, memgraph::storage::PropertyId property, int64_t count) {
+    edge_type_property_index_[{edge_type, property}] = count;
+  }
+
+  void SetHashIndexCount(memgraph::storage::LabelId label, memgraph::storage::PropertyId property, int64_t count) {
+    label_property_hash_index_[{label, property}] = count;
+  }
+
   memgraph::storage::LabelId NameToLabel(const std::string &name) {
     auto found = labels_.find(name);
     if (found != labels_.end()) return found->second;
@@ -648,7 +769,11 @@ class FakeDbAccessor {
 
   std::unordered_map<memgraph::storage::LabelId, int64_t> label_index_;
   std::vector<std::tuple<memgraph::storage::LabelId, memgraph::storage::PropertyId, int64_t>> label_property_index_;
+  std::vector<std::tuple<memgraph::storage::LabelId, std::vector<memgraph::storage::PropertyId>, int64_t>>
+      label_properties_index_;
+  std::map<std::pair<memgraph::storage::LabelId, memgraph::storage::PropertyId>, int64_t> label_property_hash_index_;
   std::unordered_map<memgraph::storage::EdgeTypeId, int64_t> edge_type_index_;
+  std::map<std::pair<memgraph::storage::EdgeTypeId, memgraph::storage::PropertyId>, int64_t> edge_type_property_index_;
 };
 
 }  // namespace memgraph::query::plan
@@ -2051,6 +2051,49 @@ TYPED_TEST(QueryPlanExpandWeightedShortestPath, ExistingNode) {
   }
 }
 
+TYPED_TEST(QueryPlanExpandWeightedShortestPath, ExistingNodeWithoutUpperBound) {
+  // Both endpoints are bound and the depth isn't limited, so the path is searched for from both ends.
+  auto n0 = MakeScanAll(this->storage, this->symbol_table, "n0");
+  n0.op_ = std::make_shared<Filter>(n0.op_, std::vector<std::shared_ptr<LogicalOperator>>{},
+                                    EQ(PROPERTY_LOOKUP(this->dba, n0.node_->identifier_, this->prop), LITERAL(3)));
+  auto results = this->ExpandWShortest(EdgeAtom::Direction::OUT, std::nullopt, LITERAL(true), std::nullopt, &n0);
+  std::sort(results.begin(), results.end(),
+            [](const auto &lhs, const auto &rhs) { return lhs.total_weight < rhs.total_weight; });
+
+  ASSERT_EQ(results.size(), 4);
+  for (const auto &result : results) EXPECT_EQ(this->GetProp(result.vertex), 3);
+
+  EXPECT_EQ(results[0].total_weight, 3);
+  EXPECT_THAT(results[0].path, testing::ElementsAre(this->e.at({2, 3})));
+  EXPECT_EQ(results[1].total_weight, 6);
+  EXPECT_THAT(results[1].path, testing::ElementsAre(this->e.at({0, 2}), this->e.at({2, 3})));
+  EXPECT_EQ(results[2].total_weight, 18);
+  EXPECT_THAT(results[2].path, testing::ElementsAre(this->e.at({4, 0}), this->e.at({0, 2}), this->e.at({2, 3})));
+  EXPECT_EQ(results[3].total_weight, 23);
+  EXPECT_THAT(results[3].path,
+              testing::ElementsAre(this->e.at({1, 4}), this->e.at({4, 0}), this->e.at({0, 2}), this->e.at({2, 3})));
+}
+
+TYPED_TEST(QueryPlanExpandWeightedShortestPath, ExistingNodeInvalidWeightOnlyReachedFromSink) {
+  // The single-source search from 0 settles 3 without walking 5->3, only the search from the sink walks it.
+  auto v5 = this->dba.InsertVertex();
+  ASSERT_TRUE(v5.SetProperty(this->prop.second, memgraph::storage::PropertyValue(5)).HasValue());
+  auto edge = this->dba.InsertEdge(&v5, &this->v[3], this->edge_type);
+  ASSERT_TRUE(edge.HasValue());
+  ASSERT_TRUE(edge->SetProperty(this->prop.second, memgraph::storage::PropertyValue(-1.0)).HasValue());
+  this->dba.AdvanceCommand();
+
+  auto n0 = MakeScanAll(this->storage, this->symbol_table, "n0");
+  n0.op_ = std::make_shared<Filter>(n0.op_, std::vector<std::shared_ptr<LogicalOperator>>{},
+                                    EQ(PROPERTY_LOOKUP(this->dba, n0.node_->identifier_, this->prop), LITERAL(3)));
+  auto results = this->ExpandWShortest(EdgeAtom::Direction::OUT, std::nullopt, LITERAL(true), 0, &n0);
+
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_EQ(this->GetProp(results[0].vertex), 3);
+  EXPECT_EQ(results[0].total_weight, 6);
+  EXPECT_THAT(results[0].path, testing::ElementsAre(this->e.at({0, 2}), this->e.at({2, 3})));
+}
+
 TYPED_TEST(QueryPlanExpandWeightedShortestPath, UpperBound) {
   {
     auto results = this->ExpandWShortest(EdgeAtom::Direction::BOTH, std::nullopt, LITERAL(true));
@@ -2618,6 +2661,26 @@ TYPED_TEST(QueryPlanExpandAllShortestPaths, MultiEdge) {
   EXPECT_EQ(results[5].total_weight, 9);
 }
 
+// Uses graph from Basic test, with an additional edge 1->-3 making two shortest paths from 0 to 4
+TYPED_TEST(QueryPlanExpandAllShortestPaths, ExistingNodeWithoutUpperBound) {
+  auto edge = this->dba.InsertEdge(&this->v[1], &this->v[3], this->edge_type);
+  ASSERT_TRUE(edge.HasValue());
+  ASSERT_TRUE(edge->SetProperty(this->prop.second, memgraph::storage::PropertyValue(1)).HasValue());
+  this->dba.AdvanceCommand();
+
+  auto n0 = MakeScanAll(this->storage, this->symbol_table, "n0");
+  n0.op_ = std::make_shared<Filter>(n0.op_, std::vector<std::shared_ptr<LogicalOperator>>{},
+                                    EQ(PROPERTY_LOOKUP(this->dba, n0.node_->identifier_, this->prop), LITERAL(4)));
+  auto results = this->ExpandAllShortest(EdgeAtom::Direction::OUT, std::nullopt, LITERAL(true), 0, &n0);
+
+  ASSERT_EQ(results.size(), 2);
+  for (const auto &result : results) {
+    EXPECT_EQ(this->GetProp(result.vertex), 4);
+    EXPECT_EQ(result.total_weight, 9);
+    EXPECT_EQ(result.path.size(), 3);
+  }
+}
+
 #ifdef MG_ENTERPRISE
 TYPED_TEST(QueryPlanExpandAllShortestPaths, BasicWithFineGrainedFiltering) {
   // All edge_types and labels allowed
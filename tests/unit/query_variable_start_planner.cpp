@@ -10,6 +10,7 @@
 // licenses/APL.txt.
 
 #include <algorithm>
+#include <map>
 #include <variant>
 
 #include "disk_test_utils.hpp"
@@ -159,6 +160,203 @@ TYPED_TEST(TestVariableStartPlanner, MatchTripletPatternReturn) {
   }
 }
 
+TYPED_TEST(TestVariableStartPlanner, MatchDisconnectedPatternsReturn) {
+  auto storage_dba = this->db->Access(ReplicationRole::MAIN);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  // Make a graph (v1) -[:r]-> (v2), (v3 :label)
+  auto v1 = dba.InsertVertex();
+  auto v2 = dba.InsertVertex();
+  auto v3 = dba.InsertVertex();
+  ASSERT_TRUE(dba.InsertEdge(&v1, &v2, dba.NameToEdgeType("r")).HasValue());
+  ASSERT_TRUE(v3.AddLabel(dba.NameToLabel("label")).HasValue());
+  dba.AdvanceCommand();
+  // Test MATCH (n) -[r]-> (m), (l :label), (k :label) RETURN n, l, k
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("r", Direction::OUT), NODE("m")),
+                                         PATTERN(NODE("l", "label")), PATTERN(NODE("k", "label"))),
+                                   RETURN("n", "l", "k")));
+  // Each of the 4 nodes can be the starting one, the other parts are joined
+  // in the order of their estimated cardinality.
+  CheckPlansProduce(4, query, this->storage, &dba, [&](const auto &results) {
+    AssertRows(results, {{TypedValue(v1), TypedValue(v3), TypedValue(v3)}}, dba);
+  });
+}
+
+class TestVariableStartPlannerOrder : public testing::Test {
+ public:
+  AstStorage storage;
+};
+
+TEST_F(TestVariableStartPlannerOrder, DisconnectedPartsOrderedByCardinality) {
+  // MATCH (n) -[r]-> (m), (l), (k)
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("r", Direction::OUT), NODE("m")),
+                                         PATTERN(NODE("l")), PATTERN(NODE("k"))),
+                                   RETURN("n", "l", "k")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto query_parts = CollectQueryParts(symbol_table, storage, query);
+  const auto &matching = query_parts.query_parts.at(0).single_query_parts.at(0).matching;
+  const std::unordered_map<std::string, double> cardinalities{{"k", 1}, {"l", 10}};
+  auto estimate = [&](const memgraph::query::Symbol &symbol, const Filters &) {
+    auto found = cardinalities.find(symbol.name());
+    return found == cardinalities.end() ? 100.0 : found->second;
+  };
+  auto start_names = [](const auto &expansions) {
+    std::vector<std::string> names;
+    for (const auto &expansion : expansions) names.push_back(expansion.node1->identifier_->name_);
+    return names;
+  };
+  size_t variants = 0;
+  for (const auto &varied : impl::VaryMatchingStart(matching, symbol_table, estimate)) {
+    ++variants;
+    const auto names = start_names(varied.expansions);
+    ASSERT_EQ(names.size(), 3);
+    // Whichever part is scanned first, the rest follow from the smallest.
+    std::vector<std::string> rest{"k", "l", "n"};
+    rest.erase(std::remove(rest.begin(), rest.end(), names.front() == "m" ? "n" : names.front()), rest.end());
+    EXPECT_EQ(std::vector<std::string>(names.begin() + 1, names.end()), rest);
+  }
+  EXPECT_EQ(variants, 4);
+  // Without an estimator the parts keep the order of the pattern.
+  for (const auto &varied : impl::VaryMatchingStart(matching, symbol_table)) {
+    const auto names = start_names(varied.expansions);
+    if (names.front() == "k") EXPECT_EQ(names, (std::vector<std::string>{"k", "n", "l"}));
+  }
+}
+
+TEST_F(TestVariableStartPlannerOrder, EstimateFromValueDistribution) {
+  memgraph::storage::InMemoryStorage db;
+  const auto label = db.NameToLabel("label");
+  const auto property = db.NameToProperty("property");
+  {
+    auto unique_acc = db.UniqueAccess(ReplicationRole::MAIN);
+    ASSERT_FALSE(unique_acc->CreateIndex(label).HasError());
+    ASSERT_FALSE(unique_acc->Commit().HasError());
+  }
+  {
+    auto unique_acc = db.UniqueAccess(ReplicationRole::MAIN);
+    ASSERT_FALSE(unique_acc->CreateIndex(label, property).HasError());
+    ASSERT_FALSE(unique_acc->Commit().HasError());
+  }
+  auto storage_dba = db.Access(ReplicationRole::MAIN);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  for (int i = 0; i < 1000; ++i) ASSERT_TRUE(dba.InsertVertex().AddLabel(label).HasValue());
+  dba.AdvanceCommand();
+  // value 0 is on 900 vertices, values 1 to 100 on one vertex each
+  std::map<memgraph::storage::PropertyValue, int64_t> values{{memgraph::storage::PropertyValue(0), 900}};
+  for (int i = 1; i <= 100; ++i) values.emplace(memgraph::storage::PropertyValue(i), 1);
+  memgraph::storage::LabelPropertyIndexStats stats{
+      .count = 1000, .distinct_values_count = 101, .statistic = 0, .avg_group_size = 1000. / 101, .avg_degree = 0};
+  memgraph::storage::SetValueDistribution(stats, values);
+  dba.SetIndexStats(label, property, stats);
+
+  // MATCH (n :label), (m :label), (k :label), (l :label)
+  // WHERE n.property = 0 AND m.property = 42 AND k.property = $0 AND l.property < 50
+  const auto prop = std::make_pair(std::string("property"), property);
+  auto *query = QUERY(SINGLE_QUERY(
+      MATCH(PATTERN(NODE("n", "label")), PATTERN(NODE("m", "label")), PATTERN(NODE("k", "label")),
+            PATTERN(NODE("l", "label"))),
+      WHERE(AND(AND(EQ(PROPERTY_LOOKUP(dba, "n", prop), LITERAL(0)), EQ(PROPERTY_LOOKUP(dba, "m", prop), LITERAL(42))),
+                AND(EQ(PROPERTY_LOOKUP(dba, "k", prop), PARAMETER_LOOKUP(0)),
+                    LESS(PROPERTY_LOOKUP(dba, "l", prop), LITERAL(50))))),
+      RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto query_parts = CollectQueryParts(symbol_table, storage, query);
+  const auto &matching = query_parts.query_parts.at(0).single_query_parts.at(0).matching;
+  std::unordered_map<std::string, memgraph::query::Symbol> symbols;
+  for (const auto &expansion : matching.expansions) {
+    symbols.emplace(expansion.node1->identifier_->name_, symbol_table.at(*expansion.node1->identifier_));
+  }
+  memgraph::query::Parameters parameters;
+  parameters.Add(0, memgraph::storage::PropertyValue(0));
+
+  auto estimate = MakeNodeCardinalityEstimator(&dba, &parameters);
+  EXPECT_DOUBLE_EQ(estimate(symbols.at("n"), matching.filters), 900);
+  EXPECT_DOUBLE_EQ(estimate(symbols.at("m"), matching.filters), 1);
+  EXPECT_DOUBLE_EQ(estimate(symbols.at("k"), matching.filters), 900);
+  const auto upper = memgraph::utils::MakeBoundExclusive(memgraph::storage::PropertyValue(50));
+  EXPECT_DOUBLE_EQ(estimate(symbols.at("l"), matching.filters),
+                   *memgraph::storage::EstimateRangeCount(stats, std::nullopt, upper));
+  // Without the value of the parameter, the average group is expected.
+  auto estimate_without_parameters = MakeNodeCardinalityEstimator(&dba, nullptr);
+  EXPECT_DOUBLE_EQ(estimate_without_parameters(symbols.at("k"), matching.filters), 1000. / 101);
+}
+
+class JoinCounter : public HierarchicalLogicalOperatorVisitor {
+ public:
+  using HierarchicalLogicalOperatorVisitor::PostVisit;
+  using HierarchicalLogicalOperatorVisitor::PreVisit;
+  using HierarchicalLogicalOperatorVisitor::Visit;
+
+  bool Visit(Once &) override { return true; }
+  bool PreVisit(HashJoin &) override {
+    ++hash_joins;
+    return true;
+  }
+  bool PreVisit(IndexedJoin &) override {
+    ++indexed_joins;
+    return true;
+  }
+
+  int hash_joins{0};
+  int indexed_joins{0};
+};
+
+TEST_F(TestVariableStartPlannerOrder, ChooseJoinByCost) {
+  memgraph::storage::InMemoryStorage db;
+  const auto label_a = db.NameToLabel("A");
+  const auto label_b = db.NameToLabel("B");
+  const auto id = db.NameToProperty("id");
+  for (auto label : {label_a, label_b}) {
+    auto unique_acc = db.UniqueAccess(ReplicationRole::MAIN);
+    ASSERT_FALSE(unique_acc->CreateIndex(label).HasError());
+    ASSERT_FALSE(unique_acc->Commit().HasError());
+  }
+  {
+    auto unique_acc = db.UniqueAccess(ReplicationRole::MAIN);
+    ASSERT_FALSE(unique_acc->CreateIndex(label_b, id).HasError());
+    ASSERT_FALSE(unique_acc->Commit().HasError());
+  }
+  auto storage_dba = db.Access(ReplicationRole::MAIN);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  for (int i = 0; i < 1000; ++i) ASSERT_TRUE(dba.InsertVertex().AddLabel(label_a).HasValue());
+  for (int i = 0; i < 100; ++i) {
+    auto vertex = dba.InsertVertex();
+    ASSERT_TRUE(vertex.AddLabel(label_b).HasValue());
+    ASSERT_TRUE(vertex.SetProperty(id, memgraph::storage::PropertyValue(i % 4)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  auto plan_joins = [&] {
+    // MATCH (a :A), (b :B) WHERE b.id = a.id RETURN a, b
+    const auto prop = std::make_pair(std::string("id"), id);
+    auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("a", "A")), PATTERN(NODE("b", "B"))),
+                                     WHERE(EQ(PROPERTY_LOOKUP(dba, "b", prop), PROPERTY_LOOKUP(dba, "a", prop))),
+                                     RETURN("a", "b")));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planning_context = MakePlanningContext(&storage, &symbol_table, query, &dba);
+    memgraph::query::Parameters parameters;
+    auto [plan, cost] = MakeLogicalPlan(&planning_context, parameters, true);
+    JoinCounter counter;
+    plan->Accept(counter);
+    return counter;
+  };
+  // Looking up the 25 vertices with the same id for each of the 1000 vertices
+  // costs more than hashing the vertices of both labels.
+  auto joins = plan_joins();
+  EXPECT_EQ(joins.hash_joins, 1);
+  EXPECT_EQ(joins.indexed_joins, 0);
+
+  // If ANALYZE GRAPH found the ids unique, the lookups are cheaper.
+  std::map<memgraph::storage::PropertyValue, int64_t> values;
+  for (int i = 0; i < 100; ++i) values.emplace(memgraph::storage::PropertyValue(i), 1);
+  memgraph::storage::LabelPropertyIndexStats stats{
+      .count = 100, .distinct_values_count = 100, .statistic = 0, .avg_group_size = 1, .avg_degree = 0};
+  memgraph::storage::SetValueDistribution(stats, values);
+  dba.SetIndexStats(label_b, id, stats);
+  joins = plan_joins();
+  EXPECT_EQ(joins.hash_joins, 0);
+  EXPECT_EQ(joins.indexed_joins, 1);
+}
+
 TYPED_TEST(TestVariableStartPlanner, MatchOptionalMatchReturn) {
   auto storage_dba = this->db->Access(ReplicationRole::MAIN);
   memgraph::query::DbAccessor dba(storage_dba.get());
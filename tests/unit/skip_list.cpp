@@ -868,3 +868,45 @@ TEST(SkipList, EstimateAverageNumberOfEquals5) {
     ASSERT_EQ(count, kMaxElements);
   }
 }
+
+TEST(SkipList, ChunkBoundaries) {
+  memgraph::utils::SkipList<int64_t> list;
+  {
+    auto acc = list.access();
+    ASSERT_TRUE(acc.chunk_boundaries(4).empty());
+  }
+
+  const int64_t kMaxElements = 100000;
+  {
+    auto acc = list.access();
+    for (int64_t i = 0; i < kMaxElements; ++i) {
+      ASSERT_TRUE(acc.insert(i).second);
+    }
+  }
+
+  auto acc = list.access();
+  {
+    auto boundaries = acc.chunk_boundaries(1);
+    ASSERT_EQ(boundaries.size(), 1);
+    ASSERT_EQ(*boundaries[0], 0);
+  }
+
+  for (uint64_t num_chunks : {2, 7, 64}) {
+    auto boundaries = acc.chunk_boundaries(num_chunks);
+    ASSERT_GE(boundaries.size(), 2);
+    ASSERT_LE(boundaries.size(), num_chunks);
+    ASSERT_EQ(*boundaries[0], 0);
+
+    // The chunks are disjoint and together cover the whole list.
+    int64_t expected = 0;
+    for (size_t i = 0; i < boundaries.size(); ++i) {
+      const auto chunk_end = i + 1 < boundaries.size() ? *boundaries[i + 1] : kMaxElements;
+      ASSERT_LT(*boundaries[i], chunk_end);
+      for (auto it = boundaries[i]; it != acc.end() && *it < chunk_end; ++it) {
+        ASSERT_EQ(*it, expected);
+        ++expected;
+      }
+    }
+    ASSERT_EQ(expected, kMaxElements);
+  }
+}
@@ -418,3 +418,89 @@ TEST(CheckStreamComplete, InvalidSegment) {
   ASSERT_EQ(stream_size, 0);
   ASSERT_EQ(data_size, 0);
 }
+
+BinaryData GetCompressibleData(size_t size) {
+  std::unique_ptr<uint8_t[]> ret(new uint8_t[size]);
+  for (size_t i = 0; i < size; ++i) {
+    ret[i] = i % 7;
+  }
+  return BinaryData(std::move(ret), size);
+}
+
+TEST(Builder, IncompressibleSegment) {
+  std::vector<uint8_t> buffer;
+  memgraph::slk::Builder builder([&buffer](const uint8_t *data, size_t size, bool have_more) {
+    for (size_t i = 0; i < size; ++i) buffer.push_back(data[i]);
+  });
+  builder.EnableCompression();
+
+  auto input = GetRandomData(memgraph::slk::kSegmentMinCompressedDataSize * 2);
+  builder.Save(input.data(), input.size());
+  builder.Finalize();
+
+  ASSERT_EQ(buffer.size(), input.size() + 2 * sizeof(memgraph::slk::SegmentSize));
+
+  auto splits =
+      BufferToBinaryData(buffer.data(), buffer.size(),
+                         {sizeof(memgraph::slk::SegmentSize), input.size(), sizeof(memgraph::slk::SegmentSize)});
+  ASSERT_EQ(splits[0], SizeToBinaryData(input.size()));
+  ASSERT_EQ(splits[1], input);
+  ASSERT_EQ(splits[2], SizeToBinaryData(0));
+}
+
+TEST(Reader, CompressedSegments) {
+  std::vector<uint8_t> buffer;
+  memgraph::slk::Builder builder([&buffer](const uint8_t *data, size_t size, bool have_more) {
+    for (size_t i = 0; i < size; ++i) buffer.push_back(data[i]);
+  });
+  builder.EnableCompression();
+
+  auto input = GetCompressibleData(memgraph::slk::kSegmentMaxDataSize + memgraph::slk::kSegmentMinCompressedDataSize);
+  builder.Save(input.data(), input.size());
+  builder.Finalize();
+
+  ASSERT_LT(buffer.size(), input.size() / 10);
+  memgraph::slk::SegmentSize header = 0;
+  memcpy(&header, buffer.data(), sizeof(memgraph::slk::SegmentSize));
+  ASSERT_NE(header & memgraph::slk::kSegmentCompressedFlag, 0);
+
+  // test stream completeness
+  {
+    auto [status, stream_size, data_size] = memgraph::slk::CheckStreamComplete(buffer.data(), buffer.size());
+    ASSERT_EQ(status, memgraph::slk::StreamStatus::COMPLETE);
+    ASSERT_EQ(stream_size, buffer.size());
+  }
+
+  // test with missing data
+  for (size_t i = 0; i < buffer.size(); ++i) {
+    memgraph::slk::Reader reader(buffer.data(), i);
+    std::vector<uint8_t> block(input.size());
+    ASSERT_THROW(
+        {
+          reader.Load(block.data(), input.size());
+          reader.Finalize();
+        },
+        memgraph::slk::SlkReaderException);
+  }
+
+  // read data with several loads
+  {
+    memgraph::slk::Reader reader(buffer.data(), buffer.size());
+    std::vector<uint8_t> block(input.size());
+    const size_t step = 1000;
+    for (size_t i = 0; i < input.size(); i += step) {
+      reader.Load(block.data() + i, std::min(step, input.size() - i));
+    }
+    reader.Finalize();
+    auto output = BinaryData(block.data(), input.size());
+    ASSERT_EQ(output, input);
+  }
+
+  // corrupt the compressed data
+  buffer[2 * sizeof(memgraph::slk::SegmentSize) + 2] ^= 0xff;
+  {
+    memgraph::slk::Reader reader(buffer.data(), buffer.size());
+    std::vector<uint8_t> block(input.size());
+    ASSERT_THROW(reader.Load(block.data(), input.size()), memgraph::slk::SlkReaderException);
+  }
+}
@@ -0,0 +1,205 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "storage/v2/adjacency_list.hpp"
+
+using memgraph::storage::AdjacencyList;
+using memgraph::storage::EdgeRef;
+using memgraph::storage::EdgeTypeId;
+using memgraph::storage::Gid;
+using memgraph::storage::Vertex;
+
+namespace {
+
+AdjacencyList::value_type MakeLink(uint32_t edge_type, uint64_t edge_gid) {
+  // NOLINTNEXTLINE(performance-no-int-to-ptr)
+  return {EdgeTypeId::FromUint(edge_type), reinterpret_cast<Vertex *>(edge_gid * 8),
+          EdgeRef(Gid::FromUint(edge_gid))};
+}
+
+std::vector<std::pair<uint32_t, uint64_t>> Contents(const AdjacencyList &list) {
+  std::vector<std::pair<uint32_t, uint64_t>> ret;
+  for (const auto &[edge_type, vertex, edge_ref] : list) {
+    ret.emplace_back(edge_type.AsUint(), edge_ref.gid.AsUint());
+  }
+  return ret;
+}
+
+void CheckGrouped(const AdjacencyList &list) {
+  auto contents = Contents(list);
+  ASSERT_TRUE(std::is_sorted(contents.begin(), contents.end(),
+                             [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; }));
+}
+
+}  // namespace
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(AdjacencyList, Empty) {
+  AdjacencyList list;
+  ASSERT_TRUE(list.empty());
+  ASSERT_EQ(list.size(), 0);
+  ASSERT_EQ(list.begin(), list.end());
+  ASSERT_EQ(list.find(MakeLink(1, 1)), list.end());
+  ASSERT_TRUE(list.equal_range(EdgeTypeId::FromUint(1)).empty());
+  ASSERT_EQ(sizeof(AdjacencyList), sizeof(void *));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(AdjacencyList, GroupedByType) {
+  AdjacencyList list;
+  list.insert(MakeLink(3, 1));
+  list.insert(MakeLink(1, 2));
+  list.insert(MakeLink(3, 3));
+  list.insert(MakeLink(2, 4));
+  list.insert(MakeLink(1, 5));
+  ASSERT_EQ(list.size(), 5);
+  ASSERT_EQ(list.num_edge_types(), 3);
+  CheckGrouped(list);
+
+  auto typed = list.equal_range(EdgeTypeId::FromUint(3));
+  std::vector<uint64_t> gids;
+  for (const auto &[edge_type, vertex, edge_ref] : typed) {
+    ASSERT_EQ(edge_type, EdgeTypeId::FromUint(3));
+    gids.push_back(edge_ref.gid.AsUint());
+  }
+  std::sort(gids.begin(), gids.end());
+  ASSERT_EQ(gids, (std::vector<uint64_t>{1, 3}));
+  ASSERT_TRUE(list.equal_range(EdgeTypeId::FromUint(4)).empty());
+
+  ASSERT_NE(list.find(MakeLink(2, 4)), list.end());
+  ASSERT_EQ(*list.find(MakeLink(2, 4)), MakeLink(2, 4));
+  ASSERT_EQ(list.find(MakeLink(3, 4)), list.end());
+
+  list.erase(list.find(MakeLink(2, 4)));
+  ASSERT_EQ(list.size(), 4);
+  ASSERT_EQ(list.num_edge_types(), 2);
+  ASSERT_EQ(list.find(MakeLink(2, 4)), list.end());
+  CheckGrouped(list);
+
+  ASSERT_EQ(list.back(), MakeLink(3, std::get<2>(list.back()).gid.AsUint()));
+  list.pop_back();
+  list.pop_back();
+  ASSERT_EQ(list.size(), 2);
+  ASSERT_EQ(list.num_edge_types(), 1);
+
+  ASSERT_EQ(list.erase_if([](const auto &link) { return std::get<2>(link).gid.AsUint() == 2; }), 1);
+  ASSERT_EQ(Contents(list), (std::vector<std::pair<uint32_t, uint64_t>>{{1, 5}}));
+
+  list.clear();
+  ASSERT_TRUE(list.empty());
+  ASSERT_EQ(list.num_edge_types(), 0);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(AdjacencyList, IterationOrder) {
+  // Edges are iterated by increasing edge type, not in insertion order.
+  AdjacencyList list;
+  list.insert(MakeLink(2, 1));
+  list.insert(MakeLink(1, 2));
+  list.insert(MakeLink(3, 3));
+  ASSERT_EQ(Contents(list), (std::vector<std::pair<uint32_t, uint64_t>>{{1, 2}, {2, 1}, {3, 3}}));
+
+  // Inserting into a group can reorder the edges of the following groups.
+  list.insert(MakeLink(3, 4));
+  list.insert(MakeLink(3, 5));
+  list.insert(MakeLink(1, 6));
+  ASSERT_EQ(Contents(list),
+            (std::vector<std::pair<uint32_t, uint64_t>>{{1, 2}, {1, 6}, {2, 1}, {3, 4}, {3, 5}, {3, 3}}));
+
+  // Changing the type of an edge erases it and inserts it again, so it moves
+  // to the slice of the new type.
+  list.erase(list.find(MakeLink(3, 4)));
+  list.insert(MakeLink(1, 4));
+  CheckGrouped(list);
+  std::vector<uint64_t> gids;
+  for (const auto &[edge_type, vertex, edge_ref] : list.equal_range(EdgeTypeId::FromUint(1))) {
+    gids.push_back(edge_ref.gid.AsUint());
+  }
+  std::sort(gids.begin(), gids.end());
+  ASSERT_EQ(gids, (std::vector<uint64_t>{2, 4, 6}));
+  ASSERT_EQ(list.find(MakeLink(3, 4)), list.end());
+  ASSERT_EQ(std::ranges::distance(list.equal_range(EdgeTypeId::FromUint(3))), 2);
+  ASSERT_EQ(list.size(), 6);
+  ASSERT_EQ(AdjacencyList::max_size(), std::numeric_limits<AdjacencyList::size_type>::max());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(AdjacencyList, CopyAndMove) {
+  AdjacencyList list;
+  for (uint64_t i = 0; i < 10; ++i) list.insert(MakeLink(i % 3, i));
+
+  AdjacencyList copy(list);
+  ASSERT_EQ(Contents(copy), Contents(list));
+
+  AdjacencyList moved(std::move(copy));
+  ASSERT_EQ(Contents(moved), Contents(list));
+  // NOLINTNEXTLINE(bugprone-use-after-move,clang-analyzer-cplusplus.Move)
+  ASSERT_TRUE(copy.empty());
+
+  copy = moved;
+  copy.erase_if([](const auto &link) { return std::get<0>(link) == EdgeTypeId::FromUint(1); });
+  ASSERT_EQ(copy.size(), 7);
+  ASSERT_EQ(moved.size(), 10);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(AdjacencyList, RandomOperations) {
+  std::mt19937 gen(42);  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+  std::uniform_int_distribution<uint32_t> type_dist(0, 15);
+  std::uniform_int_distribution<int> op_dist(0, 9);
+
+  AdjacencyList list;
+  std::vector<std::pair<uint32_t, uint64_t>> expected;
+  uint64_t next_gid = 0;
+
+  for (int i = 0; i < 20000; ++i) {
+    auto op = op_dist(gen);
+    if (op < 6 || expected.empty()) {
+      auto edge_type = type_dist(gen);
+      list.insert(MakeLink(edge_type, next_gid));
+      expected.emplace_back(edge_type, next_gid);
+      ++next_gid;
+    } else if (op < 9) {
+      std::uniform_int_distribution<size_t> idx_dist(0, expected.size() - 1);
+      auto idx = idx_dist(gen);
+      auto it = list.find(MakeLink(expected[idx].first, expected[idx].second));
+      ASSERT_NE(it, list.end());
+      list.erase(it);
+      expected.erase(expected.begin() + static_cast<std::ptrdiff_t>(idx));
+    } else {
+      auto edge_type = type_dist(gen);
+      auto removed = list.erase_if([&](const auto &link) { return std::get<0>(link).AsUint() == edge_type; });
+      auto expected_removed = std::erase_if(expected, [&](const auto &item) { return item.first == edge_type; });
+      ASSERT_EQ(removed, expected_removed);
+    }
+    ASSERT_EQ(list.size(), expected.size());
+  }
+
+  CheckGrouped(list);
+  auto contents = Contents(list);
+  std::sort(contents.begin(), contents.end());
+  std::sort(expected.begin(), expected.end());
+  ASSERT_EQ(contents, expected);
+
+  for (uint32_t edge_type = 0; edge_type <= 15; ++edge_type) {
+    auto range = list.equal_range(EdgeTypeId::FromUint(edge_type));
+    auto count =
+        std::count_if(expected.begin(), expected.end(), [&](const auto &item) { return item.first == edge_type; });
+    ASSERT_EQ(std::ranges::distance(range), count);
+  }
+}
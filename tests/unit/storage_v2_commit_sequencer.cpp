@@ -0,0 +1,83 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "storage/v2/commit_sequencer.hpp"
+
+using memgraph::storage::CommitSequencer;
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(CommitSequencerTest, PublishesInTicketOrder) {
+  constexpr auto kThreads = 8;
+  constexpr auto kCommitsPerThread = 500;
+
+  CommitSequencer sequencer;
+  std::mutex engine_lock;
+  uint64_t timestamp = 0;
+  std::vector<uint64_t> published;
+
+  std::vector<std::jthread> threads;
+  threads.reserve(kThreads);
+  for (int i = 0; i < kThreads; ++i) {
+    threads.emplace_back([&] {
+      for (int j = 0; j < kCommitsPerThread; ++j) {
+        uint64_t commit_timestamp = 0;
+        uint64_t ticket = 0;
+        {
+          auto guard = std::lock_guard{engine_lock};
+          commit_timestamp = timestamp++;
+          ticket = sequencer.NextTicket();
+        }
+        // Work done out of turn may finish in any order.
+        if (commit_timestamp % 3 == 0) std::this_thread::yield();
+        sequencer.WaitPublished(ticket);
+        published.push_back(commit_timestamp);
+        sequencer.Publish();
+      }
+    });
+  }
+  threads.clear();
+
+  ASSERT_EQ(sequencer.IssuedTickets(), kThreads * kCommitsPerThread);
+  ASSERT_EQ(published.size(), kThreads * kCommitsPerThread);
+  ASSERT_TRUE(std::is_sorted(published.begin(), published.end()));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(CommitSequencerTest, LockWaitsForCommitsInFlight) {
+  CommitSequencer sequencer;
+  const auto ticket = sequencer.NextTicket();
+
+  std::atomic<bool> locked{false};
+  std::jthread maintenance([&] {
+    auto guard = std::unique_lock{sequencer};
+    locked = true;
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  ASSERT_FALSE(locked);
+
+  sequencer.WaitPublished(ticket);
+  sequencer.Publish();
+  maintenance.join();
+  ASSERT_TRUE(locked);
+
+  // Transactions which start now don't have to wait for anything.
+  sequencer.WaitPublished(sequencer.IssuedTickets());
+}
@@ -12,7 +12,12 @@
 #include <gtest/gtest.h>
 
 #include <filesystem>
+#include <fstream>
 #include <limits>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "storage/v2/durability/serialization.hpp"
 #include "storage/v2/property_value.hpp"
@@ -354,10 +359,14 @@ TEST_F(DecoderEncoderTest, PropertyValueInvalidMarker) {
         case memgraph::storage::durability::Marker::DELTA_LABEL_INDEX_STATS_CLEAR:
         case memgraph::storage::durability::Marker::DELTA_LABEL_PROPERTY_INDEX_CREATE:
         case memgraph::storage::durability::Marker::DELTA_LABEL_PROPERTY_INDEX_DROP:
+        case memgraph::storage::durability::Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+        case memgraph::storage::durability::Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
         case memgraph::storage::durability::Marker::DELTA_LABEL_PROPERTY_INDEX_STATS_SET:
         case memgraph::storage::durability::Marker::DELTA_LABEL_PROPERTY_INDEX_STATS_CLEAR:
         case memgraph::storage::durability::Marker::DELTA_EDGE_TYPE_INDEX_CREATE:
         case memgraph::storage::durability::Marker::DELTA_EDGE_TYPE_INDEX_DROP:
+        case memgraph::storage::durability::Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_CREATE:
+        case memgraph::storage::durability::Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_DROP:
         case memgraph::storage::durability::Marker::DELTA_TEXT_INDEX_CREATE:
         case memgraph::storage::durability::Marker::DELTA_TEXT_INDEX_DROP:
         case memgraph::storage::durability::Marker::DELTA_EXISTENCE_CONSTRAINT_CREATE:
@@ -468,3 +477,228 @@ TEST_F(DecoderEncoderTest, EncoderPosition) {
     ASSERT_EQ(pos, decoder.GetSize());
   }
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(DecoderEncoderTest, CompressedFile) {
+  constexpr uint64_t kCount = 200000;
+  std::vector<uint64_t> positions;
+  {
+    memgraph::storage::durability::Encoder encoder;
+    encoder.Initialize(storage_file, kTestMagic, memgraph::storage::durability::kCompressionVersion,
+                       memgraph::storage::durability::FileCompression::ZLIB);
+    const auto placeholder_pos = encoder.GetPosition();
+    encoder.WriteUint(0);
+    for (uint64_t i = 0; i < kCount; ++i) {
+      positions.push_back(encoder.GetPosition());
+      encoder.WriteUint(i);
+      encoder.WriteString(std::to_string(i));
+    }
+    // Change data which is already compressed.
+    const auto last_pos = encoder.GetPosition();
+    encoder.SetPosition(placeholder_pos);
+    encoder.WriteUint(kCount);
+    encoder.SetPosition(last_pos);
+    encoder.WriteBool(true);
+    encoder.Finalize();
+  }
+  ASSERT_LT(std::filesystem::file_size(storage_file), positions.back() / 2);
+  {
+    memgraph::storage::durability::Decoder decoder;
+    auto version = decoder.Initialize(storage_file, kTestMagic);
+    ASSERT_TRUE(version);
+    ASSERT_EQ(*version, memgraph::storage::durability::kCompressionVersion);
+    ASSERT_EQ(decoder.ReadUint(), kCount);
+    for (uint64_t i = 0; i < kCount; ++i) {
+      ASSERT_EQ(decoder.GetPosition(), positions[i]);
+      ASSERT_EQ(decoder.ReadUint(), i);
+      ASSERT_EQ(decoder.ReadString(), std::to_string(i));
+    }
+    ASSERT_EQ(decoder.ReadBool(), true);
+    ASSERT_EQ(decoder.GetPosition(), decoder.GetSize());
+    ASSERT_FALSE(decoder.ReadMarker());
+
+    for (auto i : {kCount / 2, 0UL, kCount - 1, kCount / 3}) {
+      ASSERT_TRUE(decoder.SetPosition(positions[i]));
+      ASSERT_EQ(decoder.ReadUint(), i);
+      ASSERT_EQ(decoder.ReadString(), std::to_string(i));
+    }
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(DecoderEncoderTest, CompressedFilePartialData) {
+  constexpr uint64_t kCount = 100000;
+  uint64_t synced_size = 0;
+  {
+    memgraph::storage::durability::Encoder encoder;
+    encoder.Initialize(storage_file, kTestMagic, memgraph::storage::durability::kCompressionVersion,
+                       memgraph::storage::durability::FileCompression::ZLIB);
+    for (uint64_t i = 0; i < kCount; ++i) {
+      encoder.WriteUint(i);
+      if (i % 1000 == 999) encoder.Sync();
+    }
+    // The file isn't finalized, as when a WAL file is being written.
+    synced_size = encoder.GetPosition();
+    encoder.Close();
+  }
+  // The syncs don't cut the data into small blocks.
+  ASSERT_LT(std::filesystem::file_size(storage_file), synced_size / 2);
+  {
+    memgraph::storage::durability::Decoder decoder;
+    ASSERT_TRUE(decoder.Initialize(storage_file, kTestMagic));
+    ASSERT_EQ(decoder.GetSize(), synced_size);
+    for (uint64_t i = 0; i < kCount; ++i) ASSERT_EQ(decoder.ReadUint(), i);
+    ASSERT_FALSE(decoder.ReadUint());
+  }
+  // A block cut off by a crash isn't read, the blocks before it are.
+  std::filesystem::resize_file(storage_file, std::filesystem::file_size(storage_file) - 1);
+  {
+    memgraph::storage::durability::Decoder decoder;
+    ASSERT_TRUE(decoder.Initialize(storage_file, kTestMagic));
+    ASSERT_LT(decoder.GetSize(), synced_size);
+    constexpr uint64_t kEncodedUintSize = 1 + sizeof(uint64_t);
+    uint64_t read = 0;
+    while (*decoder.GetSize() - *decoder.GetPosition() >= kEncodedUintSize) {
+      ASSERT_EQ(decoder.ReadUint(), read);
+      ++read;
+    }
+    ASSERT_GT(read, 0);
+    ASSERT_LT(read, kCount);
+  }
+  // A corrupted block fails the checksum.
+  {
+    memgraph::utils::OutputFile file;
+    file.Open(storage_file, memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+    file.SetPosition(memgraph::utils::OutputFile::Position::SET, kTestMagic.size() + sizeof(uint64_t) + 100);
+    uint8_t byte = 0xff;
+    file.Write(&byte, sizeof(byte));
+    file.Sync();
+    file.Close();
+  }
+  {
+    memgraph::storage::durability::Decoder decoder;
+    ASSERT_TRUE(decoder.Initialize(storage_file, kTestMagic));
+    ASSERT_FALSE(decoder.ReadUint());
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(DecoderEncoderTest, CompressedFileEndingWithIndexMagic) {
+  // Random data doesn't compress, so it's stored as is and the unfinalized
+  // file ends with the data, which ends with the magic of the block index.
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> dist(0, 255);
+  std::string data(10000, '\0');
+  for (auto &c : data) c = static_cast<char>(dist(gen));
+  data.replace(data.size() - 4, 4, "MGbi");
+  {
+    memgraph::storage::durability::Encoder encoder;
+    encoder.Initialize(storage_file, kTestMagic, memgraph::storage::durability::kCompressionVersion,
+                       memgraph::storage::durability::FileCompression::ZLIB);
+    encoder.WriteString(data);
+    encoder.Close();
+  }
+  {
+    std::ifstream file(storage_file, std::ios::binary);
+    file.seekg(-4, std::ios::end);
+    std::string magic(4, '\0');
+    file.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+    ASSERT_TRUE(file);
+    ASSERT_EQ(magic, "MGbi");
+  }
+  // The data isn't mistaken for the block index.
+  memgraph::storage::durability::Decoder decoder;
+  ASSERT_TRUE(decoder.Initialize(storage_file, kTestMagic));
+  ASSERT_EQ(decoder.ReadString(), data);
+  ASSERT_FALSE(decoder.ReadUint());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(DecoderEncoderTest, CompressedFileTryFlushing) {
+  // Enough small writes for more than one block.
+  constexpr uint64_t kCount = 30000;
+  memgraph::storage::durability::Encoder encoder;
+  encoder.Initialize(storage_file, kTestMagic, memgraph::storage::durability::kCompressionVersion,
+                     memgraph::storage::durability::FileCompression::ZLIB);
+  // Everything flushed is in the file without a sync, as the encoder could be
+  // left behind by a crash.
+  auto verify_crashed_file = [&](uint64_t count) {
+    std::filesystem::copy_file(storage_file, alternate_file, std::filesystem::copy_options::overwrite_existing);
+    memgraph::storage::durability::Decoder decoder;
+    ASSERT_TRUE(decoder.Initialize(alternate_file, kTestMagic));
+    ASSERT_EQ(decoder.GetSize(), encoder.GetPosition());
+    for (uint64_t i = 0; i < count; ++i) {
+      ASSERT_EQ(decoder.ReadUint(), i);
+      ASSERT_EQ(decoder.ReadString(), "value " + std::to_string(i % 10));
+    }
+    ASSERT_FALSE(decoder.ReadUint());
+  };
+  for (uint64_t i = 0; i < kCount; ++i) {
+    if (i % 100 == 0) {
+      // Data which was already flushed is changed.
+      const auto position = encoder.GetPosition();
+      encoder.WriteUint(0);
+      encoder.TryFlushing();
+      encoder.SetPosition(position);
+    }
+    encoder.WriteUint(i);
+    encoder.WriteString("value " + std::to_string(i % 10));
+    encoder.TryFlushing();
+    if (i < 10 || i % 1000 == 999) verify_crashed_file(i + 1);
+  }
+  // The flushes don't cut the data into small blocks.
+  ASSERT_LT(std::filesystem::file_size(storage_file), encoder.GetPosition() / 2);
+  encoder.Close();
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(DecoderEncoderTest, ConcurrentAppends) {
+  constexpr uint64_t kThreads = 4;
+  constexpr uint64_t kChunksPerThread = 10;
+  for (auto compression :
+       {memgraph::storage::durability::FileCompression::NONE, memgraph::storage::durability::FileCompression::ZLIB}) {
+    // Some chunks are empty and some span multiple blocks.
+    auto chunk_size = [](uint64_t chunk) { return (chunk % 8) * 10000; };
+    std::vector<uint64_t> positions(kThreads * kChunksPerThread);
+    std::filesystem::remove(storage_file);
+    {
+      memgraph::storage::durability::Encoder encoder;
+      encoder.Initialize(storage_file, kTestMagic, memgraph::storage::durability::kCompressionVersion, compression);
+      const auto placeholder_pos = encoder.GetPosition();
+      encoder.WriteUint(0);
+      {
+        memgraph::storage::durability::ConcurrentAppender appender{encoder};
+        std::vector<std::jthread> threads;
+        for (uint64_t thread = 0; thread < kThreads; ++thread) {
+          threads.emplace_back([&, thread] {
+            memgraph::storage::durability::BufferEncoder chunk_encoder;
+            for (auto chunk = thread; chunk < positions.size(); chunk += kThreads) {
+              chunk_encoder.Clear();
+              for (uint64_t i = 0; i < chunk_size(chunk); ++i) chunk_encoder.WriteUint(chunk);
+              positions[chunk] = appender.Append(chunk_encoder.Buffer());
+            }
+          });
+        }
+      }
+      encoder.WriteBool(true);
+      // Change data written before the appended data.
+      const auto last_pos = encoder.GetPosition();
+      encoder.SetPosition(placeholder_pos);
+      encoder.WriteUint(positions.size());
+      encoder.SetPosition(last_pos);
+      encoder.Finalize();
+    }
+    {
+      memgraph::storage::durability::Decoder decoder;
+      ASSERT_TRUE(decoder.Initialize(storage_file, kTestMagic));
+      ASSERT_EQ(decoder.ReadUint(), positions.size());
+      for (uint64_t chunk = 0; chunk < positions.size(); ++chunk) {
+        ASSERT_TRUE(decoder.SetPosition(positions[chunk]));
+        for (uint64_t i = 0; i < chunk_size(chunk); ++i) ASSERT_EQ(decoder.ReadUint(), chunk);
+      }
+      // The data written after the appender follows all of the appended data.
+      ASSERT_TRUE(decoder.SetPosition(decoder.GetSize().value() - 2));
+      ASSERT_EQ(decoder.ReadBool(), true);
+    }
+  }
+}
@@ -0,0 +1,108 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "storage/v2/delta_container.hpp"
+
+using memgraph::storage::Delta;
+using memgraph::storage::DeltaContainer;
+using memgraph::storage::LabelId;
+using memgraph::storage::PropertyId;
+using memgraph::storage::PropertyValue;
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(DeltaContainerTest, KeepsOrderAndAddresses) {
+  std::atomic<uint64_t> timestamp{1};
+  constexpr uint64_t kDeltas = 3 * DeltaContainer::kMaxSlabCapacity;
+
+  DeltaContainer deltas;
+  ASSERT_TRUE(deltas.empty());
+  std::vector<const Delta *> addresses;
+  for (uint64_t i = 0; i < kDeltas; ++i) {
+    addresses.push_back(&deltas.emplace_back(Delta::DeleteObjectTag(), &timestamp, i));
+  }
+  ASSERT_EQ(deltas.size(), kDeltas);
+
+  uint64_t i = 0;
+  for (const auto &delta : deltas) {
+    ASSERT_EQ(&delta, addresses[i]);
+    ASSERT_EQ(delta.command_id, i);
+    ++i;
+  }
+  ASSERT_EQ(i, kDeltas);
+
+  // Moving the container doesn't move the deltas.
+  DeltaContainer moved{std::move(deltas)};
+  ASSERT_TRUE(deltas.empty());  // NOLINT(bugprone-use-after-move,clang-analyzer-cplusplus.Move)
+  ASSERT_EQ(deltas.begin(), deltas.end());
+  ASSERT_EQ(moved.size(), kDeltas);
+  ASSERT_EQ(&*moved.begin(), addresses.front());
+
+  moved.clear();
+  ASSERT_TRUE(moved.empty());
+  ASSERT_EQ(moved.begin(), moved.end());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(DeltaContainerTest, DestroysDeltas) {
+  std::atomic<uint64_t> timestamp{1};
+  DeltaContainer deltas;
+  for (int i = 0; i < 100; ++i) {
+    deltas.emplace_back(Delta::SetPropertyTag(), PropertyId::FromInt(i), PropertyValue(std::string(100, 'x')),
+                        &timestamp, 0);
+  }
+  ASSERT_TRUE(std::all_of(deltas.begin(), deltas.end(), [](const Delta &delta) {
+    return delta.action == Delta::Action::SET_PROPERTY && delta.property.value->ValueString().size() == 100;
+  }));
+  // Leaks of the property values are caught by the sanitizers.
+  deltas.clear();
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(DeltaContainerTest, RecyclesSlabs) {
+  std::atomic<uint64_t> timestamp{1};
+  const Delta *first = nullptr;
+  {
+    DeltaContainer deltas;
+    first = &deltas.emplace_back(Delta::DeleteObjectTag(), &timestamp, 0);
+  }
+  DeltaContainer deltas;
+  ASSERT_EQ(&deltas.emplace_back(Delta::RecreateObjectTag(), &timestamp, 0), first);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(DeltaContainerTest, DestroyedOnAnotherThread) {
+  std::atomic<uint64_t> timestamp{1};
+  std::vector<DeltaContainer> transactions(16);
+  {
+    std::vector<std::jthread> writers;
+    for (auto &deltas : transactions) {
+      writers.emplace_back([&] {
+        for (uint64_t i = 0; i < 5000; ++i) {
+          deltas.emplace_back(Delta::AddLabelTag(), LabelId::FromInt(1), &timestamp, i);
+        }
+      });
+    }
+  }
+  // Like the GC does, free all slabs on a single thread.
+  std::jthread([&] { transactions.clear(); }).join();
+
+  DeltaContainer deltas;
+  for (uint64_t i = 0; i < 5000; ++i) deltas.emplace_back(Delta::AddLabelTag(), LabelId::FromInt(1), &timestamp, i);
+  ASSERT_EQ(deltas.size(), 5000);
+}
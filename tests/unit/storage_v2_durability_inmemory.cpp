@@ -21,6 +21,7 @@
 #include <csignal>
 #include <cstdint>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <thread>
 #include <type_traits>
@@ -1465,6 +1466,39 @@ TEST_P(DurabilityTest, WalBasic) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, WalGroupCommit) {
+  // Create WALs.
+  {
+    memgraph::storage::Config config{
+        .durability = {.storage_directory = storage_directory,
+                       .snapshot_wal_mode =
+                           memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                       .snapshot_interval = std::chrono::minutes(20),
+                       .wal_group_commit = true},
+        .salient = {.items = {.properties_on_edges = GetParam()}},
+    };
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    CreateBaseDataset(db.storage(), GetParam());
+    CreateExtendedDataset(db.storage());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 0);
+  ASSERT_EQ(GetBackupSnapshotsList().size(), 0);
+  ASSERT_GE(GetWalsList().size(), 1);
+  ASSERT_EQ(GetBackupWalsList().size(), 0);
+
+  // Recover WALs.
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = storage_directory, .recover_on_startup = true},
+      .salient = {.items = {.properties_on_edges = GetParam()}},
+  };
+  memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::dbms::Database db{config, repl_state};
+  VerifyDataset(db.storage(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, WalBackup) {
   // Create WALs.
@@ -2933,6 +2967,233 @@ TEST_P(DurabilityTest, ParallelConstraintsRecovery) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, ParallelSnapshotCreation) {
+  // Create snapshot.
+  {
+    memgraph::storage::Config config{
+        .durability = {.storage_directory = storage_directory,
+                       .snapshot_on_exit = true,
+                       .items_per_batch = 13,
+                       .snapshot_thread_count = 4},
+        .salient = {.items = {.properties_on_edges = GetParam()}},
+    };
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    CreateBaseDataset(db.storage(), GetParam());
+    VerifyDataset(db.storage(), DatasetType::ONLY_BASE, GetParam());
+    CreateExtendedDataset(db.storage());
+    VerifyDataset(db.storage(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+
+  // The segments are written into a single snapshot file.
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  ASSERT_EQ(GetBackupSnapshotsList().size(), 0);
+  ASSERT_EQ(GetWalsList().size(), 0);
+  ASSERT_EQ(GetBackupWalsList().size(), 0);
+
+  // Recover snapshot.
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = storage_directory,
+                     .recover_on_startup = true,
+                     .snapshot_on_exit = false,
+                     .items_per_batch = 13,
+                     .recovery_thread_count = 4},
+      .salient = {.items = {.properties_on_edges = GetParam()}},
+  };
+  memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::dbms::Database db{config, repl_state};
+  VerifyDataset(db.storage(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+  {
+    auto acc = db.Access();
+    auto vertex = acc->CreateVertex();
+    auto edge = acc->CreateEdge(&vertex, &vertex, db.storage()->NameToEdgeType("et"));
+    ASSERT_TRUE(edge.HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, CompressedSnapshotAndWal) {
+  // Create compressed WALs.
+  {
+    memgraph::storage::Config config{
+        .durability = {.storage_directory = storage_directory,
+                       .snapshot_wal_mode =
+                           memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                       .snapshot_interval = std::chrono::minutes(20),
+                       .wal_file_flush_every_n_tx = kFlushWalEvery,
+                       .compression = true},
+        .salient = {.items = {.properties_on_edges = GetParam()}},
+    };
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    CreateBaseDataset(db.storage(), GetParam());
+    CreateExtendedDataset(db.storage());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 0);
+  ASSERT_GE(GetWalsList().size(), 1);
+
+  // Recover WALs and create a compressed snapshot from multiple segments.
+  {
+    memgraph::storage::Config config{
+        .durability = {.storage_directory = storage_directory,
+                       .recover_on_startup = true,
+                       .compression = true,
+                       .snapshot_on_exit = true,
+                       .items_per_batch = 13,
+                       .snapshot_thread_count = 4},
+        .salient = {.items = {.properties_on_edges = GetParam()}},
+    };
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    VerifyDataset(db.storage(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  ASSERT_EQ(GetBackupSnapshotsList().size(), 0);
+
+  // Recover snapshot, decompressing its batches on multiple threads.
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = storage_directory,
+                     .recover_on_startup = true,
+                     .items_per_batch = 13,
+                     .recovery_thread_count = 4},
+      .salient = {.items = {.properties_on_edges = GetParam()}},
+  };
+  memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::dbms::Database db{config, repl_state};
+  VerifyDataset(db.storage(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+  {
+    auto acc = db.Access();
+    auto vertex = acc->CreateVertex();
+    auto edge = acc->CreateEdge(&vertex, &vertex, db.storage()->NameToEdgeType("et"));
+    ASSERT_TRUE(edge.HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, CompressedWalWithoutSync) {
+  constexpr int64_t kNumCommits = 1000;
+  std::vector<memgraph::storage::Gid> gids;
+  // The WAL files as a crash leaves them behind are copied to the "crash"
+  // directory.
+  auto commit_and_crash = [&](const std::filesystem::path &directory, bool compression) {
+    memgraph::storage::Config config{
+        .durability = {.storage_directory = directory,
+                       .snapshot_wal_mode =
+                           memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                       .snapshot_interval = std::chrono::minutes(20),
+                       .wal_file_flush_every_n_tx = kNumCommits * 2,
+                       .compression = compression},
+        .salient = {.items = {.properties_on_edges = GetParam()}},
+    };
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    gids.clear();
+    for (int64_t i = 0; i < kNumCommits; ++i) {
+      auto acc = db.Access();
+      auto vertex = acc->CreateVertex();
+      gids.push_back(vertex.Gid());
+      ASSERT_TRUE(
+          vertex.SetProperty(db.storage()->NameToProperty("id"), memgraph::storage::PropertyValue(i)).HasValue());
+      ASSERT_FALSE(acc->Commit().HasError());
+    }
+
+    // The WAL was never synced or closed, a crash leaves only what is in the
+    // file at this point.
+    std::filesystem::create_directories(directory / "crash");
+    std::filesystem::copy(directory / memgraph::storage::durability::kWalDirectory,
+                          directory / "crash" / memgraph::storage::durability::kWalDirectory);
+  };
+  auto wal_size = [](const std::filesystem::path &directory) {
+    uint64_t size = 0;
+    for (const auto &item :
+         std::filesystem::directory_iterator(directory / memgraph::storage::durability::kWalDirectory)) {
+      size += item.file_size();
+    }
+    return size;
+  };
+
+  const auto uncompressed_directory = storage_directory / "uncompressed";
+  commit_and_crash(uncompressed_directory, false);
+  commit_and_crash(storage_directory, true);
+  const auto crash_directory = storage_directory / "crash";
+  // Flushing after each commit doesn't prevent the compression.
+  ASSERT_LT(wal_size(crash_directory) * 2, wal_size(uncompressed_directory / "crash"));
+
+  // Recover the WAL of the crashed instance.
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = crash_directory, .recover_on_startup = true},
+      .salient = {.items = {.properties_on_edges = GetParam()}},
+  };
+  memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::dbms::Database db{config, repl_state};
+  auto acc = db.Access();
+  for (int64_t i = 0; i < kNumCommits; ++i) {
+    auto vertex = acc->FindVertex(gids[i], memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    auto value = vertex->GetProperty(db.storage()->NameToProperty("id"), memgraph::storage::View::OLD);
+    ASSERT_TRUE(value.HasValue());
+    ASSERT_EQ(*value, memgraph::storage::PropertyValue(i));
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, CompressedWalGroupCommit) {
+  constexpr int64_t kNumCommits = 2000;
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = storage_directory,
+                     .snapshot_wal_mode =
+                         memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                     .snapshot_interval = std::chrono::minutes(20),
+                     .wal_group_commit = true,
+                     .compression = true},
+      .salient = {.items = {.properties_on_edges = GetParam()}},
+  };
+  {
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    for (int64_t i = 0; i < kNumCommits; ++i) {
+      auto acc = db.Access();
+      auto vertex = acc->CreateVertex();
+      ASSERT_TRUE(
+          vertex.SetProperty(db.storage()->NameToProperty("id"), memgraph::storage::PropertyValue(i)).HasValue());
+      ASSERT_FALSE(acc->Commit().HasError());
+    }
+  }
+
+  // Each group of commits syncs the WAL, which mustn't end its compressed
+  // block. The block index of the finalized file ends with the number of
+  // blocks, the offset of the index, its checksum and the magic.
+  const auto wals = GetWalsList();
+  ASSERT_EQ(wals.size(), 1);
+  {
+    std::ifstream wal(wals[0], std::ios::binary);
+    wal.seekg(-static_cast<std::streamoff>(2 * sizeof(uint64_t) + sizeof(uint32_t) + 4), std::ios::end);
+    uint64_t num_blocks = 0;
+    wal.read(reinterpret_cast<char *>(&num_blocks), sizeof(num_blocks));
+    uint64_t index_offset = 0;
+    wal.read(reinterpret_cast<char *>(&index_offset), sizeof(index_offset));
+    uint32_t checksum = 0;
+    wal.read(reinterpret_cast<char *>(&checksum), sizeof(checksum));
+    std::string magic(4, '\0');
+    wal.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+    ASSERT_TRUE(wal);
+    ASSERT_EQ(magic, "MGbi");
+    ASSERT_LE(num_blocks, 2);
+  }
+
+  // Recover WAL.
+  config.durability.recover_on_startup = true;
+  memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::dbms::Database db{config, repl_state};
+  auto acc = db.Access();
+  ASSERT_EQ(acc->ApproximateVertexCount(), static_cast<uint64_t>(kNumCommits));
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, ConstraintsRecoveryFunctionSetting) {
   memgraph::storage::Config config{
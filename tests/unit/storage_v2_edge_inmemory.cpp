@@ -5353,6 +5353,35 @@ TEST(StorageWithoutProperties, EdgePropertyAbort) {
   }
 }
 
+TEST(StorageWithoutProperties, EdgeChangeTypeStaleAccessor) {
+  std::unique_ptr<memgraph::storage::Storage> store(
+      new memgraph::storage::InMemoryStorage({.salient = {.items = {.properties_on_edges = false}}}));
+  memgraph::storage::Gid gid = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  {
+    auto acc = store->Access(ReplicationRole::MAIN);
+    auto vertex = acc->CreateVertex();
+    gid = vertex.Gid();
+    ASSERT_TRUE(acc->CreateEdge(&vertex, &vertex, acc->NameToEdgeType("et1")).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = store->Access(ReplicationRole::MAIN);
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    auto edge = vertex->OutEdges(memgraph::storage::View::NEW).GetValue().edges[0];
+    auto et2 = acc->NameToEdgeType("et2");
+    auto retyped_edge = acc->EdgeChangeType(&edge, et2);
+    ASSERT_TRUE(retyped_edge.HasValue());
+    ASSERT_EQ(retyped_edge->EdgeType(), et2);
+
+    // The accessor from before the retype still has the old type, but the edge isn't deleted.
+    ASSERT_TRUE(retyped_edge->IsVisible(memgraph::storage::View::NEW));
+    ASSERT_TRUE(edge.IsVisible(memgraph::storage::View::NEW));
+
+    acc->Abort();
+  }
+}
+
 TEST(StorageWithoutProperties, EdgePropertyClear) {
   std::unique_ptr<memgraph::storage::Storage> store(
       new memgraph::storage::InMemoryStorage({.salient = {.items = {.properties_on_edges = false}}}));
@@ -204,3 +204,116 @@ TEST(StorageV2Gc, Indices) {
     EXPECT_EQ(gids.size(), 1000);
   }
 }
+
+// Deleted vertices are removed from the storage and the index when the GC
+// splits its work between several threads and can only spend a little time
+// unlinking deltas in each run.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, ParallelIncremental) {
+  std::unique_ptr<memgraph::storage::Storage> storage(
+      std::make_unique<memgraph::storage::InMemoryStorage>(memgraph::storage::Config{
+          .gc = {.type = memgraph::storage::Config::Gc::Type::NONE,
+                 .threads = 4,
+                 .step_budget = std::chrono::milliseconds(1)}}));
+  {
+    auto unique_acc = storage->UniqueAccess(ReplicationRole::MAIN);
+    ASSERT_FALSE(unique_acc->CreateIndex(storage->NameToLabel("label")).HasError());
+    ASSERT_FALSE(unique_acc->Commit().HasError());
+  }
+
+  // Keeps the commits from discarding their own deltas, so everything is left
+  // to the GC.
+  auto blocker = storage->Access(ReplicationRole::MAIN);
+
+  std::vector<memgraph::storage::Gid> vertices;
+  for (uint64_t i = 0; i < 2000; ++i) {
+    auto acc = storage->Access(ReplicationRole::MAIN);
+    auto vertex = acc->CreateVertex();
+    ASSERT_TRUE(*vertex.AddLabel(acc->NameToLabel("label")));
+    vertices.push_back(vertex.Gid());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  for (auto gid : vertices) {
+    auto acc = storage->Access(ReplicationRole::MAIN);
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_TRUE(acc->DeleteVertex(&*vertex).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  blocker.reset();
+
+  for (int run = 0; run < 1000 && storage->GetBaseInfo().vertex_count != 0; ++run) {
+    storage->FreeMemory();
+  }
+  ASSERT_EQ(storage->GetBaseInfo().vertex_count, 0);
+
+  auto acc = storage->Access(ReplicationRole::MAIN);
+  EXPECT_EQ(acc->ApproximateVertexCount(acc->NameToLabel("label")), 0);
+}
+
+// Transactions are handed over to the GC when they finish, which isn't
+// necessarily the order in which they committed. A newer transaction which is
+// unlinked before an older one on the same version chain, when the budget
+// leaves the older one for a later run, must not be freed while the older one
+// still points to it.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, IncrementalOutOfOrderCommits) {
+  std::unique_ptr<memgraph::storage::Storage> storage(
+      std::make_unique<memgraph::storage::InMemoryStorage>(memgraph::storage::Config{
+          .gc = {.type = memgraph::storage::Config::Gc::Type::NONE,
+                 .threads = 1,
+                 .step_budget = std::chrono::milliseconds(1)}}));
+  auto prop = storage->NameToProperty("prop");
+
+  memgraph::storage::Gid gid;
+  {
+    auto acc = storage->Access(ReplicationRole::MAIN);
+    gid = acc->CreateVertex().Gid();
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  // The older transaction is handed over to the GC last.
+  auto older = storage->Access(ReplicationRole::MAIN);
+  {
+    auto vertex = older->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_TRUE(vertex->SetProperty(prop, memgraph::storage::PropertyValue(1)).HasValue());
+    ASSERT_FALSE(older->Commit().HasError());
+  }
+  {
+    auto acc = storage->Access(ReplicationRole::MAIN);
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_TRUE(vertex->SetProperty(prop, memgraph::storage::PropertyValue(2)).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  // Spends the budget between the newer and the older transaction.
+  {
+    auto acc = storage->Access(ReplicationRole::MAIN);
+    for (uint64_t i = 0; i < 100000; ++i) acc->CreateVertex();
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  older.reset();
+
+  storage->FreeMemory();
+
+  // New deltas reuse the memory of the freed ones while the blocker keeps them
+  // from being discarded at commit.
+  auto blocker = storage->Access(ReplicationRole::MAIN);
+  for (int64_t i = 3; i < 100; ++i) {
+    auto acc = storage->Access(ReplicationRole::MAIN);
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_TRUE(vertex->SetProperty(prop, memgraph::storage::PropertyValue(i)).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  blocker.reset();
+
+  for (int run = 0; run < 100; ++run) storage->FreeMemory();
+
+  auto acc = storage->Access(ReplicationRole::MAIN);
+  auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+  ASSERT_TRUE(vertex);
+  EXPECT_EQ(*vertex->GetProperty(prop, memgraph::storage::View::OLD), memgraph::storage::PropertyValue(99));
+  EXPECT_EQ(storage->GetBaseInfo().vertex_count, 100001);
+}
@@ -0,0 +1,174 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+#include "storage/v2/inmemory/label_property_hash_index.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+
+using memgraph::replication_coordination_glue::ReplicationRole;
+using memgraph::storage::Gid;
+using memgraph::storage::InMemoryStorage;
+using memgraph::storage::LabelId;
+using memgraph::storage::PropertyId;
+using memgraph::storage::PropertyValue;
+using memgraph::storage::PropertyValueHash;
+using memgraph::storage::View;
+
+TEST(PropertyValueHash, EqualValuesHashEqually) {
+  PropertyValueHash hash;
+  ASSERT_EQ(PropertyValue(1), PropertyValue(1.0));
+  ASSERT_EQ(hash(PropertyValue(1)), hash(PropertyValue(1.0)));
+  ASSERT_EQ(hash(PropertyValue(0.0)), hash(PropertyValue(-0.0)));
+  ASSERT_EQ(hash(PropertyValue(std::vector<PropertyValue>{PropertyValue(2), PropertyValue("a")})),
+            hash(PropertyValue(std::vector<PropertyValue>{PropertyValue(2.0), PropertyValue("a")})));
+  ASSERT_EQ(hash(PropertyValue(std::map<std::string, PropertyValue>{{"x", PropertyValue(3)}})),
+            hash(PropertyValue(std::map<std::string, PropertyValue>{{"x", PropertyValue(3.0)}})));
+}
+
+class HashIndexTest : public testing::Test {
+ protected:
+  std::unique_ptr<memgraph::storage::Storage> storage_{new InMemoryStorage(memgraph::storage::Config{
+      .gc = {.type = memgraph::storage::Config::Gc::Type::NONE},
+      .hash_indices = {.label_properties = {{"Node", "id"}}},
+  })};
+  LabelId label_{storage_->NameToLabel("Node")};
+  LabelId other_label_{storage_->NameToLabel("Other")};
+  PropertyId id_{storage_->NameToProperty("id")};
+
+  Gid CreateVertex(int64_t id) {
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    auto vertex = acc->CreateVertex();
+    EXPECT_TRUE(vertex.AddLabel(label_).HasValue());
+    EXPECT_TRUE(vertex.SetProperty(id_, PropertyValue(id)).HasValue());
+    const auto gid = vertex.Gid();
+    EXPECT_FALSE(acc->Commit().HasError());
+    return gid;
+  }
+
+  static std::vector<Gid> Lookup(memgraph::storage::Storage::Accessor *acc, LabelId label, PropertyId property,
+                                 const PropertyValue &value, View view) {
+    std::vector<Gid> gids;
+    for (auto vertex : acc->Vertices(label, property, value, view)) {
+      gids.push_back(vertex.Gid());
+    }
+    return gids;
+  }
+
+  uint64_t EntryCount() {
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    return acc->ApproximateVertexCount(label_, id_);
+  }
+};
+
+TEST_F(HashIndexTest, Declared) {
+  auto acc = storage_->Access(ReplicationRole::MAIN);
+  ASSERT_TRUE(acc->LabelPropertyHashIndexExists(label_, id_));
+  ASSERT_FALSE(acc->LabelPropertyHashIndexExists(other_label_, id_));
+  ASSERT_FALSE(acc->LabelPropertyIndexExists(label_, id_));
+  const auto info = acc->ListAllIndices();
+  ASSERT_EQ(info.label_property_hash.size(), 1);
+  ASSERT_EQ(info.label_property_hash[0], std::make_pair(label_, id_));
+  ASSERT_TRUE(info.label_property.empty());
+}
+
+TEST_F(HashIndexTest, Lookup) {
+  const auto first = CreateVertex(1);
+  const auto second = CreateVertex(2);
+  {
+    // Without the label the vertex isn't indexed.
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    auto vertex = acc->CreateVertex();
+    ASSERT_TRUE(vertex.AddLabel(other_label_).HasValue());
+    ASSERT_TRUE(vertex.SetProperty(id_, PropertyValue(1)).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  auto acc = storage_->Access(ReplicationRole::MAIN);
+  ASSERT_EQ(Lookup(acc.get(), label_, id_, PropertyValue(1), View::OLD), std::vector{first});
+  ASSERT_EQ(Lookup(acc.get(), label_, id_, PropertyValue(2.0), View::OLD), std::vector{second});
+  ASSERT_TRUE(Lookup(acc.get(), label_, id_, PropertyValue(3), View::OLD).empty());
+  ASSERT_TRUE(Lookup(acc.get(), label_, id_, PropertyValue("1"), View::OLD).empty());
+  ASSERT_TRUE(Lookup(acc.get(), label_, id_, PropertyValue(std::numeric_limits<double>::quiet_NaN()), View::OLD)
+                  .empty());
+  ASSERT_EQ(acc->ApproximateVertexCount(label_, id_), 2);
+  ASSERT_EQ(acc->ApproximateVertexCount(label_, id_, PropertyValue(1)), 1);
+}
+
+TEST_F(HashIndexTest, Visibility) {
+  const auto gid = CreateVertex(1);
+
+  auto reader = storage_->Access(ReplicationRole::MAIN);
+  {
+    auto writer = storage_->Access(ReplicationRole::MAIN);
+    auto vertex = writer->FindVertex(gid, View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_TRUE(vertex->SetProperty(id_, PropertyValue(5)).HasValue());
+    // The writer sees its own change only in the new view.
+    ASSERT_EQ(Lookup(writer.get(), label_, id_, PropertyValue(1), View::OLD), std::vector{gid});
+    ASSERT_TRUE(Lookup(writer.get(), label_, id_, PropertyValue(5), View::OLD).empty());
+    ASSERT_TRUE(Lookup(writer.get(), label_, id_, PropertyValue(1), View::NEW).empty());
+    ASSERT_EQ(Lookup(writer.get(), label_, id_, PropertyValue(5), View::NEW), std::vector{gid});
+    ASSERT_FALSE(writer->Commit().HasError());
+  }
+  // The reader started before the commit.
+  ASSERT_EQ(Lookup(reader.get(), label_, id_, PropertyValue(1), View::OLD), std::vector{gid});
+  ASSERT_TRUE(Lookup(reader.get(), label_, id_, PropertyValue(5), View::OLD).empty());
+
+  auto acc = storage_->Access(ReplicationRole::MAIN);
+  ASSERT_TRUE(Lookup(acc.get(), label_, id_, PropertyValue(1), View::OLD).empty());
+  ASSERT_EQ(Lookup(acc.get(), label_, id_, PropertyValue(5), View::OLD), std::vector{gid});
+}
+
+TEST_F(HashIndexTest, AbortRemovesEntries) {
+  CreateVertex(1);
+  ASSERT_EQ(EntryCount(), 1);
+  {
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    auto vertex = acc->CreateVertex();
+    ASSERT_TRUE(vertex.AddLabel(label_).HasValue());
+    ASSERT_TRUE(vertex.SetProperty(id_, PropertyValue(2)).HasValue());
+    ASSERT_EQ(Lookup(acc.get(), label_, id_, PropertyValue(2), View::NEW).size(), 1);
+    acc->Abort();
+  }
+  ASSERT_EQ(EntryCount(), 1);
+  auto acc = storage_->Access(ReplicationRole::MAIN);
+  ASSERT_TRUE(Lookup(acc.get(), label_, id_, PropertyValue(2), View::OLD).empty());
+}
+
+TEST_F(HashIndexTest, GarbageCollection) {
+  const auto gid = CreateVertex(1);
+  const auto deleted = CreateVertex(2);
+  for (int64_t id = 10; id < 20; ++id) {
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    auto vertex = acc->FindVertex(gid, View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_TRUE(vertex->SetProperty(id_, PropertyValue(id)).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    auto vertex = acc->FindVertex(deleted, View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_TRUE(acc->DeleteVertex(&*vertex).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  ASSERT_EQ(EntryCount(), 12);
+
+  storage_->FreeMemory();
+  ASSERT_EQ(EntryCount(), 1);
+  auto acc = storage_->Access(ReplicationRole::MAIN);
+  ASSERT_EQ(Lookup(acc.get(), label_, id_, PropertyValue(19), View::OLD), std::vector{gid});
+  ASSERT_TRUE(Lookup(acc.get(), label_, id_, PropertyValue(2), View::OLD).empty());
+}
@@ -968,6 +968,158 @@ TYPED_TEST(IndexTest, LabelPropertyIndexCountEstimate) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, LabelPropertyCompositeIndexCreateAndDrop) {
+  if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    const std::vector<PropertyId> properties{this->prop_val, this->prop_id};
+    {
+      auto unique_acc = this->storage->UniqueAccess(ReplicationRole::MAIN);
+      EXPECT_FALSE(unique_acc->CreateIndex(this->label1, properties).HasError());
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+    {
+      auto acc = this->storage->Access(ReplicationRole::MAIN);
+      EXPECT_TRUE(acc->LabelPropertyCompositeIndexExists(this->label1, properties));
+      EXPECT_FALSE(acc->LabelPropertyCompositeIndexExists(this->label1, {this->prop_id, this->prop_val}));
+      EXPECT_FALSE(acc->LabelPropertyIndexExists(this->label1, this->prop_val));
+      EXPECT_THAT(acc->ListAllIndices().label_properties,
+                  UnorderedElementsAre(std::make_pair(this->label1, properties)));
+    }
+    {
+      auto unique_acc = this->storage->UniqueAccess(ReplicationRole::MAIN);
+      EXPECT_TRUE(unique_acc->CreateIndex(this->label1, properties).HasError());
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+    {
+      auto unique_acc = this->storage->UniqueAccess(ReplicationRole::MAIN);
+      EXPECT_FALSE(unique_acc->DropIndex(this->label1, properties).HasError());
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+    {
+      auto acc = this->storage->Access(ReplicationRole::MAIN);
+      EXPECT_FALSE(acc->LabelPropertyCompositeIndexExists(this->label1, properties));
+      EXPECT_THAT(acc->ListAllIndices().label_properties, IsEmpty());
+    }
+    {
+      auto unique_acc = this->storage->UniqueAccess(ReplicationRole::MAIN);
+      EXPECT_TRUE(unique_acc->DropIndex(this->label1, properties).HasError());
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, LabelPropertyCompositeIndexPrefixScan) {
+  if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    PropertyId prop_b;
+    {
+      auto acc = this->storage->Access(ReplicationRole::MAIN);
+      prop_b = acc->NameToProperty("b");
+    }
+    const std::vector<PropertyId> properties{this->prop_val, prop_b};
+    {
+      auto unique_acc = this->storage->UniqueAccess(ReplicationRole::MAIN);
+      EXPECT_FALSE(unique_acc->CreateIndex(this->label1, properties).HasError());
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+
+    // Vertices 0..9 have val = id % 2 and b = id, vertex 10 doesn't have b and
+    // vertex 11 doesn't have val.
+    {
+      auto acc = this->storage->Access(ReplicationRole::MAIN);
+      for (int i = 0; i < 12; ++i) {
+        auto vertex = this->CreateVertex(acc.get());
+        ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+        if (i != 11) ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(i % 2)));
+        if (i < 10) ASSERT_NO_ERROR(vertex.SetProperty(prop_b, PropertyValue(i)));
+      }
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+
+    auto acc = this->storage->Access(ReplicationRole::MAIN);
+    auto scan = [&](std::vector<PropertyValue> prefix,
+                    const std::optional<memgraph::utils::Bound<PropertyValue>> &lower = std::nullopt,
+                    const std::optional<memgraph::utils::Bound<PropertyValue>> &upper = std::nullopt) {
+      return this->GetIds(acc->Vertices(this->label1, properties, prefix, lower, upper, View::OLD), View::OLD);
+    };
+    EXPECT_THAT(scan({}), UnorderedElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10));
+    EXPECT_THAT(scan({PropertyValue(1)}), UnorderedElementsAre(1, 3, 5, 7, 9));
+    EXPECT_THAT(scan({PropertyValue(0), PropertyValue(4)}), UnorderedElementsAre(4));
+    EXPECT_THAT(scan({PropertyValue(0), PropertyValue(5)}), IsEmpty());
+    EXPECT_THAT(scan({PropertyValue(0)}, memgraph::utils::MakeBoundInclusive(PropertyValue(2)),
+                     memgraph::utils::MakeBoundExclusive(PropertyValue(8))),
+                UnorderedElementsAre(2, 4, 6));
+    EXPECT_THAT(scan({PropertyValue(1)}, memgraph::utils::MakeBoundExclusive(PropertyValue(5))),
+                UnorderedElementsAre(7, 9));
+    EXPECT_THAT(scan({}, std::nullopt, memgraph::utils::MakeBoundInclusive(PropertyValue(0))),
+                UnorderedElementsAre(0, 2, 4, 6, 8, 10));
+
+    EXPECT_EQ(acc->ApproximateVertexCount(this->label1, properties, {}), 11);
+    EXPECT_EQ(acc->ApproximateVertexCount(this->label1, properties, {PropertyValue(1)}), 5);
+    EXPECT_EQ(acc->ApproximateVertexCount(this->label1, properties, {PropertyValue(1), PropertyValue(3)}), 1);
+
+    // Changes of the second property are visible in the new view only.
+    for (auto vertex : acc->Vertices(this->label1, properties, {PropertyValue(1), PropertyValue(3)}, std::nullopt,
+                                     std::nullopt, View::OLD)) {
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_b, PropertyValue(30)));
+    }
+    EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, properties, {PropertyValue(1), PropertyValue(3)},
+                                           std::nullopt, std::nullopt, View::NEW),
+                             View::NEW),
+                IsEmpty());
+    EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, properties, {PropertyValue(1), PropertyValue(30)},
+                                           std::nullopt, std::nullopt, View::NEW),
+                             View::NEW),
+                UnorderedElementsAre(3));
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, LabelPropertyCompositeIndexAbort) {
+  if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    const std::vector<PropertyId> properties{this->prop_val, this->prop_id};
+    {
+      auto unique_acc = this->storage->UniqueAccess(ReplicationRole::MAIN);
+      EXPECT_FALSE(unique_acc->CreateIndex(this->label1, properties).HasError());
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+    Gid gid;
+    {
+      auto acc = this->storage->Access(ReplicationRole::MAIN);
+      auto vertex = this->CreateVertex(acc.get());
+      gid = vertex.Gid();
+      ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+      ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(0)));
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+    EXPECT_EQ(this->storage->Access(ReplicationRole::MAIN)->ApproximateVertexCount(this->label1, properties, {}), 1);
+
+    // Every entry the aborted transaction added is removed, including the ones
+    // for intermediate values.
+    {
+      auto acc = this->storage->Access(ReplicationRole::MAIN);
+      for (int i = 0; i < 5; ++i) {
+        auto vertex = this->CreateVertex(acc.get());
+        ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(i)));
+        ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+        ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(i + 10)));
+      }
+      auto vertex = acc->FindVertex(gid, View::OLD);
+      ASSERT_TRUE(vertex);
+      ASSERT_NO_ERROR(vertex->SetProperty(this->prop_val, PropertyValue(1)));
+      ASSERT_NO_ERROR(vertex->SetProperty(this->prop_id, PropertyValue(2)));
+      EXPECT_EQ(acc->ApproximateVertexCount(this->label1, properties, {}), 1 + 5 * 2 + 2);
+      acc->Abort();
+    }
+
+    auto acc = this->storage->Access(ReplicationRole::MAIN);
+    EXPECT_EQ(acc->ApproximateVertexCount(this->label1, properties, {}), 1);
+    EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, properties, {}, std::nullopt, std::nullopt, View::OLD),
+                             View::OLD),
+                UnorderedElementsAre(0));
+  }
+}
+
 TYPED_TEST(IndexTest, LabelPropertyIndexMixedIteration) {
   {
     auto unique_acc = this->storage->UniqueAccess(ReplicationRole::MAIN);
@@ -1673,3 +1825,267 @@ TYPED_TEST(IndexTest, EdgeTypeIndexRepeatingEdgeTypesBetweenSameVertices) {
                 UnorderedElementsAre(0, 1, 2, 3, 4));
   }
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, EdgeTypePropertyIndexBasic) {
+  if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    {
+      auto acc = this->storage->Access(ReplicationRole::MAIN);
+      for (int i = 0; i < 10; ++i) {
+        auto vertex_from = this->CreateVertexWithoutProperties(acc.get());
+        auto vertex_to = this->CreateVertexWithoutProperties(acc.get());
+        this->CreateEdge(&vertex_from, &vertex_to, i % 2 ? this->edge_type_id1 : this->edge_type_id2, acc.get());
+      }
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+
+    {
+      auto unique_acc = this->storage->UniqueAccess(ReplicationRole::MAIN);
+      EXPECT_FALSE(unique_acc->CreateIndex(this->edge_type_id1, this->prop_id).HasError());
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+    {
+      auto unique_acc = this->storage->UniqueAccess(ReplicationRole::MAIN);
+      EXPECT_TRUE(unique_acc->CreateIndex(this->edge_type_id1, this->prop_id).HasError());
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+
+    {
+      auto acc = this->storage->Access(ReplicationRole::MAIN);
+      EXPECT_TRUE(acc->EdgeTypePropertyIndexExists(this->edge_type_id1, this->prop_id));
+      EXPECT_FALSE(acc->EdgeTypePropertyIndexExists(this->edge_type_id2, this->prop_id));
+      EXPECT_THAT(acc->ListAllIndices().edge_type_property,
+                  UnorderedElementsAre(std::make_pair(this->edge_type_id1, this->prop_id)));
+      EXPECT_EQ(acc->ApproximateEdgeCount(this->edge_type_id1, this->prop_id), 5);
+
+      EXPECT_THAT(this->GetIds(acc->Edges(this->edge_type_id1, this->prop_id, View::OLD), View::OLD),
+                  UnorderedElementsAre(1, 3, 5, 7, 9));
+      EXPECT_THAT(this->GetIds(acc->Edges(this->edge_type_id1, this->prop_id, PropertyValue(5), View::OLD), View::OLD),
+                  UnorderedElementsAre(5));
+      EXPECT_THAT(this->GetIds(acc->Edges(this->edge_type_id1, this->prop_id,
+                                          memgraph::utils::MakeBoundInclusive(PropertyValue(3)),
+                                          memgraph::utils::MakeBoundExclusive(PropertyValue(7)), View::OLD),
+                               View::OLD),
+                  UnorderedElementsAre(3, 5));
+
+      for (auto edge : acc->Edges(this->edge_type_id1, this->prop_id, PropertyValue(5), View::OLD)) {
+        ASSERT_NO_ERROR(edge.SetProperty(this->prop_id, PropertyValue(100)));
+      }
+      EXPECT_THAT(this->GetIds(acc->Edges(this->edge_type_id1, this->prop_id, View::NEW), View::NEW),
+                  UnorderedElementsAre(1, 3, 7, 9, 100));
+      EXPECT_THAT(this->GetIds(acc->Edges(this->edge_type_id1, this->prop_id, PropertyValue(5), View::NEW), View::NEW),
+                  IsEmpty());
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+
+    {
+      auto unique_acc = this->storage->UniqueAccess(ReplicationRole::MAIN);
+      EXPECT_FALSE(unique_acc->DropIndex(this->edge_type_id1, this->prop_id).HasError());
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+    {
+      auto acc = this->storage->Access(ReplicationRole::MAIN);
+      EXPECT_FALSE(acc->EdgeTypePropertyIndexExists(this->edge_type_id1, this->prop_id));
+      EXPECT_EQ(acc->ListAllIndices().edge_type_property.size(), 0);
+    }
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(IndexCreationTest, MultipleThreads) {
+  auto storage = std::make_unique<InMemoryStorage>(Config{.index_creation = {.thread_count = 4}});
+  LabelId label;
+  PropertyId property;
+  std::vector<int64_t> expected;
+  {
+    auto acc = storage->Access(ReplicationRole::MAIN);
+    label = acc->NameToLabel("label");
+    property = acc->NameToProperty("property");
+    for (int64_t i = 0; i < 10'000; ++i) {
+      auto vertex = acc->CreateVertex();
+      ASSERT_NO_ERROR(vertex.SetProperty(property, PropertyValue(i % 100)));
+      if (i % 3 == 0) {
+        ASSERT_NO_ERROR(vertex.AddLabel(label));
+        expected.push_back(i % 100);
+      }
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+  {
+    auto unique_acc = storage->UniqueAccess(ReplicationRole::MAIN);
+    ASSERT_NO_ERROR(unique_acc->CreateIndex(label));
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+  {
+    auto unique_acc = storage->UniqueAccess(ReplicationRole::MAIN);
+    ASSERT_NO_ERROR(unique_acc->CreateIndex(label, property));
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+
+  auto acc = storage->Access(ReplicationRole::MAIN);
+  std::vector<int64_t> label_values;
+  for (auto vertex : acc->Vertices(label, View::OLD)) {
+    label_values.push_back(vertex.GetProperty(property, View::OLD)->ValueInt());
+  }
+  std::vector<int64_t> label_property_values;
+  for (auto vertex : acc->Vertices(label, property, View::OLD)) {
+    label_property_values.push_back(vertex.GetProperty(property, View::OLD)->ValueInt());
+  }
+  std::sort(expected.begin(), expected.end());
+  std::sort(label_values.begin(), label_values.end());
+  // The label+property index is ordered by the property value.
+  EXPECT_TRUE(std::is_sorted(label_property_values.begin(), label_property_values.end()));
+  EXPECT_EQ(label_values, expected);
+  EXPECT_EQ(label_property_values, expected);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(IndexCreationTest, Online) {
+  auto storage = std::make_unique<InMemoryStorage>(Config{.index_creation = {.online = true}});
+  LabelId label;
+  PropertyId property;
+  std::vector<Gid> gids;
+  {
+    auto acc = storage->Access(ReplicationRole::MAIN);
+    label = acc->NameToLabel("label");
+    property = acc->NameToProperty("property");
+    for (int64_t i = 0; i < 1'000; ++i) {
+      auto vertex = acc->CreateVertex();
+      gids.push_back(vertex.Gid());
+      ASSERT_NO_ERROR(vertex.SetProperty(property, PropertyValue(i)));
+      if (i % 2 == 0) {
+        ASSERT_NO_ERROR(vertex.AddLabel(label));
+      }
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  // The writer adds and removes labels and changes properties while the
+  // indices are being built.
+  std::atomic<bool> done{false};
+  std::jthread writer([&] {
+    for (uint64_t i = 0; !done.load(); ++i) {
+      auto acc = storage->Access(ReplicationRole::MAIN);
+      auto created = acc->CreateVertex();
+      ASSERT_NO_ERROR(created.AddLabel(label));
+      ASSERT_NO_ERROR(created.SetProperty(property, PropertyValue(static_cast<int64_t>(i))));
+      auto existing = acc->FindVertex(gids[i % gids.size()], View::OLD);
+      ASSERT_TRUE(existing);
+      if (*existing->HasLabel(label, View::NEW)) {
+        ASSERT_NO_ERROR(existing->RemoveLabel(label));
+      } else {
+        ASSERT_NO_ERROR(existing->AddLabel(label));
+      }
+      ASSERT_NO_ERROR(existing->SetProperty(property, PropertyValue(static_cast<int64_t>(i + 1'000))));
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+  });
+
+  storage->BuildIndexOnline(ReplicationRole::MAIN, label, std::nullopt);
+  storage->BuildIndexOnline(ReplicationRole::MAIN, label, property);
+  {
+    // The indices aren't visible until they are created.
+    auto acc = storage->Access(ReplicationRole::MAIN);
+    EXPECT_FALSE(acc->LabelIndexExists(label));
+    EXPECT_FALSE(acc->LabelPropertyIndexExists(label, property));
+    EXPECT_TRUE(acc->ListAllIndices().label.empty());
+  }
+  {
+    auto unique_acc = storage->UniqueAccess(ReplicationRole::MAIN);
+    ASSERT_NO_ERROR(unique_acc->CreateIndex(label));
+    ASSERT_NO_ERROR(unique_acc->CreateIndex(label, property));
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+  done.store(true);
+  writer.join();
+
+  auto acc = storage->Access(ReplicationRole::MAIN);
+  ASSERT_TRUE(acc->LabelIndexExists(label));
+  ASSERT_TRUE(acc->LabelPropertyIndexExists(label, property));
+  std::vector<Gid> expected;
+  for (auto vertex : acc->Vertices(View::OLD)) {
+    if (*vertex.HasLabel(label, View::OLD)) expected.push_back(vertex.Gid());
+  }
+  std::vector<Gid> label_gids;
+  for (auto vertex : acc->Vertices(label, View::OLD)) {
+    label_gids.push_back(vertex.Gid());
+  }
+  std::vector<Gid> label_property_gids;
+  for (auto vertex : acc->Vertices(label, property, View::OLD)) {
+    label_property_gids.push_back(vertex.Gid());
+  }
+  std::sort(expected.begin(), expected.end());
+  std::sort(label_gids.begin(), label_gids.end());
+  std::sort(label_property_gids.begin(), label_property_gids.end());
+  EXPECT_EQ(label_gids, expected);
+  EXPECT_EQ(label_property_gids, expected);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(IndexCreationTest, OnlineAborted) {
+  auto storage = std::make_unique<InMemoryStorage>(Config{.index_creation = {.online = true}});
+  LabelId label;
+  PropertyId property;
+  {
+    auto acc = storage->Access(ReplicationRole::MAIN);
+    label = acc->NameToLabel("label");
+    property = acc->NameToProperty("property");
+    for (int64_t i = 0; i < 100; ++i) {
+      auto vertex = acc->CreateVertex();
+      ASSERT_NO_ERROR(vertex.AddLabel(label));
+      ASSERT_NO_ERROR(vertex.SetProperty(property, PropertyValue(i)));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  // An aborted build leaves nothing behind.
+  storage->BuildIndexOnline(ReplicationRole::MAIN, label, std::nullopt);
+  storage->BuildIndexOnline(ReplicationRole::MAIN, label, property);
+  storage->AbortIndexOnline(label, std::nullopt);
+  storage->AbortIndexOnline(label, property);
+  {
+    auto unique_acc = storage->UniqueAccess(ReplicationRole::MAIN);
+    EXPECT_FALSE(unique_acc->LabelIndexExists(label));
+    EXPECT_FALSE(unique_acc->LabelPropertyIndexExists(label, property));
+    EXPECT_TRUE(unique_acc->DropIndex(label).HasError());
+    EXPECT_TRUE(unique_acc->DropIndex(label, property).HasError());
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+
+  // A build which isn't created yet can't be dropped by another query.
+  storage->BuildIndexOnline(ReplicationRole::MAIN, label, std::nullopt);
+  storage->BuildIndexOnline(ReplicationRole::MAIN, label, property);
+  {
+    auto unique_acc = storage->UniqueAccess(ReplicationRole::MAIN);
+    EXPECT_TRUE(unique_acc->DropIndex(label).HasError());
+    EXPECT_TRUE(unique_acc->DropIndex(label, property).HasError());
+    ASSERT_NO_ERROR(unique_acc->CreateIndex(label));
+    ASSERT_NO_ERROR(unique_acc->CreateIndex(label, property));
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+  // Aborting after the index was created doesn't drop it, dropping it does.
+  storage->AbortIndexOnline(label, std::nullopt);
+  storage->AbortIndexOnline(label, property);
+  {
+    auto unique_acc = storage->UniqueAccess(ReplicationRole::MAIN);
+    ASSERT_NO_ERROR(unique_acc->DropIndex(label));
+    ASSERT_NO_ERROR(unique_acc->DropIndex(label, property));
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+
+  // The dropped index is built again from scratch.
+  storage->BuildIndexOnline(ReplicationRole::MAIN, label, std::nullopt);
+  storage->BuildIndexOnline(ReplicationRole::MAIN, label, property);
+  {
+    auto unique_acc = storage->UniqueAccess(ReplicationRole::MAIN);
+    ASSERT_NO_ERROR(unique_acc->CreateIndex(label));
+    ASSERT_NO_ERROR(unique_acc->CreateIndex(label, property));
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+
+  auto acc = storage->Access(ReplicationRole::MAIN);
+  ASSERT_TRUE(acc->LabelIndexExists(label));
+  ASSERT_TRUE(acc->LabelPropertyIndexExists(label, property));
+  EXPECT_EQ(std::ranges::distance(acc->Vertices(label, View::OLD)), 100);
+  EXPECT_EQ(std::ranges::distance(acc->Vertices(label, property, View::OLD)), 100);
+}
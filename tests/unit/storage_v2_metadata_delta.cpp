@@ -0,0 +1,49 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "storage/v2/metadata_delta.hpp"
+
+using memgraph::storage::LabelId;
+using memgraph::storage::LabelPropertyIndexStats;
+using memgraph::storage::MetadataDelta;
+using memgraph::storage::PropertyId;
+
+// The stats live in a union member, so the delta has to destroy them itself,
+// otherwise the sanitizers report the histogram and most common values as
+// leaked.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(MetadataDeltaTest, LabelPropertyIndexStatsSetDestroysStats) {
+  LabelPropertyIndexStats stats{.count = 100,
+                                .distinct_values_count = 10,
+                                .statistic = 1.0,
+                                .avg_group_size = 10.0,
+                                .avg_degree = 0.0,
+                                .histogram_count = 100};
+  for (int i = 0; i <= 100; ++i) stats.histogram_bounds.push_back(i);
+  for (uint64_t i = 0; i < 10; ++i) stats.most_common_values.emplace_back(i, 10);
+
+  std::vector<std::unique_ptr<MetadataDelta>> deltas;
+  for (int i = 0; i < 10; ++i) {
+    deltas.push_back(std::make_unique<MetadataDelta>(MetadataDelta::label_property_index_stats_set,
+                                                     LabelId::FromUint(1), PropertyId::FromUint(2), stats));
+  }
+  for (const auto &delta : deltas) {
+    ASSERT_EQ(delta->action, MetadataDelta::Action::LABEL_PROPERTY_INDEX_STATS_SET);
+    EXPECT_EQ(delta->label_property_stats.stats.histogram_bounds, stats.histogram_bounds);
+    EXPECT_EQ(delta->label_property_stats.stats.most_common_values, stats.most_common_values);
+  }
+  deltas.clear();
+}
@@ -0,0 +1,142 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <optional>
+
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/property_column_cache.hpp"
+
+using memgraph::replication_coordination_glue::ReplicationRole;
+using memgraph::storage::Gid;
+using memgraph::storage::InMemoryStorage;
+using memgraph::storage::PropertyValue;
+using memgraph::storage::View;
+
+class PropertyColumnCacheTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    storage_ = std::make_unique<InMemoryStorage>(memgraph::storage::Config{
+        .gc = {.type = memgraph::storage::Config::Gc::Type::NONE},
+        .property_column_cache = {.columns = {{"Person", "age"}}},
+    });
+    label_ = storage_->NameToLabel("Person");
+    age_ = storage_->NameToProperty("age");
+
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    auto vertex = acc->CreateVertex();
+    gid_ = vertex.Gid();
+    ASSERT_TRUE(vertex.AddLabel(label_).HasValue());
+    ASSERT_TRUE(vertex.SetProperty(age_, PropertyValue(30)).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+    storage_->FreeMemory();
+  }
+
+  /// Value held by the columns for the test vertex, if any.
+  std::optional<PropertyValue> Cached() {
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    auto vertex = acc->FindVertex(gid_, View::OLD);
+    MG_ASSERT(vertex);
+    PropertyValue value;
+    if (!storage_->property_column_cache_.Get(*vertex->vertex_, age_, &value)) return std::nullopt;
+    return value;
+  }
+
+  PropertyValue Visible() {
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    auto vertex = acc->FindVertex(gid_, View::OLD);
+    MG_ASSERT(vertex);
+    return *vertex->GetProperty(age_, View::OLD);
+  }
+
+  std::unique_ptr<memgraph::storage::Storage> storage_;
+  memgraph::storage::LabelId label_;
+  memgraph::storage::PropertyId age_;
+  Gid gid_;
+};
+
+TEST_F(PropertyColumnCacheTest, CommittedValue) {
+  ASSERT_EQ(Cached(), PropertyValue(30));
+  ASSERT_EQ(Visible(), PropertyValue(30));
+
+  {
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    auto vertex = acc->FindVertex(gid_, View::OLD);
+    ASSERT_TRUE(vertex->SetProperty(age_, PropertyValue(31.5)).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  storage_->FreeMemory();
+  ASSERT_EQ(Cached(), PropertyValue(31.5));
+  ASSERT_EQ(Visible(), PropertyValue(31.5));
+}
+
+TEST_F(PropertyColumnCacheTest, AbortRestoresValue) {
+  {
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    auto vertex = acc->FindVertex(gid_, View::OLD);
+    ASSERT_TRUE(vertex->SetProperty(age_, PropertyValue(40)).HasValue());
+    acc->Abort();
+  }
+  ASSERT_EQ(Cached(), PropertyValue(30));
+  ASSERT_EQ(Visible(), PropertyValue(30));
+}
+
+TEST_F(PropertyColumnCacheTest, OlderTransactionSeesOldValue) {
+  auto old_acc = storage_->Access(ReplicationRole::MAIN);
+  {
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    auto vertex = acc->FindVertex(gid_, View::OLD);
+    ASSERT_TRUE(vertex->SetProperty(age_, PropertyValue(50)).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  // The columns already hold the new value, but the vertex still has deltas.
+  auto vertex = old_acc->FindVertex(gid_, View::OLD);
+  ASSERT_EQ(*vertex->GetProperty(age_, View::OLD), PropertyValue(30));
+  ASSERT_FALSE(old_acc->Commit().HasError());
+}
+
+TEST_F(PropertyColumnCacheTest, UncachedValues) {
+  {
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    auto vertex = acc->FindVertex(gid_, View::OLD);
+    ASSERT_TRUE(vertex->SetProperty(age_, PropertyValue("thirty")).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  storage_->FreeMemory();
+  ASSERT_EQ(Cached(), std::nullopt);
+  ASSERT_EQ(Visible(), PropertyValue("thirty"));
+
+  {
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    auto vertex = acc->FindVertex(gid_, View::OLD);
+    ASSERT_TRUE(vertex->SetProperty(age_, PropertyValue(33)).HasValue());
+    ASSERT_TRUE(vertex->RemoveLabel(label_).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  storage_->FreeMemory();
+  ASSERT_EQ(Cached(), std::nullopt);
+  ASSERT_EQ(Visible(), PropertyValue(33));
+}
+
+TEST_F(PropertyColumnCacheTest, AnalyticalMode) {
+  static_cast<InMemoryStorage *>(storage_.get())->SetStorageMode(memgraph::storage::StorageMode::IN_MEMORY_ANALYTICAL);
+  {
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    auto vertex = acc->FindVertex(gid_, View::OLD);
+    ASSERT_TRUE(vertex->SetProperty(age_, PropertyValue(60)).HasValue());
+    ASSERT_EQ(*vertex->GetProperty(age_, View::OLD), PropertyValue(60));
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  static_cast<InMemoryStorage *>(storage_.get())->SetStorageMode(memgraph::storage::StorageMode::IN_MEMORY_TRANSACTIONAL);
+  ASSERT_EQ(Cached(), PropertyValue(60));
+  ASSERT_EQ(Visible(), PropertyValue(60));
+}
@@ -28,9 +28,13 @@
 #include "replication/config.hpp"
 #include "replication/state.hpp"
 #include "replication_handler/replication_handler.hpp"
+#include "rpc/client.hpp"
+#include "rpc/server.hpp"
 #include "storage/v2/indices/label_index_stats.hpp"
+#include "storage/v2/replication/rpc.hpp"
 #include "storage/v2/storage.hpp"
 #include "storage/v2/view.hpp"
+#include "utils/on_scope_exit.hpp"
 
 using testing::UnorderedElementsAre;
 
@@ -1122,3 +1126,86 @@ TEST_F(ReplicationTest, AddingInvalidReplica) {
                   })
                   .GetError() == RegisterReplicaError::ERROR_ACCEPTING_MAIN);
 }
+
+namespace {
+// Heartbeat response of replicas which can't read compressed SLK segments.
+struct UncompressedHeartbeatRes {
+  static const memgraph::utils::TypeInfo kType;
+
+  static void Load(UncompressedHeartbeatRes *self, memgraph::slk::Reader *reader) {
+    memgraph::slk::Load(&self->success, reader);
+    memgraph::slk::Load(&self->current_commit_timestamp, reader);
+    memgraph::slk::Load(&self->epoch_id, reader);
+  }
+  static void Save(const UncompressedHeartbeatRes &self, memgraph::slk::Builder *builder) {
+    memgraph::slk::Save(self.success, builder);
+    memgraph::slk::Save(self.current_commit_timestamp, builder);
+    memgraph::slk::Save(self.epoch_id, builder);
+  }
+
+  bool success;
+  uint64_t current_commit_timestamp;
+  std::string epoch_id;
+};
+
+const memgraph::utils::TypeInfo UncompressedHeartbeatRes::kType{memgraph::utils::TypeId::REP_HEARTBEAT_RES,
+                                                                "HeartbeatRes", nullptr};
+
+using UncompressedHeartbeatRpc =
+    memgraph::rpc::RequestResponse<memgraph::storage::replication::HeartbeatReq, UncompressedHeartbeatRes>;
+}  // namespace
+
+TEST(ReplicationCompressionTest, ReplicaWithoutCompression) {
+  memgraph::communication::ServerContext server_context;
+  memgraph::rpc::Server server({"127.0.0.1", 0}, &server_context);
+  auto const on_exit = memgraph::utils::OnScopeExit{[&] {
+    server.Shutdown();
+    server.AwaitShutdown();
+  }};
+  server.Register<memgraph::storage::replication::HeartbeatRpc>([](auto *req_reader, auto *res_builder) {
+    memgraph::storage::replication::HeartbeatReq req;
+    memgraph::slk::Load(&req, req_reader);
+    UncompressedHeartbeatRes::Save({true, req.main_commit_timestamp, req.epoch_id}, res_builder);
+  });
+  ASSERT_TRUE(server.Start());
+
+  memgraph::communication::ClientContext client_context;
+  memgraph::rpc::Client client(server.endpoint(), &client_context);
+  for (uint64_t timestamp = 1; timestamp <= 2; ++timestamp) {
+    auto res = client.Call<memgraph::storage::replication::HeartbeatRpc>(memgraph::utils::UUID{},
+                                                                        memgraph::utils::UUID{}, timestamp, "epoch");
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.current_commit_timestamp, timestamp);
+    ASSERT_EQ(res.epoch_id, "epoch");
+    ASSERT_FALSE(res.compression);
+  }
+}
+
+TEST(ReplicationCompressionTest, MainWithoutCompression) {
+  memgraph::communication::ServerContext server_context;
+  memgraph::rpc::Server server({"127.0.0.1", 0}, &server_context);
+  auto const on_exit = memgraph::utils::OnScopeExit{[&] {
+    server.Shutdown();
+    server.AwaitShutdown();
+  }};
+  server.Register<memgraph::storage::replication::HeartbeatRpc>([](auto *req_reader, auto *res_builder) {
+    memgraph::storage::replication::HeartbeatReq req;
+    memgraph::slk::Load(&req, req_reader);
+    memgraph::storage::replication::HeartbeatRes res{true, req.main_commit_timestamp, req.epoch_id};
+    ASSERT_TRUE(res.compression);
+    memgraph::slk::Save(res, res_builder);
+  });
+  ASSERT_TRUE(server.Start());
+
+  // MAIN doesn't know the field which tells that the replica can read
+  // compressed data, and neither the response nor the next one is broken by it.
+  memgraph::communication::ClientContext client_context;
+  memgraph::rpc::Client client(server.endpoint(), &client_context);
+  for (uint64_t timestamp = 1; timestamp <= 2; ++timestamp) {
+    auto res = client.Call<UncompressedHeartbeatRpc>(memgraph::utils::UUID{}, memgraph::utils::UUID{}, timestamp,
+                                                     "epoch");
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.current_commit_timestamp, timestamp);
+    ASSERT_EQ(res.epoch_id, "epoch");
+  }
+}
@@ -0,0 +1,121 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/inmemory/vertex_directory.hpp"
+
+using memgraph::replication_coordination_glue::ReplicationRole;
+using memgraph::storage::Gid;
+using memgraph::storage::InMemoryStorage;
+using memgraph::storage::Vertex;
+using memgraph::storage::VertexDirectory;
+using memgraph::storage::View;
+
+TEST(VertexDirectory, Disabled) {
+  VertexDirectory directory;
+  Vertex vertex{Gid::FromUint(1), nullptr};
+  directory.Insert(&vertex);
+  ASSERT_FALSE(directory.Enabled());
+  ASSERT_FALSE(directory.Find(Gid::FromUint(1)).has_value());
+}
+
+TEST(VertexDirectory, InsertFindRemove) {
+  VertexDirectory directory;
+  directory.Enable();
+  ASSERT_TRUE(directory.Enabled());
+
+  // The second vertex is in another chunk.
+  Vertex first{Gid::FromUint(3), nullptr};
+  Vertex second{Gid::FromUint(VertexDirectory::kChunkSize + 3), nullptr};
+  directory.Insert(&first);
+  directory.Insert(&second);
+  ASSERT_EQ(directory.Find(first.gid).value(), &first);
+  ASSERT_EQ(directory.Find(second.gid).value(), &second);
+  ASSERT_EQ(directory.Find(Gid::FromUint(4)).value(), nullptr);
+  // The chunk of the gid doesn't exist.
+  ASSERT_EQ(directory.Find(Gid::FromUint(5 * VertexDirectory::kChunkSize)).value(), nullptr);
+
+  directory.Remove(first.gid);
+  ASSERT_EQ(directory.Find(first.gid).value(), nullptr);
+  ASSERT_EQ(directory.Find(second.gid).value(), &second);
+
+  directory.Clear();
+  ASSERT_EQ(directory.Find(second.gid).value(), nullptr);
+}
+
+TEST(VertexDirectory, GidOutsideOfTable) {
+  VertexDirectory directory;
+  directory.Enable();
+  Vertex vertex{Gid::FromUint(VertexDirectory::kChunkSize * VertexDirectory::kMaxChunks), nullptr};
+  directory.Insert(&vertex);
+  directory.Remove(vertex.gid);
+  ASSERT_FALSE(directory.Find(vertex.gid).has_value());
+}
+
+class VertexDirectoryStorageTest : public testing::Test {
+ protected:
+  std::unique_ptr<memgraph::storage::Storage> storage_{new InMemoryStorage(memgraph::storage::Config{
+      .gc = {.type = memgraph::storage::Config::Gc::Type::NONE},
+      .vertex_directory = {.enabled = true},
+  })};
+};
+
+TEST_F(VertexDirectoryStorageTest, FindVertex) {
+  std::vector<Gid> gids;
+  {
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    for (int i = 0; i < 10; ++i) gids.push_back(acc->CreateVertex().Gid());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    for (const auto gid : gids) {
+      auto vertex = acc->FindVertex(gid, View::OLD);
+      ASSERT_TRUE(vertex);
+      ASSERT_EQ(vertex->Gid(), gid);
+    }
+    ASSERT_FALSE(acc->FindVertex(Gid::FromUint(gids.back().AsUint() + 1), View::OLD));
+  }
+}
+
+TEST_F(VertexDirectoryStorageTest, DeletedAndAbortedVertices) {
+  Gid deleted;
+  Gid kept;
+  {
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    deleted = acc->CreateVertex().Gid();
+    kept = acc->CreateVertex().Gid();
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    auto vertex = acc->FindVertex(deleted, View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_TRUE(acc->DeleteVertex(&*vertex).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  Gid aborted;
+  {
+    auto acc = storage_->Access(ReplicationRole::MAIN);
+    aborted = acc->CreateVertex().Gid();
+    acc->Abort();
+  }
+  storage_->FreeMemory();
+
+  auto acc = storage_->Access(ReplicationRole::MAIN);
+  ASSERT_FALSE(acc->FindVertex(deleted, View::OLD));
+  ASSERT_FALSE(acc->FindVertex(aborted, View::OLD));
+  ASSERT_TRUE(acc->FindVertex(kept, View::OLD));
+}
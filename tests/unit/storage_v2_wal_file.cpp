@@ -41,6 +41,10 @@ memgraph::storage::durability::WalDeltaData::Type StorageMetadataOperationToWalD
       return memgraph::storage::durability::WalDeltaData::Type::EDGE_INDEX_CREATE;
     case memgraph::storage::durability::StorageMetadataOperation::EDGE_TYPE_INDEX_DROP:
       return memgraph::storage::durability::WalDeltaData::Type::EDGE_INDEX_DROP;
+    case memgraph::storage::durability::StorageMetadataOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+      return memgraph::storage::durability::WalDeltaData::Type::EDGE_PROPERTY_INDEX_CREATE;
+    case memgraph::storage::durability::StorageMetadataOperation::EDGE_TYPE_PROPERTY_INDEX_DROP:
+      return memgraph::storage::durability::WalDeltaData::Type::EDGE_PROPERTY_INDEX_DROP;
     case memgraph::storage::durability::StorageMetadataOperation::LABEL_INDEX_STATS_SET:
       return memgraph::storage::durability::WalDeltaData::Type::LABEL_INDEX_STATS_SET;
     case memgraph::storage::durability::StorageMetadataOperation::LABEL_INDEX_STATS_CLEAR:
@@ -49,6 +53,10 @@ memgraph::storage::durability::WalDeltaData::Type StorageMetadataOperationToWalD
       return memgraph::storage::durability::WalDeltaData::Type::LABEL_PROPERTY_INDEX_CREATE;
     case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_INDEX_DROP:
       return memgraph::storage::durability::WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP;
+    case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+      return memgraph::storage::durability::WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE;
+    case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+      return memgraph::storage::durability::WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP;
     case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_INDEX_STATS_SET:
       return memgraph::storage::durability::WalDeltaData::Type::LABEL_PROPERTY_INDEX_STATS_SET;
     case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_INDEX_STATS_CLEAR:
@@ -293,6 +301,10 @@ class DeltaGenerator final {
           break;
         case memgraph::storage::durability::StorageMetadataOperation::EDGE_TYPE_INDEX_CREATE:
         case memgraph::storage::durability::StorageMetadataOperation::EDGE_TYPE_INDEX_DROP:
+        case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+        case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+        case memgraph::storage::durability::StorageMetadataOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+        case memgraph::storage::durability::StorageMetadataOperation::EDGE_TYPE_PROPERTY_INDEX_DROP:
           MG_ASSERT(false, "Invalid function call!");
       }
       data_.emplace_back(timestamp_, data);
@@ -326,6 +338,10 @@ class DeltaGenerator final {
         case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_INDEX_STATS_SET:
         case memgraph::storage::durability::StorageMetadataOperation::UNIQUE_CONSTRAINT_CREATE:
         case memgraph::storage::durability::StorageMetadataOperation::UNIQUE_CONSTRAINT_DROP:
+        case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+        case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+        case memgraph::storage::durability::StorageMetadataOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+        case memgraph::storage::durability::StorageMetadataOperation::EDGE_TYPE_PROPERTY_INDEX_DROP:
           MG_ASSERT(false, "Invalid function call!");
       }
       data_.emplace_back(timestamp_, data);
@@ -0,0 +1,114 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "storage/v2/durability/wal_group_commit.hpp"
+#include "utils/file.hpp"
+
+using memgraph::storage::durability::WalGroupCommit;
+
+class WalGroupCommitTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::filesystem::remove(path_);
+    file_.Open(path_, memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+  }
+
+  void TearDown() override {
+    file_.Close();
+    std::filesystem::remove(path_);
+  }
+
+  /// Simulates a committing transaction: the "WAL records" are written while
+  /// holding the lock that orders the WAL and then the transaction waits.
+  void Commit(WalGroupCommit &group_commit) {
+    uint64_t ticket = 0;
+    {
+      auto guard = std::lock_guard{wal_lock_};
+      file_.Write("transaction");
+      ticket = group_commit.Enqueue();
+    }
+    group_commit.WaitDurable(ticket);
+  }
+
+  WalGroupCommit::SyncRequest Prepare(WalGroupCommit &group_commit) {
+    auto guard = std::lock_guard{wal_lock_};
+    ++syncs_;
+    synced_size_ = file_.GetSize();
+    return {.ticket = group_commit.LastTicket(), .fd = file_.FlushAndDuplicateDescriptor()};
+  }
+
+  std::filesystem::path path_{std::filesystem::temp_directory_path() / "MG_test_unit_storage_v2_wal_group_commit"};
+  memgraph::utils::OutputFile file_;
+  std::mutex wal_lock_;
+  std::atomic<uint64_t> syncs_{0};
+  std::atomic<uint64_t> synced_size_{0};
+};
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(WalGroupCommitTest, SingleTransaction) {
+  std::optional<WalGroupCommit> group_commit;
+  group_commit.emplace([&] { return Prepare(*group_commit); });
+
+  Commit(*group_commit);
+  ASSERT_EQ(syncs_, 1);
+  ASSERT_EQ(synced_size_, std::string_view{"transaction"}.size());
+
+  // Already durable tickets don't wait for another sync.
+  group_commit->WaitDurable(1);
+  ASSERT_EQ(syncs_, 1);
+
+  Commit(*group_commit);
+  ASSERT_EQ(syncs_, 2);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(WalGroupCommitTest, ConcurrentTransactions) {
+  constexpr auto kThreads = 8;
+  constexpr auto kTransactionsPerThread = 200;
+
+  std::optional<WalGroupCommit> group_commit;
+  group_commit.emplace([&] { return Prepare(*group_commit); });
+
+  std::vector<std::jthread> threads;
+  threads.reserve(kThreads);
+  for (int i = 0; i < kThreads; ++i) {
+    threads.emplace_back([&] {
+      for (int j = 0; j < kTransactionsPerThread; ++j) Commit(*group_commit);
+    });
+  }
+  threads.clear();
+
+  ASSERT_EQ(group_commit->LastTicket(), kThreads * kTransactionsPerThread);
+  ASSERT_LE(syncs_, kThreads * kTransactionsPerThread);
+  ASSERT_EQ(synced_size_, kThreads * kTransactionsPerThread * std::string_view{"transaction"}.size());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(WalGroupCommitTest, FinalizedWalFile) {
+  // When the WAL file was finalized in the meantime, nothing is left to sync.
+  std::optional<WalGroupCommit> group_commit;
+  group_commit.emplace([&] {
+    ++syncs_;
+    return WalGroupCommit::SyncRequest{.ticket = group_commit->LastTicket(), .fd = -1};
+  });
+  const auto ticket = group_commit->Enqueue();
+  group_commit->WaitDurable(ticket);
+  ASSERT_EQ(syncs_, 1);
+}
@@ -11,9 +11,12 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <stdexcept>
 #include <thread>
+#include <vector>
 
 #include <utils/thread_pool.hpp>
 
@@ -38,3 +41,123 @@ TEST(ThreadPool, Basic) {
     ASSERT_EQ(count.load(), adder_count);
   }
 }
+
+TEST(ThreadPool, SingleWorkerKeepsSubmissionOrder) {
+  memgraph::utils::ThreadPool pool{1};
+  std::vector<int> order;
+  for (int i = 0; i < 1000; ++i) {
+    pool.AddTask([&order, i] { order.push_back(i); });
+  }
+  while (pool.UnfinishedTasksNum() != 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_EQ(order.size(), 1000);
+  ASSERT_TRUE(std::is_sorted(order.begin(), order.end()));
+}
+
+TEST(ThreadPool, SingleWorkerKeepsOrderOfNestedSubmissions) {
+  memgraph::utils::ThreadPool pool{1};
+  std::atomic<bool> release{false};
+  pool.AddTask([&] {
+    while (!release.load()) std::this_thread::sleep_for(1ms);
+  });
+
+  std::vector<int> order;
+  // Every task submits a task which has to run after the already queued ones.
+  for (int i = 0; i < 100; ++i) {
+    pool.AddTask([&pool, &order, i] {
+      order.push_back(i);
+      pool.AddTask([&order, i] { order.push_back(100 + i); });
+    });
+  }
+  release.store(true);
+  while (pool.UnfinishedTasksNum() != 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_EQ(order.size(), 200);
+  ASSERT_TRUE(std::is_sorted(order.begin(), order.end()));
+}
+
+TEST(ThreadPool, HighPriorityTasksFirst) {
+  memgraph::utils::ThreadPool pool{1};
+  std::atomic<bool> release{false};
+  pool.AddTask([&] {
+    while (!release.load()) std::this_thread::sleep_for(1ms);
+  });
+
+  std::vector<memgraph::utils::TaskPriority> order;
+  for (int i = 0; i < 10; ++i) {
+    pool.AddTask([&] { order.push_back(memgraph::utils::TaskPriority::NORMAL); });
+    pool.AddTask([&] { order.push_back(memgraph::utils::TaskPriority::HIGH); }, memgraph::utils::TaskPriority::HIGH);
+  }
+  release.store(true);
+  while (pool.UnfinishedTasksNum() != 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_EQ(order.size(), 20);
+  ASSERT_TRUE(std::all_of(order.begin(), order.begin() + 10,
+                          [](auto priority) { return priority == memgraph::utils::TaskPriority::HIGH; }));
+}
+
+TEST(ThreadPool, PinnedWorkers) {
+  memgraph::utils::ThreadPool pool{2, true};
+  std::atomic<int> count{0};
+  for (int i = 0; i < 100; ++i) {
+    pool.AddTask([&] { count.fetch_add(1); });
+  }
+  while (pool.UnfinishedTasksNum() != 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_EQ(count.load(), 100);
+}
+
+TEST(TaskGroup, ForkJoin) {
+  memgraph::utils::ThreadPool pool{4};
+  std::atomic<uint64_t> sum{0};
+  memgraph::utils::TaskGroup group(pool);
+  for (uint64_t i = 1; i <= 100; ++i) {
+    group.Run([&, i] {
+      // Nested groups are waited for from the pool threads.
+      memgraph::utils::TaskGroup nested(pool);
+      for (uint64_t j = 0; j < i; ++j) {
+        nested.Run([&] { sum.fetch_add(1); });
+      }
+      nested.Wait();
+    });
+  }
+  group.Wait();
+  ASSERT_EQ(sum.load(), 5050);
+}
+
+TEST(TaskGroup, BusyPool) {
+  memgraph::utils::ThreadPool pool{1};
+  std::atomic<bool> release{false};
+  pool.AddTask([&] {
+    while (!release.load()) std::this_thread::sleep_for(1ms);
+  });
+
+  // The only worker is busy, so the tasks are run by the waiting thread.
+  std::atomic<int> count{0};
+  memgraph::utils::TaskGroup group(pool);
+  for (int i = 0; i < 10; ++i) {
+    group.Run([&] { count.fetch_add(1); });
+  }
+  group.Wait();
+  ASSERT_EQ(count.load(), 10);
+  release.store(true);
+}
+
+TEST(TaskGroup, RethrowsError) {
+  memgraph::utils::ThreadPool pool{2};
+  std::atomic<int> count{0};
+  memgraph::utils::TaskGroup group(pool);
+  for (int i = 0; i < 10; ++i) {
+    group.Run([&, i] {
+      count.fetch_add(1);
+      if (i == 5) throw std::runtime_error("task failed");
+    });
+  }
+  ASSERT_THROW(group.Wait(), std::runtime_error);
+  ASSERT_EQ(count.load(), 10);
+  ASSERT_NO_THROW(group.Wait());
+}